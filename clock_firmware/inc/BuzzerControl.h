@@ -1,44 +1,44 @@
-/*
- * Copyright (c) 2018, 2019, Adrian Chemicz
- * All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *    1. Redistributions of source code must retain the above copyright
- *       notice, this list of conditions and the following disclaimer.
- *    2. Redistributions in binary form must reproduce the above copyright
- *       notice, this list of conditions and the following disclaimer in the
- *       documentation and/or other materials provided with the distribution.
- *    3. Neither the name of contributors may be used to endorse or promote products
- *       derived from this software without specific prior written permission.
-
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
- * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
- * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
- * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
- * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-
-#ifndef _BUZZER_CONTROL_H_
-#define _BUZZER_CONTROL_H_
-
-#include <stdint.h>
-
-/*
- * This module configure PWM used to control piezo buzzer. PWM use pin nTRST/PIO0_14/ADC_6/CT32B1_MAT1/U1_TXD
- * and timer CT32B1. PWM pin is configured in Buzzer_Init() function so separate GPIO configuration isn't
- * necessary.
- */
-
-void Buzzer_Init(void);
-void Buzzer_TurnOn(void);
-void Buzzer_TurnOff(void);
-void Buzzer_SetBuzzerPwmCounterRegister(uint16_t value);
-void Buzzer_SetOctave(uint8_t octaveNumber);
-
-#endif /* _BUZZER_CONTROL_H_ */
+/*
+ * Copyright (c) 2018, 2019, Adrian Chemicz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _BUZZER_CONTROL_H_
+#define _BUZZER_CONTROL_H_
+
+#include <stdint.h>
+
+/*
+ * This module configure PWM used to control piezo buzzer. PWM use pin nTRST/PIO0_14/ADC_6/CT32B1_MAT1/U1_TXD
+ * and timer CT32B1. PWM pin is configured in Buzzer_Init() function so separate GPIO configuration isn't
+ * necessary.
+ */
+
+void Buzzer_Init(void);
+void Buzzer_TurnOn(void);
+void Buzzer_TurnOff(void);
+void Buzzer_SetBuzzerPwmCounterRegister(uint16_t value);
+void Buzzer_SetOctave(uint8_t octaveNumber);
+
+#endif /* _BUZZER_CONTROL_H_ */
@@ -0,0 +1,66 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _COBS_FRAMING_H_
+#define _COBS_FRAMING_H_
+
+/*
+ * This module divide stream of bytes from serial link into messages by COBS(Consistent
+ * Overhead Byte Stuffing). Coded message don't contain byte 0x00 so this byte is used as
+ * delimiter placed after each message. Message is divided into blocks ended by 0x00(last
+ * block is ended by end of message), each block is replaced by code byte equal number of
+ * bytes of block plus one and bytes of block without 0x00. Block longer than 254 bytes is
+ * divided and code byte 0xFF mean block without 0x00 at end:
+ *	11 22 00 33 -> 03 11 22 02 33 00
+ *	00 -> 01 01 00
+ * Overhead of coding is one byte per each 254 bytes of message plus delimiter. After lost
+ * of data receiver is synchronized again on next delimiter. Received stream is decoded byte
+ * after byte so decoded message can be stored directly in receive buffer. Delimiters
+ * between messages are ignored so sender can place delimiter also before message.
+ * Module don't use any hardware so the same file can be used by host application which
+ * communicate with clock via serial link.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define COBS_FRAMING_DELIMITER		0x00
+#define COBS_FRAMING_MAX_BLOCK_CODE	0xFF //code of block with 254 bytes without 0x00 at end
+//max size of coded message with delimiter
+#define COBS_FRAMING_MAX_ENCODED_SIZE(size)	((size) + ((size) / 254) + 2)
+
+typedef enum COBS_DECODE_RESULT
+{
+	COBS_DECODE_NO_DATA = 	0,//byte was code byte or delimiter between messages
+	COBS_DECODE_DATA,//decoded byte is available
+	COBS_DECODE_FRAME_END,//delimiter after correct message
+	COBS_DECODE_FRAME_ERROR,//delimiter inside block, data of message must be dropped
+}COBS_DECODE_RESULT;
+
+typedef struct
+{
+	uint8_t blockRemaining;//bytes of current block which wasn't received yet
+	bool zeroPending;//0x00 is decoded before next block
+	bool frameStarted;//at least one byte of message was received after delimiter
+}CobsDecoder;
+
+uint16_t CobsFraming_Encode(const uint8_t *data, uint16_t size, uint8_t *buffer, uint16_t bufferSize);
+void CobsFraming_InitDecoder(CobsDecoder *decoder);
+COBS_DECODE_RESULT CobsFraming_DecodeByte(CobsDecoder *decoder, uint8_t codedByte, uint8_t *decodedByte);
+
+#endif /* _COBS_FRAMING_H_ */
@@ -1,364 +1,568 @@
-/*
- * Copyright (c) 2018, 2019, Adrian Chemicz
- * All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *    1. Redistributions of source code must retain the above copyright
- *       notice, this list of conditions and the following disclaimer.
- *    2. Redistributions in binary form must reproduce the above copyright
- *       notice, this list of conditions and the following disclaimer in the
- *       documentation and/or other materials provided with the distribution.
- *    3. Neither the name of contributors may be used to endorse or promote products
- *       derived from this software without specific prior written permission.
-
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
- * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
- * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
- * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
- * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-
-#ifndef _ESP_LAYER_H_
-#define _ESP_LAYER_H_
-
-/*
- * This module handle ESP8266 module connected to microcontroller via UART.
- * API provide by module allow user to:
- * - Connect to APN
- * - Check APN connection status
- * - Create TCP server
- * - Receive and send data to devices connected to TCP server
- * - Monitor link status and gather additional data about connection to TCP server
- * - Check presence of ESP8266 module
- * All function provided by this module work without blocking. Communication
- * with ESP8266 is performed on UART via AT command. Typical schematic of send
- * AT command to ESP8266 via povided API was depicted on below steps:
- *  1.Call function which copy AT command to Tx que if device will not be busy.
- *  If device will be Busy during start execution of function then false will be returned.
- *  2.Call function ESP_Process to copy data from Tx que to UART buffer. This
- * function  must be call cyclically to receive resoponse, process event from
- * module about open links, close links and receive data from module.
- *  3.When function ESP_Process will detect that response was received then
- * deviceStatus will change to RESPONSE_RECEIVED. Status of response can be checked
- * via function ESP_GetRequestState.
- *	4.If deviceStatus is equal RESPONSE_RECEIVED then should be call function which
- * will process response. In this API exist many type of process response functions
- * so called function must be appropriate for request. Description about function which
- * should be use was added to request function description part above function in c file.
- * Many request don't require special process response function because answear is
- * simple(OK\r\n). In this case to those type of function we can use
- * ESP_ProcessGaneralFormatResponse.
- * ESP8266 module not only wait for AT request and send AT response but also send
- * information on event. Those information are open link(example data - 0,CONNECT\r\n ),
- * close link(example data - 0,CLOSED\r\n ) and receive data(example data -
- * \r\n+IPD,0,10:payloadPay ).
- * In communication with ESP8266 module character '\r' mean <CR> or in hex is equal 0x0D,
- * character '\n' mean <LF> or in hex is equal 0x0A.
- * ESP layer provide global structures ApnStructure and RxMessageTable. ApnStructure
- * contain information about available access points and is filled when ESP_SendApnListRequest
- * function will be call and correct response will be processed by ESP_ProcessApnListResponse.
- * RxMessageTable contain information that message received, payload of received message
- * and information about number of link which send message.
- * Known issues:
- * 	-only TCP server is supported
- * 	-necessary change in few places socketNumber to link ID
- *
- * Simple example how to use API:
-static void ClockSleep2(uint32_t time)
-{
-	for (volatile uint32_t count = 0; count < (uint32_t)(time<<10);){count++;}
-}
-
-int main(void)
-{
-	ESP_Init(0, 115200, 10000, 3, 0);
-	UART_DisableInterrupts(ESP_GetUartPortNumber());
-
-	ClockSleep2(1000);
-
-	ESP_ClearRxBuffer();
-
-	ESP_SendResetRequest();
-
-	for(;ESP_GetRequestState() == BUSY;)
-	{
-		ESP_Process();
-		ClockSleep2(1);
-	}
-
-	if(ESP_ProcessGaneralFormatResponse() == true)
-	{
-		ClockSleep(1000);
-		ESP_ClearRxBuffer();
-
-		ESP_SendDetectDeviceRequest();
-
-		for(;ESP_GetRequestState() == BUSY;)
-		{
-			ESP_Process();
-			ClockSleep2(1);
-		}
-
-		//device was reseted and detected
-		if(ESP_ProcessGaneralFormatResponse() == true)
-		{
-			ESP_SendWifiModeRequest(AT_STATION_MODE);
-
-			for(;ESP_GetRequestState() == BUSY;)
-			{
-				ESP_Process();
-				ClockSleep2(1);
-			}
-
-			//device was configured correctly to work in station mode
-			if(ESP_ProcessGaneralFormatResponse() == false)
-			{
-				goto endApplication;
-			}
-
-			ESP_SendConnectToApnRequest("ZTE-cb82da", "44f436cb19");
-
-			for(;ESP_GetRequestState() == BUSY;)
-			{
-				ESP_Process();
-				ClockSleep2(2);
-			}
-
-			//device was connected to APN correctly
-			if(ESP_ProcessGaneralFormatResponse() == false)
-			{
-				goto endApplication;
-			}
-
-			ESP_SendAcceptMultipleConnectionRequest();
-
-			for(;ESP_GetRequestState() == BUSY;)
-			{
-				ESP_Process();
-				ClockSleep2(1);
-			}
-
-			if(ESP_ProcessGaneralFormatResponse() == false)
-			{
-				goto endApplication;
-			}
-
-			ESP_SendServerCommandRequest(true, 3000);
-
-			for(;ESP_GetRequestState() == BUSY;)
-			{
-				ESP_Process();
-				ClockSleep2(1);
-			}
-
-			//ESP was configured to work in expected mode and TCP server run
-			if(ESP_ProcessGaneralFormatResponse() == true)
-			{
-				bool linkStatus = true;
-				uint8_t executedAtRequest;
-				uint8_t socketId;
-
-				for(uint32_t timer = 1; ; timer++)
-				{
-					if(ESP_GetRequestState() == READY)
-					{
-						if(timer%12000 == 0)
-						{
-							ESP_GetConnectionStatus();
-							executedAtRequest = 0;
-						}
-						else
-						{
-							//search rx data
-							for(uint8_t i = 0; i < MAX_NUMBER_OF_RX_BUFFER; i++)
-							{
-								if(RxMessageTable[i].lockFlag)
-								{
-									ESP_SendWriteDataRequest(RxMessageTable[i].socketId, sizeof("TestMessage"));
-									socketId = i;
-									executedAtRequest = 1;
-								}
-							}
-						}
-					}// if(ESP_GetRequestState() == READY)
-
-					ESP_Process();
-					ClockSleep2(2);
-
-					if(ESP_GetRequestState() == RESPONSE_RECEIVED)
-					{
-						switch(executedAtRequest)
-						{
-						case 0:
-							ESP_ProcessConnectionStatus(&linkStatus);
-							break;
-						case 1:
-							if(ESP_ProcessGaneralFormatResponse())
-							{
-								ESP_Write("TestMessage", sizeof("TestMessage"));
-								executedAtRequest = 2;
-							}
-							else
-							{
-								RxMessageTable[socketId].lockFlag = false;
-							}
-							break;
-						case 2:
-							//send message succesfull
-							if(ESP_ProcessGaneralFormatResponse())
-							{
-								RxMessageTable[socketId].lockFlag = false;
-							}
-							else//send message fail
-							{
-								RxMessageTable[socketId].lockFlag = false;
-							}
-							break;
-						}// switch(executedAtRequest)
-					}// if(ESP_GetRequestState() == RESPONSE_RECEIVED)
-				}// for(uint32_t timer = 1; ; timer++)
-			}
-		}
-	}
-endApplication:
-	for(;;){}
-
- */
-
-#include <stdbool.h>
-#include <stdint.h>
-
-#define MAX_NUMBER_OF_APN 								10U
-#define MAX_NUMBER_OF_SOCKET 							5U
-#define INVALID_SOCKET_ID								0xFFU
-#define MAX_SIZE_OF_SOCKET_BUFFER 						200U
-#define MAX_NUMBER_OF_RX_BUFFER 						5U
-#define CONNECT_HEADER_LENGTH 							11U
-#define CLOSED_HEADER_LENGTH 							10U
-#define TX_RX_BUFFER_SIZE 								400U
-#define MINIMAL_CHECKED_RX_SIZE							3U
-#define AT_REQ_TIMEOUT_DISABLE 							0U
-#define RX_TIMEOUT_DISABLE								0U
-#define SSID_STRING_LENGTH 								33U
-#define IP_ADDRESS_BYTE_LENGTH 							4U
-#define STATUS_STATION_CREATED_TCP_OR_UDP_TRANSMISSION	3U
-#define STATUS_STATION_NOT_CONNECTED_TO_APN 			5U
-#define TCP_CONNECTION_TYPE								6U
-#define UDP_CONNECTION_TYPE								17U
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-	typedef enum DEVICE_STATUS
-	{
-		READY = 			0,
-		BUSY,
-		RESPONSE_RECEIVED,
-	}DEVICE_STATUS;
-
-	typedef enum ESP_DEVICE_MODE
-	{
-		AT_STATION_MODE		 	= 1U,
-		AT_SOFT_AP_MODE			= 2U,
-		AT_SOFT_AP_STATION_MODE	= 3U,
-	}ESP_DEVICE_MODE;
-
-	typedef struct{
-		uint32_t UART_OVERRUN : 	1;
-		uint32_t UART_FRAME_ERROR : 1;
-		uint32_t AT_RETURN_ERROR : 	1;
-		uint32_t AT_TIMEOUT : 		1;
-		uint32_t AT_OVERRUN : 		1;
-	}ERROR_CODE;
-
-	typedef struct{
-		bool socketIsOpen; /* this flag is refresh when event from ESP will receive and when
-		user call ESP_GetConnectionStatus function */
-		bool additionalSocketDataIsAvailable;/* this flag inform that below data is available.
-		To gather below data is necessary call ESP_GetConnectionStatus function */
-		uint8_t connectionType;
-		uint8_t remoteIpAddress[IP_ADDRESS_BYTE_LENGTH];
-		uint16_t remotePort;
-		uint16_t localPort;
-		bool tcpConnectionRunAsServer;
-	}SocketState;
-
-	typedef struct{
-		bool lockFlag;
-		uint8_t socketId;
-		uint16_t payloadSize;
-		uint8_t payload[MAX_SIZE_OF_SOCKET_BUFFER] __attribute__((aligned(32)));
-	}SocketMessage;
-
-	typedef struct{
-		uint8_t securityLevel;
-		int8_t signalPower;
-		char ssid[SSID_STRING_LENGTH];//max length plus one
-		char bssid[18];
-	}ApnInformation;
-
-	typedef struct{
-		ApnInformation AppInformationTable[MAX_NUMBER_OF_APN];
-		uint8_t NumberOfApn;
-	}ApnStructureType;
-
-	typedef struct{
-		DEVICE_STATUS deviceStatus;
-		ERROR_CODE errorCode;
-		uint8_t txBuffer[TX_RX_BUFFER_SIZE];
-		uint16_t txSize;
-		uint16_t txProgress;
-		uint8_t rxBuffer[TX_RX_BUFFER_SIZE];
-		uint16_t rxSize;
-		uint8_t uartPortNumber;
-		//variables used to detect request timeout cause by missing response or lose data
-		uint32_t timeoutRequestTreshold;
-		uint32_t timeoutRequestCounter;
-		//variables used to lock ESP if device will be during receive data
-		bool rxDeviceLock;
-		uint16_t rxLockCounter;
-		uint16_t rxLockTreshold;
-		//variables used to clear RX buffer of ESP layer if AT request isn't processed longer time
-		uint16_t rxClearCounter;
-		uint16_t rxClearThreshold;
-		uint16_t lastRxSizeStatus;
-	}ESP_Status;
-
-	extern ApnStructureType ApnStructure;
-	extern SocketMessage RxMessageTable[MAX_NUMBER_OF_RX_BUFFER];
-
-	void ESP_Init(uint8_t portNum, uint32_t baudrate, uint32_t timeoutRequestTreshold, uint16_t rxLockTreshold, uint16_t rxClearThreshold);
-	SocketState ESP_ReturnLinkInformation(uint8_t linkId);
-	void ESP_Process(void);
-	DEVICE_STATUS ESP_GetRequestState(void);
-	bool ESP_SendDetectDeviceRequest(void);
-	bool ESP_SendResetRequest(void);
-	bool ESP_ProcessGaneralFormatResponse(void);
-	bool ESP_SendConnectToApnRequest(const char* ssidName, const char* password);
-	bool ESP_SendWifiModeRequest(uint8_t wifiMode);
-	bool ESP_SendDisconnectRequest(void);
-	bool ESP_SendApnListRequest(void);
-	bool ESP_ProcessApnListResponse(void);
-	bool ESP_GetAssignedIpAddress(void);
-	bool ESP_ProcessGetAssignedIpResponse(uint8_t *pointerToIpAdressTable);
-	bool ESP_GetConnectionStatus(void);
-	bool ESP_ProcessConnectionStatus(bool *flagPointer);
-	bool ESP_SendAcceptMultipleConnectionRequest(void);
-	bool ESP_SendServerCommandRequest(bool serverStatus, uint16_t portNumber);
-	bool ESP_SendWriteDataRequest(uint8_t socketNumber, uint16_t writeBufferSizeOf);
-	bool ESP_Write(uint8_t* bufferPointer, uint16_t bufferSizeOf);
-	void ESP_ClearRxBuffer(void);
-	uint8_t ESP_GetUartPortNumber(void);
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* _ESP_LAYER_H_ */
+/*
+ * Copyright (c) 2018, 2019, Adrian Chemicz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _ESP_LAYER_H_
+#define _ESP_LAYER_H_
+
+/*
+ * This module handle ESP8266 module connected to microcontroller via UART.
+ * API provide by module allow user to:
+ * - Connect to APN
+ * - Check APN connection status
+ * - Create TCP server
+ * - Receive and send data to devices connected to TCP server
+ * - Send data to remote device by UDP link
+ * - Monitor link status and gather additional data about connection to TCP server
+ * - Check presence of ESP8266 module
+ * All function provided by this module work without blocking. Communication
+ * with ESP8266 is performed on UART via AT command. Typical schematic of send
+ * AT command to ESP8266 via povided API was depicted on below steps:
+ *  1.Call function which copy AT command to Tx que if device will not be busy.
+ *  If device will be Busy during start execution of function then false will be returned.
+ *  2.Call function ESP_Process to copy data from Tx que to UART buffer. This
+ * function  must be call cyclically to receive resoponse, process event from
+ * module about open links, close links and receive data from module.
+ *  3.When function ESP_Process will detect that response was received then
+ * deviceStatus will change to RESPONSE_RECEIVED. Status of response can be checked
+ * via function ESP_GetRequestState.
+ *	4.If deviceStatus is equal RESPONSE_RECEIVED then should be call function which
+ * will process response. In this API exist many type of process response functions
+ * so called function must be appropriate for request. Description about function which
+ * should be use was added to request function description part above function in c file.
+ * Many request don't require special process response function because answear is
+ * simple(OK\r\n). In this case to those type of function we can use
+ * ESP_ProcessGaneralFormatResponse.
+ * Instead of above steps commands can be added to command queue by ESP_QueueCommand or
+ * ESP_QueueCommandSequence. Each command(ESP_Command) contain request function, response
+ * function, timeout, number of retries and callback. ESP_Process send next command from
+ * queue as soon as previous command will be finished, so list of commands like connect
+ * to APN and get IP address is performed without gaps between commands.
+ * For session with single client ESP8266 can be switched to passthrough(transparent
+ * transmission) mode. In this mode ESP8266 work as TCP client(AT+CIPMUX=0, AT+CIPMODE=1,
+ * AT+CIPSTART, AT+CIPSEND) and data is send and received as raw stream without AT+CIPSEND
+ * handshake and +IPD headers. Data is send by ESP_PassthroughWrite. ESP_StopPassthrough
+ * send "+++" escape sequence and return module to command mode.
+ * Received data of each socket is treat as stream and is divided into messages by length
+ * field from message header(ESP_FRAME_HEADER_SIZE and ESP_FRAME_LENGTH_FIELD_BEGIN match
+ * SOME/IP header). One +IPD payload can contain few messages and one message can be
+ * divided into few +IPD payloads. Each message is stored in separate SocketBufferTable buffer
+ * and ESP_GetReceivedMessage return messages in order of receive. Too long messages are
+ * dropped. Header of message dropped because all buffers were used is stored in small queue
+ * and can be read by ESP_GetDroppedMessage so user can answer it by error. If length field is malformed then data of socket is dropped until begin of next
+ * +IPD payload(or until ESP_FRAME_TIMEOUT calls without data in passthrough mode).
+ * Instead of ESP8266 module UART can be connected directly to other device(for example by
+ * USB-UART converter). ESP_StartSerialLink switch layer to serial link mode where AT
+ * requests aren't send and received stream is divided into messages by COBS delimiters
+ * (CobsFraming module). Each decoded message is stored in SocketBufferTable with socketId
+ * ESP_SERIAL_LINK_SOCKET_ID like messages received from socket. Message is coded and send
+ * by ESP_SerialLinkWrite. COBS don't detect damaged bytes so user must check content of
+ * message(SOME/IP messages contain CRC of extension). Partial message is dropped after
+ * ESP_FRAME_TIMEOUT calls without data.
+ * ESP8266 module not only wait for AT request and send AT response but also send
+ * information on event. Those information are open link(example data - 0,CONNECT\r\n ),
+ * close link(example data - 0,CLOSED\r\n ) and receive data(example data -
+ * \r\n+IPD,0,10:payloadPay ).
+ * Data received from UART is stored in RX ring by UART interrupt and parsed byte after
+ * byte by ESP_Process. Size of RX ring and ESP_RX_PARSE_LIMIT are calculated from
+ * ESP_MAX_LINK_BAUDRATE. In one call ESP_Process parse up to twice the number of bytes which
+ * can be received in ESP_PROCESS_PERIOD_MS, so ring is drained also after one delayed call.
+ * Ring hold at least the same number of bytes. For 460800 baud it is 922 bytes per period,
+ * parse limit 1844 bytes and 2048 bytes of ring, for 1000000 baud(serial link) it is 2000
+ * bytes per period, parse limit 4000 bytes and 4096 bytes of ring. Worst case is reached
+ * when link is continuously filled: ring is overrun when ESP_Process isn't called for more
+ * than ESP_RX_RING_SIZE/(baudrate/10) seconds(44ms for 460800 baud, 41ms for 1000000 baud),
+ * so no other task of Thread_Call may take longer than about one period. Bytes lost in
+ * UART or in ring are counted in ESP_RxStatistics. Sustained receive is also limited by
+ * SocketBufferTable, message which can't be stored because all buffers are used is dropped
+ * by framer. Lines with
+ * AT result codes and socket events are consumed by parser, messages from payload of +IPD
+ * are copied directly to SocketBufferTable and other lines of response stay in RX buffer.
+ * In communication with ESP8266 module character '\r' mean <CR> or in hex is equal 0x0D,
+ * character '\n' mean <LF> or in hex is equal 0x0A.
+ * ESP layer provide global structures ApnStructure and SocketBufferTable. ApnStructure
+ * contain information about available access points and is filled when ESP_SendApnListRequest
+ * function will be call and correct response will be processed by ESP_ProcessApnListResponse.
+ * SocketBufferTable is one pool of buffers used for received and send messages. Buffer
+ * contain information that message received, payload of received message and information
+ * about number of link which send message. User clear lockFlag of message when message was
+ * processed. Message is processed in place, user which keep message for later or code
+ * response in place of request set acceptedFlag. Buffer with set transmitFlag hold message
+ * which wait for send by ESP_Write, ESP_PassthroughWrite or ESP_SerialLinkWrite directly
+ * from its payload. ESP layer reserve for reception only buffers with cleared lockFlag.
+ * Known issues:
+ * 	-only TCP server is supported(TCP client only in passthrough mode, UDP link only to send data)
+ * 	-necessary change in few places socketNumber to link ID
+ *
+ * Simple example how to use API:
+static void ClockSleep2(uint32_t time)
+{
+	for (volatile uint32_t count = 0; count < (uint32_t)(time<<10);){count++;}
+}
+
+int main(void)
+{
+	ESP_Init(0, 115200, 10000, 3, 0);
+
+	ClockSleep2(1000);
+
+	ESP_ClearRxBuffer();
+
+	ESP_SendResetRequest();
+
+	for(;ESP_GetRequestState() == BUSY;)
+	{
+		ESP_Process();
+		ClockSleep2(1);
+	}
+
+	if(ESP_ProcessGaneralFormatResponse() == true)
+	{
+		ClockSleep(1000);
+		ESP_ClearRxBuffer();
+
+		ESP_SendDetectDeviceRequest();
+
+		for(;ESP_GetRequestState() == BUSY;)
+		{
+			ESP_Process();
+			ClockSleep2(1);
+		}
+
+		//device was reseted and detected
+		if(ESP_ProcessGaneralFormatResponse() == true)
+		{
+			ESP_SendWifiModeRequest(AT_STATION_MODE);
+
+			for(;ESP_GetRequestState() == BUSY;)
+			{
+				ESP_Process();
+				ClockSleep2(1);
+			}
+
+			//device was configured correctly to work in station mode
+			if(ESP_ProcessGaneralFormatResponse() == false)
+			{
+				goto endApplication;
+			}
+
+			ESP_SendConnectToApnRequest("ZTE-cb82da", "44f436cb19");
+
+			for(;ESP_GetRequestState() == BUSY;)
+			{
+				ESP_Process();
+				ClockSleep2(2);
+			}
+
+			//device was connected to APN correctly
+			if(ESP_ProcessGaneralFormatResponse() == false)
+			{
+				goto endApplication;
+			}
+
+			ESP_SendAcceptMultipleConnectionRequest();
+
+			for(;ESP_GetRequestState() == BUSY;)
+			{
+				ESP_Process();
+				ClockSleep2(1);
+			}
+
+			if(ESP_ProcessGaneralFormatResponse() == false)
+			{
+				goto endApplication;
+			}
+
+			ESP_SendServerCommandRequest(true, 3000);
+
+			for(;ESP_GetRequestState() == BUSY;)
+			{
+				ESP_Process();
+				ClockSleep2(1);
+			}
+
+			//ESP was configured to work in expected mode and TCP server run
+			if(ESP_ProcessGaneralFormatResponse() == true)
+			{
+				bool linkStatus = true;
+				uint8_t executedAtRequest;
+				uint8_t socketId;
+
+				for(uint32_t timer = 1; ; timer++)
+				{
+					if(ESP_GetRequestState() == READY)
+					{
+						if(timer%12000 == 0)
+						{
+							ESP_GetConnectionStatus();
+							executedAtRequest = 0;
+						}
+						else
+						{
+							//search rx data
+							for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET_BUFFER; i++)
+							{
+								if(SocketBufferTable[i].lockFlag)
+								{
+									ESP_SendWriteDataRequest(SocketBufferTable[i].socketId, sizeof("TestMessage"));
+									socketId = i;
+									executedAtRequest = 1;
+								}
+							}
+						}
+					}// if(ESP_GetRequestState() == READY)
+
+					ESP_Process();
+					ClockSleep2(2);
+
+					if(ESP_GetRequestState() == RESPONSE_RECEIVED)
+					{
+						switch(executedAtRequest)
+						{
+						case 0:
+							ESP_ProcessConnectionStatus(&linkStatus);
+							break;
+						case 1:
+							if(ESP_ProcessGaneralFormatResponse())
+							{
+								ESP_Write("TestMessage", sizeof("TestMessage"));
+								executedAtRequest = 2;
+							}
+							else
+							{
+								SocketBufferTable[socketId].lockFlag = false;
+							}
+							break;
+						case 2:
+							//send message succesfull
+							if(ESP_ProcessGaneralFormatResponse())
+							{
+								SocketBufferTable[socketId].lockFlag = false;
+							}
+							else//send message fail
+							{
+								SocketBufferTable[socketId].lockFlag = false;
+							}
+							break;
+						}// switch(executedAtRequest)
+					}// if(ESP_GetRequestState() == RESPONSE_RECEIVED)
+				}// for(uint32_t timer = 1; ; timer++)
+			}
+		}
+	}
+endApplication:
+	for(;;){}
+
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "CobsFraming.h"
+
+#define MAX_NUMBER_OF_APN 								10U
+#define MAX_NUMBER_OF_SOCKET 							5U
+#define INVALID_SOCKET_ID								0xFFU
+#define MAX_SIZE_OF_SOCKET_BUFFER 						200U
+#define MAX_NUMBER_OF_SOCKET_BUFFER 					5U //buffers shared by received requests and coded responses
+#define IPD_HEADER_LENGTH 								5U
+#define TX_RX_BUFFER_SIZE 								400U
+//RX ring and parse budget are calculated from the highest baudrate of UART port used by ESP layer
+#ifndef ESP_MAX_LINK_BAUDRATE
+#define ESP_MAX_LINK_BAUDRATE 							460800U //must be at least baudrate set by ESP_ChangeBaudrate
+#endif
+#define ESP_PROCESS_PERIOD_MS 							20U //period of ESP_Process calls(period of Thread_Call)
+#define ESP_RX_BYTES_PER_PROCESS 						(((ESP_MAX_LINK_BAUDRATE/10U)*ESP_PROCESS_PERIOD_MS)/1000U) //8N1 frame has 10 bits
+#define ESP_RX_PARSE_LIMIT 								(2U*ESP_RX_BYTES_PER_PROCESS) //max number of bytes parsed in one ESP_Process call
+#if (ESP_RX_PARSE_LIMIT <= 1024U)
+#define ESP_RX_RING_SIZE 								1024U //must be power of two
+#elif (ESP_RX_PARSE_LIMIT <= 2048U)
+#define ESP_RX_RING_SIZE 								2048U
+#elif (ESP_RX_PARSE_LIMIT <= 4096U)
+#define ESP_RX_RING_SIZE 								4096U
+#else
+#error "ESP_MAX_LINK_BAUDRATE is too high for RX ring"
+#endif
+#define ESP_COMMAND_QUEUE_SIZE 							4U
+#define ESP_COMMAND_DEFAULT_TIMEOUT 					0U //use timeout set in ESP_Init
+//received stream of socket is divided into messages by length field
+#define ESP_FRAME_HEADER_SIZE 							8U //bytes of message header, length field is inside header
+#define ESP_FRAME_LENGTH_FIELD_BEGIN 					4U //big endian 32 bit field with number of bytes after header
+#define ESP_FRAME_MIN_LENGTH 							8U //length field cover at least rest of SOME/IP header
+#define ESP_FRAME_TIMEOUT 								25U //ESP_Process calls without data after which partial message is dropped
+#define ESP_DROPPED_MESSAGE_QUEUE_SIZE 					8U //headers of messages dropped because all RX buffers were used
+//passthrough(transparent transmission) mode
+#define ESP_PASSTHROUGH_SOCKET_ID 						0U //socketId of messages received in passthrough mode
+#define ESP_PASSTHROUGH_ESCAPE_GUARD_TIME 				3U //ESP_Process calls without TX data before "+++"
+#define ESP_PASSTHROUGH_EXIT_TIME 						60U //ESP_Process calls after "+++" before next AT request(min 1s)
+//serial link mode
+#define ESP_SERIAL_LINK_SOCKET_ID 						0U //socketId of messages received by serial link
+#define AT_REQ_TIMEOUT_DISABLE 							0U
+#define RX_TIMEOUT_DISABLE								0U
+#define SSID_STRING_LENGTH 								33U
+#define IP_ADDRESS_BYTE_LENGTH 							4U
+#define STATUS_STATION_CREATED_TCP_OR_UDP_TRANSMISSION	3U
+#define STATUS_STATION_NOT_CONNECTED_TO_APN 			5U
+#define TCP_CONNECTION_TYPE								6U
+#define UDP_CONNECTION_TYPE								17U
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	typedef enum DEVICE_STATUS
+	{
+		READY = 			0,
+		BUSY,
+		RESPONSE_RECEIVED,
+		PASSTHROUGH_MODE,//AT requests can't be send until ESP_StopPassthrough will finish
+		SERIAL_LINK_MODE,//ESP8266 isn't used, AT requests can't be send until ESP_StopSerialLink
+	}DEVICE_STATUS;
+
+	typedef enum ESP_RX_PARSER_STATE
+	{
+		ESP_RX_STATE_LINE = 	0,
+		ESP_RX_STATE_PAYLOAD,
+		ESP_RX_STATE_PASSTHROUGH,
+		ESP_RX_STATE_SERIAL_LINK,
+	}ESP_RX_PARSER_STATE;
+
+	typedef enum ESP_PASSTHROUGH_STATE
+	{
+		ESP_PASSTHROUGH_DISABLED = 	0,
+		ESP_PASSTHROUGH_WAIT_PROMPT,//AT+CIPSEND was send, '>' is expected
+		ESP_PASSTHROUGH_ACTIVE,
+		ESP_PASSTHROUGH_WAIT_ESCAPE,//wait for end of TX data and guard time before "+++"
+		ESP_PASSTHROUGH_WAIT_EXIT,//"+++" was send, wait until module will accept AT requests
+	}ESP_PASSTHROUGH_STATE;
+
+	typedef enum ESP_STATION_STATE
+	{
+		ESP_STATION_UNKNOWN = 	0,//any event wasn't received since ESP_Init
+		ESP_STATION_DISCONNECTED,//WIFI DISCONNECT
+		ESP_STATION_CONNECTED,//WIFI CONNECTED, IP address isn't assigned yet
+		ESP_STATION_GOT_IP,//WIFI GOT IP
+	}ESP_STATION_STATE;
+
+	typedef enum ESP_DEVICE_MODE
+	{
+		AT_STATION_MODE		 	= 1U,
+		AT_SOFT_AP_MODE			= 2U,
+		AT_SOFT_AP_STATION_MODE	= 3U,
+	}ESP_DEVICE_MODE;
+
+	typedef struct{
+		uint32_t UART_OVERRUN : 	1;
+		uint32_t UART_FRAME_ERROR : 1;
+		uint32_t AT_RETURN_ERROR : 	1;
+		uint32_t AT_TIMEOUT : 		1;
+		uint32_t AT_OVERRUN : 		1;
+		uint32_t RX_FRAME_ERROR : 	1;//received message was dropped because of length field
+	}ERROR_CODE;
+
+	typedef struct{
+		bool socketIsOpen; /* this flag is refresh when event from ESP will receive and when
+		user call ESP_GetConnectionStatus function */
+		bool additionalSocketDataIsAvailable;/* this flag inform that below data is available.
+		To gather below data is necessary call ESP_GetConnectionStatus function */
+		uint8_t connectionType;
+		uint8_t remoteIpAddress[IP_ADDRESS_BYTE_LENGTH];
+		uint16_t remotePort;
+		uint16_t localPort;
+		bool tcpConnectionRunAsServer;
+	}SocketState;
+
+	typedef struct{
+		bool lockFlag;//message is complete and wasn't processed by user
+		bool receptionFlag;//buffer is filled by ESP layer
+		bool acceptedFlag;//message was taken by user and buffer is used until lockFlag will be cleared
+		bool transmitFlag;//buffer hold coded message which wait for send
+		uint8_t socketId;
+		uint8_t sequenceNumber;//messages are numbered in order of receive
+		uint16_t payloadSize;
+		uint8_t payload[MAX_SIZE_OF_SOCKET_BUFFER] __attribute__((aligned(32)));
+	}SocketMessage;
+
+	typedef struct{
+		uint8_t header[ESP_FRAME_HEADER_SIZE];
+		uint8_t headerSize;
+		uint16_t messageRemaining;//bytes of message after header which wasn't received yet
+		SocketMessage *message;//NULL if message is dropped
+		bool messageRejected;//message is dropped because all RX buffers were used
+		bool synchronizationLost;//malformed length was received, data is dropped
+		uint16_t idleCounter;//ESP_Process calls without data of partial message
+	}ESP_StreamFramer;
+
+	typedef struct{
+		uint8_t socketId;
+		uint8_t header[ESP_FRAME_HEADER_SIZE];
+	}ESP_DroppedMessage;
+
+	typedef struct{
+		uint8_t securityLevel;
+		int8_t signalPower;
+		char ssid[SSID_STRING_LENGTH];//max length plus one
+		char bssid[18];
+	}ApnInformation;
+
+	typedef struct{
+		ApnInformation AppInformationTable[MAX_NUMBER_OF_APN];
+		uint8_t NumberOfApn;
+	}ApnStructureType;
+
+	typedef struct{
+		uint32_t uartOverrunCounter;//number of overrun errors reported by UART RX FIFO
+		uint32_t ringOverrunCounter;//number of bytes lost because RX ring was full
+		uint16_t ringHighWatermark;//the highest number of bytes stored in RX ring
+	}ESP_RxStatistics;
+
+	typedef struct{
+		bool (*requestFunction)(void* context);/* copy AT request to ESP layer TX buffer by call of
+		function like ESP_SendDetectDeviceRequest. Return false if request can't be created */
+		bool (*responseFunction)(void* context);/* process response by call of function like
+		ESP_ProcessGaneralFormatResponse. Return true if command was finished with success */
+		void (*callbackFunction)(bool result, void* context);//called when command is finished, can be NULL
+		void* context;//parameter passed to above functions
+		uint32_t timeout;//response timeout in ESP_Process calls or ESP_COMMAND_DEFAULT_TIMEOUT
+		uint8_t retries;//number of repetitions of command if response function return false
+	}ESP_Command;
+
+	typedef struct{
+		ESP_Command command;
+		uint8_t sequenceNumber;//commands added by one ESP_QueueCommandSequence call have the same number
+		uint8_t retryCounter;
+	}ESP_CommandQueueEntry;
+
+	typedef struct{
+		DEVICE_STATUS deviceStatus;
+		ERROR_CODE errorCode;
+		uint8_t txBuffer[TX_RX_BUFFER_SIZE];
+		const uint8_t* txDataPointer;//data send to UART, txBuffer or buffer passed to ESP_Write
+		uint16_t txSize;
+		uint16_t txProgress;
+		uint8_t rxBuffer[TX_RX_BUFFER_SIZE];//lines of AT response which are processed by user
+		uint16_t rxSize;
+		uint16_t rxLineBegin;//position in rxBuffer where currently received line begin
+		//ring with data received from UART which wasn't parsed yet
+		uint8_t rxRing[ESP_RX_RING_SIZE];
+		volatile uint16_t rxRingHead;//written only by UART interrupt
+		volatile uint16_t rxRingTail;//written only by ESP_Process
+		//values of ESP_RxStatistics counters which was already reported in errorCode
+		uint32_t lastUartOverrunCounter;
+		uint32_t lastRingOverrunCounter;
+		//variables used to copy messages from payload of +IPD message directly to SocketBufferTable
+		ESP_RX_PARSER_STATE rxParserState;
+		uint16_t rxPayloadRemaining;
+		uint8_t rxPayloadSocketId;//INVALID_SOCKET_ID if payload is dropped
+		ESP_StreamFramer framerTable[MAX_NUMBER_OF_SOCKET];
+		uint8_t rxMessageSequenceNumber;
+		ESP_DroppedMessage droppedMessageQueue[ESP_DROPPED_MESSAGE_QUEUE_SIZE];
+		uint8_t droppedMessageHead;
+		uint8_t droppedMessageCount;
+		//variables used in passthrough mode
+		ESP_PASSTHROUGH_STATE passthroughState;
+		uint16_t passthroughCounter;//counter of ESP_Process calls used by escape sequence
+		//variables used in serial link mode
+		CobsDecoder serialLinkDecoder;
+		SocketMessage *serialLinkMessage;//NULL if message isn't received or is dropped
+		bool serialLinkMessageDropped;//data is ignored until end of message
+		uint16_t serialLinkIdleCounter;//ESP_Process calls without data of partial message
+		//state of station connection updated by events received from module
+		ESP_STATION_STATE stationState;
+		bool stationStateChanged;//stationState wasn't read by ESP_GetStationStateEvent
+		uint8_t uartPortNumber;
+		uint32_t baudrate;
+		//variables used to detect request timeout cause by missing response or lose data
+		uint32_t timeoutRequestTreshold;
+		uint32_t timeoutRequestCounter;
+		uint32_t defaultTimeoutRequestTreshold;//value set in ESP_Init, restored after finish of command
+		//queue of commands send one after another
+		ESP_CommandQueueEntry commandQueue[ESP_COMMAND_QUEUE_SIZE];
+		uint8_t commandQueueHead;
+		uint8_t commandQueueSize;
+		uint8_t commandSequenceNumber;
+		bool commandIsActive;//first command of queue was send and response is expected
+		//variables used to lock ESP if device will be during receive data
+		bool rxDeviceLock;
+		uint16_t rxLockCounter;
+		uint16_t rxLockTreshold;
+		//variables used to clear RX buffer of ESP layer if AT request isn't processed longer time
+		uint16_t rxClearCounter;
+		uint16_t rxClearThreshold;
+		uint16_t lastRxSizeStatus;
+	}ESP_Status;
+
+	extern ApnStructureType ApnStructure;
+	extern SocketMessage SocketBufferTable[MAX_NUMBER_OF_SOCKET_BUFFER];
+
+	bool ESP_Init(uint8_t portNum, uint32_t baudrate, uint32_t timeoutRequestTreshold, uint16_t rxLockTreshold, uint16_t rxClearThreshold);
+	SocketState ESP_ReturnLinkInformation(uint8_t linkId);
+	void ESP_Process(void);
+	DEVICE_STATUS ESP_GetRequestState(void);
+	bool ESP_SendDetectDeviceRequest(void);
+	bool ESP_SendResetRequest(void);
+	bool ESP_ProcessGaneralFormatResponse(void);
+	bool ESP_SendConnectToApnRequest(const char* ssidName, const char* password);
+	bool ESP_SendWifiModeRequest(uint8_t wifiMode);
+	bool ESP_SendUartConfigurationRequest(uint32_t baudrate);
+	bool ESP_SendDisconnectRequest(void);
+	bool ESP_SendApnListRequest(void);
+	bool ESP_ProcessApnListResponse(void);
+	bool ESP_GetAssignedIpAddress(void);
+	bool ESP_ProcessGetAssignedIpResponse(uint8_t *pointerToIpAdressTable);
+	bool ESP_GetConnectionStatus(void);
+	bool ESP_ProcessConnectionStatus(bool *flagPointer);
+	bool ESP_SendAcceptMultipleConnectionRequest(void);
+	bool ESP_SendServerCommandRequest(bool serverStatus, uint16_t portNumber);
+	bool ESP_SendSingleConnectionRequest(void);
+	bool ESP_SendTransferModeRequest(bool passthroughMode);
+	bool ESP_SendStartTcpConnectionRequest(const uint8_t* ipAddress, uint16_t portNumber);
+	bool ESP_SendStartUdpConnectionRequest(uint8_t linkId, const uint8_t* ipAddress, uint16_t portNumber);
+	bool ESP_SendStartPassthroughRequest(void);
+	bool ESP_PassthroughWrite(const uint8_t* bufferPointer, uint16_t bufferSizeOf);
+	bool ESP_StopPassthrough(void);
+	bool ESP_PassthroughIsActive(void);
+	void ESP_StartSerialLink(void);
+	void ESP_StopSerialLink(void);
+	bool ESP_SerialLinkWrite(const uint8_t* bufferPointer, uint16_t bufferSizeOf);
+	bool ESP_SerialLinkIsActive(void);
+	bool ESP_SendWriteDataRequest(uint8_t socketNumber, uint16_t writeBufferSizeOf);
+	bool ESP_Write(uint8_t* bufferPointer, uint16_t bufferSizeOf);
+	void ESP_ClearRxBuffer(void);
+	SocketMessage* ESP_GetReceivedMessage(void);
+	bool ESP_GetDroppedMessage(ESP_DroppedMessage* droppedMessage);
+	uint8_t ESP_GetUartPortNumber(void);
+	bool ESP_QueueCommandSequence(const ESP_Command* commandTable, uint8_t numberOfCommands);
+	bool ESP_QueueCommand(const ESP_Command* command);
+	uint8_t ESP_GetQueuedCommandNumber(void);
+	bool ESP_ChangeBaudrate(uint32_t baudrate);
+	uint32_t ESP_GetBaudrate(void);
+	ESP_RxStatistics ESP_GetRxStatistics(void);
+	bool ESP_GetStationStateEvent(ESP_STATION_STATE *stationState);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ESP_LAYER_H_ */
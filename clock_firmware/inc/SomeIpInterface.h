@@ -0,0 +1,79 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/* Generated by GenerateSomeIpInterface.py from SomeIpInterface.json, don't edit. */
+
+#ifndef _SOME_IP_INTERFACE_H_
+#define _SOME_IP_INTERFACE_H_
+
+/*
+ * Module contain MethodDescriptorTable of methods supported by WIFI_InteractionLayer,
+ * decoders of request payloads and encoders of response payloads. Payload fields are
+ * little-endian and are read and written byte after byte, so payload in buffer doesn't need
+ * to be aligned and structures can have padding. Handlers of methods are implemented by
+ * WIFI_InteractionLayer.c. Decoder is called after check of payload size by
+ * WIFI_ProcessRequest. Request which hasn't all fields of structure(unsubscribe) clear
+ * other fields.
+ */
+
+#include "WIFI_InteractionLayer.h"
+
+#if WIFI_FRAM_IMAGE_SERVICE
+#define NUMBER_OF_METHOD_DESCRIPTORS	12
+#else
+#define NUMBER_OF_METHOD_DESCRIPTORS	9
+#endif
+
+extern const WifiMethodDescriptorType MethodDescriptorTable[NUMBER_OF_METHOD_DESCRIPTORS];
+
+uint8_t WIFI_ClockStatusSetHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter);
+uint8_t WIFI_ClockStatusGetHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter);
+uint8_t WIFI_ClockStatusSubscribeHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter);
+uint8_t WIFI_DayMeasurementHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter);
+uint8_t WIFI_RangeQueryHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter);
+#if WIFI_FRAM_IMAGE_SERVICE
+uint8_t WIFI_FramImageExportHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter);
+uint8_t WIFI_FramImageImportHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter);
+uint8_t WIFI_FramImageValidateHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter);
+#endif
+
+void SomeIpInterface_DecodeClockStatusSetRequest(const uint8_t* payload, SomeIpClockStatusSetRequestMethodPayload* structure);
+void SomeIpInterface_DecodeClockStatusSubscribeRequest(const uint8_t* payload, SomeIpClockStatusSubscribeRequestMethodPayload* structure);
+void SomeIpInterface_DecodeClockStatusUnsubscribeRequest(const uint8_t* payload, SomeIpClockStatusSubscribeRequestMethodPayload* structure);
+void SomeIpInterface_DecodeDayMeasurementPartRequest(const uint8_t* payload, SomeIpDayMeasurmentRequestPayload* structure);
+void SomeIpInterface_DecodeDayMeasurementGetSegmentedRequest(const uint8_t* payload, SomeIpDayMeasurmentSegmentedRequestPayload* structure);
+void SomeIpInterface_DecodeDayMeasurementRangeQueryRequest(const uint8_t* payload, SomeIpRangeQueryRequestPayload* structure);
+#if WIFI_FRAM_IMAGE_SERVICE
+void SomeIpInterface_DecodeFramImageExportRequest(const uint8_t* payload, SomeIpFramImageExportRequestPayload* structure);
+void SomeIpInterface_DecodeFramImageImportRequest(const uint8_t* payload, SomeIpFramImageImportRequestPayload* structure);
+#endif
+void SomeIpInterface_EncodeClockStatusGetResponse(uint8_t* payload, const SomeIpClockStatusGetResponseMethodPayload* structure);
+void SomeIpInterface_EncodeDaySummaryGetResponse(uint8_t* payload, const SomeIpDaySummaryResponsePayload* structure);
+#if WIFI_FRAM_IMAGE_SERVICE
+void SomeIpInterface_EncodeFramImageValidateResponse(uint8_t* payload, const SomeIpFramImageValidateResponsePayload* structure);
+#endif
+
+#endif  /* _SOME_IP_INTERFACE_H_ */
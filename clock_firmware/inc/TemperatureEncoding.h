@@ -0,0 +1,49 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _TEMPERATURE_ENCODING_H_
+#define _TEMPERATURE_ENCODING_H_
+
+/*
+ * This module code table of temperature samples in compact form used in responses with
+ * history of temperatures. Consecutive samples differ usually only by few tenths of degree
+ * so instead of value is stored difference from previous sample(first sample is compared
+ * with 0). Difference is signed so it is converted by zig-zag coding to unsigned number
+ * where small negative and small positive differences give small numbers:
+ *	0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, 2 -> 4 ...
+ * Number is stored as varint: 7 bits in each byte starting from least significant bits,
+ * most significant bit of byte is set when next byte belong to the same number. Difference
+ * lower than 64 in both directions take one byte, the biggest take three bytes. All
+ * calculations are performed modulo 2^16 so INVALID_READ_SENSOR_VALUE is coded like other
+ * values.
+ * Module don't use any hardware so the same file is used as reference decoder by host
+ * application which receive history from clock.
+ */
+
+#include <stdint.h>
+
+#define TEMPERATURE_ENCODING_RAW			0 //little-endian uint16 values
+#define TEMPERATURE_ENCODING_DELTA_VARINT	1 //zig-zag varint differences between consecutive values
+#define TEMPERATURE_ENCODING_MAX_VALUE_SIZE	3 //max number of bytes of one coded value
+
+uint16_t TemperatureEncoding_EncodeDelta(const uint16_t *values, uint8_t numberOfValues, uint8_t *buffer,
+		uint16_t bufferSize, uint8_t *numberOfEncodedValues);
+uint8_t TemperatureEncoding_DecodeDelta(const uint8_t *buffer, uint16_t bufferSize, uint16_t *values,
+		uint8_t maxNumberOfValues);
+
+#endif /* _TEMPERATURE_ENCODING_H_ */
@@ -0,0 +1,67 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _TEMPERATURE_RECORD_CACHE_H_
+#define _TEMPERATURE_RECORD_CACHE_H_
+
+/*
+ * This module hold small cache of verified day measurements(TemperatureSingleDayRecordType)
+ * loaded from FRAM. Cache is shared by graph buffer(ReadFramTempBufferTable) and WiFi
+ * service so day measurement which was already loaded and verified by checksum by one of
+ * them isn't loaded again from FRAM by second one. Day measurement is searched by source
+ * and date. Present day measurement isn't stored in cache but TemperatureSingleDay table
+ * is returned directly.
+ * Load of new day measurement is performed in three steps:
+ * TemperatureRecordCache_Reserve - return buffer of least recently used entry which isn't
+ *	used by anybody. Buffer is locked so it will not be used by other reservation.
+ * TemperatureRecordCache_Commit - called when loaded data was verified. After this call
+ *	day measurement can be find by TemperatureRecordCache_Find.
+ * TemperatureRecordCache_Unlock - release lock. Entry is still valid if was committed.
+ * Entry is treat as used when it is locked or is pointed by available element of graph
+ * buffer, such entry will be never chosen by TemperatureRecordCache_Reserve. Except
+ * TemperatureRecordCache_InvalidateFramIndex all functions must be call from thread context.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "GUI_Clock.h"
+
+//all graph buffer elements can point to cache, one entry is necessary for load data and rest hold prefetched days
+#define TEMPERATURE_RECORD_CACHE_SIZE 		(READ_TEMP_FRAM_BUFFER_SIZE + 1 + PREFETCH_MAX_DEPTH)
+
+typedef struct
+{
+	TemperatureSingleDayRecordType singleRecord;
+	uint16_t framIndex; //index in FRAM where singleRecord occur
+	uint8_t lockCounter; //number of users which hold pointer to singleRecord
+	uint8_t usageRank; //0 for most recently used entry, TEMPERATURE_RECORD_CACHE_SIZE - 1 for least recently used
+	bool validFlag; //flag is set when singleRecord contain verified data
+	bool demotedFlag; //entry is reused before all other valid entries, cleared when entry is used again
+}TemperatureRecordCacheEntryType;
+
+void TemperatureRecordCache_Init(void);
+TemperatureSingleDayRecordType* TemperatureRecordCache_Find(uint8_t source, uint8_t day, uint8_t month, uint8_t year,
+		uint16_t *framIndex);
+TemperatureSingleDayRecordType* TemperatureRecordCache_Reserve(void);
+void TemperatureRecordCache_Commit(TemperatureSingleDayRecordType *record, uint16_t framIndex);
+void TemperatureRecordCache_Lock(TemperatureSingleDayRecordType *record);
+void TemperatureRecordCache_Unlock(TemperatureSingleDayRecordType *record);
+void TemperatureRecordCache_InvalidateFramIndex(uint16_t framIndex);
+void TemperatureRecordCache_Demote(uint8_t source, uint8_t day, uint8_t month, uint8_t year);
+
+#endif /* _TEMPERATURE_RECORD_CACHE_H_ */
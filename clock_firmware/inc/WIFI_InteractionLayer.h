@@ -1,168 +1,568 @@
-/*
-
-clock_firmware
-Copyright (C) 2019 Adrian Chemicz
-
-This program is free software: you can redistribute it and/or modify
-it under the terms of the GNU General Public License as published by
-the Free Software Foundation, either version 3 of the License, or
-(at your option) any later version.
-
-This program is distributed in the hope that it will be useful,
-but WITHOUT ANY WARRANTY; without even the implied warranty of
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-GNU General Public License for more details.
-
-You should have received a copy of the GNU General Public License
-along with this program. If not, see <http://www.gnu.org/licenses/>. */
-
-#ifndef _WIFI_INTERACTIONLAYER_H_
-#define _WIFI_INTERACTIONLAYER_H_
-
-/*
- * This module is responsible for handle direct communication with ESP_Layer and provide result of
- * communication to higher layer like GUI. Functionality of this module was divide into three
- * separate functions:
- * WIFI_Init - function responsible for initialization ESP8266 like check presence of module,
- *	reset ESP and clear RX buffer before normal operation. This function work only on beggining.
- *	If ESP module will initialize correctly then appropriate flag will be set as true.
- * WIFI_Process - function must be call cyclically after initialization process with correct
- *	result. Information about get connection status, assigned IP address and available APN
- *	is performed inside this function. Inside this part is also performed log to APN if
- *	password was set.
- * WIFI_ProcessRequest - function is only call from WIFI_Process and is only responsible for
- *	process SOME/IP request. If SOME/IP message is correct(correct SOME/IP message header
- *	and CRC if this extension was set) then payload is processed. Inside this function is
- *	performed request validation like chech that service and method is supported and data
- *	for dedicated request is correct.
- * Two last function require pointer to WifiStateType structure as input parameter. Inside this
- * structure is hold data necessary for all operations like cyclically check connection status,
- * get APN list if it is necessary, send TX responses and search FRAM memory to find appropriate
- * data.
- */
-
-#include "ESP_Layer.h"
-#include "SOMEIP_Layer.h"
-#include "GUI_Clock.h"
-
-#define WIFI_INIT_MULTIPLY_CONNECTION		0
-#define WIFI_CREATE_TCP_SERVER				1
-#define TCP_SERVER_PORT_NUMBER			 3000
-#define MAX_NUMBER_OF_TX_BUFFER				2
-#define WIFI_SEND_DATA_REPETITION			3
-
-//supported services and methods
-#define SOME_IP_SERVICE_CLOCK_STATUS				1
-#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET 	0
-#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET 	1
-#define SOME_IP_SERVICE_DAY_MEASUREMENT				2
-
-//SOME/IP payload message defines
-#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET_PAYLOAD_SIZE	5
-#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET_PAYLOAD_SIZE	12
-#define SOME_IP_SERVICE_DAY_MEASUREMENT_REQ_PAYLOAD_SIZE		4
-#define DAY_MEASUREMENT_HEADER_SIZE								4
-#define SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE	40
-
-typedef enum WIFI_STARTUP_PHASES_TYPE
-{
-	WIFI_STARTUP_WAIT,
-	WIFI_SEND_FIRST_REQUEST,
-	WIFI_SEND_RESET,
-	WIFI_RESET_WAIT,
-	WIFI_SEND_ESP_MODE,
-	WIFI_SEND_DETECT_REQUEST,
-	WIFI_DEVICE_DONT_DETECTED
-}WIFI_STARTUP_PHASES;
-
-typedef enum WIFI_REQUESTS_TYPE
-{
-	WIFI_REQUEST_NONE,
-	WIFI_REQUEST_GET_APN,
-	WIFI_REQUEST_CONNECT_TO_APN,
-	WIFI_REQUEST_DISCONNECT,
-	WIFI_REQUEST_GET_IP_ADDRESS,
-	WIFI_REQUEST_CONNECTION_STATUS,
-	WIFI_REQUEST_ACCEPT_MULLTIPLY_CONNECTION,
-	WIFI_REQUEST_CREATE_TCP_SERVER,
-	WIFI_REQUEST_SEND_RESPONSE_MESSAGE
-}WIFI_REQUESTS;
-
-typedef enum DAY_STRUCTURE_SEARCH_STATUS_TYPE
-{
-	SEARCH_NOT_REQUESTED,
-	SEARCH_REQUESTED,
-	SEARCH_PENDING,
-	SEARCH_PENDING_READ_READY,
-	SEARCH_HEADER_MATCH,
-	SEARCH_FINISHED
-}DAY_STRUCTURE_SEARCH_STATUS;
-
-typedef struct
-{
-	uint8_t minute;
-	uint8_t hour;
-	uint8_t day;
-	uint8_t month;
-	uint8_t year;
-}SomeIpClockStatusSetRequestMethodPayload;
-
-typedef struct
-{
-	uint8_t minute;
-	uint8_t hour;
-	uint8_t day;
-	uint8_t month;
-	uint8_t year;
-	uint8_t reserved;
-	uint16_t temperatureOutside;
-	uint16_t temperatureInside;
-	uint16_t temperatureFurnace;
-}SomeIpClockStatusGetResponseMethodPayload;
-
-typedef struct
-{
-	uint8_t source;
-	uint8_t day;
-	uint8_t month;
-	uint8_t year;
-}SomeIpDayMeasurmentRequestPayload, DayMeasurementHeader;
-
-typedef struct
-{
-	uint16_t getApnCounter;
-	uint16_t connectToApnCounter;
-	uint16_t checkConnectionCounter;
-	uint8_t processedRequest;
-	uint8_t diconnectRepetitionCounter;
-	bool initSocketFlag;
-	uint8_t initSocketPhase;
-
-	SocketMessage TxMessageTable[MAX_NUMBER_OF_TX_BUFFER];
-	uint8_t sendTxMessageNumber;
-	bool sendTxFirstStepWasPerformed;
-	uint8_t sendTxErrorCounter;
-
-	//request data
-	bool messageIsReceived;
-	SomeIpMessage someIpReceivedMessage;
-
-	//temperature per day data
-	DayMeasurementHeader SearchedDayMeasurementHeader;	/* This structure contain content copied from SOME/IP request */
-	TemperatureSingleDayRecordType TemperatureSingleDayRecordLoadedBuffer; /* Buffer which hold correct last searched day
-	measurement if temperatureStructureIsValid is set */
-	TemperatureSingleDayRecordType TemperatureSingleDayRecordTmp; /* Structure used as temporary buffer during verification of
-	correctness of storing data */
-	bool temperatureStructureIsValid;	/* This flag hold information about correctness of TemperatureSingleDayRecordLoadedBuffer
-	structure. This flag is used to decide about load process if correct data is stored in TemperatureSingleDayRecordLoadedBuffer
-	and header is the same then search isn't necessary */
-	bool searchedStructureExist;	// Result of search. if match structure will not find in all FRAM then it will be set as false
-	uint8_t searchState;	// This variable hold state used by state machine working on process day measurement request
-	bool readFramWasRequested;
-	uint16_t searchFramIndex;
-}WifiStateType;
-
-void WIFI_Init(void);
-void WIFI_Process(WifiStateType* wifiStateStructure);
-
-#endif /* _WIFI_INTERACTIONLAYER_H_ */
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _WIFI_INTERACTIONLAYER_H_
+#define _WIFI_INTERACTIONLAYER_H_
+
+/*
+ * This module is responsible for handle direct communication with ESP_Layer and provide result of
+ * communication to higher layer like GUI. Functionality of this module was divide into three
+ * separate functions:
+ * WIFI_Init - function responsible for initialization ESP8266 like check presence of module,
+ *	reset ESP and clear RX buffer before normal operation. This function work only on beggining.
+ *	If ESP module will initialize correctly then appropriate flag will be set as true.
+ * WIFI_Process - function must be call cyclically after initialization process with correct
+ *	result. Information about get connection status, assigned IP address and available APN
+ *	is performed inside this function. Inside this part is also performed log to APN if
+ *	password was set.
+ * WIFI_ProcessRequest - function is only call from WIFI_Process and is only responsible for
+ *	process SOME/IP request. If SOME/IP message is correct(correct SOME/IP message header
+ *	and CRC if this extension was set) then payload is processed. Supported methods are
+ *	described by MethodDescriptorTable sorted by service ID and method ID. Descriptor found
+ *	by binary search contain size of request payload and handler which validate data for
+ *	dedicated request and fill response. MethodDescriptorTable and decoders of payloads
+ *	(SomeIpInterface.c) are generated from test/SomeIpInterface.json, new method is added
+ *	to this description and its handler is written in WIFI_InteractionLayer.c.
+ * Two last function require pointer to WifiStateType structure as input parameter. Inside this
+ * structure is hold data necessary for all operations like cyclically check connection status,
+ * get APN list if it is necessary, send TX responses and search FRAM memory to find appropriate
+ * data.
+ * Received requests are stored in queue of socket which send request. Next processed
+ * request is chosen from queues of sockets in round robin order so one client can't block
+ * others. Requests, responses and notifications use the same SocketBufferTable of ESP layer.
+ * Response is coded in place of request and is send directly from its buffer, so message
+ * isn't copied between RX and TX buffers. Notifications and responses created after FRAM
+ * search take free buffer only when other one stay free for reception. Request is queued
+ * only when two buffers stay free, so requests which wait for FRAM search can't take
+ * buffer needed by response of search. If queue of socket is full or buffers are used
+ * then request is rejected in place by SOME/IP error with SOME_IP_RETURN_CODE_E_NOT_READY.
+ * Only one day measurement request can be searched in FRAM at the same time, other requests
+ * are processed during search. Responses are send in order in which they were created.
+ *
+ * Day measurement can be requested in two ways. Method ID lower than
+ * SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_GET_SEGMENTED is index of 40 bytes part of one day
+ * measurement. Method SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_GET_SEGMENTED return range of
+ * consecutive days as SOME/IP-TP segments send one after another without next requests.
+ * Original payload is table of TemperatureSingleDayRecordType structures for each day of
+ * range and each structure is divided into SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENTS_PER_DAY
+ * segments. Request contain date of first day and bit mask of segments which should be send
+ * so client which lost part of segments request only missing ones. Day measurement which
+ * doesn't exist is send as zeros. More segments flag is cleared in last segment send as
+ * response for request.
+ * History of many days and sources is requested by SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_RANGE_QUERY.
+ * Request contain mask of sources, first and last day of range and downsampling step. Headers
+ * of all FRAM are read once and FRAM index of each requested day measurement is remembered,
+ * next day measurements are loaded one by one in order of date and source. Each day
+ * measurement is send as entry with summary of day(step equal 0) or with averages of step
+ * consecutive samples. Entries are packed into response messages send one after another
+ * without next requests, day measurements which doesn't exist are skipped. Last response
+ * message has cleared moreMessages field.
+ * When client set SOME_IP_RANGE_QUERY_COMPACT_ENCODING_FLAG in source mask then samples are
+ * send in SomeIpRangeQueryEncodedSamplesEntry. Each entry contain samples coded by
+ * TemperatureEncoding module or raw samples if coded form wouldn't be smaller.
+ * Method SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST has the same request and response
+ * stream but entry contain only header and CRC16 of day measurement(calculated like
+ * CRC16Value field but also for present day which CRC16Value isn't updated in RAM). Client
+ * which store history compare CRC with local copy and request only changed or new days.
+ * Range of manifest can contain WIFI_MANIFEST_MAX_DAYS days, range of range query only
+ * WIFI_RANGE_QUERY_MAX_DAYS days.
+ * CRC of day measurement which isn't loaded to cache is read from FRAM without verification
+ * of whole record.
+ *
+ * Client which follow state of clock don't need to poll SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET.
+ * Instead it can subscribe eventgroups(time, temperatures and alarms) by method
+ * SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE. After subscription and after each change of
+ * ClockState fields which belong to eventgroup clock send SOME/IP notification with event ID
+ * of eventgroup. Request contain minimum interval between notifications send to subscriber so
+ * changes which occur during this time are send as one notification with newest values.
+ * Subscription is removed by SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE, when socket is
+ * closed or when WiFi connection is lost.
+ * Response of SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET is coded once and stored with CRC in
+ * WifiStateType structure. Code which change time, date or temperatures in ClockState call
+ * WIFI_ClockStatusChanged which increment generation counter and response is coded again
+ * only if generation was changed. Otherwise cached message is copied to TX buffer.
+ *
+ * Service SOME_IP_SERVICE_FRAM_IMAGE(enabled by WIFI_FRAM_IMAGE_SERVICE) is used to backup
+ * whole history or move it to other clock. FRAM from FRAM_MEASUREMENT_DATA_BEGIN to end of
+ * memory is divided into blocks of WIFI_FRAM_IMAGE_BLOCK_SIZE bytes(last block is shorter).
+ * SOME_IP_SERVICE_FRAM_IMAGE_METHOD_EXPORT send requested blocks one after another without
+ * next requests, each message contain one block with its CRC16. Interrupted export is
+ * continued by request which begin from first missing block.
+ * SOME_IP_SERVICE_FRAM_IMAGE_METHOD_IMPORT write one block with CRC16 to FRAM, block with
+ * wrong CRC is rejected by SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE and can be send again.
+ * Blocks can be imported in any order. After import client call
+ * SOME_IP_SERVICE_FRAM_IMAGE_METHOD_VALIDATE which check CRC of all day measurements in FRAM
+ * and return number of valid, damaged and empty ones. First import open import session
+ * which is closed by validation or after WIFI_FRAM_IMAGE_SESSION_MAX_TIME. During session
+ * temperatures are still stored in present day in RAM but aren't written to FRAM, so they
+ * can't be overwritten by imported blocks. Session is shorter than period of temperature
+ * store so at most one write is delayed. Validation also move FRAM index of
+ * next day measurement after the newest valid day measurement so imported history isn't
+ * overwritten. Present day of each recorded source stay in RAM and is stored again under
+ * index of imported day measurement with the same date or under new index. CRC16 of block
+ * is calculated like CRC16Value field of day measurement.
+ *
+ * If WIFI_TELEMETRY_MODE is set then after creation of TCP server clock open UDP link to
+ * collector and send to it notification SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TELEMETRY once
+ * a minute and after each store of 15 minutes temperature in day measurement. Collector
+ * doesn't need to connect to clock or send any request and doesn't answer notifications.
+ *
+ * If WIFI_SERIAL_LINK_MODE is set then ESP8266 isn't used and the same SOME/IP messages are
+ * exchanged with device connected directly to UART of ESP8266(for example PC with USB-UART
+ * converter). Messages are divided by COBS delimiters and are protected by CRC of SOME/IP
+ * extension. Link is treat as one socket which is always connected so connection to APN
+ * isn't performed and services work like with TCP client.
+ */
+
+#include "ESP_Layer.h"
+#include "SOMEIP_Layer.h"
+#include "GUI_Clock.h"
+
+#define TCP_SERVER_PORT_NUMBER			 3000
+#define WIFI_RECEPTION_SOCKET_BUFFERS		1 //free buffers of SocketBufferTable which aren't used for new TX message
+#define WIFI_SEND_DATA_REPETITION			3
+#define WIFI_DISCONNECT_REPETITION			3
+#define WIFI_REQUEST_QUEUE_SIZE				2 //number of requests of one socket waiting for process
+#define WIFI_EVENT_MAX_MINIMUM_INTERVAL		600 //max minimum interval between notifications in seconds
+#define WIFI_RESPONSE_DEFERRED				0xFF //returned by method handler when response is send after FRAM search
+#define WIFI_RESPONSE_COMPLETE				0xFE //returned by method handler which copied whole coded response to TX buffer
+#define WIFI_RANGE_QUERY_MAX_DAYS			31 //max number of days in range of one range query
+#define WIFI_MANIFEST_MAX_DAYS				92 //max number of days in range of one manifest(one quarter of year)
+#define WIFI_RANGE_INDEX_TABLE_DAYS			WIFI_MANIFEST_MAX_DAYS //manifest has the longest range
+#define WIFI_RANGE_QUERY_INDEX_NOT_FOUND	0xFFFF
+#define WIFI_CONNECTION_WATCHDOG_PERIOD		60 //period of AT+CIPSTATUS in seconds, link state is updated by events
+//build options below can be also set by compiler option -D, host tests use it to build other modes
+/* When set as 1 then FRAM image service is available. Import isn't authenticated and allow
+ * any client in network to overwrite history so service is disabled by default. */
+#ifndef WIFI_FRAM_IMAGE_SERVICE
+#define WIFI_FRAM_IMAGE_SERVICE				0
+#endif
+#define WIFI_FRAM_IMAGE_SESSION_MAX_TIME	600 //seconds after first import when session is closed without validation
+#define WIFI_FRAM_IMAGE_BLOCK_SIZE			160 //bytes of FRAM in one message, must be even
+#define WIFI_FRAM_IMAGE_NUMBER_OF_BLOCKS \
+	(((FRAM_MEMORY_SIZE - FRAM_MEASUREMENT_DATA_BEGIN) + WIFI_FRAM_IMAGE_BLOCK_SIZE - 1) / WIFI_FRAM_IMAGE_BLOCK_SIZE)
+/* When set as 1 then clock don't create TCP server but connect to remote device as TCP client
+ * and exchange SOME/IP messages with it in passthrough mode of ESP8266. */
+#ifndef WIFI_PASSTHROUGH_MODE
+#define WIFI_PASSTHROUGH_MODE				0
+#endif
+#define WIFI_PASSTHROUGH_SERVER_IP_ADDRESS	{192, 168, 1, 100}
+#define WIFI_PASSTHROUGH_SERVER_PORT_NUMBER	3000
+/* When set as 1 then clock send temperatures to collector by UDP. Link WIFI_TELEMETRY_LINK_ID
+ * is used by UDP so number of clients of TCP server is lower by one. */
+#ifndef WIFI_TELEMETRY_MODE
+#define WIFI_TELEMETRY_MODE					0
+#endif
+#define WIFI_TELEMETRY_COLLECTOR_IP_ADDRESS	{192, 168, 1, 100}
+#define WIFI_TELEMETRY_COLLECTOR_PORT_NUMBER	3001
+#define WIFI_TELEMETRY_LINK_ID				(MAX_NUMBER_OF_SOCKET - 1)
+/* When set as 1 then clock exchange SOME/IP messages by wired serial link instead of ESP8266.
+ * USART0 interrupt has the highest priority so RX FIFO is read on time also with higher
+ * baudrate than WIFI_HIGH_SPEED_BAUDRATE. */
+#ifndef WIFI_SERIAL_LINK_MODE
+#define WIFI_SERIAL_LINK_MODE				0
+#endif
+#define WIFI_SERIAL_LINK_BAUDRATE		  1000000
+/* baudrate used after initialization of ESP8266. RX FIFO is read by interrupt after 14
+ * bytes so higher value leave too short time for interrupt latency. */
+#define WIFI_HIGH_SPEED_BAUDRATE		   460800
+
+//supported services and methods
+#define SOME_IP_SERVICE_CLOCK_STATUS				1
+#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET 	0
+#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET 	1
+#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE	2
+#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE	3
+#define SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TIME			0x8001
+#define SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TEMPERATURE	0x8002
+#define SOME_IP_SERVICE_CLOCK_STATUS_EVENT_ALARM		0x8003
+#define SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TELEMETRY	0x8010 //send only to collector, can't be subscribed
+#define SOME_IP_SERVICE_DAY_MEASUREMENT				2
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_GET_SEGMENTED	0x40
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_RANGE_QUERY		0x41
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST			0x42
+#define SOME_IP_SERVICE_DAY_SUMMARY					3
+#define SOME_IP_SERVICE_DAY_SUMMARY_METHOD_GET		0
+#define SOME_IP_SERVICE_FRAM_IMAGE					4
+#define SOME_IP_SERVICE_FRAM_IMAGE_METHOD_EXPORT	0
+#define SOME_IP_SERVICE_FRAM_IMAGE_METHOD_IMPORT	1
+#define SOME_IP_SERVICE_FRAM_IMAGE_METHOD_VALIDATE	2
+
+//SOME/IP payload message defines
+#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET_PAYLOAD_SIZE	5
+#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET_PAYLOAD_SIZE	12
+//size of buffer with coded GET response, SOMEIP_CodeTxMessage clear 3 bytes after payload
+#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET_CACHE_SIZE		32
+#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE_PAYLOAD_SIZE		4
+#define SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE_PAYLOAD_SIZE	1
+#define SOME_IP_SERVICE_CLOCK_STATUS_EVENT_MAX_PAYLOAD_SIZE		8
+#define SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TELEMETRY_PAYLOAD_SIZE	(4 + (4 * NUM_OF_TEMPERATURE_SOURCE))
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_REQ_PAYLOAD_SIZE		4
+#define DAY_MEASUREMENT_HEADER_SIZE								4
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE	40
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_NUMBER_OF_PARTS \
+	((sizeof(TemperatureSingleDayRecordType) + SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE - 1) / SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE)
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENTED_REQ_PAYLOAD_SIZE	8
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENT_SIZE			128 //must be multiply of SOME_IP_TP_OFFSET_UNIT
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENTS_PER_DAY \
+	((sizeof(TemperatureSingleDayRecordType) + SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENT_SIZE - 1) / SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENT_SIZE)
+#define SOME_IP_SERVICE_DAY_SUMMARY_RESP_PAYLOAD_SIZE			8
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_REQ_PAYLOAD_SIZE	8
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_RESP_HEADER_SIZE	4
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_SUMMARY_ENTRY_SIZE	12
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_SAMPLES_ENTRY_HEADER_SIZE	6
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_MANIFEST_ENTRY_SIZE		6
+#define SOME_IP_SERVICE_DAY_MEASUREMENT_ENCODED_SAMPLES_ENTRY_HEADER_SIZE	8
+#define SOME_IP_RANGE_QUERY_COMPACT_ENCODING_FLAG	0x80 //set in source mask when client can decode compact samples
+#define SOME_IP_SERVICE_FRAM_IMAGE_EXPORT_REQ_PAYLOAD_SIZE		4
+#define SOME_IP_SERVICE_FRAM_IMAGE_BLOCK_HEADER_SIZE			8
+#define SOME_IP_SERVICE_FRAM_IMAGE_IMPORT_REQ_PAYLOAD_SIZE		(4 + WIFI_FRAM_IMAGE_BLOCK_SIZE)
+#define SOME_IP_SERVICE_FRAM_IMAGE_VALIDATE_RESP_PAYLOAD_SIZE	6
+
+//eventgroups of service SOME_IP_SERVICE_CLOCK_STATUS, event ID of each is 0x8001 + index
+typedef enum WIFI_EVENTGROUP_TYPE
+{
+	WIFI_EVENTGROUP_TIME,
+	WIFI_EVENTGROUP_TEMPERATURE,
+	WIFI_EVENTGROUP_ALARM,
+	WIFI_NUMBER_OF_EVENTGROUPS
+}WIFI_EVENTGROUP;
+
+typedef enum WIFI_STARTUP_PHASES_TYPE
+{
+	WIFI_STARTUP_WAIT,
+	WIFI_SEND_FIRST_REQUEST,
+	WIFI_SEND_RESET,
+	WIFI_RESET_WAIT,
+	WIFI_SEND_ESP_MODE,
+	WIFI_SEND_UART_CONFIGURATION,
+	WIFI_SEND_DETECT_REQUEST,
+	WIFI_DEVICE_DONT_DETECTED
+}WIFI_STARTUP_PHASES;
+
+typedef enum DAY_STRUCTURE_SEARCH_STATUS_TYPE
+{
+	SEARCH_NOT_REQUESTED,
+	SEARCH_REQUESTED,
+	SEARCH_PENDING,
+	SEARCH_PENDING_READ_READY,
+	SEARCH_HEADER_MATCH,
+	SEARCH_FINISHED,
+	SEARCH_RANGE_REQUESTED,
+	SEARCH_RANGE_SCAN,
+	SEARCH_RANGE_NEXT_ENTRY,
+	SEARCH_RANGE_LOAD_REQUESTED,
+	SEARCH_RANGE_LOAD,
+	SEARCH_RANGE_SEND,
+	SEARCH_RANGE_FINISHED,
+	SEARCH_IMAGE_EXPORT_REQUESTED,
+	SEARCH_IMAGE_EXPORT_READ,
+	SEARCH_IMAGE_IMPORT_REQUESTED,
+	SEARCH_IMAGE_IMPORT_WRITE,
+	SEARCH_IMAGE_IMPORT_FINISHED,
+	SEARCH_IMAGE_VALIDATE_REQUESTED,
+	SEARCH_IMAGE_VALIDATE_READ,
+	SEARCH_IMAGE_VALIDATE_FINISHED
+}DAY_STRUCTURE_SEARCH_STATUS;
+
+typedef struct
+{
+	uint8_t minute;
+	uint8_t hour;
+	uint8_t day;
+	uint8_t month;
+	uint8_t year;
+}SomeIpClockStatusSetRequestMethodPayload;
+
+typedef struct
+{
+	uint8_t minute;
+	uint8_t hour;
+	uint8_t day;
+	uint8_t month;
+	uint8_t year;
+	uint8_t reserved;
+	uint16_t temperatureOutside;
+	uint16_t temperatureInside;
+	uint16_t temperatureFurnace;
+}SomeIpClockStatusGetResponseMethodPayload;
+
+typedef struct
+{
+	uint8_t eventgroupMask; //bit set for each subscribed WIFI_EVENTGROUP
+	uint8_t reserved;
+	uint16_t minimumInterval; //minimum time between notifications in seconds
+}SomeIpClockStatusSubscribeRequestMethodPayload;
+
+typedef struct
+{
+	uint8_t minute;
+	uint8_t hour;
+	uint8_t day;
+	uint8_t month;
+	uint8_t year;
+	uint8_t reserved;
+}SomeIpClockStatusTimeEventPayload;
+
+typedef struct
+{
+	uint16_t temperatureOutside;
+	uint16_t temperatureInside;
+	uint16_t temperatureFurnace;
+}SomeIpClockStatusTemperatureEventPayload;
+
+typedef struct
+{
+	uint8_t firstAlarmHour;
+	uint8_t firstAlarmMinute;
+	uint8_t secondAlarmHour;
+	uint8_t secondAlarmMinute;
+	uint8_t alarmFlags; //active and raised flags of first, second and furnace alarm in bits 0-5
+	uint8_t reserved;
+	uint16_t temperatureFurnaceAlarmThreshold;
+}SomeIpClockStatusAlarmEventPayload;
+
+typedef struct
+{
+	uint8_t hour;
+	uint8_t minute;
+	uint8_t reserved[2];
+	uint16_t temperatureTable[NUM_OF_TEMPERATURE_SOURCE]; //present temperature of each source
+	uint16_t aggregateTable[NUM_OF_TEMPERATURE_SOURCE]; //last 15 minutes temperature stored in day measurement
+}SomeIpClockStatusTelemetryEventPayload;
+
+typedef struct
+{
+	uint8_t source;
+	uint8_t day;
+	uint8_t month;
+	uint8_t year;
+}SomeIpDayMeasurmentRequestPayload, DayMeasurementHeader;
+
+typedef struct
+{
+	uint8_t source;
+	uint8_t day; //first day of range
+	uint8_t month;
+	uint8_t year;
+	uint32_t requestedSegmentsMask; //bit 0 correspond to first segment of first day
+}SomeIpDayMeasurmentSegmentedRequestPayload;
+
+typedef struct
+{
+	uint16_t minTemperature;
+	uint16_t maxTemperature;
+	uint16_t averageTemperature;
+	uint16_t numberOfTemperatures;
+}SomeIpDaySummaryResponsePayload;
+
+typedef struct
+{
+	uint8_t sourceMask; //bit set for each requested temperature source and SOME_IP_RANGE_QUERY_COMPACT_ENCODING_FLAG
+	uint8_t firstDay;
+	uint8_t firstMonth;
+	uint8_t firstYear;
+	uint8_t step; //0 - summary of each day, otherwise number of consecutive samples averaged into one, not used by manifest
+	uint8_t lastDay;
+	uint8_t lastMonth;
+	uint8_t lastYear;
+}SomeIpRangeQueryRequestPayload;
+
+typedef struct
+{
+	uint16_t messageIndex; //number of response message in stream
+	uint8_t moreMessages; //cleared in last response message
+	uint8_t numberOfEntries;
+}SomeIpRangeQueryResponseHeader;
+
+typedef struct
+{
+	DayMeasurementHeader header;
+	SomeIpDaySummaryResponsePayload summary;
+}SomeIpRangeQuerySummaryEntry;
+
+typedef struct
+{
+	DayMeasurementHeader header;
+	uint8_t firstSampleIndex; //index of first sample in downsampled day, day can be split between messages
+	uint8_t numberOfSamples;
+	uint16_t temperatureValues[];
+}SomeIpRangeQuerySamplesEntry;
+
+typedef struct
+{
+	DayMeasurementHeader header;
+	uint8_t firstSampleIndex; //index of first sample in downsampled day, day can be split between messages
+	uint8_t numberOfSamples;
+	uint8_t encoding; //TEMPERATURE_ENCODING_RAW or TEMPERATURE_ENCODING_DELTA_VARINT
+	uint8_t dataSize; //number of bytes of samples placed after entry header
+	uint8_t data[];
+}SomeIpRangeQueryEncodedSamplesEntry;
+
+typedef struct
+{
+	DayMeasurementHeader header;
+	uint16_t crc16Value;
+}SomeIpManifestEntry;
+
+typedef struct
+{
+	uint16_t firstBlockIndex;
+	uint16_t numberOfBlocks; //0 mean all blocks until end of FRAM
+}SomeIpFramImageExportRequestPayload;
+
+typedef struct
+{
+	uint16_t blockIndex;
+	uint16_t numberOfBlocks; //number of blocks of whole image
+	uint16_t crc16Value; //CRC16 of data
+	uint8_t moreMessages; //cleared in last message of export
+	uint8_t reserved;
+	uint8_t data[]; //size is calculated from size of payload
+}SomeIpFramImageBlock;
+
+typedef struct
+{
+	uint16_t blockIndex;
+	uint16_t crc16Value; //CRC16 of part of data which belong to block
+	uint8_t data[WIFI_FRAM_IMAGE_BLOCK_SIZE]; //bytes after end of FRAM in last block are ignored
+}SomeIpFramImageImportRequestPayload;
+
+typedef struct
+{
+	uint16_t numberOfValidRecords;
+	uint16_t numberOfDamagedRecords;
+	uint16_t numberOfEmptyRecords; //day measurements with header filled by zeros
+}SomeIpFramImageValidateResponsePayload;
+
+typedef struct
+{
+	SocketMessage* requestTable[WIFI_REQUEST_QUEUE_SIZE]; //requests stay in SocketBufferTable until process
+	uint8_t head;
+	uint8_t size;
+}WifiRequestQueueType;
+
+typedef struct
+{
+	uint8_t eventgroupMask; //subscribed eventgroups, 0 when socket don't have subscription
+	uint8_t pendingEventgroupMask; //eventgroups changed since last notification
+	uint16_t minimumInterval; //in number of WIFI_Process calls
+	uint16_t intervalCounter; //number of WIFI_Process calls since last notification
+}WifiSubscriptionType;
+
+typedef struct
+{
+	uint16_t getApnCounter;
+	uint16_t connectToApnCounter;
+	uint16_t checkConnectionCounter;
+	bool initSocketFlag;
+
+	SocketMessage* sendTxMessage; //buffer of SocketBufferTable which is send by ESP command queue
+	bool sendTxPending; //send sequence of message pointed by sendTxMessage is in ESP command queue
+	uint8_t sendTxErrorCounter;
+
+	uint8_t txSequenceNumber; //TX messages are send in order of this number
+
+	//request data
+	WifiRequestQueueType RequestQueueTable[MAX_NUMBER_OF_SOCKET];
+	uint8_t nextServedSocket; //queue of this socket is checked first during choice of next request
+	//header fields of day measurement request which wait for result of FRAM search
+	uint16_t searchedServiceId;
+	uint16_t searchedMethodId;
+	uint8_t searchedSocketId;
+
+	//temperature per day data
+	DayMeasurementHeader SearchedDayMeasurementHeader;	/* This structure contain content copied from SOME/IP request */
+	DayMeasurementHeader ReadDayMeasurementHeader;	/* Header of day measurement read from FRAM during search */
+	TemperatureSingleDayRecordType *temperatureSingleDayRecordPointer; /* Pointer to day measurement locked in cache(or
+	present day measurement) until response will be send. During search it point to buffer reserved in cache */
+	bool searchedStructureExist;	// Result of search. if match structure will not find in all FRAM then it will be set as false
+	uint8_t searchState;	// This variable hold state used by state machine working on process day measurement request
+	bool readFramWasRequested;
+	uint16_t searchFramIndex;
+
+	//segmented transfer of day measurements
+	bool segmentedTransfer;	// Set when range of days is send as SOME/IP-TP segments
+	uint8_t segmentIndex;	// Index of segment in requested range which will be send
+	uint32_t pendingSegmentMask;	// Bit is set for each segment of range which still must be send
+
+	//range query
+	SomeIpRangeQueryRequestPayload RangeQueryRequest;	// Copy of range query request
+	uint16_t RangeQueryFramIndexTable[WIFI_RANGE_INDEX_TABLE_DAYS][NUM_OF_TEMPERATURE_SOURCE]; /* FRAM index of day
+	measurement of each day and source from range found during read of headers */
+	uint8_t rangeQueryNumberOfDays;
+	uint8_t rangeQueryDayIndex;	// Day of range which is send, its date and source is hold in SearchedDayMeasurementHeader
+	uint8_t rangeQuerySampleIndex;	// Next downsampled sample of day measurement which will be send
+	uint16_t rangeQueryMessageIndex;
+	bool rangeQueryManifest;	// Set when entries contain only CRC of day measurement
+	uint16_t rangeQueryCrc16Value;	// CRC of day measurement send in manifest entry
+	SocketMessage* rangeQueryTxMessage;	/* TX buffer filled by entries or by block of FRAM image, it is hold by
+	WIFI_HoldTxMessage so it isn't used for reception until it will be queued */
+	SomeIpWriter rangeQueryWriter;
+
+	//event notifications
+	WifiSubscriptionType SubscriptionTable[MAX_NUMBER_OF_SOCKET];
+	uint8_t EventPayloadTable[WIFI_NUMBER_OF_EVENTGROUPS][SOME_IP_SERVICE_CLOCK_STATUS_EVENT_MAX_PAYLOAD_SIZE]; /* Last
+	state of ClockState fields of each eventgroup, compared with present state to detect change */
+
+	//FRAM image
+	uint8_t FramImageBlock[WIFI_FRAM_IMAGE_BLOCK_SIZE] __attribute__((aligned(4)));	// Imported block which wait for write to FRAM
+	uint16_t framImageBlockIndex;	// Exported or imported block, during validation index of checked day measurement
+	uint16_t framImageLastBlockIndex;	// Export is finished before this block
+	SomeIpFramImageValidateResponsePayload FramImageValidationResult;
+	DayMeasurementHeader FramImageNewestHeader;	// Header of valid day measurement with the newest date
+	uint16_t framImageNewestIndex;	// Index of above day measurement, NOT_INITIALIZED_FRAM_INDEX_VALUE if it wasn't found
+	uint16_t FramImagePresentDayIndexTable[NUM_OF_TEMPERATURE_SOURCE];	/* Index of valid day measurement with
+	date of present day of each source or NOT_INITIALIZED_FRAM_INDEX_VALUE */
+	bool framImageImportActive;	// Set by first import, cleared by validation - temperatures aren't written to FRAM
+	uint16_t framImageSessionCounter;	// Number of WIFI_Process calls since first import of session
+
+	//cached response of SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET
+	uint8_t ClockStatusResponseCache[SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET_CACHE_SIZE] __attribute__((aligned(4)));
+	uint16_t clockStatusResponseSize;	// Size of coded message, 0 when cache wasn't filled yet
+	uint16_t clockStatusResponseGeneration;	// Value of generation counter when response was coded
+
+	//UDP telemetry
+	bool telemetryLinkReady;	// UDP link to collector was opened
+	bool telemetryPending;	// Notification will be send when TX buffer will be free, set also after store of 15 minutes temperature
+	uint8_t telemetryMinute;	// Minute of last notification
+	uint16_t telemetryLinkCounter;	// Number of WIFI_Process calls since last try of link open
+}WifiStateType;
+
+typedef struct
+{
+	uint16_t serviceId;
+	uint16_t firstMethodId;
+	uint16_t lastMethodId; //descriptor describe range of methods with the same payload
+	uint16_t requestPayloadSize;
+	bool searchInFram; //request wait in queue until previous FRAM search will be finished
+	uint8_t (*handler)(WifiStateType* wifiStateStructure, SocketMessage* request, SomeIpWriter* responseWriter);
+}WifiMethodDescriptorType;
+
+void WIFI_Init(void);
+void WIFI_Process(WifiStateType* wifiStateStructure);
+void WIFI_ClockStatusChanged(void);
+bool WIFI_SelectNextSegment(WifiStateType* wifiStateStructure);
+uint8_t WIFI_GetRangeQueryDayIndex(WifiStateType* wifiStateStructure, DayMeasurementHeader* header);
+bool WIFI_SelectNextRangeQueryEntry(WifiStateType* wifiStateStructure);
+uint16_t WIFI_GetFramImageBlockSize(uint16_t blockIndex);
+SocketMessage* WIFI_GetFreeTxMessage(WifiStateType* wifiStateStructure);
+void WIFI_HoldTxMessage(SocketMessage* txMessage);
+void WIFI_QueueTxMessage(WifiStateType* wifiStateStructure, SocketMessage* txMessage, uint8_t socketId);
+
+#endif /* _WIFI_INTERACTIONLAYER_H_ */
@@ -1,73 +1,86 @@
-#ifndef __UGUI_CONFIG_H
-#define __UGUI_CONFIG_H
-
-#include <stdint.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-
-/* -------------------------------------------------------------------------------- */
-/* -- CONFIG SECTION                                                             -- */
-/* -------------------------------------------------------------------------------- */
-
-//#define USE_MULTITASKING    
-
-/* Enable color mode */
-#define USE_COLOR_RGB888   // RGB = 0xFF,0xFF,0xFF
-//#define USE_COLOR_RGB565   // RGB = 0bRRRRRGGGGGGBBBBB 
-
-/* Enable needed fonts here */
-#define  USE_FONT_4X6
-//#define  USE_FONT_5X8
-//#define  USE_FONT_5X12
-#define  USE_FONT_6X8
-//#define  USE_FONT_6X10
-//#define  USE_FONT_7X12
-#define  USE_FONT_8X8
-//#define  USE_FONT_8X12_CYRILLIC
-#define  USE_FONT_8X12
-//#define  USE_FONT_8X12
-//#define  USE_FONT_8X14
-#define  USE_FONT_10X16
-#define  USE_FONT_12X16
-#define  USE_FONT_12X20
-//#define  USE_FONT_16X26
-//#define  USE_FONT_22X36
-//#define  USE_FONT_24X40
-#define  USE_FONT_32X53
-
-/* Specify platform-dependent integer types here */
-
-#define __UG_FONT_DATA const
-typedef uint8_t      UG_U8;
-typedef int8_t       UG_S8;
-typedef uint16_t     UG_U16;
-typedef int16_t      UG_S16;
-typedef uint32_t     UG_U32;
-typedef int32_t      UG_S32;
-
-
-/* Example for dsPIC33
-typedef unsigned char         UG_U8;
-typedef signed char           UG_S8;
-typedef unsigned int          UG_U16;
-typedef signed int            UG_S16;
-typedef unsigned long int     UG_U32;
-typedef signed long int       UG_S32;
-*/
-
-/* -------------------------------------------------------------------------------- */
-/* -------------------------------------------------------------------------------- */
-
-
-/* Feature enablers */
-#define USE_PRERENDER_EVENT
-#define USE_POSTRENDER_EVENT
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
+#ifndef __UGUI_CONFIG_H
+#define __UGUI_CONFIG_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* -------------------------------------------------------------------------------- */
+/* -- CONFIG SECTION                                                             -- */
+/* -------------------------------------------------------------------------------- */
+
+//#define USE_MULTITASKING    
+
+/* Enable color mode */
+#define USE_COLOR_RGB888   // RGB = 0xFF,0xFF,0xFF
+//#define USE_COLOR_RGB565   // RGB = 0bRRRRRGGGGGGBBBBB 
+
+/* Enable needed fonts here */
+#define  USE_FONT_4X6
+//#define  USE_FONT_5X8
+//#define  USE_FONT_5X12
+#define  USE_FONT_6X8
+//#define  USE_FONT_6X10
+//#define  USE_FONT_7X12
+#define  USE_FONT_8X8
+//#define  USE_FONT_8X12_CYRILLIC
+#define  USE_FONT_8X12
+//#define  USE_FONT_8X12
+//#define  USE_FONT_8X14
+#define  USE_FONT_10X16
+#define  USE_FONT_12X16
+#define  USE_FONT_12X20
+//#define  USE_FONT_16X26
+//#define  USE_FONT_22X36
+//#define  USE_FONT_24X40
+#define  USE_FONT_32X53
+
+/* Specify platform-dependent integer types here */
+
+#define __UG_FONT_DATA const
+typedef uint8_t      UG_U8;
+typedef int8_t       UG_S8;
+typedef uint16_t     UG_U16;
+typedef int16_t      UG_S16;
+typedef uint32_t     UG_U32;
+typedef int32_t      UG_S32;
+
+
+/* Example for dsPIC33
+typedef unsigned char         UG_U8;
+typedef signed char           UG_S8;
+typedef unsigned int          UG_U16;
+typedef signed int            UG_S16;
+typedef unsigned long int     UG_U32;
+typedef signed long int       UG_S32;
+*/
+
+/* -------------------------------------------------------------------------------- */
+/* -------------------------------------------------------------------------------- */
+
+
+/* Feature enablers */
+#define USE_PRERENDER_EVENT
+#define USE_POSTRENDER_EVENT
+
+/* Allow object index of window: coarse touch grid, list of objects which wait for
+   update or event and table of object slots by type and ID. Touch, update and event
+   processing check only indexed objects. Index is attached by UG_WindowSetObjectIndex()
+   to windows with many objects, other windows use linear search. */
+#define USE_OBJECT_INDEX
+#define UG_OBJECT_INDEX_MAX_OBJECTS    64     // max number of objects in window
+#define UG_OBJECT_INDEX_COLUMNS        4      // grid cells cover window area starting from
+#define UG_OBJECT_INDEX_ROWS           4      // top left corner, last cells cover rest of area
+#define UG_OBJECT_INDEX_CELL_WIDTH     80
+#define UG_OBJECT_INDEX_CELL_HEIGHT    60
+#define UG_OBJECT_INDEX_TYPES          4      // object types with direct lookup by type and ID
+#define UG_OBJECT_INDEX_MAX_ID         40     // highest ID with direct lookup
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,136 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "CobsFraming.h"
+
+/*****************************************************************************************
+* CobsFraming_Encode() - code message by COBS and add delimiter at end.
+*
+* Parameters:
+* @data: pointer to coded message.
+* @size: number of bytes of message.
+* @buffer: pointer to buffer where coded message will be stored.
+* @bufferSize: size of buffer, must be at least COBS_FRAMING_MAX_ENCODED_SIZE(size).
+*
+* Return: number of bytes of coded message with delimiter or 0 if buffer is too small.
+*****************************************************************************************/
+uint16_t CobsFraming_Encode(const uint8_t *data, uint16_t size, uint8_t *buffer, uint16_t bufferSize)
+{
+	uint16_t codePosition = 0;
+	uint16_t position = 1;
+	uint8_t code = 1;
+
+	if(bufferSize < COBS_FRAMING_MAX_ENCODED_SIZE((uint32_t)size))
+		return 0;
+
+	for(uint16_t i = 0; i < size; i++)
+	{
+		if(data[i] == 0)
+		{
+			buffer[codePosition] = code;
+			codePosition = position++;
+			code = 1;
+		}
+		else
+		{
+			buffer[position++] = data[i];
+			code++;
+
+			//block is full so next one is started without 0x00 between them
+			if(code == COBS_FRAMING_MAX_BLOCK_CODE)
+			{
+				buffer[codePosition] = code;
+				codePosition = position++;
+				code = 1;
+			}
+		}
+	}
+
+	buffer[codePosition] = code;
+	buffer[position++] = COBS_FRAMING_DELIMITER;
+
+	return position;
+}
+
+/*****************************************************************************************
+* CobsFraming_InitDecoder() - prepare decoder for search of new message. Partial message
+* is forgotten.
+*
+* Parameters:
+* @decoder: pointer to decoder.
+*
+*****************************************************************************************/
+void CobsFraming_InitDecoder(CobsDecoder *decoder)
+{
+	decoder->blockRemaining = 0;
+	decoder->zeroPending = false;
+	decoder->frameStarted = false;
+}
+
+/*****************************************************************************************
+* CobsFraming_DecodeByte() - process one byte of coded stream. Each coded byte give at
+* most one decoded byte so caller can store decoded data directly in receive buffer.
+*
+* Parameters:
+* @decoder: pointer to decoder.
+* @codedByte: byte received from serial link.
+* @decodedByte: pointer to variable where decoded byte will be stored when function
+*  return COBS_DECODE_DATA.
+*
+* Return: COBS_DECODE_RESULT with information about decoded byte or end of message.
+*****************************************************************************************/
+COBS_DECODE_RESULT CobsFraming_DecodeByte(CobsDecoder *decoder, uint8_t codedByte, uint8_t *decodedByte)
+{
+	if(codedByte == COBS_FRAMING_DELIMITER)
+	{
+		bool frameCompleteTmp = (decoder->blockRemaining == 0);
+		bool frameStartedTmp = decoder->frameStarted;
+
+		CobsFraming_InitDecoder(decoder);
+
+		if(frameStartedTmp == false)
+			return COBS_DECODE_NO_DATA;
+
+		return frameCompleteTmp ? COBS_DECODE_FRAME_END : COBS_DECODE_FRAME_ERROR;
+	}
+
+	decoder->frameStarted = true;
+
+	if(decoder->blockRemaining != 0)
+	{
+		decoder->blockRemaining--;
+		*decodedByte = codedByte;
+
+		return COBS_DECODE_DATA;
+	}
+
+	//code byte - 0x00 which ended previous block is decoded now because last block don't have it
+	decoder->blockRemaining = codedByte - 1;
+
+	if(decoder->zeroPending)
+	{
+		decoder->zeroPending = (codedByte != COBS_FRAMING_MAX_BLOCK_CODE);
+		*decodedByte = 0;
+
+		return COBS_DECODE_DATA;
+	}
+
+	decoder->zeroPending = (codedByte != COBS_FRAMING_MAX_BLOCK_CODE);
+
+	return COBS_DECODE_NO_DATA;
+}
@@ -1,1284 +1,2463 @@
-/*
- * Copyright (c) 2018, 2019, Adrian Chemicz
- * All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *    1. Redistributions of source code must retain the above copyright
- *       notice, this list of conditions and the following disclaimer.
- *    2. Redistributions in binary form must reproduce the above copyright
- *       notice, this list of conditions and the following disclaimer in the
- *       documentation and/or other materials provided with the distribution.
- *    3. Neither the name of contributors may be used to endorse or promote products
- *       derived from this software without specific prior written permission.
-
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
- * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
- * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
- * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
- * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-
-#include "ESP_Layer.h"
-#include "UART_Driver.h"
-#include <string.h>
-
-static ESP_Status ESP_DeviceStatus;
-static SocketState SocketStateTable[MAX_NUMBER_OF_SOCKET];
-
-SocketMessage RxMessageTable[MAX_NUMBER_OF_RX_BUFFER];
-ApnStructureType ApnStructure;
-
-/*****************************************************************************************
-* strCatWithSpecialCharacters() - concatenates two strings. s2 string is append on s1
-* string. If s2 string will contain special characters like space or backslash then
-* to s1 string will be added additional backslash character. This format is require by
-* ESP AT commands.
-*
-* Parameters:
-* @s1: destination string
-* @s1: source string which will be append
-*
-*****************************************************************************************/
-static void strCatWithSpecialCharacters(char* s1, char* s2)
-{
-	for(uint16_t i = 0, len = strlen(s1); i < strlen(s2); i++)
-	{
-		if((s2[i] == '\\') || (s2[i] == '"'))
-		{
-			s1[len++] = '\\';
-			s1[len++] = s2[i];
-			s1[len] = '\0';
-		}
-		else
-		{
-			s1[len++] = s2[i];
-			s1[len] = '\0';
-		}
-	}
-}
-
-/*****************************************************************************************
-* ESP_DataSendInit() - function used to initialize ESP layer before copy AT command
-* request to internal buffer. This function is always call from all AT request function.
-*
-* Parameters:
-* @dataSize: size of all AT command request. In few cases must be necessary resize of
-* ESP_DeviceStatus.txSize which is initialize by this parameter. This situation can happen
-* when AT request isn't constant.
-*
-*****************************************************************************************/
-static void ESP_DataSendInit(uint16_t dataSize)
-{
-	ESP_DeviceStatus.deviceStatus = BUSY;
-	memset(&ESP_DeviceStatus.errorCode, 0, sizeof(ERROR_CODE));
-	ESP_DeviceStatus.txSize = dataSize;
-	ESP_DeviceStatus.txProgress = 0;
-	ESP_DeviceStatus.rxSize = 0;
-	ESP_DeviceStatus.timeoutRequestCounter = 0;
-	ESP_DeviceStatus.rxDeviceLock = false;
-	ESP_DeviceStatus.rxLockCounter = 0;
-
-	//init begin of buffer
-	memcpy(ESP_DeviceStatus.txBuffer, "AT+\0", 4);
-}
-
-/*****************************************************************************************
-* ESP_CopyToInternalBuffer() - called from ESP_Process function when complete asynchronous
-* +IPD message(received data) will be completely received. Received data is copied to first
-* free Rx buffer in RxMessageTable.
-*
-* Parameters:
-* @socketNumber: number of socket(link) which is idetifier of opened connection. This
-*  identifier can be used to recognize which device and opened socket send data.
-*  Using function ESP_ReturnLinkInformation is possible to gather more information
-*  about socket.
-* @bufferPointer: pointer to first element of data which will be copied to RX buffer.
-* @bufferSizeOf: size of data which will be copied to RX buffer.
-*
-*****************************************************************************************/
-static void ESP_CopyToInternalBuffer(uint8_t socketNumber, uint8_t* bufferPointer, uint16_t bufferSizeOf)
-{
-	for(int i = 0; i < MAX_NUMBER_OF_RX_BUFFER; i++)
-	{
-		if(RxMessageTable[i].lockFlag == false)
-		{
-			RxMessageTable[i].socketId = socketNumber;
-			RxMessageTable[i].payloadSize = bufferSizeOf;
-			memcpy(RxMessageTable[i].payload, bufferPointer, bufferSizeOf);
-			RxMessageTable[i].lockFlag = true;
-			break;
-		}
-	}
-}
-
-/*****************************************************************************************
-* ESP_DeleteDataFromRxBuffer() - function used to delete part of data from
-* ESP_DeviceStatus.rxBuffer. Data can be present in center of rx buffer then memory will be
-* shifted. Function called from ESP_Process when +IPD message(received data) will be
-* completely received to delete this message from rx buffer.
-*
-* Parameters:
-* @rxPointer: pointer to beggining place in ESP_DeviceStatus.rxBuffer which will be cleared.
-* @size: size of data which will be cleared in ESP_DeviceStatus.rxBuffer.
-*
-*****************************************************************************************/
-static void ESP_DeleteDataFromRxBuffer(uint8_t* rxPointer, uint16_t size)
-{
-	uint32_t positionInsideRxBuffer = (rxPointer + size) - ESP_DeviceStatus.rxBuffer;
-	memmove(rxPointer, (rxPointer + size), ESP_DeviceStatus.rxSize - (positionInsideRxBuffer));
-
-	//add null termination character and decrease rxSize
-	ESP_DeviceStatus.rxSize -= size;
-	ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxSize] = '\0';
-}
-
-/*****************************************************************************************
-* ESP_ParseIpAddress() - convert IP address from string to byte table. Function expect data
-* in as example '"192.168.1.3"' where first character of string is quotation mark(").
-*
-* Parameters:
-* @stringPointer: pointer to string with IP address which will be parsed
-* @ipAddressTable: pointer to table where raw number with IP address will be stored.
-*
-* Return: Return true if string with IP address is in corrected format.
-*****************************************************************************************/
-static bool ESP_ParseIpAddress(uint8_t* stringPointer, uint8_t* ipAddressTable)
-{
-	for(int i = 0; i < IP_ADDRESS_BYTE_LENGTH; i++)
-	{
-		ipAddressTable[i] = atoi(stringPointer + 1);
-		stringPointer++;
-
-		if(i != (IP_ADDRESS_BYTE_LENGTH - 1))
-		{
-			stringPointer = strstr(stringPointer, ".");
-
-			if(stringPointer == NULL)
-			{
-				return false;
-			}
-		}
-	}/* for(int i = 0; i < IP_ADDRESS_BYTE_LENGTH; i++) */
-	return true;
-}
-
-/*****************************************************************************************
-* ESP_ReturnLinkInformation() - return socket activity information assigned to linkId.
-* Those information are that socket is open, IP address of connected device, source and
-* destination port number. Basic information like 'socketIsOpen' flag is updated by
-* ESP_Process function but other fields of SocketState flags will be updated when
-* ESP_GetConnectionStatus function will call and apropriate request process function will
-* be executed without errors.
-*
-* Parameters:
-* @linkId: index used to get information from SocketStateTable.
-*
-* Return: SocketState structure with information that socket(link) is active or if more
-* information is available(flag additionalSocketDataIsAvailable is set) then is possible
-* to get information like IP address of connected device.
-*****************************************************************************************/
-SocketState ESP_ReturnLinkInformation(uint8_t linkId)
-{
-	if(linkId > (MAX_NUMBER_OF_SOCKET - 1))
-	{
-		SocketState socketStateTmp;
-		socketStateTmp.additionalSocketDataIsAvailable = false;
-		socketStateTmp.socketIsOpen = false;
-
-		return socketStateTmp;
-	}
-	else
-	{
-		return SocketStateTable[linkId];
-	}
-}
-
-/*****************************************************************************************
-* ESP_Init() - function initialize ESP layer by configuring basic parameters like baudrate
-* and timeouts. Timeout counters is increment when appropriate condition will be fulfiled
-* and function ESP_Process will be call. When timeout values will be set should be analyze
-* time between call ESP_Process and delay between AT request and AT response. In one test
-* case time between request and response consume almost 10 seconds. Set timeout values as
-* zero will cause that timeout in set functionality will be disabled.
-*
-* Parameters:
-* @portNum: UART port number used by ESP layer.
-* @baudrate: baudrate of UART port used by ESP layer.
-* @timeoutRequestTreshold: value used as wait limit for AT response.
-* @rxLockTreshold: if in RX buffer occur receive event(+IPD:) then device will set as
-*	BUSY. This value decide how long device should be blocked. This treshold prevent by
-*	situation when user start send AT request command during ESP8266 transmision.
-* @rxClearThreshold: number of cycles when RX buffer will be clear. To increment counter
-*	which will compare with this thresholdmust be pass two condition. First condition is
-*	device is on READY state. Second condition data in RX buffer is greater then zero.
-*	If ESP layer is very often used to send request then this threshold cam be set as
-*	zero.
-"
-*****************************************************************************************/
-void ESP_Init(uint8_t portNum, uint32_t baudrate, uint32_t timeoutRequestTreshold, uint16_t rxLockTreshold, uint16_t rxClearThreshold)
-{
-	UART_DriverInit(portNum, baudrate, L8_BIT, ONE_BIT, NONE_PARITY);
-
-	//initialize field inside structure
-	ESP_DeviceStatus.uartPortNumber = portNum;
-	ESP_DeviceStatus.deviceStatus = READY;
-	memset(&ESP_DeviceStatus.errorCode, 0, sizeof(ERROR_CODE));
-	ESP_DeviceStatus.rxLockTreshold = rxLockTreshold;
-	ESP_DeviceStatus.rxLockCounter = 0;
-	ESP_DeviceStatus.timeoutRequestTreshold = timeoutRequestTreshold;
-	ESP_DeviceStatus.timeoutRequestCounter = 0;
-	ESP_DeviceStatus.rxClearThreshold = rxClearThreshold;
-	ESP_DeviceStatus.rxClearCounter = 0;
-	ESP_DeviceStatus.lastRxSizeStatus = 0;
-	ESP_DeviceStatus.txProgress = 0;
-	ESP_DeviceStatus.txSize = 0;
-	ESP_DeviceStatus.rxSize = 0;
-}
-
-/*****************************************************************************************
-* ESP_Process() - function responsible for cyclicaly check data inside UART buffers,
-* process received data from ESP module and copy request to UART TX buffer.
-* This function must be call cyclically inside loop.
-* Function can be also call in interrupt from UART but in this case must be prevented
-* situation when ESP_Process is executed and in UART interrupt this function also will call.
-* Situation like this is low risk but can happen.
-* To prevent it call ESP_Process function like below(only if UART interrupt is used):
-*	UART_DisableInterrupts(ESP_GetUartPortNumber());
-*	ESP_Process();
-*	UART_EnableInterrupts(ESP_GetUartPortNumber());
-*
-* Function during call move data from tx ESP layer buffer to UART register,
-* move data from UART rx register to rx ESP layer buffer, react on event like
-* open link(example data - 0,CONNECT\r\n ), close link(example data - 0,CLOSED\r\n )
-* and receive data(example data - \r\n+IPD,0,10:payloadPay ).
-*
-*****************************************************************************************/
-void ESP_Process(void)
-{
-	UART_Status status = UART_ReturnStatusRegister(ESP_DeviceStatus.uartPortNumber);
-
-	//process TX data when transmit holding register is empty
-	if(status.THRE == 1)
-	{
-		//copy max 16 byte or less if part of request is less
-		for(uint32_t i = 0; i < UART_BUFFER_SIZE && ESP_DeviceStatus.txProgress < ESP_DeviceStatus.txSize; i++)
-		{
-			UART_PutByteToTransmitter(ESP_DeviceStatus.uartPortNumber, 
-				ESP_DeviceStatus.txBuffer[ESP_DeviceStatus.txProgress]);
-
-			ESP_DeviceStatus.txProgress++;
-
-			//clear timeuot counter
-			ESP_DeviceStatus.timeoutRequestCounter = 0;
-		}
-	}
-
-	//check errors flags inside status register
-	if(status.OE == 1)
-		ESP_DeviceStatus.errorCode.UART_OVERRUN = 1;
-
-	if(status.RXFE == 1)
-		ESP_DeviceStatus.errorCode.UART_FRAME_ERROR;
-
-	//process RX data
-	//check availability RX data inside UART buffer
-	for(; status.RDR == 1;)
-	{
-		ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxSize] = UART_ReadByteFromTrasmitter(ESP_DeviceStatus.uartPortNumber);
-		ESP_DeviceStatus.rxSize++;
-
-		//add termination character to end of string
-		ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxSize] = '\0';
-		
-		//refresh status register
-		status = UART_ReturnStatusRegister(ESP_DeviceStatus.uartPortNumber);
-
-		//clear timeuot counters
-		ESP_DeviceStatus.timeoutRequestCounter = 0;
-
-		if(ESP_DeviceStatus.rxDeviceLock == true)
-			ESP_DeviceStatus.rxLockCounter = 0;
-
-		ESP_DeviceStatus.rxClearCounter = 0;
-	}/* for(; status.RDR == 1;) */
-
-	//detect end of frame (search OK<CR><NL> or ERROR<CR><NL> )
-	if(ESP_DeviceStatus.rxSize > MINIMAL_CHECKED_RX_SIZE)
-	{
-		char* occurencePointer = strstr(ESP_DeviceStatus.rxBuffer, "OK\r\n");
-		if(occurencePointer != NULL)
-		{
-			ESP_DeviceStatus.deviceStatus = RESPONSE_RECEIVED;
-			memcpy(occurencePointer, "----", 4);
-		}
-		occurencePointer = strstr(ESP_DeviceStatus.rxBuffer, "ERROR\r\n");
-		if(occurencePointer != NULL)
-		{
-			ESP_DeviceStatus.errorCode.AT_RETURN_ERROR = 1;
-			ESP_DeviceStatus.deviceStatus = RESPONSE_RECEIVED;
-			memcpy(occurencePointer, "-------", 7);
-		}
-	}/* if (ESP_DeviceStatus.rxSize > MINIMAL_CHECKED_RX_SIZE) */
-
-	//search information from ESP module about socket connection state (,CONNECT\r\n and ,CLOSED\r\n)
-	if(ESP_DeviceStatus.rxSize > MINIMAL_CHECKED_RX_SIZE)
-	{
-		uint8_t socketNumber = INVALID_SOCKET_ID;
-
-		uint8_t* occurencePointerConnect = strstr(ESP_DeviceStatus.rxBuffer+1, ",CONNECT\r\n");
-		uint8_t* occurencePointerIpd = strstr(ESP_DeviceStatus.rxBuffer, "+IPD");
-
-		if(occurencePointerConnect != NULL && ((occurencePointerIpd == NULL) || (occurencePointerConnect < occurencePointerIpd)))
-		{
-			socketNumber = atoi(occurencePointerConnect - 1);
-
-			if(socketNumber > (MAX_NUMBER_OF_SOCKET - 1))
-			{
-				SocketStateTable[socketNumber].socketIsOpen = true;
-			}
-
-			//shift memory2
-			ESP_DeleteDataFromRxBuffer((occurencePointerConnect - 1), CONNECT_HEADER_LENGTH);
-		}
-		
-		uint8_t* occurencePointerClosed = strstr(ESP_DeviceStatus.rxBuffer+1, ",CLOSED\r\n");
-
-		if(occurencePointerClosed != NULL && ((occurencePointerIpd == NULL) || (occurencePointerClosed < occurencePointerIpd)))
-		{
-			if(socketNumber > (MAX_NUMBER_OF_SOCKET - 1))
-			{
-				//check that in one rxBuffer don't exist two event(connect and closed)
-				if(socketNumber == atoi(occurencePointerClosed - 1))
-				{
-					//if exist both event the last state is more important
-					if(occurencePointerConnect > occurencePointerClosed)
-					{
-						SocketStateTable[socketNumber].socketIsOpen = true;
-					}
-					else
-					{
-						SocketStateTable[socketNumber].socketIsOpen = false;
-						SocketStateTable[socketNumber].additionalSocketDataIsAvailable = false;
-					}
-				}
-				else//if no only assign state to table
-				{
-					socketNumber = atoi(occurencePointerClosed - 1);
-					SocketStateTable[socketNumber].socketIsOpen = false;
-				}
-			}
-			//shift memory
-			ESP_DeleteDataFromRxBuffer((occurencePointerClosed - 1), CLOSED_HEADER_LENGTH);
-		}/* if(occurencePointerClosed != NULL && ((occurencePointerIpd == NULL) || (occurencePointerClosed < occurencePointerIpd))) */
-	}/* if (ESP_DeviceStatus.rxSize > MINIMAL_CHECKED_RX_SIZE) */
-
-	//detect receive message. Example message +IPD,0,5:abcde
-	if(ESP_DeviceStatus.rxSize > MINIMAL_CHECKED_RX_SIZE)
-	{
-		uint8_t* rxFrameBegining = strstr(ESP_DeviceStatus.rxBuffer, "+IPD,");
-		uint8_t* occurencePointer = rxFrameBegining;
-
-		//check that appriapriate phrase exist and header is complete
-		if((occurencePointer != NULL) && (strstr(rxFrameBegining, ":") != NULL))
-		{
-			uint32_t headerLength = 0;
-			uint16_t numberOfReceivedBytes = atoi(occurencePointer + 7);
-			uint8_t numberOfSocket = atoi(occurencePointer + 5);
-
-			//calculate payload begining of received message
-			occurencePointer = strstr(occurencePointer, ":");
-			headerLength = occurencePointer - rxFrameBegining + 1;
-
-			//check that rxbuffer contain all data which belong to message
-			if((ESP_DeviceStatus.rxSize - ((occurencePointer + 1) - ESP_DeviceStatus.rxBuffer)) >= numberOfReceivedBytes)
-			{
-				//copy data to internal buffer
-				ESP_CopyToInternalBuffer(numberOfSocket, (occurencePointer + 1), numberOfReceivedBytes);
-
-				//shift all data to be sure that this memory area will not interpret as new frame
-				ESP_DeleteDataFromRxBuffer(rxFrameBegining, headerLength + numberOfReceivedBytes);
-
-				if(ESP_DeviceStatus.rxDeviceLock == true)
-				{
-					ESP_DeviceStatus.deviceStatus = READY;
-					ESP_DeviceStatus.rxDeviceLock = false;
-				}
-			}
-			else if(ESP_DeviceStatus.deviceStatus == READY)
-			{
-				ESP_DeviceStatus.deviceStatus = BUSY;
-				ESP_DeviceStatus.rxDeviceLock = true;
-				ESP_DeviceStatus.rxLockCounter = 0;
-			}
-			else if((ESP_DeviceStatus.rxDeviceLock == true) && (ESP_DeviceStatus.rxLockCounter >= ESP_DeviceStatus.rxLockTreshold))
-			{
-				ESP_DeviceStatus.deviceStatus = READY;
-				ESP_DeviceStatus.rxDeviceLock = false;
-				ESP_DeleteDataFromRxBuffer(rxFrameBegining, (ESP_DeviceStatus.rxSize - (rxFrameBegining - ESP_DeviceStatus.rxBuffer)) );
-			}
-		}/* if((occurencePointer != NULL) && (strstr(rxFrameBegining, ":") != NULL)) */
-	}/* if (ESP_DeviceStatus.rxSize > MINIMAL_CHECKED_RX_SIZE) */
-
-	//RX timeout (in READY state if no data will incomming in set duration time then clear RX buffer)
-	if((RX_TIMEOUT_DISABLE != ESP_DeviceStatus.rxClearThreshold)
-		&& (ESP_DeviceStatus.rxSize > 0))
-	{
-		if(ESP_DeviceStatus.rxClearCounter >= ESP_DeviceStatus.rxClearThreshold)
-		{
-			ESP_DeviceStatus.rxSize = 0;
-			ESP_DeviceStatus.rxBuffer[0] = '\0';
-			ESP_DeviceStatus.rxClearCounter = 0;
-		}
-		else if((ESP_DeviceStatus.deviceStatus == READY)
-			&& (ESP_DeviceStatus.rxSize != ESP_DeviceStatus.lastRxSizeStatus))
-		{
-			ESP_DeviceStatus.rxClearCounter = 0;
-		}
-		else
-		{
-			ESP_DeviceStatus.rxClearCounter++;
-		}
-
-		ESP_DeviceStatus.lastRxSizeStatus = ESP_DeviceStatus.rxSize;
-	}/* if(RX_TIMEOUT_DISABLE != ESP_DeviceStatus.rxClearThreshold) */
-
-	//AT request timeout detection
-	if((AT_REQ_TIMEOUT_DISABLE != ESP_DeviceStatus.timeoutRequestTreshold)
-		&& (ESP_DeviceStatus.deviceStatus == BUSY)
-		&& (ESP_DeviceStatus.timeoutRequestCounter >= ESP_DeviceStatus.timeoutRequestTreshold))
-	{
-		ESP_DeviceStatus.errorCode.AT_TIMEOUT = 1;
-		ESP_DeviceStatus.deviceStatus = RESPONSE_RECEIVED;
-		ESP_DeviceStatus.timeoutRequestCounter = 0;
-	}
-
-	//increment timeout counter when request is processed
-	if(ESP_DeviceStatus.deviceStatus == BUSY)
-		ESP_DeviceStatus.timeoutRequestCounter++;
-
-}
-
-/*****************************************************************************************
-* ESP_GetRequestState() - return DEVICE_STATUS enum holding by ESP_DeviceStatus structure.
-* DEVICE_STATUS enum contain information about current processed request. According to
-* this information can be checked when request was finished.
-*
-* Return: DEVICE_STATUS enum holding by ESP_DeviceStatus structure with information
-* about request state.
-*****************************************************************************************/
-DEVICE_STATUS ESP_GetRequestState(void)
-{
-	return ESP_DeviceStatus.deviceStatus;
-}
-
-/*****************************************************************************************
-* ESP_SendDetectDeviceRequest() - copy simple AT command request to ESP layer TX buffer.
-* This AT command don't change any option inside ESP8266 module but can be used to detect
-* module which is used in this function. AT response for this command is constant.
-* Process function:
-*	ESP_ProcessGaneralFormatResponse()
-* Request:
-* 	AT\r\n
-* Response:
-*	AT\r\r\n\r\nOK\r\n
-*
-* Return: true if ESP layer is ready for new AT command request in another case return
-* false.
-*****************************************************************************************/
-bool ESP_SendDetectDeviceRequest(void)
-{
-	if(ESP_DeviceStatus.deviceStatus == READY)
-	{
-		ESP_DataSendInit(4U);
-
-		memcpy(&ESP_DeviceStatus.txBuffer[2], "\r\n", 2);
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_SendResetRequest() - copy reset AT command request to ESP layer TX buffer.
-* Command will cause restart ESP8266 module and module with startup with default settings
-* also settings set by user which is remembered also after reset cause by power and
-* stored in flash memory.
-* After response like below module send two parts of data first with baudrate the same like
-* AT command was send. Second part was send with baudrate like on startup. Observation was
-* performed on module on which baudrate wasn't changed. First part of data was added below:
-*	\r\n ets Jan 8 2013,rst cause:2,boot mode:(3,7)\r\n\r\nload 0x40100000, len 1856, room 16 \r\ntail 0\r\nchksum 0x63\r\nload 0x3ffe8000, len 776, room 8 \r\ntail 0\r\nchksum 0x02\r\nload 0x3ffe8310, len 552, room 8
-*	\r\ntail 0\r\nchksum 0x79\r\ncsum 0x79\r\n\r\n2nd boot version : 1.5\r\n  SPI Speed      : 40MHz\r\n  SPI Mode       : DIO\r\n  SPI Flash Size & Map: 8Mbit(512KB+512KB)\r\njump to run user1 @ 1000\r\n\r\n
-* Time between begining of AT request and last data received from ESP module was measure
-* and is equal 0.262s so wait procederu should be added.
-* Process function:
-*	ESP_ProcessGaneralFormatResponse()
-* Request:
-* 	AT+RST\r\n
-* Response:
-*	AT+RST\r\r\n\r\nOK\r\n
-*
-* Return: true if ESP layer is ready for new AT command request in another case return
-* false.
-*****************************************************************************************/
-bool ESP_SendResetRequest(void)
-{
-	if (ESP_DeviceStatus.deviceStatus == READY)
-	{
-		ESP_DataSendInit(8U);
-
-		strcat(ESP_DeviceStatus.txBuffer, "RST\r\n");
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_ProcessGaneralFormatResponse() - function used to process AT command response if it
-* was received or if AT timeout was set. This type of analyze response can be used to many
-* request which return simple answear.
-*
-* Return: true if device correctly response without any errors.
-*****************************************************************************************/
-bool ESP_ProcessGaneralFormatResponse(void)
-{
-	if(ESP_DeviceStatus.deviceStatus == RESPONSE_RECEIVED)
-		ESP_DeviceStatus.deviceStatus = READY;
-
-	if(*((uint32_t *)&ESP_DeviceStatus.errorCode) > 0)
-		return false;
-	else
-		return true;
-}
-
-/*****************************************************************************************
-* ESP_SendConnectToApnRequest() - initialize ESP layer to send AT command request with
-* parameters necessary to connect to APN. Those data are SSID and password. Before using
-* request appropriate mode should be set via function ESP_SendWifiModeRequest. If mode
-* will be AT_SOFT_AP_MODE then connection failure.
-* This request can be processed very long. During one test time between last bit of AT
-* request and last bit of AT response is equal 7.000s in one test measure.
-* Process function:
-*	ESP_ProcessGaneralFormatResponse()
-* Request:
-*	AT+CWJAP_CUR="TestTest","289384759667"\r\n
-* Response:
-*	AT+CWJAP_CUR="TestTest","289384759667"\r\r\nWIFI CONNECTED\r\nWIFI GOT IP\r\n\r\nOK\r\n
-*
-* Parameters:
-* @ssidName: SSID of chosen APN
-* @password: password to chosen APN
-*
-* Return: true if during AT comunication any errors don't occur like UART errors or AT
-* errors. Errors is hold in ESP_DeviceStatus.errorCode structure.
-*****************************************************************************************/
-bool ESP_SendConnectToApnRequest(const char* ssidName, const char* password)
-{
-	if(ESP_DeviceStatus.deviceStatus == READY)
-	{
-		ESP_DataSendInit(4U);
-
-		strcat(ESP_DeviceStatus.txBuffer, "CWJAP_CUR=\"");
-		strCatWithSpecialCharacters(ESP_DeviceStatus.txBuffer, ssidName);
-		strcat(ESP_DeviceStatus.txBuffer, "\",\"");
-		strCatWithSpecialCharacters(ESP_DeviceStatus.txBuffer, password);
-		strcat(ESP_DeviceStatus.txBuffer, "\"\r\n");
-		ESP_DeviceStatus.txSize = strlen(ESP_DeviceStatus.txBuffer);
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_SendWifiModeRequest() - store in ESP layer TX buffer AT request which will switch
-* mode of ESP8266 module. Supported modes are: AT_STATION_MODE, AT_SOFT_AP_MODE and
-* AT_SOFT_AP_STATION_MODE. Tested ESP-07 module default work in AT_SOFT_AP_MODE mode.
-* Execute some operation in invalide mode can cause error during perform AT command request.
-* Process function:
-*	ESP_ProcessGaneralFormatResponse()
-* Request:
-* 	AT+CWMODE_CUR=1\r\n
-* Response:
-*	AT+CWMODE_CUR=1\r\r\n\r\nOK\r\n
-*
-* Parameters:
-* @wifiMode: this parameter contain selected mode. Possible values and meaning of it is
-*  stored inside ESP_DEVICE_MODE enum.
-*
-* Return: true if ESP layer is ready for new AT command request in another case return
-* false.
-*****************************************************************************************/
-bool ESP_SendWifiModeRequest(uint8_t wifiMode)
-{
-	if(ESP_DeviceStatus.deviceStatus == READY)
-	{
-		ESP_DataSendInit(17U);
-
-		strcat(ESP_DeviceStatus.txBuffer, "CWMODE_CUR=\0");
-
-		if((wifiMode >= AT_STATION_MODE) && (wifiMode <= AT_SOFT_AP_STATION_MODE))
-		{
-			uint8_t modeChar = (uint8_t)('0') + wifiMode;
-			strncat(ESP_DeviceStatus.txBuffer, &modeChar, 1);
-		}
-
-		strcat(ESP_DeviceStatus.txBuffer, "\r\n");
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_SendDisconnectRequest() - if ESPESP8266 module is connected to APN this function
-* can be used to copy AT command request ESP layer TX buffer.
-* Process function:
-*	ESP_ProcessApnListResponse()
-* Request:
-* 	AT+CWQAP\r\n
-* Response:
-* 	AT+CWQAP\r\r\n\r\nOK\r\nWIFI DISCONNECT\r\n
-*
-* Return: true if ESP layer is ready for new AT command request in another case return
-* false.
-*****************************************************************************************/
-bool ESP_SendDisconnectRequest(void)
-{
-	if(ESP_DeviceStatus.deviceStatus == READY)
-	{
-		ESP_DataSendInit(10U);
-
-		strcat(ESP_DeviceStatus.txBuffer, "CWQAP\r\n");
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_SendApnListRequest() - store in ESP layer TX buffer AT request to get access points
-* list. Performing AT command request with receive response can consume 2.14s(value was
-* measure during one test case).
-* Process function:
-*	ESP_ProcessApnListResponse()
-* Request:
-*	AT+CWLAP\r\n
-* Response:
-*	AT+CWLAP\r\r\n+CWLAP:(4,"TestTest",-44,"94:f2:56:cb:80:da",10,-2,0)\r\n+CWLAP:(4,"TestTest2",-90,"da:84:69:d2:42:40",3,-4,0)\r\n\r\nOK\r\n
-*
-* Return: true if ESP layer is ready for new AT command request in another case return
-* false.
-*****************************************************************************************/
-bool ESP_SendApnListRequest(void)
-{
-	if(ESP_DeviceStatus.deviceStatus == READY)
-	{
-		ESP_DataSendInit(10U);
-
-		strcat(ESP_DeviceStatus.txBuffer, "CWLAP\r\n");
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_ProcessApnListResponse() - function used to process AT command response with
-* information about available access points. Obtained information via function is stored
-* inside ApnStructure which is available as global structure.
-*
-* Return: true if during AT comunication any errors don't occur like UART errors or AT
-* errors. Errors is hold in ESP_DeviceStatus.errorCode structure.
-*****************************************************************************************/
-bool ESP_ProcessApnListResponse(void)
-{
-	uint8_t *rxCwlapBufferPointer = ESP_DeviceStatus.rxBuffer;
-	ApnStructure.NumberOfApn = 0;
-
-	//fill structures in AppInformationTable
-	for(uint16_t i = 0; i < MAX_NUMBER_OF_APN; i++)
-	{
-		rxCwlapBufferPointer = strstr(rxCwlapBufferPointer, "+CWLAP:");
-		if(rxCwlapBufferPointer != NULL)
-		{
-			uint8_t* endingCharLocation = 0;
-
-			//fill securityLevel
-			ApnStructure.AppInformationTable[i].securityLevel = rxCwlapBufferPointer[8] - '0';
-
-			//fill ssid
-			endingCharLocation = strstr(&rxCwlapBufferPointer[11], "\",");
-
-			if(endingCharLocation != NULL)
-			{
-				memcpy(ApnStructure.AppInformationTable[i].ssid, &rxCwlapBufferPointer[11],
-						(int)(endingCharLocation - &rxCwlapBufferPointer[11]));
-				//add NULL termination symbol
-				ApnStructure.AppInformationTable[i].ssid[endingCharLocation - &rxCwlapBufferPointer[11]] = '\0';
-			}
-			else
-			{
-				break;
-			}
-
-			//fill signalPower
-			endingCharLocation = strstr(&rxCwlapBufferPointer[11], "\",");
-
-			if(endingCharLocation != NULL)
-			{
-				ApnStructure.AppInformationTable[i].signalPower = atoi(endingCharLocation + 2);
-				rxCwlapBufferPointer = endingCharLocation + 2;
-			}
-			else
-			{
-				break;
-			}
-
-			//fill bssid
-			endingCharLocation = strstr(rxCwlapBufferPointer, ",\"");
-
-			if(endingCharLocation != NULL)
-			{
-				memcpy(ApnStructure.AppInformationTable[i].bssid, endingCharLocation + 2, 17);
-				ApnStructure.AppInformationTable[i].bssid[17] = '\0';
-			}
-			else
-			{
-				break;
-			}
-
-			//increasy counter with APN number
-			ApnStructure.NumberOfApn++;
-		}
-		else/* in this case it mean that no more access point wasn't detected */
-		{
-			break;
-		}
-	}
-
-	if(ESP_DeviceStatus.deviceStatus == RESPONSE_RECEIVED)
-		ESP_DeviceStatus.deviceStatus = READY;
-
-	if(*((uint32_t *)&ESP_DeviceStatus.errorCode) > 0)
-		return false;
-	else
-		return true;
-}
-
-/*****************************************************************************************
-* ESP_GetAssignedIpAddress() - store in ESP layer TX buffer AT request to get
-* IP address assigned to device.
-* Process function:
-*	ESP_ProcessGetAssignedIpResponse()
-* Request:
-*	AT+CIFSR\r\n
-* Response:
-*	AT+CIFSR\r\r\n+CIFSR:STAIP,"192.168.1.3"\r\n+CIFSR:STAMAC,"8C:FC:8F:66:30:6F"\r\n\r\nOK\r\n
-*
-* Return: true if ESP layer is ready for new AT command request in another case return
-* false.
-*****************************************************************************************/
-bool ESP_GetAssignedIpAddress(void)
-{
-	if(ESP_DeviceStatus.deviceStatus == READY)
-	{
-		ESP_DataSendInit(10U);
-
-		strcat(ESP_DeviceStatus.txBuffer, "CIFSR\r\n");
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_ProcessGetAssignedIpResponse() - function used to process AT command response with
-* information about IP address assigned to device. IP address is copied to memory pointed
-* by function parameter(pointerToIpAdressTable).
-*
-* Parameters:
-* @pointerToIpAdressTable: pointer to memory where decoded IP address will be copied.
-*
-* Return: true if during AT comunication any errors don't occur like UART errors or AT
-* errors. Errors is hold in ESP_DeviceStatus.errorCode structure.
-*****************************************************************************************/
-bool ESP_ProcessGetAssignedIpResponse(uint8_t *pointerToIpAdressTable)
-{
-	uint8_t ipAddressTable[IP_ADDRESS_BYTE_LENGTH];
-	uint8_t *rxIpBufferPointer = NULL;
-
-	if(ESP_DeviceStatus.deviceStatus == RESPONSE_RECEIVED)
-		ESP_DeviceStatus.deviceStatus = READY;
-
-	//check errors to don't parse possible incorrect string
-	if(*((uint32_t *)&ESP_DeviceStatus.errorCode) > 0)
-	{
-		return false;
-	}
-
-	rxIpBufferPointer = strstr(ESP_DeviceStatus.rxBuffer, "STAIP");
-
-	if(rxIpBufferPointer == NULL)
-	{
-		rxIpBufferPointer = strstr(ESP_DeviceStatus.rxBuffer, "APIP");
-	}
-
-	if(rxIpBufferPointer != NULL)
-	{
-		//parse IP address
-		rxIpBufferPointer = strstr(rxIpBufferPointer, "\"");
-
-		if(!ESP_ParseIpAddress(rxIpBufferPointer, ipAddressTable))
-		{
-			return false;
-		}
-	}/* if(rxIpBufferPointer != NULL) */
-
-	memcpy(pointerToIpAdressTable, ipAddressTable, 4);
-
-	return true;
-}
-
-/*****************************************************************************************
-* ESP_GetConnectionStatus() - store in ESP layer TX buffer AT request to get connection
-* status. Connection status in this case mean that ESP module is connected via WiFi to
-* other device or not. Execution of this AT command request also cause that in response
-* can be added information about links(connections to sockets) if links will established.
-* This mean that SocketStateTable will be updated.
-* Process function:
-*	ESP_ProcessConnectionStatus()
-* Request:
-*	AT+CIPSTATUS\r\n
-* Response:
-*	AT+CIPSTATUS\r\r\nSTATUS:2\r\n\r\nOK\r\n
-*	AT+CIPSTATUS\r\r\nSTATUS:3\r\n+CIPSTATUS:0,"TCP","192.168.1.3",51171,3000,1\r\n\r\nOK\r\n
-*
-* Return: true if ESP layer is ready for new AT command request in another case return
-* false.
-*****************************************************************************************/
-bool ESP_GetConnectionStatus(void)
-{
-	if(ESP_DeviceStatus.deviceStatus == READY)
-	{
-		ESP_DataSendInit(14U);
-
-		strcat(ESP_DeviceStatus.txBuffer, "CIPSTATUS\r\n");
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_ProcessConnectionStatus() - function used to process AT command response with
-* information about connection status. If returned status as AT response will be equal
-* 5(station not connected to access point) then to variable pointed by flagPointer(function
-* input parameter) will be copied false, otherwise will be copied true. If returned status
-* as AT response will be equal 3 (station created TCP or UPD trasmnission) then link
-* information in SocketStateTable will be updated.
-*
-* Parameters:
-* @flagPointer: pointer to flag which will be store connection status. True mean that
-*  device is connected via WiFi to other device.
-*
-* Return: true if during AT comunication any errors don't occur like UART errors or AT
-* errors. Errors is hold in ESP_DeviceStatus.errorCode structure.
-*****************************************************************************************/
-bool ESP_ProcessConnectionStatus(bool *flagPointer)
-{
-	uint8_t *rxStatusBufferPointer = NULL;
-	volatile uint8_t linkStatus = 0;
-
-	if(ESP_DeviceStatus.deviceStatus == RESPONSE_RECEIVED)
-		ESP_DeviceStatus.deviceStatus = READY;
-
-	//check errors to don't parse possible incorrect string
-	if(*((uint32_t *)&ESP_DeviceStatus.errorCode) > 0)
-	{
-		return false;
-	}
-
-	rxStatusBufferPointer = strstr(ESP_DeviceStatus.rxBuffer, "STATUS:");
-
-	if(rxStatusBufferPointer != NULL)
-	{
-		linkStatus = rxStatusBufferPointer[7] - (uint8_t)'0';
-
-		if(linkStatus == STATUS_STATION_NOT_CONNECTED_TO_APN)
-		{
-			*flagPointer = false;
-		}
-		else
-		{
-			*flagPointer = true;
-		}
-
-		//clear
-		for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
-		{
-			SocketStateTable[i].socketIsOpen = false;
-			SocketStateTable[i].additionalSocketDataIsAvailable = false;
-		}
-
-		if(linkStatus == STATUS_STATION_CREATED_TCP_OR_UDP_TRANSMISSION)
-		{
-			for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
-			{
-				rxStatusBufferPointer = strstr(rxStatusBufferPointer, "CIPSTATUS:");
-
-				//pass this condition mean that entries with information about socket exist
-				if(rxStatusBufferPointer != NULL)
-				{
-					uint8_t socketId = rxStatusBufferPointer[10] - (uint8_t)'0';
-
-					rxStatusBufferPointer = &rxStatusBufferPointer[13];
-
-					if(socketId > (MAX_NUMBER_OF_SOCKET - 1))
-						break;
-
-					//parse protocol type
-					if(rxStatusBufferPointer[0] == 'T')
-					{
-						SocketStateTable[socketId].connectionType = TCP_CONNECTION_TYPE;
-					}
-					else if(rxStatusBufferPointer[0] == 'U')
-					{
-						SocketStateTable[socketId].connectionType = UDP_CONNECTION_TYPE;
-					}
-					else
-					{
-						break;
-					}
-
-					//parse IP address
-					rxStatusBufferPointer = strstr(rxStatusBufferPointer, ",\"");
-
-					if(rxStatusBufferPointer != NULL)
-					{
-						rxStatusBufferPointer++;
-
-						if(!ESP_ParseIpAddress(rxStatusBufferPointer, SocketStateTable[socketId].remoteIpAddress))
-						{
-							break;
-						}
-
-					}/* if(rxIpBufferPointer != NULL) */
-					else
-					{
-						break;
-					}
-
-					//parse remote port
-					rxStatusBufferPointer = strstr(rxStatusBufferPointer, "\",");
-
-					if(rxStatusBufferPointer != NULL)
-					{
-						SocketStateTable[socketId].remotePort = atoi(rxStatusBufferPointer + 2);
-						rxStatusBufferPointer += 2;
-					}
-					else
-					{
-						break;
-					}
-
-					//parse local port
-					rxStatusBufferPointer = strstr(rxStatusBufferPointer, ",");
-
-					if(rxStatusBufferPointer != NULL)
-					{
-						SocketStateTable[socketId].localPort = atoi(rxStatusBufferPointer + 1);
-						rxStatusBufferPointer++;
-					}
-					else
-					{
-						break;
-					}
-
-					//parse tcp client or server
-					rxStatusBufferPointer = strstr(rxStatusBufferPointer, ",");
-
-					if(rxStatusBufferPointer != NULL)
-					{
-						uint8_t tcpConnectionTypeTmp = atoi(rxStatusBufferPointer + 1);
-						if(tcpConnectionTypeTmp == 0)
-							SocketStateTable[socketId].tcpConnectionRunAsServer = false;
-						else if(tcpConnectionTypeTmp == 1)
-							SocketStateTable[socketId].tcpConnectionRunAsServer = true;
-						else
-							break;
-
-					}
-					else
-					{
-						break;
-					}
-
-					//mark that all data are correct
-					SocketStateTable[i].socketIsOpen = true;
-					SocketStateTable[i].additionalSocketDataIsAvailable = true;
-				}/* if(rxStatusBufferPointer != NULL) */
-				else
-				{
-					break;
-				}
-			}/* for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++) */
-		}/* if(linkStatus == STATUS_STATION_CREATED_TCP_OR_UDP_TRANSMISSION) */
-	}/* if(rxStatusBufferPointer != NULL) */
-
-	return true;
-}
-
-/*****************************************************************************************
-* ESP_SendAcceptMultipleConnectionRequest() - store in ESP layer TX buffer AT request to
-* allow multiply connection to TCP server. Call this command is require for other function
-* because only multiply connection is supported.
-* Process function:
-*	ESP_ProcessGaneralFormatResponse()
-* Request:
-*	AT+CIPMUX=1\r\n
-* Response:
-*	AT+CIPMUX=1\r\r\n\r\nOK\r\n
-*
-* Return: true if ESP layer is ready for new AT command request in another case return
-* false.
-*****************************************************************************************/
-bool ESP_SendAcceptMultipleConnectionRequest(void)
-{
-	if(ESP_DeviceStatus.deviceStatus == READY)
-	{
-		ESP_DataSendInit(13U);
-
-		strcat(ESP_DeviceStatus.txBuffer, "CIPMUX=1\r\n");
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_SendServerCommandRequest() - store in ESP layer TX buffer AT request to create or
-* close TCP server. Function contain two parameters one to decide about close or open,
-* second parameter decide about port number of server.
-* Process function:
-*	ESP_ProcessGaneralFormatResponse()
-* Request:
-*	AT+CIPSERVER=1,3000\r\n
-* Response:
-*	AT+CIPSERVER=1,3000\r\r\n\r\nOK\r\n
-*
-* Parameters:
-* @serverStatus: flag which decide about action regarding to server. True mean that server
-*  will be created. False meam that server will be closed.
-* @portNumber: port number of created/closed server.
-*
-* Return: true if ESP layer is ready for new AT command request in another case return
-* false.
-*****************************************************************************************/
-bool ESP_SendServerCommandRequest(bool serverStatus, uint16_t portNumber)
-{
-	if(ESP_DeviceStatus.deviceStatus == READY)
-	{
-		char portNumberTmp[8];
-		memset(portNumberTmp, 0, sizeof(portNumberTmp));
-
-		ESP_DataSendInit(0U);
-
-		strcat(ESP_DeviceStatus.txBuffer, "CIPSERVER=");
-		
-		if(serverStatus)
-			strcat(ESP_DeviceStatus.txBuffer, "1,");
-		else
-			strcat(ESP_DeviceStatus.txBuffer, "0,");
-			
-		strcat(ESP_DeviceStatus.txBuffer, itoa(portNumber, portNumberTmp, 10U));
-
-		strcat(ESP_DeviceStatus.txBuffer, "\r\n");
-
-		ESP_DeviceStatus.txSize = strlen(ESP_DeviceStatus.txBuffer);
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_SendWriteDataRequest() - store in ESP layer TX buffer AT request to send number of
-* bytes to selected link ID(socketNumber). This function is one of two part send data
-* process. To send data via socket is necessary use this function and in next if AT response
-* will be OK then use ESP_Write function.
-* Process function:
-*	ESP_ProcessGaneralFormatResponse()
-* Request:
-*	AT+CIPSEND=0,18\r\n
-* Response:
-* 	"AT+CIPSEND=0,18\r\r\n\r\nOK\r\n> "
-*
-* Parameters:
-* @socketNumber: value of link ID to which will be send data.
-* @writeBufferSizeOf: number of bytes send to selected socketNumber(link ID).
-*
-* Return: true if ESP layer is ready for new AT command request in another case return
-* false.
-*****************************************************************************************/
-bool ESP_SendWriteDataRequest(uint8_t socketNumber, uint16_t writeBufferSizeOf)
-{
-	//execute when device is ready and socket is open
-	if(ESP_DeviceStatus.deviceStatus == READY && SocketStateTable[socketNumber].socketIsOpen == true)
-	{
-		char stringTmp[8];
-		memset(stringTmp, 0, sizeof(stringTmp));
-
-		ESP_DataSendInit(0U);
-
-		strcat(ESP_DeviceStatus.txBuffer, "CIPSEND=");
-		
-		strcat(ESP_DeviceStatus.txBuffer, itoa(socketNumber, stringTmp, 10U));
-
-		strcat(ESP_DeviceStatus.txBuffer, ",");
-
-		strcat(ESP_DeviceStatus.txBuffer, itoa(writeBufferSizeOf, stringTmp, 10U));
-		
-		strcat(ESP_DeviceStatus.txBuffer, "\r\n");
-
-		ESP_DeviceStatus.txSize = strlen(ESP_DeviceStatus.txBuffer);
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy or socket is closed so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_Write() - store in ESP layer TX buffer raw data which will be send to previously
-* selected link ID. This function is one of two part send data process. First part is
-* ESP_SendWriteDataRequest. This function is second part of send process.
-* Process function:
-*	ESP_ProcessGaneralFormatResponse()
-* Request:
-*	Example raw data: '0','1','0','0','0','0','0',\n,'0','0','0','0','1','1','128','0',\,'142'
-* Response:
-*	\r\nRecv 18 bytes\r\n\r\nSEND OK\r\n
-*
-* Parameters:
-* @bufferPointer: pointer to buffer which hold data for transmission.
-* @bufferSizeOf: number of data which must be copied from selected memory.
-*
-* Return: true if ESP layer is ready for new AT command request in another case return
-* false.
-*****************************************************************************************/
-bool ESP_Write(uint8_t* bufferPointer, uint16_t bufferSizeOf)
-{
-	//execute when device is ready and socket is open
-	if(ESP_DeviceStatus.deviceStatus == READY)
-	{
-		ESP_DataSendInit(bufferSizeOf);
-		memcpy(ESP_DeviceStatus.txBuffer, bufferPointer, bufferSizeOf);
-
-		//command will be executed when function ESP_Process() will call
-		return true;
-	}
-	else
-	{
-		//device is busy or socket is closed so AT command cannot be executed
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* ESP_ClearRxBuffer() - clear RX data and status register inside physical UART port used
-* by ESP layer.
-*
-*****************************************************************************************/
-void ESP_ClearRxBuffer(void)
-{
-	UART_Status status = UART_ReturnStatusRegister(ESP_DeviceStatus.uartPortNumber);
-
-	//clear UART RX buffer
-	for(uint8_t rxDataTmp = 0; status.RDR == 1;)
-	{
-		rxDataTmp = UART_ReadByteFromTrasmitter(ESP_DeviceStatus.uartPortNumber);
-		status = UART_ReturnStatusRegister(ESP_DeviceStatus.uartPortNumber);
-	}
-}
-
-/*****************************************************************************************
-* ESP_GetUartPortNumber() - function return UART port number used by ESP layer. The same port
-* number was set during call initialization function(ESP_Init()).
-*
-* Return: UART port number used by ESP layer.
-*****************************************************************************************/
-uint8_t ESP_GetUartPortNumber(void)
-{
-	return ESP_DeviceStatus.uartPortNumber;
-}
-
-/*****************************************************************************************
-* USART0_IRQHandler() - function call if interruption on UART port occur. If code inside
-* this file will be move to other microntroller this function must be changed or removed.
-*
-*****************************************************************************************/
-void USART0_IRQHandler(void)
-{
-	ESP_Process();
-}
+/*
+ * Copyright (c) 2018, 2019, Adrian Chemicz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ESP_Layer.h"
+#include "UART_Driver.h"
+#include <string.h>
+
+static ESP_Status ESP_DeviceStatus;
+static volatile ESP_RxStatistics ESP_RxStatistic;
+static SocketState SocketStateTable[MAX_NUMBER_OF_SOCKET];
+
+SocketMessage SocketBufferTable[MAX_NUMBER_OF_SOCKET_BUFFER];
+ApnStructureType ApnStructure;
+
+/*****************************************************************************************
+* strCatWithSpecialCharacters() - concatenates two strings. s2 string is append on s1
+* string. If s2 string will contain special characters like space or backslash then
+* to s1 string will be added additional backslash character. This format is require by
+* ESP AT commands.
+*
+* Parameters:
+* @s1: destination string
+* @s1: source string which will be append
+*
+*****************************************************************************************/
+static void strCatWithSpecialCharacters(char* s1, char* s2)
+{
+	for(uint16_t i = 0, len = strlen(s1); i < strlen(s2); i++)
+	{
+		if((s2[i] == '\\') || (s2[i] == '"'))
+		{
+			s1[len++] = '\\';
+			s1[len++] = s2[i];
+			s1[len] = '\0';
+		}
+		else
+		{
+			s1[len++] = s2[i];
+			s1[len] = '\0';
+		}
+	}
+}
+
+/*****************************************************************************************
+* ESP_DataSendInit() - function used to initialize ESP layer before copy AT command
+* request to internal buffer. This function is always call from all AT request function.
+*
+* Parameters:
+* @dataSize: size of all AT command request. In few cases must be necessary resize of
+* ESP_DeviceStatus.txSize which is initialize by this parameter. This situation can happen
+* when AT request isn't constant.
+*
+*****************************************************************************************/
+static void ESP_DataSendInit(uint16_t dataSize)
+{
+	ESP_DeviceStatus.deviceStatus = BUSY;
+	memset(&ESP_DeviceStatus.errorCode, 0, sizeof(ERROR_CODE));
+	ESP_DeviceStatus.txSize = dataSize;
+	ESP_DeviceStatus.txProgress = 0;
+	ESP_DeviceStatus.txDataPointer = ESP_DeviceStatus.txBuffer;
+	ESP_DeviceStatus.timeoutRequestCounter = 0;
+	ESP_DeviceStatus.rxDeviceLock = false;
+	ESP_DeviceStatus.rxLockCounter = 0;
+
+	//clear response of previous request but keep unfinished line(it can be begin of event)
+	ESP_DeviceStatus.rxSize -= ESP_DeviceStatus.rxLineBegin;
+	memmove(ESP_DeviceStatus.rxBuffer, &ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxLineBegin], ESP_DeviceStatus.rxSize);
+	ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxSize] = '\0';
+	ESP_DeviceStatus.rxLineBegin = 0;
+
+	//init begin of buffer
+	memcpy(ESP_DeviceStatus.txBuffer, "AT+\0", 4);
+}
+
+/*****************************************************************************************
+* ESP_ResetFramer() - drop partial message of socket and start search of new message
+* header. Buffer in SocketBufferTable used by partial message is released.
+*
+* Parameters:
+* @socketId: number of socket.
+*
+*****************************************************************************************/
+static void ESP_ResetFramer(uint8_t socketId)
+{
+	ESP_StreamFramer* framer = &ESP_DeviceStatus.framerTable[socketId];
+
+	if(framer->message != NULL)
+		framer->message->receptionFlag = false;
+
+	framer->message = NULL;
+	framer->messageRejected = false;
+	framer->headerSize = 0;
+	framer->messageRemaining = 0;
+	framer->synchronizationLost = false;
+	framer->idleCounter = 0;
+}
+
+/*****************************************************************************************
+* ESP_ReserveRxMessage() - find free buffer in SocketBufferTable and mark it as filled by ESP
+* layer.
+*
+* Parameters:
+* @socketId: number of socket which send message.
+*
+* Return: pointer to buffer or NULL if all buffers are used.
+*****************************************************************************************/
+static SocketMessage* ESP_ReserveRxMessage(uint8_t socketId)
+{
+	for(int i = 0; i < MAX_NUMBER_OF_SOCKET_BUFFER; i++)
+	{
+		if((SocketBufferTable[i].lockFlag == false) && (SocketBufferTable[i].receptionFlag == false))
+		{
+			SocketBufferTable[i].receptionFlag = true;
+			SocketBufferTable[i].acceptedFlag = false;
+			SocketBufferTable[i].transmitFlag = false;
+			SocketBufferTable[i].socketId = socketId;
+			SocketBufferTable[i].payloadSize = 0;
+
+			return &SocketBufferTable[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************************
+* ESP_ParseFrameByte() - process one byte of data received from socket. First
+* ESP_FRAME_HEADER_SIZE bytes of message are collected to read length field, then whole
+* message is copied to first free buffer in SocketBufferTable. If all buffers are used or
+* message is too long then message is dropped. Header of message dropped because all
+* buffers were used is added to queue of dropped messages when whole message will be
+* received, so user can answer it. If length field is malformed then stream
+* can't be divided into messages so next bytes are dropped until framer will be reset.
+*
+* Parameters:
+* @socketId: number of socket which send data.
+* @rxByte: byte taken from RX ring.
+*
+*****************************************************************************************/
+static void ESP_ParseFrameByte(uint8_t socketId, uint8_t rxByte)
+{
+	ESP_StreamFramer* framer = &ESP_DeviceStatus.framerTable[socketId];
+
+	framer->idleCounter = 0;
+
+	if(framer->synchronizationLost)
+		return;
+
+	if(framer->messageRemaining == 0)
+	{
+		uint8_t* lengthPointer = &framer->header[ESP_FRAME_LENGTH_FIELD_BEGIN];
+		uint32_t messageLength;
+
+		framer->header[framer->headerSize] = rxByte;
+		framer->headerSize++;
+
+		if(framer->headerSize < ESP_FRAME_HEADER_SIZE)
+			return;
+
+		framer->headerSize = 0;
+		messageLength = ((uint32_t)lengthPointer[0] << 24U) | ((uint32_t)lengthPointer[1] << 16U)
+			| ((uint32_t)lengthPointer[2] << 8U) | (uint32_t)lengthPointer[3];
+
+		if((messageLength < ESP_FRAME_MIN_LENGTH) || (messageLength > UINT16_MAX))
+		{
+			ESP_DeviceStatus.errorCode.RX_FRAME_ERROR = 1;
+			framer->synchronizationLost = true;
+
+			return;
+		}
+
+		framer->message = NULL;
+		framer->messageRejected = false;
+
+		if(messageLength <= (MAX_SIZE_OF_SOCKET_BUFFER - ESP_FRAME_HEADER_SIZE))
+		{
+			framer->message = ESP_ReserveRxMessage(socketId);
+
+			if(framer->message != NULL)
+			{
+				memcpy(framer->message->payload, framer->header, ESP_FRAME_HEADER_SIZE);
+				framer->message->payloadSize = ESP_FRAME_HEADER_SIZE;
+			}
+			else
+			{
+				framer->messageRejected = true;
+			}
+		}
+		else
+		{
+			ESP_DeviceStatus.errorCode.RX_FRAME_ERROR = 1;
+		}
+
+		framer->messageRemaining = messageLength;
+
+		return;
+	}
+
+	if(framer->message != NULL)
+	{
+		framer->message->payload[framer->message->payloadSize] = rxByte;
+		framer->message->payloadSize++;
+	}
+
+	framer->messageRemaining--;
+
+	if(framer->messageRemaining == 0)
+	{
+		if(framer->message != NULL)
+		{
+			framer->message->sequenceNumber = ESP_DeviceStatus.rxMessageSequenceNumber++;
+			framer->message->receptionFlag = false;
+			framer->message->lockFlag = true;
+		}
+		else if(framer->messageRejected)
+		{
+			//header stay in framer until next message so it can be copied now
+			if(ESP_DeviceStatus.droppedMessageCount < ESP_DROPPED_MESSAGE_QUEUE_SIZE)
+			{
+				ESP_DroppedMessage* droppedMessage = &ESP_DeviceStatus.droppedMessageQueue[
+					(ESP_DeviceStatus.droppedMessageHead + ESP_DeviceStatus.droppedMessageCount) % ESP_DROPPED_MESSAGE_QUEUE_SIZE];
+
+				droppedMessage->socketId = socketId;
+				memcpy(droppedMessage->header, framer->header, ESP_FRAME_HEADER_SIZE);
+				ESP_DeviceStatus.droppedMessageCount++;
+			}
+			else
+			{
+				ESP_DeviceStatus.errorCode.RX_FRAME_ERROR = 1;
+			}
+		}
+
+		framer->message = NULL;
+		framer->messageRejected = false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_ResetSerialLinkFrame() - drop partial message received by serial link and wait for
+* next delimiter. Buffer in SocketBufferTable used by partial message is released.
+*****************************************************************************************/
+static void ESP_ResetSerialLinkFrame(void)
+{
+	if(ESP_DeviceStatus.serialLinkMessage != NULL)
+		ESP_DeviceStatus.serialLinkMessage->receptionFlag = false;
+
+	ESP_DeviceStatus.serialLinkMessage = NULL;
+	ESP_DeviceStatus.serialLinkMessageDropped = false;
+	ESP_DeviceStatus.serialLinkIdleCounter = 0;
+	CobsFraming_InitDecoder(&ESP_DeviceStatus.serialLinkDecoder);
+}
+
+/*****************************************************************************************
+* ESP_ParseSerialLinkByte() - process one byte received in serial link mode. Byte is
+* decoded by COBS and decoded data is copied to buffer in SocketBufferTable reserved on first
+* byte of message. Message is passed to user when delimiter is received. If all buffers
+* are used, message is too long or coding is broken then message is dropped.
+*
+* Parameters:
+* @rxByte: byte taken from RX ring.
+*
+*****************************************************************************************/
+static void ESP_ParseSerialLinkByte(uint8_t rxByte)
+{
+	SocketMessage* message = ESP_DeviceStatus.serialLinkMessage;
+	uint8_t decodedByte = 0;
+
+	ESP_DeviceStatus.serialLinkIdleCounter = 0;
+
+	switch(CobsFraming_DecodeByte(&ESP_DeviceStatus.serialLinkDecoder, rxByte, &decodedByte))
+	{
+	case COBS_DECODE_NO_DATA:
+		break;
+
+	case COBS_DECODE_DATA:
+		if(ESP_DeviceStatus.serialLinkMessageDropped)
+			break;
+
+		if(message == NULL)
+		{
+			message = ESP_ReserveRxMessage(ESP_SERIAL_LINK_SOCKET_ID);
+			ESP_DeviceStatus.serialLinkMessage = message;
+		}
+
+		if((message == NULL) || (message->payloadSize >= MAX_SIZE_OF_SOCKET_BUFFER))
+		{
+			ESP_DeviceStatus.errorCode.RX_FRAME_ERROR = 1;
+			ESP_DeviceStatus.serialLinkMessageDropped = true;
+			break;
+		}
+
+		message->payload[message->payloadSize] = decodedByte;
+		message->payloadSize++;
+		break;
+
+	case COBS_DECODE_FRAME_END:
+		//message without data isn't passed to user
+		if((message != NULL) && (ESP_DeviceStatus.serialLinkMessageDropped == false))
+		{
+			message->sequenceNumber = ESP_DeviceStatus.rxMessageSequenceNumber++;
+			message->receptionFlag = false;
+			message->lockFlag = true;
+			ESP_DeviceStatus.serialLinkMessage = NULL;
+		}
+
+		ESP_ResetSerialLinkFrame();
+		break;
+
+	case COBS_DECODE_FRAME_ERROR:
+		ESP_DeviceStatus.errorCode.RX_FRAME_ERROR = 1;
+		ESP_ResetSerialLinkFrame();
+		break;
+	}
+}
+
+/*****************************************************************************************
+* ESP_FinishRxPayload() - called when all bytes of +IPD message(received data) was parsed
+* or when receive of message was interrupted. Message which isn't complete at end of
+* payload wait for rest of data in next +IPD message. If receive of payload was interrupted
+* then partial message is dropped. If device was locked during receive of message then
+* lock is released.
+*
+* Parameters:
+* @complete: true if all bytes of payload was received.
+*
+*****************************************************************************************/
+static void ESP_FinishRxPayload(bool complete)
+{
+	if((complete == false) && (ESP_DeviceStatus.rxPayloadSocketId != INVALID_SOCKET_ID))
+	{
+		ESP_ResetFramer(ESP_DeviceStatus.rxPayloadSocketId);
+	}
+
+	ESP_DeviceStatus.rxPayloadSocketId = INVALID_SOCKET_ID;
+	ESP_DeviceStatus.rxPayloadRemaining = 0;
+	ESP_DeviceStatus.rxParserState = ESP_RX_STATE_LINE;
+
+	if(ESP_DeviceStatus.rxDeviceLock == true)
+	{
+		ESP_DeviceStatus.deviceStatus = READY;
+		ESP_DeviceStatus.rxDeviceLock = false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_StartRxPayload() - called when complete header of +IPD message(example header -
+* +IPD,0,5:) was received. Header is removed from RX buffer and parser is switched to
+* payload state where next bytes are passed to framer of socket. Framer which lost
+* synchronization is reset because new TCP packet is expected to begin with new message.
+*
+*****************************************************************************************/
+static void ESP_StartRxPayload(void)
+{
+	uint8_t* headerPointer = &ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxLineBegin];
+	uint8_t* lengthPointer = strchr(headerPointer + IPD_HEADER_LENGTH, ',');
+	uint8_t socketNumber = atoi(headerPointer + IPD_HEADER_LENGTH);
+	uint16_t numberOfReceivedBytes = 0;
+
+	if(lengthPointer != NULL)
+	{
+		numberOfReceivedBytes = atoi(lengthPointer + 1);
+	}
+
+	//remove header from RX buffer
+	ESP_DeviceStatus.rxSize = ESP_DeviceStatus.rxLineBegin;
+	ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxSize] = '\0';
+
+	if(numberOfReceivedBytes == 0)
+		return;
+
+	ESP_DeviceStatus.rxPayloadSocketId = INVALID_SOCKET_ID;
+
+	if(socketNumber < MAX_NUMBER_OF_SOCKET)
+	{
+		ESP_DeviceStatus.rxPayloadSocketId = socketNumber;
+
+		if(ESP_DeviceStatus.framerTable[socketNumber].synchronizationLost)
+			ESP_ResetFramer(socketNumber);
+	}
+
+	ESP_DeviceStatus.rxPayloadRemaining = numberOfReceivedBytes;
+	ESP_DeviceStatus.rxParserState = ESP_RX_STATE_PAYLOAD;
+
+	//prevent send of new AT request during receive of message
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DeviceStatus.deviceStatus = BUSY;
+		ESP_DeviceStatus.rxDeviceLock = true;
+		ESP_DeviceStatus.rxLockCounter = 0;
+	}
+}
+
+/*****************************************************************************************
+* ESP_ProcessRxLine() - called when complete line(ended by <LF>) was received. Line with
+* result of AT request(OK, SEND OK, ERROR, FAIL, SEND FAIL) change state of device, line
+* with information about socket connection state(example data - 0,CONNECT\r\n ) update
+* SocketStateTable and line with information about station connection state(WIFI CONNECTED,
+* WIFI GOT IP, WIFI DISCONNECT) update stationState. Those lines are removed from RX buffer.
+* Other lines stay in RX buffer and are used by functions which process response.
+*
+*****************************************************************************************/
+static void ESP_ProcessRxLine(void)
+{
+	uint8_t* linePointer = &ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxLineBegin];
+	uint8_t socketNumber = linePointer[0] - '0';
+	bool removeLine = true;
+
+	if((strcmp(linePointer, "OK\r\n") == 0) || (strcmp(linePointer, "SEND OK\r\n") == 0))
+	{
+		//request of passthrough mode is finished when prompt will be received
+		if(ESP_DeviceStatus.passthroughState != ESP_PASSTHROUGH_WAIT_PROMPT)
+			ESP_DeviceStatus.deviceStatus = RESPONSE_RECEIVED;
+	}
+	else if((strcmp(linePointer, "ERROR\r\n") == 0) || (strcmp(linePointer, "FAIL\r\n") == 0)
+		|| (strcmp(linePointer, "SEND FAIL\r\n") == 0))
+	{
+		ESP_DeviceStatus.errorCode.AT_RETURN_ERROR = 1;
+		ESP_DeviceStatus.deviceStatus = RESPONSE_RECEIVED;
+
+		if(ESP_DeviceStatus.passthroughState == ESP_PASSTHROUGH_WAIT_PROMPT)
+			ESP_DeviceStatus.passthroughState = ESP_PASSTHROUGH_DISABLED;
+	}
+	else if((socketNumber < MAX_NUMBER_OF_SOCKET) && (strcmp(&linePointer[1], ",CONNECT\r\n") == 0))
+	{
+		SocketStateTable[socketNumber].socketIsOpen = true;
+	}
+	else if((socketNumber < MAX_NUMBER_OF_SOCKET) && (strcmp(&linePointer[1], ",CLOSED\r\n") == 0))
+	{
+		SocketStateTable[socketNumber].socketIsOpen = false;
+		SocketStateTable[socketNumber].additionalSocketDataIsAvailable = false;
+		ESP_ResetFramer(socketNumber);
+	}
+	else if(strcmp(linePointer, "WIFI CONNECTED\r\n") == 0)
+	{
+		ESP_DeviceStatus.stationState = ESP_STATION_CONNECTED;
+		ESP_DeviceStatus.stationStateChanged = true;
+	}
+	else if(strcmp(linePointer, "WIFI GOT IP\r\n") == 0)
+	{
+		ESP_DeviceStatus.stationState = ESP_STATION_GOT_IP;
+		ESP_DeviceStatus.stationStateChanged = true;
+	}
+	else if(strcmp(linePointer, "WIFI DISCONNECT\r\n") == 0)
+	{
+		ESP_DeviceStatus.stationState = ESP_STATION_DISCONNECTED;
+		ESP_DeviceStatus.stationStateChanged = true;
+
+		//module close all links when connection with APN is lost
+		for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
+		{
+			SocketStateTable[i].socketIsOpen = false;
+			SocketStateTable[i].additionalSocketDataIsAvailable = false;
+			ESP_ResetFramer(i);
+		}
+	}
+	else
+	{
+		removeLine = false;
+	}
+
+	if(removeLine)
+	{
+		ESP_DeviceStatus.rxSize = ESP_DeviceStatus.rxLineBegin;
+		ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxSize] = '\0';
+	}
+	else
+	{
+		ESP_DeviceStatus.rxLineBegin = ESP_DeviceStatus.rxSize;
+	}
+}
+
+/*****************************************************************************************
+* ESP_ParseRxByte() - process one byte received from ESP module. In line state byte is
+* appended to RX buffer and complete line or +IPD header is processed. In payload and
+* passthrough state byte is passed to framer of socket. In serial link state byte is
+* decoded by COBS. Each received byte is processed only once.
+*
+* Parameters:
+* @rxByte: byte taken from RX ring.
+*
+*****************************************************************************************/
+static void ESP_ParseRxByte(uint8_t rxByte)
+{
+	if(ESP_DeviceStatus.rxParserState == ESP_RX_STATE_SERIAL_LINK)
+	{
+		ESP_ParseSerialLinkByte(rxByte);
+		return;
+	}
+
+	if(ESP_DeviceStatus.rxParserState == ESP_RX_STATE_PASSTHROUGH)
+	{
+		ESP_ParseFrameByte(ESP_PASSTHROUGH_SOCKET_ID, rxByte);
+		return;
+	}
+
+	//prompt after AT+CIPSEND finish request of passthrough mode
+	if((rxByte == '>') && (ESP_DeviceStatus.passthroughState == ESP_PASSTHROUGH_WAIT_PROMPT))
+	{
+		ESP_DeviceStatus.passthroughState = ESP_PASSTHROUGH_ACTIVE;
+		ESP_DeviceStatus.rxParserState = ESP_RX_STATE_PASSTHROUGH;
+		ESP_ResetFramer(ESP_PASSTHROUGH_SOCKET_ID);
+		ESP_DeviceStatus.rxSize = 0;
+		ESP_DeviceStatus.rxBuffer[0] = '\0';
+		ESP_DeviceStatus.rxLineBegin = 0;
+		ESP_DeviceStatus.deviceStatus = RESPONSE_RECEIVED;
+		return;
+	}
+
+	if(ESP_DeviceStatus.rxParserState == ESP_RX_STATE_PAYLOAD)
+	{
+		if(ESP_DeviceStatus.rxPayloadSocketId != INVALID_SOCKET_ID)
+			ESP_ParseFrameByte(ESP_DeviceStatus.rxPayloadSocketId, rxByte);
+
+		ESP_DeviceStatus.rxPayloadRemaining--;
+
+		if(ESP_DeviceStatus.rxPayloadRemaining == 0)
+			ESP_FinishRxPayload(true);
+
+		return;
+	}
+
+	//one byte is reserved for null termination character
+	if(ESP_DeviceStatus.rxSize >= (TX_RX_BUFFER_SIZE - 1))
+	{
+		ESP_DeviceStatus.errorCode.AT_OVERRUN = 1;
+		return;
+	}
+
+	ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxSize] = rxByte;
+	ESP_DeviceStatus.rxSize++;
+	ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxSize] = '\0';
+
+	//detect header of received message. Example message +IPD,0,5:abcde
+	if((rxByte == ':') && ((ESP_DeviceStatus.rxSize - ESP_DeviceStatus.rxLineBegin) > IPD_HEADER_LENGTH)
+		&& (memcmp(&ESP_DeviceStatus.rxBuffer[ESP_DeviceStatus.rxLineBegin], "+IPD,", IPD_HEADER_LENGTH) == 0))
+	{
+		ESP_StartRxPayload();
+	}
+	else if(rxByte == '\n')
+	{
+		ESP_ProcessRxLine();
+	}
+}
+
+/*****************************************************************************************
+* ESP_ParseIpAddress() - convert IP address from string to byte table. Function expect data
+* in as example '"192.168.1.3"' where first character of string is quotation mark(").
+*
+* Parameters:
+* @stringPointer: pointer to string with IP address which will be parsed
+* @ipAddressTable: pointer to table where raw number with IP address will be stored.
+*
+* Return: Return true if string with IP address is in corrected format.
+*****************************************************************************************/
+static bool ESP_ParseIpAddress(uint8_t* stringPointer, uint8_t* ipAddressTable)
+{
+	for(int i = 0; i < IP_ADDRESS_BYTE_LENGTH; i++)
+	{
+		ipAddressTable[i] = atoi(stringPointer + 1);
+		stringPointer++;
+
+		if(i != (IP_ADDRESS_BYTE_LENGTH - 1))
+		{
+			stringPointer = strstr(stringPointer, ".");
+
+			if(stringPointer == NULL)
+			{
+				return false;
+			}
+		}
+	}/* for(int i = 0; i < IP_ADDRESS_BYTE_LENGTH; i++) */
+	return true;
+}
+
+/*****************************************************************************************
+* ESP_ReturnLinkInformation() - return socket activity information assigned to linkId.
+* Those information are that socket is open, IP address of connected device, source and
+* destination port number. Basic information like 'socketIsOpen' flag is updated by
+* ESP_Process function but other fields of SocketState flags will be updated when
+* ESP_GetConnectionStatus function will call and apropriate request process function will
+* be executed without errors.
+*
+* Parameters:
+* @linkId: index used to get information from SocketStateTable.
+*
+* Return: SocketState structure with information that socket(link) is active or if more
+* information is available(flag additionalSocketDataIsAvailable is set) then is possible
+* to get information like IP address of connected device.
+*****************************************************************************************/
+SocketState ESP_ReturnLinkInformation(uint8_t linkId)
+{
+	if(linkId > (MAX_NUMBER_OF_SOCKET - 1))
+	{
+		SocketState socketStateTmp;
+		socketStateTmp.additionalSocketDataIsAvailable = false;
+		socketStateTmp.socketIsOpen = false;
+
+		return socketStateTmp;
+	}
+	else
+	{
+		return SocketStateTable[linkId];
+	}
+}
+
+/*****************************************************************************************
+* ESP_FinishCommand() - remove first command from command queue and call its callback. If
+* command failed then rest of commands from the same sequence is also removed and their
+* callbacks are called with false result. Callbacks are called after remove of command so
+* callback can queue new commands.
+*
+* Parameters:
+* @result: result of first command.
+*
+*****************************************************************************************/
+static void ESP_FinishCommand(bool result)
+{
+	uint8_t sequenceNumber = ESP_DeviceStatus.commandQueue[ESP_DeviceStatus.commandQueueHead].sequenceNumber;
+	bool removeNextCommand = true;
+
+	ESP_DeviceStatus.commandIsActive = false;
+	ESP_DeviceStatus.timeoutRequestTreshold = ESP_DeviceStatus.defaultTimeoutRequestTreshold;
+
+	while(removeNextCommand)
+	{
+		ESP_Command commandTmp = ESP_DeviceStatus.commandQueue[ESP_DeviceStatus.commandQueueHead].command;
+
+		ESP_DeviceStatus.commandQueueHead = (ESP_DeviceStatus.commandQueueHead + 1) % ESP_COMMAND_QUEUE_SIZE;
+		ESP_DeviceStatus.commandQueueSize--;
+
+		if(commandTmp.callbackFunction != NULL)
+			commandTmp.callbackFunction(result, commandTmp.context);
+
+		//new commands queued by callback have different sequence number
+		removeNextCommand = (result == false) && (ESP_DeviceStatus.commandQueueSize > 0)
+			&& (ESP_DeviceStatus.commandQueue[ESP_DeviceStatus.commandQueueHead].sequenceNumber == sequenceNumber);
+	}
+}
+
+/*****************************************************************************************
+* ESP_ProcessCommandQueue() - function is only call from ESP_Process. When response of
+* active command is received then response function of command is called. If command
+* failed and retries are available then command is send again, otherwise command is
+* finished. When ESP layer is ready then next command from queue is send.
+*****************************************************************************************/
+static void ESP_ProcessCommandQueue(void)
+{
+	if(ESP_DeviceStatus.commandIsActive && (ESP_DeviceStatus.deviceStatus == RESPONSE_RECEIVED))
+	{
+		ESP_CommandQueueEntry *entry = &ESP_DeviceStatus.commandQueue[ESP_DeviceStatus.commandQueueHead];
+		bool result = entry->command.responseFunction(entry->command.context);
+
+		//response function don't have to change state
+		if(ESP_DeviceStatus.deviceStatus == RESPONSE_RECEIVED)
+			ESP_DeviceStatus.deviceStatus = READY;
+
+		if((result == false) && (entry->retryCounter < entry->command.retries))
+		{
+			//command will be send again below
+			entry->retryCounter++;
+			ESP_DeviceStatus.commandIsActive = false;
+		}
+		else
+		{
+			ESP_FinishCommand(result);
+		}
+	}
+
+	//next command is send when module work in command mode
+	if((ESP_DeviceStatus.passthroughState == ESP_PASSTHROUGH_ACTIVE) && (ESP_DeviceStatus.deviceStatus == READY))
+		ESP_DeviceStatus.deviceStatus = PASSTHROUGH_MODE;
+
+	while((ESP_DeviceStatus.commandIsActive == false) && (ESP_DeviceStatus.commandQueueSize > 0)
+		&& (ESP_DeviceStatus.deviceStatus == READY))
+	{
+		ESP_CommandQueueEntry *entry = &ESP_DeviceStatus.commandQueue[ESP_DeviceStatus.commandQueueHead];
+
+		if(entry->command.requestFunction(entry->command.context))
+		{
+			ESP_DeviceStatus.commandIsActive = true;
+
+			if(entry->command.timeout != ESP_COMMAND_DEFAULT_TIMEOUT)
+				ESP_DeviceStatus.timeoutRequestTreshold = entry->command.timeout;
+		}
+		else
+		{
+			//request can't be created so command failed
+			ESP_FinishCommand(false);
+		}
+	}
+}
+
+/*****************************************************************************************
+* ESP_QueueTxData() - copy not queued part of ESP layer TX buffer to UART TX ring. If TX
+* ring is full then rest of data will be queued during next call.
+*
+* Return: true if whole TX buffer was queued in UART TX ring.
+*****************************************************************************************/
+static bool ESP_QueueTxData(void)
+{
+	if(ESP_DeviceStatus.txProgress < ESP_DeviceStatus.txSize)
+	{
+		ESP_DeviceStatus.txProgress += UART_Write(ESP_DeviceStatus.uartPortNumber,
+			&ESP_DeviceStatus.txDataPointer[ESP_DeviceStatus.txProgress], ESP_DeviceStatus.txSize - ESP_DeviceStatus.txProgress);
+	}
+
+	return (ESP_DeviceStatus.txProgress >= ESP_DeviceStatus.txSize);
+}
+
+/*****************************************************************************************
+* ESP_ProcessFramers() - function is only call from ESP_Process. Partial message is
+* dropped if rest of message isn't received in ESP_FRAME_TIMEOUT calls. Framer which lost
+* synchronization is reset after the same time without data. Partial message of serial
+* link is dropped the same way.
+*****************************************************************************************/
+static void ESP_ProcessFramers(void)
+{
+	if(ESP_DeviceStatus.serialLinkDecoder.frameStarted)
+	{
+		ESP_DeviceStatus.serialLinkIdleCounter++;
+
+		if(ESP_DeviceStatus.serialLinkIdleCounter >= ESP_FRAME_TIMEOUT)
+			ESP_ResetSerialLinkFrame();
+	}
+
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
+	{
+		ESP_StreamFramer* framer = &ESP_DeviceStatus.framerTable[i];
+
+		if((framer->headerSize != 0) || (framer->messageRemaining != 0) || framer->synchronizationLost)
+		{
+			framer->idleCounter++;
+
+			if(framer->idleCounter >= ESP_FRAME_TIMEOUT)
+				ESP_ResetFramer(i);
+		}
+	}
+}
+
+/*****************************************************************************************
+* ESP_ProcessPassthrough() - function is only call from ESP_Process. Function perform
+* escape sequence started by ESP_StopPassthrough. "+++" must be received by ESP8266 as
+* separate packet so it is send after ESP_PASSTHROUGH_ESCAPE_GUARD_TIME calls without TX
+* data. After "+++" module accept AT requests after 1s.
+*****************************************************************************************/
+static void ESP_ProcessPassthrough(void)
+{
+	switch(ESP_DeviceStatus.passthroughState)
+	{
+	case ESP_PASSTHROUGH_WAIT_ESCAPE:
+		if((ESP_DeviceStatus.txProgress < ESP_DeviceStatus.txSize)
+			|| (UART_IsTransmitFinished(ESP_DeviceStatus.uartPortNumber) == false))
+		{
+			ESP_DeviceStatus.passthroughCounter = 0;
+		}
+		else if(++ESP_DeviceStatus.passthroughCounter >= ESP_PASSTHROUGH_ESCAPE_GUARD_TIME)
+		{
+			memcpy(ESP_DeviceStatus.txBuffer, "+++", 3);
+			ESP_DeviceStatus.txDataPointer = ESP_DeviceStatus.txBuffer;
+			ESP_DeviceStatus.txSize = 3;
+			ESP_DeviceStatus.txProgress = 0;
+			ESP_DeviceStatus.passthroughCounter = 0;
+			ESP_DeviceStatus.passthroughState = ESP_PASSTHROUGH_WAIT_EXIT;
+		}
+		break;
+
+	case ESP_PASSTHROUGH_WAIT_EXIT:
+		if(++ESP_DeviceStatus.passthroughCounter >= ESP_PASSTHROUGH_EXIT_TIME)
+		{
+			ESP_DeviceStatus.passthroughState = ESP_PASSTHROUGH_DISABLED;
+			ESP_DeviceStatus.rxParserState = ESP_RX_STATE_LINE;
+			ESP_ResetFramer(ESP_PASSTHROUGH_SOCKET_ID);
+			ESP_DeviceStatus.deviceStatus = READY;
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+/*****************************************************************************************
+* ESP_Init() - function initialize ESP layer by configuring basic parameters like baudrate
+* and timeouts. Timeout counters is increment when appropriate condition will be fulfiled
+* and function ESP_Process will be call. When timeout values will be set should be analyze
+* time between call ESP_Process and delay between AT request and AT response. In one test
+* case time between request and response consume almost 10 seconds. Set timeout values as
+* zero will cause that timeout in set functionality will be disabled.
+*
+* Parameters:
+* @portNum: UART port number used by ESP layer.
+* @baudrate: baudrate of UART port used by ESP layer.
+* @timeoutRequestTreshold: value used as wait limit for AT response.
+* @rxLockTreshold: if in RX buffer occur receive event(+IPD:) then device will set as
+*	BUSY. This value decide how long device should be blocked. This treshold prevent by
+*	situation when user start send AT request command during ESP8266 transmision.
+* @rxClearThreshold: number of cycles when RX buffer will be clear. To increment counter
+*	which will compare with this thresholdmust be pass two condition. First condition is
+*	device is on READY state. Second condition data in RX buffer is greater then zero.
+*	If ESP layer is very often used to send request then this threshold cam be set as
+*	zero.
+"
+* Return: false if UART can't be configured with requested baudrate, layer isn't
+* initialized then.
+*****************************************************************************************/
+bool ESP_Init(uint8_t portNum, uint32_t baudrate, uint32_t timeoutRequestTreshold, uint16_t rxLockTreshold, uint16_t rxClearThreshold)
+{
+	if(UART_DriverInit(portNum, baudrate, L8_BIT, ONE_BIT, NONE_PARITY) == false)
+		return false;
+
+	//initialize field inside structure
+	ESP_DeviceStatus.uartPortNumber = portNum;
+	ESP_DeviceStatus.baudrate = baudrate;
+	ESP_DeviceStatus.deviceStatus = READY;
+	memset(&ESP_DeviceStatus.errorCode, 0, sizeof(ERROR_CODE));
+	ESP_DeviceStatus.rxLockTreshold = rxLockTreshold;
+	ESP_DeviceStatus.rxLockCounter = 0;
+	ESP_DeviceStatus.timeoutRequestTreshold = timeoutRequestTreshold;
+	ESP_DeviceStatus.defaultTimeoutRequestTreshold = timeoutRequestTreshold;
+	ESP_DeviceStatus.timeoutRequestCounter = 0;
+	ESP_DeviceStatus.rxClearThreshold = rxClearThreshold;
+	ESP_DeviceStatus.rxClearCounter = 0;
+	ESP_DeviceStatus.lastRxSizeStatus = 0;
+	ESP_DeviceStatus.txProgress = 0;
+	ESP_DeviceStatus.txSize = 0;
+	ESP_DeviceStatus.txDataPointer = ESP_DeviceStatus.txBuffer;
+	ESP_DeviceStatus.rxSize = 0;
+	ESP_DeviceStatus.rxBuffer[0] = '\0';
+	ESP_DeviceStatus.rxLineBegin = 0;
+	ESP_DeviceStatus.rxRingHead = 0;
+	ESP_DeviceStatus.rxRingTail = 0;
+	ESP_DeviceStatus.lastUartOverrunCounter = 0;
+	ESP_DeviceStatus.lastRingOverrunCounter = 0;
+	memset((void*)&ESP_RxStatistic, 0, sizeof(ESP_RxStatistics));
+	ESP_DeviceStatus.rxParserState = ESP_RX_STATE_LINE;
+	ESP_DeviceStatus.rxPayloadRemaining = 0;
+	ESP_DeviceStatus.rxPayloadSocketId = INVALID_SOCKET_ID;
+	ESP_DeviceStatus.rxMessageSequenceNumber = 0;
+	ESP_DeviceStatus.droppedMessageHead = 0;
+	ESP_DeviceStatus.droppedMessageCount = 0;
+	ESP_DeviceStatus.passthroughState = ESP_PASSTHROUGH_DISABLED;
+	ESP_DeviceStatus.passthroughCounter = 0;
+	ESP_DeviceStatus.serialLinkMessage = NULL;
+	ESP_ResetSerialLinkFrame();
+	ESP_DeviceStatus.stationState = ESP_STATION_UNKNOWN;
+	ESP_DeviceStatus.stationStateChanged = false;
+	ESP_DeviceStatus.commandQueueHead = 0;
+	ESP_DeviceStatus.commandQueueSize = 0;
+	ESP_DeviceStatus.commandSequenceNumber = 0;
+	ESP_DeviceStatus.commandIsActive = false;
+
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
+	{
+		ESP_ResetFramer(i);
+	}
+
+	return true;
+}
+
+/*****************************************************************************************
+* ESP_Process() - function responsible for cyclicaly check data inside UART buffers,
+* process received data from ESP module and copy request to UART TX buffer.
+* This function must be call cyclically inside loop and must not be call from interrupt.
+* Data from UART is copied to RX ring only by UART interrupt(USART0_IRQHandler) so UART
+* interrupt must be enabled. In one call max ESP_RX_PARSE_LIMIT bytes is parsed, rest
+* of data is parsed during next call.
+*
+* Function during call move data from tx ESP layer buffer to UART TX ring(whole request
+* is queued at once and send by UART interrupt) and parse data from RX ring byte after byte.
+* Parser react on AT result codes, event like open link(example data - 0,CONNECT\r\n ),
+* close link(example data - 0,CLOSED\r\n ), change of station connection(example data -
+* WIFI DISCONNECT\r\n ) and receive data(example data -
+* \r\n+IPD,0,10:payloadPay ). Payload of received data is copied directly to SocketBufferTable.
+* When response of command from command queue is received then command is finished and
+* next command is send in the same call.
+*
+*****************************************************************************************/
+void ESP_Process(void)
+{
+	//process RX data
+	//data lost in UART or in RX ring since last call
+	if((ESP_RxStatistic.uartOverrunCounter != ESP_DeviceStatus.lastUartOverrunCounter)
+		|| (ESP_RxStatistic.ringOverrunCounter != ESP_DeviceStatus.lastRingOverrunCounter))
+	{
+		ESP_DeviceStatus.errorCode.UART_OVERRUN = 1;
+		ESP_DeviceStatus.lastUartOverrunCounter = ESP_RxStatistic.uartOverrunCounter;
+		ESP_DeviceStatus.lastRingOverrunCounter = ESP_RxStatistic.ringOverrunCounter;
+	}
+
+	//parse RX ring byte after byte - result codes, socket events and +IPD messages are detected on the fly
+	if(ESP_DeviceStatus.rxDeviceLock == true)
+		ESP_DeviceStatus.rxLockCounter++;
+
+	for(uint16_t i = 0; (i < ESP_RX_PARSE_LIMIT) && (ESP_DeviceStatus.rxRingTail != ESP_DeviceStatus.rxRingHead); i++)
+	{
+		ESP_ParseRxByte(ESP_DeviceStatus.rxRing[ESP_DeviceStatus.rxRingTail]);
+		ESP_DeviceStatus.rxRingTail = (ESP_DeviceStatus.rxRingTail + 1) & (ESP_RX_RING_SIZE - 1);
+
+		//clear timeuot counters
+		ESP_DeviceStatus.timeoutRequestCounter = 0;
+		ESP_DeviceStatus.rxLockCounter = 0;
+		ESP_DeviceStatus.rxClearCounter = 0;
+	}
+
+	//message wasn't received completely in expected time
+	if((ESP_DeviceStatus.rxDeviceLock == true) && (ESP_DeviceStatus.rxLockCounter >= ESP_DeviceStatus.rxLockTreshold))
+	{
+		ESP_FinishRxPayload(false);
+	}
+
+	ESP_ProcessFramers();
+	ESP_ProcessPassthrough();
+
+	//RX timeout (in READY state if no data will incomming in set duration time then clear RX buffer)
+	if((RX_TIMEOUT_DISABLE != ESP_DeviceStatus.rxClearThreshold)
+		&& ((ESP_DeviceStatus.rxSize > 0) || (ESP_DeviceStatus.rxParserState == ESP_RX_STATE_PAYLOAD)))
+	{
+		if(ESP_DeviceStatus.rxClearCounter >= ESP_DeviceStatus.rxClearThreshold)
+		{
+			ESP_DeviceStatus.rxSize = 0;
+			ESP_DeviceStatus.rxBuffer[0] = '\0';
+			ESP_DeviceStatus.rxLineBegin = 0;
+			ESP_DeviceStatus.rxClearCounter = 0;
+
+			if(ESP_DeviceStatus.rxParserState == ESP_RX_STATE_PAYLOAD)
+				ESP_FinishRxPayload(false);
+		}
+		else if((ESP_DeviceStatus.deviceStatus == READY)
+			&& (ESP_DeviceStatus.rxSize != ESP_DeviceStatus.lastRxSizeStatus))
+		{
+			ESP_DeviceStatus.rxClearCounter = 0;
+		}
+		else
+		{
+			ESP_DeviceStatus.rxClearCounter++;
+		}
+
+		ESP_DeviceStatus.lastRxSizeStatus = ESP_DeviceStatus.rxSize;
+	}/* if(RX_TIMEOUT_DISABLE != ESP_DeviceStatus.rxClearThreshold) */
+
+	//AT request timeout detection
+	if((AT_REQ_TIMEOUT_DISABLE != ESP_DeviceStatus.timeoutRequestTreshold)
+		&& (ESP_DeviceStatus.deviceStatus == BUSY)
+		&& (ESP_DeviceStatus.timeoutRequestCounter >= ESP_DeviceStatus.timeoutRequestTreshold))
+	{
+		ESP_DeviceStatus.errorCode.AT_TIMEOUT = 1;
+		ESP_DeviceStatus.deviceStatus = RESPONSE_RECEIVED;
+		ESP_DeviceStatus.timeoutRequestCounter = 0;
+
+		if(ESP_DeviceStatus.passthroughState == ESP_PASSTHROUGH_WAIT_PROMPT)
+			ESP_DeviceStatus.passthroughState = ESP_PASSTHROUGH_DISABLED;
+	}
+
+	//finish command from queue and send next one without waiting for next call
+	ESP_ProcessCommandQueue();
+
+	//process TX data - request is queued in UART TX ring and send by UART interrupt
+	if(ESP_DeviceStatus.txProgress < ESP_DeviceStatus.txSize)
+	{
+		//if TX ring is full then rest of request will be queued during next call
+		ESP_QueueTxData();
+
+		//clear timeuot counter
+		ESP_DeviceStatus.timeoutRequestCounter = 0;
+	}
+
+	//increment timeout counter when request is processed
+	if(ESP_DeviceStatus.deviceStatus == BUSY)
+		ESP_DeviceStatus.timeoutRequestCounter++;
+
+}
+
+/*****************************************************************************************
+* ESP_GetRequestState() - return DEVICE_STATUS enum holding by ESP_DeviceStatus structure.
+* DEVICE_STATUS enum contain information about current processed request. According to
+* this information can be checked when request was finished.
+*
+* Return: DEVICE_STATUS enum holding by ESP_DeviceStatus structure with information
+* about request state.
+*****************************************************************************************/
+DEVICE_STATUS ESP_GetRequestState(void)
+{
+	return ESP_DeviceStatus.deviceStatus;
+}
+
+/*****************************************************************************************
+* ESP_SendDetectDeviceRequest() - copy simple AT command request to ESP layer TX buffer.
+* This AT command don't change any option inside ESP8266 module but can be used to detect
+* module which is used in this function. AT response for this command is constant.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+* 	AT\r\n
+* Response:
+*	AT\r\r\n\r\nOK\r\n
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendDetectDeviceRequest(void)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(4U);
+
+		memcpy(&ESP_DeviceStatus.txBuffer[2], "\r\n", 2);
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_SendResetRequest() - copy reset AT command request to ESP layer TX buffer.
+* Command will cause restart ESP8266 module and module with startup with default settings
+* also settings set by user which is remembered also after reset cause by power and
+* stored in flash memory.
+* After response like below module send two parts of data first with baudrate the same like
+* AT command was send. Second part was send with baudrate like on startup. Observation was
+* performed on module on which baudrate wasn't changed. First part of data was added below:
+*	\r\n ets Jan 8 2013,rst cause:2,boot mode:(3,7)\r\n\r\nload 0x40100000, len 1856, room 16 \r\ntail 0\r\nchksum 0x63\r\nload 0x3ffe8000, len 776, room 8 \r\ntail 0\r\nchksum 0x02\r\nload 0x3ffe8310, len 552, room 8
+*	\r\ntail 0\r\nchksum 0x79\r\ncsum 0x79\r\n\r\n2nd boot version : 1.5\r\n  SPI Speed      : 40MHz\r\n  SPI Mode       : DIO\r\n  SPI Flash Size & Map: 8Mbit(512KB+512KB)\r\njump to run user1 @ 1000\r\n\r\n
+* Time between begining of AT request and last data received from ESP module was measure
+* and is equal 0.262s so wait procederu should be added.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+* 	AT+RST\r\n
+* Response:
+*	AT+RST\r\r\n\r\nOK\r\n
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendResetRequest(void)
+{
+	if (ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(8U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "RST\r\n");
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_ProcessGaneralFormatResponse() - function used to process AT command response if it
+* was received or if AT timeout was set. This type of analyze response can be used to many
+* request which return simple answear.
+*
+* Return: true if device correctly response without any errors.
+*****************************************************************************************/
+bool ESP_ProcessGaneralFormatResponse(void)
+{
+	if(ESP_DeviceStatus.deviceStatus == RESPONSE_RECEIVED)
+		ESP_DeviceStatus.deviceStatus = READY;
+
+	if(*((uint32_t *)&ESP_DeviceStatus.errorCode) > 0)
+		return false;
+	else
+		return true;
+}
+
+/*****************************************************************************************
+* ESP_SendConnectToApnRequest() - initialize ESP layer to send AT command request with
+* parameters necessary to connect to APN. Those data are SSID and password. Before using
+* request appropriate mode should be set via function ESP_SendWifiModeRequest. If mode
+* will be AT_SOFT_AP_MODE then connection failure.
+* This request can be processed very long. During one test time between last bit of AT
+* request and last bit of AT response is equal 7.000s in one test measure.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+*	AT+CWJAP_CUR="TestTest","289384759667"\r\n
+* Response:
+*	AT+CWJAP_CUR="TestTest","289384759667"\r\r\nWIFI CONNECTED\r\nWIFI GOT IP\r\n\r\nOK\r\n
+* Lines WIFI CONNECTED and WIFI GOT IP are events which are also send by module without
+* request(for example after automatic reconnection) so they are processed by RX parser and
+* can be read by ESP_GetStationStateEvent.
+*
+* Parameters:
+* @ssidName: SSID of chosen APN
+* @password: password to chosen APN
+*
+* Return: true if during AT comunication any errors don't occur like UART errors or AT
+* errors. Errors is hold in ESP_DeviceStatus.errorCode structure.
+*****************************************************************************************/
+bool ESP_SendConnectToApnRequest(const char* ssidName, const char* password)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(4U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CWJAP_CUR=\"");
+		strCatWithSpecialCharacters(ESP_DeviceStatus.txBuffer, ssidName);
+		strcat(ESP_DeviceStatus.txBuffer, "\",\"");
+		strCatWithSpecialCharacters(ESP_DeviceStatus.txBuffer, password);
+		strcat(ESP_DeviceStatus.txBuffer, "\"\r\n");
+		ESP_DeviceStatus.txSize = strlen(ESP_DeviceStatus.txBuffer);
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_SendWifiModeRequest() - store in ESP layer TX buffer AT request which will switch
+* mode of ESP8266 module. Supported modes are: AT_STATION_MODE, AT_SOFT_AP_MODE and
+* AT_SOFT_AP_STATION_MODE. Tested ESP-07 module default work in AT_SOFT_AP_MODE mode.
+* Execute some operation in invalide mode can cause error during perform AT command request.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+* 	AT+CWMODE_CUR=1\r\n
+* Response:
+*	AT+CWMODE_CUR=1\r\r\n\r\nOK\r\n
+*
+* Parameters:
+* @wifiMode: this parameter contain selected mode. Possible values and meaning of it is
+*  stored inside ESP_DEVICE_MODE enum.
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendWifiModeRequest(uint8_t wifiMode)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(17U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CWMODE_CUR=\0");
+
+		if((wifiMode >= AT_STATION_MODE) && (wifiMode <= AT_SOFT_AP_STATION_MODE))
+		{
+			uint8_t modeChar = (uint8_t)('0') + wifiMode;
+			strncat(ESP_DeviceStatus.txBuffer, &modeChar, 1);
+		}
+
+		strcat(ESP_DeviceStatus.txBuffer, "\r\n");
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_SendUartConfigurationRequest() - store in ESP layer TX buffer AT request which will
+* change baudrate of ESP8266 module. Configuration isn't stored in flash memory of module
+* so after reset module use default baudrate. Response is send with old baudrate and
+* after that module switch to new baudrate, so when response will be correct then
+* ESP_ChangeBaudrate should be call with the same value. Frame format isn't changed(8 data
+* bits, 1 stop bit, no parity and no flow control).
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+* 	AT+UART_CUR=460800,8,1,0,0\r\n
+* Response:
+*	AT+UART_CUR=460800,8,1,0,0\r\r\n\r\nOK\r\n
+*
+* Parameters:
+* @baudrate: new baudrate of ESP8266 module.
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendUartConfigurationRequest(uint32_t baudrate)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		char baudrateTmp[11];
+
+		ESP_DataSendInit(0U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "UART_CUR=");
+		strcat(ESP_DeviceStatus.txBuffer, itoa(baudrate, baudrateTmp, 10U));
+		strcat(ESP_DeviceStatus.txBuffer, ",8,1,0,0\r\n");
+		ESP_DeviceStatus.txSize = strlen(ESP_DeviceStatus.txBuffer);
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_SendDisconnectRequest() - if ESPESP8266 module is connected to APN this function
+* can be used to copy AT command request ESP layer TX buffer.
+* Process function:
+*	ESP_ProcessApnListResponse()
+* Request:
+* 	AT+CWQAP\r\n
+* Response:
+* 	AT+CWQAP\r\r\n\r\nOK\r\nWIFI DISCONNECT\r\n
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendDisconnectRequest(void)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(10U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CWQAP\r\n");
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_SendApnListRequest() - store in ESP layer TX buffer AT request to get access points
+* list. Performing AT command request with receive response can consume 2.14s(value was
+* measure during one test case).
+* Process function:
+*	ESP_ProcessApnListResponse()
+* Request:
+*	AT+CWLAP\r\n
+* Response:
+*	AT+CWLAP\r\r\n+CWLAP:(4,"TestTest",-44,"94:f2:56:cb:80:da",10,-2,0)\r\n+CWLAP:(4,"TestTest2",-90,"da:84:69:d2:42:40",3,-4,0)\r\n\r\nOK\r\n
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendApnListRequest(void)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(10U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CWLAP\r\n");
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_ProcessApnListResponse() - function used to process AT command response with
+* information about available access points. Obtained information via function is stored
+* inside ApnStructure which is available as global structure.
+*
+* Return: true if during AT comunication any errors don't occur like UART errors or AT
+* errors. Errors is hold in ESP_DeviceStatus.errorCode structure.
+*****************************************************************************************/
+bool ESP_ProcessApnListResponse(void)
+{
+	uint8_t *rxCwlapBufferPointer = ESP_DeviceStatus.rxBuffer;
+	ApnStructure.NumberOfApn = 0;
+
+	//fill structures in AppInformationTable
+	for(uint16_t i = 0; i < MAX_NUMBER_OF_APN; i++)
+	{
+		rxCwlapBufferPointer = strstr(rxCwlapBufferPointer, "+CWLAP:");
+		if(rxCwlapBufferPointer != NULL)
+		{
+			uint8_t* endingCharLocation = 0;
+
+			//fill securityLevel
+			ApnStructure.AppInformationTable[i].securityLevel = rxCwlapBufferPointer[8] - '0';
+
+			//fill ssid
+			endingCharLocation = strstr(&rxCwlapBufferPointer[11], "\",");
+
+			if(endingCharLocation != NULL)
+			{
+				memcpy(ApnStructure.AppInformationTable[i].ssid, &rxCwlapBufferPointer[11],
+						(int)(endingCharLocation - &rxCwlapBufferPointer[11]));
+				//add NULL termination symbol
+				ApnStructure.AppInformationTable[i].ssid[endingCharLocation - &rxCwlapBufferPointer[11]] = '\0';
+			}
+			else
+			{
+				break;
+			}
+
+			//fill signalPower
+			endingCharLocation = strstr(&rxCwlapBufferPointer[11], "\",");
+
+			if(endingCharLocation != NULL)
+			{
+				ApnStructure.AppInformationTable[i].signalPower = atoi(endingCharLocation + 2);
+				rxCwlapBufferPointer = endingCharLocation + 2;
+			}
+			else
+			{
+				break;
+			}
+
+			//fill bssid
+			endingCharLocation = strstr(rxCwlapBufferPointer, ",\"");
+
+			if(endingCharLocation != NULL)
+			{
+				memcpy(ApnStructure.AppInformationTable[i].bssid, endingCharLocation + 2, 17);
+				ApnStructure.AppInformationTable[i].bssid[17] = '\0';
+			}
+			else
+			{
+				break;
+			}
+
+			//increasy counter with APN number
+			ApnStructure.NumberOfApn++;
+		}
+		else/* in this case it mean that no more access point wasn't detected */
+		{
+			break;
+		}
+	}
+
+	if(ESP_DeviceStatus.deviceStatus == RESPONSE_RECEIVED)
+		ESP_DeviceStatus.deviceStatus = READY;
+
+	if(*((uint32_t *)&ESP_DeviceStatus.errorCode) > 0)
+		return false;
+	else
+		return true;
+}
+
+/*****************************************************************************************
+* ESP_GetAssignedIpAddress() - store in ESP layer TX buffer AT request to get
+* IP address assigned to device.
+* Process function:
+*	ESP_ProcessGetAssignedIpResponse()
+* Request:
+*	AT+CIFSR\r\n
+* Response:
+*	AT+CIFSR\r\r\n+CIFSR:STAIP,"192.168.1.3"\r\n+CIFSR:STAMAC,"8C:FC:8F:66:30:6F"\r\n\r\nOK\r\n
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_GetAssignedIpAddress(void)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(10U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CIFSR\r\n");
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_ProcessGetAssignedIpResponse() - function used to process AT command response with
+* information about IP address assigned to device. IP address is copied to memory pointed
+* by function parameter(pointerToIpAdressTable).
+*
+* Parameters:
+* @pointerToIpAdressTable: pointer to memory where decoded IP address will be copied.
+*
+* Return: true if during AT comunication any errors don't occur like UART errors or AT
+* errors. Errors is hold in ESP_DeviceStatus.errorCode structure.
+*****************************************************************************************/
+bool ESP_ProcessGetAssignedIpResponse(uint8_t *pointerToIpAdressTable)
+{
+	uint8_t ipAddressTable[IP_ADDRESS_BYTE_LENGTH];
+	uint8_t *rxIpBufferPointer = NULL;
+
+	if(ESP_DeviceStatus.deviceStatus == RESPONSE_RECEIVED)
+		ESP_DeviceStatus.deviceStatus = READY;
+
+	//check errors to don't parse possible incorrect string
+	if(*((uint32_t *)&ESP_DeviceStatus.errorCode) > 0)
+	{
+		return false;
+	}
+
+	rxIpBufferPointer = strstr(ESP_DeviceStatus.rxBuffer, "STAIP");
+
+	if(rxIpBufferPointer == NULL)
+	{
+		rxIpBufferPointer = strstr(ESP_DeviceStatus.rxBuffer, "APIP");
+	}
+
+	if(rxIpBufferPointer != NULL)
+	{
+		//parse IP address
+		rxIpBufferPointer = strstr(rxIpBufferPointer, "\"");
+
+		if(!ESP_ParseIpAddress(rxIpBufferPointer, ipAddressTable))
+		{
+			return false;
+		}
+	}/* if(rxIpBufferPointer != NULL) */
+
+	memcpy(pointerToIpAdressTable, ipAddressTable, 4);
+
+	return true;
+}
+
+/*****************************************************************************************
+* ESP_GetConnectionStatus() - store in ESP layer TX buffer AT request to get connection
+* status. Connection status in this case mean that ESP module is connected via WiFi to
+* other device or not. Execution of this AT command request also cause that in response
+* can be added information about links(connections to sockets) if links will established.
+* This mean that SocketStateTable will be updated.
+* Process function:
+*	ESP_ProcessConnectionStatus()
+* Request:
+*	AT+CIPSTATUS\r\n
+* Response:
+*	AT+CIPSTATUS\r\r\nSTATUS:2\r\n\r\nOK\r\n
+*	AT+CIPSTATUS\r\r\nSTATUS:3\r\n+CIPSTATUS:0,"TCP","192.168.1.3",51171,3000,1\r\n\r\nOK\r\n
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_GetConnectionStatus(void)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(14U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CIPSTATUS\r\n");
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_ProcessConnectionStatus() - function used to process AT command response with
+* information about connection status. If returned status as AT response will be equal
+* 5(station not connected to access point) then to variable pointed by flagPointer(function
+* input parameter) will be copied false, otherwise will be copied true. If returned status
+* as AT response will be equal 3 (station created TCP or UPD trasmnission) then link
+* information in SocketStateTable will be updated.
+*
+* Parameters:
+* @flagPointer: pointer to flag which will be store connection status. True mean that
+*  device is connected via WiFi to other device.
+*
+* Return: true if during AT comunication any errors don't occur like UART errors or AT
+* errors. Errors is hold in ESP_DeviceStatus.errorCode structure.
+*****************************************************************************************/
+bool ESP_ProcessConnectionStatus(bool *flagPointer)
+{
+	uint8_t *rxStatusBufferPointer = NULL;
+	volatile uint8_t linkStatus = 0;
+
+	if(ESP_DeviceStatus.deviceStatus == RESPONSE_RECEIVED)
+		ESP_DeviceStatus.deviceStatus = READY;
+
+	//check errors to don't parse possible incorrect string
+	if(*((uint32_t *)&ESP_DeviceStatus.errorCode) > 0)
+	{
+		return false;
+	}
+
+	rxStatusBufferPointer = strstr(ESP_DeviceStatus.rxBuffer, "STATUS:");
+
+	if(rxStatusBufferPointer != NULL)
+	{
+		linkStatus = rxStatusBufferPointer[7] - (uint8_t)'0';
+
+		if(linkStatus == STATUS_STATION_NOT_CONNECTED_TO_APN)
+		{
+			*flagPointer = false;
+		}
+		else
+		{
+			*flagPointer = true;
+		}
+
+		//clear
+		for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
+		{
+			SocketStateTable[i].socketIsOpen = false;
+			SocketStateTable[i].additionalSocketDataIsAvailable = false;
+		}
+
+		if(linkStatus == STATUS_STATION_CREATED_TCP_OR_UDP_TRANSMISSION)
+		{
+			for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
+			{
+				rxStatusBufferPointer = strstr(rxStatusBufferPointer, "CIPSTATUS:");
+
+				//pass this condition mean that entries with information about socket exist
+				if(rxStatusBufferPointer != NULL)
+				{
+					uint8_t socketId = rxStatusBufferPointer[10] - (uint8_t)'0';
+
+					rxStatusBufferPointer = &rxStatusBufferPointer[13];
+
+					if(socketId > (MAX_NUMBER_OF_SOCKET - 1))
+						break;
+
+					//parse protocol type
+					if(rxStatusBufferPointer[0] == 'T')
+					{
+						SocketStateTable[socketId].connectionType = TCP_CONNECTION_TYPE;
+					}
+					else if(rxStatusBufferPointer[0] == 'U')
+					{
+						SocketStateTable[socketId].connectionType = UDP_CONNECTION_TYPE;
+					}
+					else
+					{
+						break;
+					}
+
+					//parse IP address
+					rxStatusBufferPointer = strstr(rxStatusBufferPointer, ",\"");
+
+					if(rxStatusBufferPointer != NULL)
+					{
+						rxStatusBufferPointer++;
+
+						if(!ESP_ParseIpAddress(rxStatusBufferPointer, SocketStateTable[socketId].remoteIpAddress))
+						{
+							break;
+						}
+
+					}/* if(rxIpBufferPointer != NULL) */
+					else
+					{
+						break;
+					}
+
+					//parse remote port
+					rxStatusBufferPointer = strstr(rxStatusBufferPointer, "\",");
+
+					if(rxStatusBufferPointer != NULL)
+					{
+						SocketStateTable[socketId].remotePort = atoi(rxStatusBufferPointer + 2);
+						rxStatusBufferPointer += 2;
+					}
+					else
+					{
+						break;
+					}
+
+					//parse local port
+					rxStatusBufferPointer = strstr(rxStatusBufferPointer, ",");
+
+					if(rxStatusBufferPointer != NULL)
+					{
+						SocketStateTable[socketId].localPort = atoi(rxStatusBufferPointer + 1);
+						rxStatusBufferPointer++;
+					}
+					else
+					{
+						break;
+					}
+
+					//parse tcp client or server
+					rxStatusBufferPointer = strstr(rxStatusBufferPointer, ",");
+
+					if(rxStatusBufferPointer != NULL)
+					{
+						uint8_t tcpConnectionTypeTmp = atoi(rxStatusBufferPointer + 1);
+						if(tcpConnectionTypeTmp == 0)
+							SocketStateTable[socketId].tcpConnectionRunAsServer = false;
+						else if(tcpConnectionTypeTmp == 1)
+							SocketStateTable[socketId].tcpConnectionRunAsServer = true;
+						else
+							break;
+
+					}
+					else
+					{
+						break;
+					}
+
+					//mark that all data are correct
+					SocketStateTable[socketId].socketIsOpen = true;
+					SocketStateTable[socketId].additionalSocketDataIsAvailable = true;
+				}/* if(rxStatusBufferPointer != NULL) */
+				else
+				{
+					break;
+				}
+			}/* for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++) */
+		}/* if(linkStatus == STATUS_STATION_CREATED_TCP_OR_UDP_TRANSMISSION) */
+	}/* if(rxStatusBufferPointer != NULL) */
+
+	return true;
+}
+
+/*****************************************************************************************
+* ESP_SendAcceptMultipleConnectionRequest() - store in ESP layer TX buffer AT request to
+* allow multiply connection to TCP server. Call this command is require for other function
+* because only multiply connection is supported.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+*	AT+CIPMUX=1\r\n
+* Response:
+*	AT+CIPMUX=1\r\r\n\r\nOK\r\n
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendAcceptMultipleConnectionRequest(void)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(13U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CIPMUX=1\r\n");
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_SendServerCommandRequest() - store in ESP layer TX buffer AT request to create or
+* close TCP server. Function contain two parameters one to decide about close or open,
+* second parameter decide about port number of server.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+*	AT+CIPSERVER=1,3000\r\n
+* Response:
+*	AT+CIPSERVER=1,3000\r\r\n\r\nOK\r\n
+*
+* Parameters:
+* @serverStatus: flag which decide about action regarding to server. True mean that server
+*  will be created. False meam that server will be closed.
+* @portNumber: port number of created/closed server.
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendServerCommandRequest(bool serverStatus, uint16_t portNumber)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		char portNumberTmp[8];
+		memset(portNumberTmp, 0, sizeof(portNumberTmp));
+
+		ESP_DataSendInit(0U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CIPSERVER=");
+		
+		if(serverStatus)
+			strcat(ESP_DeviceStatus.txBuffer, "1,");
+		else
+			strcat(ESP_DeviceStatus.txBuffer, "0,");
+			
+		strcat(ESP_DeviceStatus.txBuffer, itoa(portNumber, portNumberTmp, 10U));
+
+		strcat(ESP_DeviceStatus.txBuffer, "\r\n");
+
+		ESP_DeviceStatus.txSize = strlen(ESP_DeviceStatus.txBuffer);
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_SendSingleConnectionRequest() - store in ESP layer TX buffer AT request which allow
+* only single connection. Single connection is required by passthrough mode and can't be
+* set when TCP server is created.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+*	AT+CIPMUX=0\r\n
+* Response:
+*	AT+CIPMUX=0\r\r\n\r\nOK\r\n
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendSingleConnectionRequest(void)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(13U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CIPMUX=0\r\n");
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_SendTransferModeRequest() - store in ESP layer TX buffer AT request which select
+* normal or passthrough(transparent transmission) mode. Passthrough mode is used only
+* when data is send by AT+CIPSEND request without parameters(ESP_SendStartPassthroughRequest).
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+*	AT+CIPMODE=1\r\n
+* Response:
+*	AT+CIPMODE=1\r\r\n\r\nOK\r\n
+*
+* Parameters:
+* @passthroughMode: true mean passthrough mode, false mean normal mode.
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendTransferModeRequest(bool passthroughMode)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(14U);
+
+		if(passthroughMode)
+			strcat(ESP_DeviceStatus.txBuffer, "CIPMODE=1\r\n");
+		else
+			strcat(ESP_DeviceStatus.txBuffer, "CIPMODE=0\r\n");
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_SendStartTcpConnectionRequest() - store in ESP layer TX buffer AT request which
+* create TCP connection to remote device. Request is supported only for single connection.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+*	AT+CIPSTART="TCP","192.168.1.10",3000\r\n
+* Response:
+*	AT+CIPSTART="TCP","192.168.1.10",3000\r\r\nCONNECT\r\n\r\nOK\r\n
+*
+* Parameters:
+* @ipAddress: table with IP address of remote device.
+* @portNumber: port number of remote device.
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendStartTcpConnectionRequest(const uint8_t* ipAddress, uint16_t portNumber)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		char stringTmp[8];
+
+		ESP_DataSendInit(0U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CIPSTART=\"TCP\",\"");
+
+		for(uint8_t i = 0; i < IP_ADDRESS_BYTE_LENGTH; i++)
+		{
+			strcat(ESP_DeviceStatus.txBuffer, itoa(ipAddress[i], stringTmp, 10U));
+
+			if(i != (IP_ADDRESS_BYTE_LENGTH - 1))
+				strcat(ESP_DeviceStatus.txBuffer, ".");
+		}
+
+		strcat(ESP_DeviceStatus.txBuffer, "\",");
+		strcat(ESP_DeviceStatus.txBuffer, itoa(portNumber, stringTmp, 10U));
+		strcat(ESP_DeviceStatus.txBuffer, "\r\n");
+		ESP_DeviceStatus.txSize = strlen(ESP_DeviceStatus.txBuffer);
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_SendStartUdpConnectionRequest() - store in ESP layer TX buffer AT request which
+* create UDP link to remote device. Request is supported only for multiple connection and
+* selected link ID can't be used by client of TCP server. Data is send to link by
+* ESP_SendWriteDataRequest like to TCP socket but without any acknowledge from remote device.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+*	AT+CIPSTART=4,"UDP","192.168.1.10",3001\r\n
+* Response:
+*	AT+CIPSTART=4,"UDP","192.168.1.10",3001\r\r\n4,CONNECT\r\n\r\nOK\r\n
+*
+* Parameters:
+* @linkId: ID of link used by UDP transmission.
+* @ipAddress: table with IP address of remote device.
+* @portNumber: port number of remote device.
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendStartUdpConnectionRequest(uint8_t linkId, const uint8_t* ipAddress, uint16_t portNumber)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		char stringTmp[8];
+
+		ESP_DataSendInit(0U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CIPSTART=");
+		strcat(ESP_DeviceStatus.txBuffer, itoa(linkId, stringTmp, 10U));
+		strcat(ESP_DeviceStatus.txBuffer, ",\"UDP\",\"");
+
+		for(uint8_t i = 0; i < IP_ADDRESS_BYTE_LENGTH; i++)
+		{
+			strcat(ESP_DeviceStatus.txBuffer, itoa(ipAddress[i], stringTmp, 10U));
+
+			if(i != (IP_ADDRESS_BYTE_LENGTH - 1))
+				strcat(ESP_DeviceStatus.txBuffer, ".");
+		}
+
+		strcat(ESP_DeviceStatus.txBuffer, "\",");
+		strcat(ESP_DeviceStatus.txBuffer, itoa(portNumber, stringTmp, 10U));
+		strcat(ESP_DeviceStatus.txBuffer, "\r\n");
+		ESP_DeviceStatus.txSize = strlen(ESP_DeviceStatus.txBuffer);
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_SendStartPassthroughRequest() - store in ESP layer TX buffer AT request which start
+* passthrough mode. Before this request passthrough mode must be selected by
+* ESP_SendTransferModeRequest and TCP connection must be created by
+* ESP_SendStartTcpConnectionRequest. Response is finished by prompt('>'), after that ESP
+* layer work in passthrough mode until ESP_StopPassthrough will be call.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+*	AT+CIPSEND\r\n
+* Response:
+*	AT+CIPSEND\r\r\n\r\nOK\r\n\r\n>
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendStartPassthroughRequest(void)
+{
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(12U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CIPSEND\r\n");
+		ESP_DeviceStatus.passthroughState = ESP_PASSTHROUGH_WAIT_PROMPT;
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_PassthroughWrite() - store in ESP layer TX buffer raw data which will be send in
+* passthrough mode and queue it in UART TX ring at once, so next data can be written in
+* the same call when TX ring has space. Data isn't confirmed by ESP8266 module.
+*
+* Parameters:
+* @bufferPointer: pointer to buffer which hold data for transmission.
+* @bufferSizeOf: number of data which must be copied from selected memory.
+*
+* Return: true if data was copied. False if passthrough mode isn't active or previous data
+* wasn't copied to UART yet.
+*****************************************************************************************/
+bool ESP_PassthroughWrite(const uint8_t* bufferPointer, uint16_t bufferSizeOf)
+{
+	if((ESP_DeviceStatus.passthroughState == ESP_PASSTHROUGH_ACTIVE)
+		&& ESP_QueueTxData()
+		&& (bufferSizeOf <= TX_RX_BUFFER_SIZE))
+	{
+		memcpy(ESP_DeviceStatus.txBuffer, bufferPointer, bufferSizeOf);
+		ESP_DeviceStatus.txDataPointer = ESP_DeviceStatus.txBuffer;
+		ESP_DeviceStatus.txSize = bufferSizeOf;
+		ESP_DeviceStatus.txProgress = 0;
+
+		//part which don't fit in TX ring will be queued by ESP_Process
+		ESP_QueueTxData();
+
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_StopPassthrough() - start escape sequence which return ESP8266 module to command
+* mode. Sequence is performed by ESP_Process and take over 1s, when it will be finished
+* device state will be changed to READY. TCP connection isn't closed.
+*
+* Return: true if escape sequence was started.
+*****************************************************************************************/
+bool ESP_StopPassthrough(void)
+{
+	if(ESP_DeviceStatus.passthroughState == ESP_PASSTHROUGH_ACTIVE)
+	{
+		ESP_DeviceStatus.passthroughState = ESP_PASSTHROUGH_WAIT_ESCAPE;
+		ESP_DeviceStatus.passthroughCounter = 0;
+
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_PassthroughIsActive() - function return information that ESP layer work in
+* passthrough mode. During escape sequence function also return true.
+*
+* Return: true if module don't work in command mode.
+*****************************************************************************************/
+bool ESP_PassthroughIsActive(void)
+{
+	return (ESP_DeviceStatus.passthroughState != ESP_PASSTHROUGH_DISABLED)
+		&& (ESP_DeviceStatus.passthroughState != ESP_PASSTHROUGH_WAIT_PROMPT);
+}
+
+/*****************************************************************************************
+* ESP_StartSerialLink() - switch ESP layer to serial link mode used when UART is connected
+* directly to other device instead of ESP8266 module. Data which wasn't parsed yet and
+* commands from command queue are dropped. In this mode AT requests aren't send, received
+* data is divided into messages by COBS and messages are send by ESP_SerialLinkWrite.
+*
+*****************************************************************************************/
+void ESP_StartSerialLink(void)
+{
+	ESP_ClearRxBuffer();
+
+	ESP_DeviceStatus.commandQueueSize = 0;
+	ESP_DeviceStatus.commandIsActive = false;
+	ESP_DeviceStatus.passthroughState = ESP_PASSTHROUGH_DISABLED;
+	ESP_DeviceStatus.rxParserState = ESP_RX_STATE_SERIAL_LINK;
+	ESP_DeviceStatus.deviceStatus = SERIAL_LINK_MODE;
+}
+
+/*****************************************************************************************
+* ESP_StopSerialLink() - return ESP layer to command mode so ESP8266 module can be used
+* again. Partial message is dropped.
+*
+*****************************************************************************************/
+void ESP_StopSerialLink(void)
+{
+	if(ESP_DeviceStatus.rxParserState != ESP_RX_STATE_SERIAL_LINK)
+		return;
+
+	ESP_ResetSerialLinkFrame();
+
+	ESP_DeviceStatus.rxParserState = ESP_RX_STATE_LINE;
+	ESP_DeviceStatus.deviceStatus = READY;
+}
+
+/*****************************************************************************************
+* ESP_SerialLinkWrite() - code message by COBS, store it in ESP layer TX buffer and queue
+* it in UART TX ring at once, so next message can be written in the same call when TX ring
+* has space. Part of message which don't fit in TX ring is queued by ESP_Process.
+*
+* Parameters:
+* @bufferPointer: pointer to buffer which hold message.
+* @bufferSizeOf: number of bytes of message.
+*
+* Return: true if message was coded. False if serial link mode isn't active, previous
+* message wasn't copied to UART yet or coded message don't fit in TX buffer.
+*****************************************************************************************/
+bool ESP_SerialLinkWrite(const uint8_t* bufferPointer, uint16_t bufferSizeOf)
+{
+	uint16_t codedSize = 0;
+
+	if((ESP_DeviceStatus.rxParserState != ESP_RX_STATE_SERIAL_LINK)
+		|| (ESP_QueueTxData() == false))
+	{
+		return false;
+	}
+
+	codedSize = CobsFraming_Encode(bufferPointer, bufferSizeOf, ESP_DeviceStatus.txBuffer, TX_RX_BUFFER_SIZE);
+
+	if(codedSize == 0)
+		return false;
+
+	ESP_DeviceStatus.txDataPointer = ESP_DeviceStatus.txBuffer;
+	ESP_DeviceStatus.txSize = codedSize;
+	ESP_DeviceStatus.txProgress = 0;
+
+	ESP_QueueTxData();
+
+	return true;
+}
+
+/*****************************************************************************************
+* ESP_SerialLinkIsActive() - function return information that ESP layer work in serial
+* link mode.
+*
+* Return: true if serial link mode is active.
+*****************************************************************************************/
+bool ESP_SerialLinkIsActive(void)
+{
+	return (ESP_DeviceStatus.rxParserState == ESP_RX_STATE_SERIAL_LINK);
+}
+
+/*****************************************************************************************
+* ESP_SendWriteDataRequest() - store in ESP layer TX buffer AT request to send number of
+* bytes to selected link ID(socketNumber). This function is one of two part send data
+* process. To send data via socket is necessary use this function and in next if AT response
+* will be OK then use ESP_Write function.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+*	AT+CIPSEND=0,18\r\n
+* Response:
+* 	"AT+CIPSEND=0,18\r\r\n\r\nOK\r\n> "
+*
+* Parameters:
+* @socketNumber: value of link ID to which will be send data.
+* @writeBufferSizeOf: number of bytes send to selected socketNumber(link ID).
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_SendWriteDataRequest(uint8_t socketNumber, uint16_t writeBufferSizeOf)
+{
+	//execute when device is ready and socket is open
+	if(ESP_DeviceStatus.deviceStatus == READY && SocketStateTable[socketNumber].socketIsOpen == true)
+	{
+		char stringTmp[8];
+		memset(stringTmp, 0, sizeof(stringTmp));
+
+		ESP_DataSendInit(0U);
+
+		strcat(ESP_DeviceStatus.txBuffer, "CIPSEND=");
+		
+		strcat(ESP_DeviceStatus.txBuffer, itoa(socketNumber, stringTmp, 10U));
+
+		strcat(ESP_DeviceStatus.txBuffer, ",");
+
+		strcat(ESP_DeviceStatus.txBuffer, itoa(writeBufferSizeOf, stringTmp, 10U));
+		
+		strcat(ESP_DeviceStatus.txBuffer, "\r\n");
+
+		ESP_DeviceStatus.txSize = strlen(ESP_DeviceStatus.txBuffer);
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy or socket is closed so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_Write() - start send of raw data to previously selected link ID. Data isn't copied to
+* ESP layer TX buffer but is send directly from user buffer so buffer can't be changed
+* until response will be received. This function is one of two part send data process.
+* First part is ESP_SendWriteDataRequest. This function is second part of send process.
+* Process function:
+*	ESP_ProcessGaneralFormatResponse()
+* Request:
+*	Example raw data: '0','1','0','0','0','0','0',\n,'0','0','0','0','1','1','128','0',\,'142'
+* Response:
+*	\r\nRecv 18 bytes\r\n\r\nSEND OK\r\n
+*
+* Parameters:
+* @bufferPointer: pointer to buffer which hold data for transmission.
+* @bufferSizeOf: number of data which must be copied from selected memory.
+*
+* Return: true if ESP layer is ready for new AT command request in another case return
+* false.
+*****************************************************************************************/
+bool ESP_Write(uint8_t* bufferPointer, uint16_t bufferSizeOf)
+{
+	//execute when device is ready and socket is open
+	if(ESP_DeviceStatus.deviceStatus == READY)
+	{
+		ESP_DataSendInit(bufferSizeOf);
+		ESP_DeviceStatus.txDataPointer = bufferPointer;
+
+		//command will be executed when function ESP_Process() will call
+		return true;
+	}
+	else
+	{
+		//device is busy or socket is closed so AT command cannot be executed
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* ESP_ClearRxBuffer() - clear RX data and status register inside physical UART port used
+* by ESP layer. Data from RX ring and not processed lines of response are also cleared.
+*
+*****************************************************************************************/
+void ESP_ClearRxBuffer(void)
+{
+	UART_DisableInterrupts(ESP_DeviceStatus.uartPortNumber);
+
+	UART_Status status = UART_ReturnStatusRegister(ESP_DeviceStatus.uartPortNumber);
+
+	//clear UART RX buffer
+	for(uint8_t rxDataTmp = 0; status.RDR == 1;)
+	{
+		rxDataTmp = UART_ReadByteFromTrasmitter(ESP_DeviceStatus.uartPortNumber);
+		status = UART_ReturnStatusRegister(ESP_DeviceStatus.uartPortNumber);
+	}
+
+	ESP_DeviceStatus.rxRingTail = ESP_DeviceStatus.rxRingHead;
+
+	UART_EnableInterrupts(ESP_DeviceStatus.uartPortNumber);
+
+	ESP_DeviceStatus.rxSize = 0;
+	ESP_DeviceStatus.rxBuffer[0] = '\0';
+	ESP_DeviceStatus.rxLineBegin = 0;
+
+	if(ESP_DeviceStatus.rxParserState == ESP_RX_STATE_PAYLOAD)
+		ESP_FinishRxPayload(false);
+
+	//partial messages are dropped
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
+	{
+		ESP_ResetFramer(i);
+	}
+
+	ESP_ResetSerialLinkFrame();
+}
+
+/*****************************************************************************************
+* ESP_GetReceivedMessage() - return the oldest received message from SocketBufferTable.
+* Message stay in SocketBufferTable until user clear lockFlag so user which can't process
+* message now can leave it for later. Message with set acceptedFlag was already taken by
+* user which use buffer until lockFlag will be cleared(for example response is coded in
+* place of request and wait for send) so it isn't returned again.
+*
+* Return: pointer to message or NULL if no message was received.
+*****************************************************************************************/
+SocketMessage* ESP_GetReceivedMessage(void)
+{
+	SocketMessage* oldestMessage = NULL;
+
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET_BUFFER; i++)
+	{
+		if(SocketBufferTable[i].lockFlag && (SocketBufferTable[i].acceptedFlag == false)
+			&& ((oldestMessage == NULL)
+				|| ((int8_t)(SocketBufferTable[i].sequenceNumber - oldestMessage->sequenceNumber) < 0)))
+		{
+			oldestMessage = &SocketBufferTable[i];
+		}
+	}
+
+	return oldestMessage;
+}
+
+/*****************************************************************************************
+* ESP_GetDroppedMessage() - take the oldest header of message which was received complete
+* but was dropped because all buffers in SocketBufferTable were used. Queue has
+* ESP_DROPPED_MESSAGE_QUEUE_SIZE entries, if it is full then next headers are lost and
+* RX_FRAME_ERROR is set.
+*
+* Parameters:
+* @droppedMessage: pointer to structure where socketId and header of message is copied.
+*
+* Return: true if header was copied, false if queue is empty.
+*****************************************************************************************/
+bool ESP_GetDroppedMessage(ESP_DroppedMessage* droppedMessage)
+{
+	if(ESP_DeviceStatus.droppedMessageCount == 0)
+		return false;
+
+	*droppedMessage = ESP_DeviceStatus.droppedMessageQueue[ESP_DeviceStatus.droppedMessageHead];
+	ESP_DeviceStatus.droppedMessageHead = (ESP_DeviceStatus.droppedMessageHead + 1) % ESP_DROPPED_MESSAGE_QUEUE_SIZE;
+	ESP_DeviceStatus.droppedMessageCount--;
+
+	return true;
+}
+
+/*****************************************************************************************
+* ESP_GetRxStatistics() - return counters of lost RX data and the highest observed usage
+* of RX ring. Counters are incremented in UART interrupt and are never cleared so they
+* can be used to choose size of RX ring and ESP_RX_PARSE_LIMIT.
+*
+* Return: ESP_RxStatistics structure with copy of counters.
+*****************************************************************************************/
+ESP_RxStatistics ESP_GetRxStatistics(void)
+{
+	ESP_RxStatistics statisticsTmp;
+
+	UART_DisableInterrupts(ESP_DeviceStatus.uartPortNumber);
+	statisticsTmp = ESP_RxStatistic;
+	UART_EnableInterrupts(ESP_DeviceStatus.uartPortNumber);
+
+	return statisticsTmp;
+}
+
+/*****************************************************************************************
+* ESP_GetUartPortNumber() - function return UART port number used by ESP layer. The same port
+* number was set during call initialization function(ESP_Init()).
+*
+* Return: UART port number used by ESP layer.
+*****************************************************************************************/
+uint8_t ESP_GetUartPortNumber(void)
+{
+	return ESP_DeviceStatus.uartPortNumber;
+}
+
+/*****************************************************************************************
+* ESP_QueueCommandSequence() - add list of commands to command queue. Commands are send one
+* after another by ESP_Process as soon as previous command will be finished. If one of
+* commands will fail(after all retries) then rest of commands from this list is removed
+* from queue and their callbacks are called with false result. Commands are added only if
+* whole list fit to queue. Direct call of request functions like ESP_SendDetectDeviceRequest
+* is still possible when queue is empty.
+*
+* Parameters:
+* @commandTable: table with commands. Content of table is copied to queue.
+* @numberOfCommands: number of commands inside table.
+*
+* Return: true if commands was added to queue.
+*****************************************************************************************/
+bool ESP_QueueCommandSequence(const ESP_Command* commandTable, uint8_t numberOfCommands)
+{
+	if((numberOfCommands == 0)
+		|| (numberOfCommands > (ESP_COMMAND_QUEUE_SIZE - ESP_DeviceStatus.commandQueueSize)))
+		return false;
+
+	ESP_DeviceStatus.commandSequenceNumber++;
+
+	for(uint8_t i = 0; i < numberOfCommands; i++)
+	{
+		ESP_CommandQueueEntry *entry = &ESP_DeviceStatus.commandQueue[(ESP_DeviceStatus.commandQueueHead
+			+ ESP_DeviceStatus.commandQueueSize) % ESP_COMMAND_QUEUE_SIZE];
+
+		entry->command = commandTable[i];
+		entry->sequenceNumber = ESP_DeviceStatus.commandSequenceNumber;
+		entry->retryCounter = 0;
+		ESP_DeviceStatus.commandQueueSize++;
+	}
+
+	return true;
+}
+
+/*****************************************************************************************
+* ESP_QueueCommand() - add single command to command queue.
+*
+* Parameters:
+* @command: pointer to command. Content of command is copied to queue.
+*
+* Return: true if command was added to queue.
+*****************************************************************************************/
+bool ESP_QueueCommand(const ESP_Command* command)
+{
+	return ESP_QueueCommandSequence(command, 1);
+}
+
+/*****************************************************************************************
+* ESP_GetQueuedCommandNumber() - function return number of commands inside command queue.
+* Command which is currently processed is also counted.
+*
+* Return: number of not finished commands.
+*****************************************************************************************/
+uint8_t ESP_GetQueuedCommandNumber(void)
+{
+	return ESP_DeviceStatus.commandQueueSize;
+}
+
+/*****************************************************************************************
+* ESP_ChangeBaudrate() - change baudrate of UART port used by ESP layer. Function should be
+* call when ESP8266 module confirm change of baudrate(ESP_SendUartConfigurationRequest) or
+* when previous baudrate should be restored. Data received during change of baudrate can
+* be broken so RX data is cleared.
+*
+* Parameters:
+* @baudrate: new baudrate of UART port.
+*
+* Return: true if baudrate was changed. False if ESP layer isn't ready, request wasn't
+* send yet or baudrate can't be set with acceptable error.
+*****************************************************************************************/
+bool ESP_ChangeBaudrate(uint32_t baudrate)
+{
+	if((ESP_DeviceStatus.deviceStatus != READY)
+		|| (UART_IsTransmitFinished(ESP_DeviceStatus.uartPortNumber) == false))
+		return false;
+
+	if(UART_ChangeBaudrate(ESP_DeviceStatus.uartPortNumber, baudrate) == false)
+		return false;
+
+	ESP_DeviceStatus.baudrate = baudrate;
+	ESP_ClearRxBuffer();
+
+	return true;
+}
+
+/*****************************************************************************************
+* ESP_GetBaudrate() - function return baudrate of UART port used by ESP layer.
+*
+* Return: baudrate set by ESP_Init or ESP_ChangeBaudrate.
+*****************************************************************************************/
+uint32_t ESP_GetBaudrate(void)
+{
+	return ESP_DeviceStatus.baudrate;
+}
+
+/*****************************************************************************************
+* USART0_IRQHandler() - function call if interruption on UART port occur. Function only
+* copy data from UART RX FIFO to RX ring and count lost data, data is parsed later by
+* ESP_Process. Data from UART TX ring is moved to TX FIFO by UART driver. Interrupt is the only writer of rxRingHead and ESP_Process is the only
+* writer of rxRingTail so access to RX ring don't need lock. If code inside this file will
+* be move to other microntroller this function must be changed or removed.
+*
+*****************************************************************************************/
+void USART0_IRQHandler(void)
+{
+	UART_Status status = UART_ReturnStatusRegister(ESP_DeviceStatus.uartPortNumber);
+
+	if(status.OE == 1)
+		ESP_RxStatistic.uartOverrunCounter++;
+
+	for(; status.RDR == 1;)
+	{
+		uint8_t rxByte = UART_ReadByteFromTrasmitter(ESP_DeviceStatus.uartPortNumber);
+		uint16_t nextHead = (ESP_DeviceStatus.rxRingHead + 1) & (ESP_RX_RING_SIZE - 1);
+
+		if(nextHead != ESP_DeviceStatus.rxRingTail)
+		{
+			uint16_t ringUsage;
+
+			ESP_DeviceStatus.rxRing[ESP_DeviceStatus.rxRingHead] = rxByte;
+			ESP_DeviceStatus.rxRingHead = nextHead;
+
+			ringUsage = (nextHead - ESP_DeviceStatus.rxRingTail) & (ESP_RX_RING_SIZE - 1);
+
+			if(ringUsage > ESP_RxStatistic.ringHighWatermark)
+				ESP_RxStatistic.ringHighWatermark = ringUsage;
+		}
+		else
+		{
+			ESP_RxStatistic.ringOverrunCounter++;
+		}
+
+		//refresh status register
+		status = UART_ReturnStatusRegister(ESP_DeviceStatus.uartPortNumber);
+
+		if(status.OE == 1)
+			ESP_RxStatistic.uartOverrunCounter++;
+	}
+
+	UART_ProcessTransmitInterrupt(ESP_DeviceStatus.uartPortNumber);
+}
+
+/*****************************************************************************************
+* ESP_GetStationStateEvent() - return state of station connection if it was changed by
+* event received from module(WIFI CONNECTED, WIFI GOT IP, WIFI DISCONNECT) since last call.
+* Module send those events without request so change of connection is detected without
+* polling by AT+CIPSTATUS. Events aren't received in passthrough mode.
+*
+* Parameters:
+* @stationState: pointer to variable where state of station connection will be stored.
+*
+* Return: true if state was changed since last call otherwise false.
+*****************************************************************************************/
+bool ESP_GetStationStateEvent(ESP_STATION_STATE *stationState)
+{
+	if(ESP_DeviceStatus.stationStateChanged == false)
+		return false;
+
+	*stationState = ESP_DeviceStatus.stationState;
+	ESP_DeviceStatus.stationStateChanged = false;
+
+	return true;
+}
@@ -1,236 +1,526 @@
-/*
- * Copyright (c) 2019, Adrian Chemicz
- * All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *    1. Redistributions of source code must retain the above copyright
- *       notice, this list of conditions and the following disclaimer.
- *    2. Redistributions in binary form must reproduce the above copyright
- *       notice, this list of conditions and the following disclaimer in the
- *       documentation and/or other materials provided with the distribution.
- *    3. Neither the name of contributors may be used to endorse or promote products
- *       derived from this software without specific prior written permission.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
- * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
- * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
- * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
- * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-
-#include "SOMEIP_Layer.h"
-#include <string.h>
-
-#if SOME_IP_CRC_EXTENSION
-#include <chip.h>
-#endif
-
-/*****************************************************************************************
-* SOMEIP_DecodeRxMessage() - Decode SOME/IP message and copy result to SomeIpMessage
-* structure.
-*
-* Parameters:
-* @someIpRxMessage: pointer to.SomeIpMessage structure which will be initiated by data inside
-*  rxBuffer if those data will be correct.
-* @externalBufferPointer: Pointer to destination buffer. If this pointer will be different than
-*  null then decoded data will be copied to pointed memory area and information about buffer
-*  location will be assigned to structure pointed by someIpRxMessage pointer.
-* @rxBuffer: pointer to buffer which hold raw SOME/IP message.
-* @rxBufferSize: size of data in rxBuffer.
-*
-* Return: Return true if data stored in rxBuffer is correct otherwise return false.
-*****************************************************************************************/
-bool SOMEIP_DecodeRxMessage(SomeIpMessage *someIpRxMessage, uint8_t *externalBufferPointer, uint8_t *rxBuffer, uint16_t rxBufferSize)
-{
-	uint32_t someIpLength = 0;
-	uint16_t someIpCrc = 0;
-	uint8_t *bufferPointerTmp = someIpRxMessage->payload;
-
-	//check that received frame can be validated(minimal length is fulfiled)
-	if(rxBufferSize < SOME_IP_MINIMAL_MESSAGE_SIZE)
-	{
-		return false;
-	}
-
-	//validate length in SOME/IP header
-	someIpLength = ((uint32_t)rxBuffer[SOME_IP_HEADER_LENGTH_FIELD_BEGIN] << 24U)
-		|((uint32_t)rxBuffer[SOME_IP_HEADER_LENGTH_FIELD_BEGIN + 1] << 16U)
-		|((uint32_t)rxBuffer[SOME_IP_HEADER_LENGTH_FIELD_BEGIN + 2] << 8U)
-		|(uint32_t)rxBuffer[SOME_IP_HEADER_LENGTH_FIELD_BEGIN + 3];
-
-	if(rxBufferSize != (someIpLength + SOME_IP_HEADER_LENGTH))
-	{
-		return false;
-	}
-
-	//validete protocol version and interface version
-	if((rxBuffer[SOME_IP_PROTOCOL_VERSION_FIELD_BEGIN] != SOME_IP_SUPPORTED_PROTOCOL_VERSION)
-		|| (rxBuffer[SOME_IP_PROTOCOL_VERSION_FIELD_BEGIN] != SOME_IP_SUPPORTED_INTERFACE_VERSION))
-	{
-		return false;
-	}
-
-	//validate message type
-	if((rxBuffer[SOME_IP_MESSAGE_TYPE_FIELD_BEGIN] != SOME_IP_REQUEST_CODE)
-		&& (rxBuffer[SOME_IP_MESSAGE_TYPE_FIELD_BEGIN] != SOME_IP_NOTIFICATION_CODE)
-		&& (rxBuffer[SOME_IP_MESSAGE_TYPE_FIELD_BEGIN] != SOME_IP_RESPONSE_CODE))
-	{
-		return false;
-	}
-
-#if SOME_IP_CRC_EXTENSION
-	//additional CRC protection code part
-	if(rxBufferSize >= (SOME_IP_MINIMAL_MESSAGE_SIZE + 2))
-	{
-		uint16_t someIpCalculatedCrc = 0;
-
-		/* on every request at end will be added two bytes of CRC16 calculated from
-	  	  whole packets(this isn't standard SOME/IP behaviour but additional protection) */
-		someIpCrc = ((uint16_t)rxBuffer[rxBufferSize - 2] << 8)|rxBuffer[rxBufferSize - 1];
-
-		memset(&rxBuffer[rxBufferSize - 2], 0, 3);
-
-		if(rxBufferSize % 2 != 0)
-		{
-			someIpCalculatedCrc = Chip_CRC_CRC16((uint16_t*)rxBuffer, (rxBufferSize - 1)/2);
-		}
-		else
-		{
-			someIpCalculatedCrc = Chip_CRC_CRC16((uint16_t*)rxBuffer, (rxBufferSize - 2)/2);
-		}
-
-		if(someIpCrc != someIpCalculatedCrc)
-		{
-			return false;
-		}
-	}
-	else
-	{
-		return false;
-	}
-#endif
-
-	/****************************************************************
-	 *	after validation initialize fields of SOME/IP message
-	 ****************************************************************/
-	someIpRxMessage->serviceId = ((uint16_t)rxBuffer[SOME_IP_SERVICE_ID_FIELD_BEGIN] << 8)
-			|rxBuffer[SOME_IP_SERVICE_ID_FIELD_BEGIN + 1];
-	someIpRxMessage->methodId = ((uint16_t)rxBuffer[SOME_IP_METHOD_ID_FIELD_BEGIN] << 8)
-			|rxBuffer[SOME_IP_METHOD_ID_FIELD_BEGIN + 1];
-	someIpRxMessage->messageType = rxBuffer[SOME_IP_MESSAGE_TYPE_FIELD_BEGIN];
-	someIpRxMessage->externalPayloadBufferPointer = externalBufferPointer;
-#if SOME_IP_CRC_EXTENSION
-	someIpRxMessage->payloadSize = rxBufferSize - SOME_IP_MINIMAL_MESSAGE_SIZE - 2;
-#else
-	someIpRxMessage->payloadSize = rxBufferSize - SOME_IP_MINIMAL_MESSAGE_SIZE;
-#endif
-	/****************************************************************
-	 *	copy payload
-	 ****************************************************************/
-	if(someIpRxMessage->externalPayloadBufferPointer == NULL)
-	{
-		if(someIpRxMessage->payloadSize > SOME_IP_MESSAGE_PAYLOAD_SIZE)
-		{
-			someIpRxMessage->payloadSize = SOME_IP_MESSAGE_PAYLOAD_SIZE;
-		}
-	}
-	else
-	{
-		bufferPointerTmp = someIpRxMessage->externalPayloadBufferPointer;
-	}
-
-	for(uint16_t i = 0; i < someIpRxMessage->payloadSize; i++)
-	{
-		bufferPointerTmp[i] = rxBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE + i];
-	}
-
-	return true;
-}
-
-/*****************************************************************************************
-* SOMEIP_CodeTxMessage() - Code SOME/IP message and copy to someIpTxMessageBuffer buffer.
-*
-* Parameters:
-* @serviceId: value of service id which will be copied to beggining of header.
-* @methodId: value of method id which will be copied to beggining of header.
-* @messageType: possible values of message type field was defined in SOME_IP_MESSAGE_TYPE
-* 	enum. Request code is SOME_IP_REQUEST_CODE value and response code is SOME_IP_RESPONSE_CODE
-* 	value.
-* @returnCode: few typical value of response code was defined in SOMEIP_Layer.h file. Example
-* 	typical value is SOME_IP_RETURN_CODE_E_OK_VALUE. User can define own return code.
-* @someIpTxMessageBuffer: pointer to address where SOME/IP message will be asembled.
-* @payloadPointer: pointer to SOME/IP message payload which isn't required because message
-* 	can be empty(contain only SOME/IP header).
-* @payloadSize: number of bytes which will be copied as SOME/IP message payload. If value will
-* 	be equal zero then will be send only SOME/IP header without SOME/IP payload which is allowed.
-*
-* Return: Return size of generated SOME/IP message.
-*****************************************************************************************/
-uint16_t SOMEIP_CodeTxMessage(uint16_t serviceId, uint16_t methodId, uint8_t messageType, uint8_t returnCode,
-		uint8_t *someIpTxMessageBuffer, uint8_t *payloadPointer, uint16_t payloadSize)
-{
-	uint16_t crcValue = 0;
-	uint16_t someIpLength = 0;
-
-	//clear
-	memset(someIpTxMessageBuffer, 0, SOME_IP_MINIMAL_MESSAGE_SIZE);
-
-	//service ID
-	someIpTxMessageBuffer[SOME_IP_SERVICE_ID_FIELD_BEGIN] = (uint8_t)serviceId>>8;
-	someIpTxMessageBuffer[SOME_IP_SERVICE_ID_FIELD_BEGIN + 1] = (uint8_t)serviceId&0xFF;
-
-	//method ID
-	someIpTxMessageBuffer[SOME_IP_METHOD_ID_FIELD_BEGIN] = (uint8_t)methodId>>8;
-	someIpTxMessageBuffer[SOME_IP_METHOD_ID_FIELD_BEGIN + 1] = (uint8_t)methodId&0xFF;
-
-	//client ID and sesion ID will be set as zero(value was set during start clearing)
-
-	//set protocol version field, interface version field, type field and return code field
-	someIpTxMessageBuffer[SOME_IP_PROTOCOL_VERSION_FIELD_BEGIN] = SOME_IP_SUPPORTED_PROTOCOL_VERSION;
-	someIpTxMessageBuffer[SOME_IP_INTERFACE_VERSION_FIELD_BEGIN] = SOME_IP_SUPPORTED_INTERFACE_VERSION;
-	someIpTxMessageBuffer[SOME_IP_MESSAGE_TYPE_FIELD_BEGIN] = messageType;
-	someIpTxMessageBuffer[SOME_IP_RETURN_CODE_FIELD_BEGIN] = returnCode;
-
-	//copy payload after header
-	if((payloadSize > 0) && (payloadPointer!= NULL))
-	{
-		memcpy(&someIpTxMessageBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE], payloadPointer, payloadSize);
-	}
-
-	someIpLength = (SOME_IP_MINIMAL_MESSAGE_SIZE - 8) + payloadSize;
-
-#if SOME_IP_CRC_EXTENSION
-	//add CRC field length
-	someIpLength += 2;
-#endif
-
-	//length
-	someIpTxMessageBuffer[SOME_IP_HEADER_LENGTH_FIELD_BEGIN] = (uint8_t)((someIpLength>>24)&0xFF);
-	someIpTxMessageBuffer[SOME_IP_HEADER_LENGTH_FIELD_BEGIN + 1] = (uint8_t)((someIpLength>>16)&0xFF);
-	someIpTxMessageBuffer[SOME_IP_HEADER_LENGTH_FIELD_BEGIN + 2] = (uint8_t)((someIpLength>>8)&0xFF);
-	someIpTxMessageBuffer[SOME_IP_HEADER_LENGTH_FIELD_BEGIN + 3] = (uint8_t)((someIpLength)&0xFF);
-
-#if SOME_IP_CRC_EXTENSION
-	memset(&someIpTxMessageBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE + payloadSize], 0, 3);
-
-	if(payloadSize > 0 && payloadSize % 2 != 0)
-	{
-		crcValue = Chip_CRC_CRC16((uint16_t*)someIpTxMessageBuffer, (SOME_IP_MINIMAL_MESSAGE_SIZE + payloadSize + 1)/2);
-	}
-	else
-	{
-		crcValue = Chip_CRC_CRC16((uint16_t*)someIpTxMessageBuffer, (SOME_IP_MINIMAL_MESSAGE_SIZE + payloadSize)/2);
-	}
-
-	someIpTxMessageBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE + payloadSize] = crcValue >> 8;
-	someIpTxMessageBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE + payloadSize + 1] = crcValue&0xFF;
-#endif
-
-	return (someIpLength + 8);
-}
+/*
+ * Copyright (c) 2019, Adrian Chemicz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "SOMEIP_Layer.h"
+#include <string.h>
+
+#if SOME_IP_CRC_EXTENSION
+#include <chip.h>
+#endif
+
+/*****************************************************************************************
+* SOMEIP_ReadUint16() - read big-endian 16 bit value from buffer. Buffer don't need to be
+* aligned.
+*
+* Parameters:
+* @buffer: pointer to first byte of value.
+*
+* Return: read value.
+*****************************************************************************************/
+uint16_t SOMEIP_ReadUint16(const uint8_t *buffer)
+{
+	return ((uint16_t)buffer[0] << 8) | buffer[1];
+}
+
+/*****************************************************************************************
+* SOMEIP_ReadUint32() - read big-endian 32 bit value from buffer. Buffer don't need to be
+* aligned.
+*
+* Parameters:
+* @buffer: pointer to first byte of value.
+*
+* Return: read value.
+*****************************************************************************************/
+uint32_t SOMEIP_ReadUint32(const uint8_t *buffer)
+{
+	return ((uint32_t)buffer[0] << 24U) | ((uint32_t)buffer[1] << 16U)
+		| ((uint32_t)buffer[2] << 8U) | (uint32_t)buffer[3];
+}
+
+/*****************************************************************************************
+* SOMEIP_WriteUint16() - write 16 bit value to buffer in big-endian order.
+*
+* Parameters:
+* @buffer: pointer to place of first byte of value.
+* @value: written value.
+*
+*****************************************************************************************/
+void SOMEIP_WriteUint16(uint8_t *buffer, uint16_t value)
+{
+	buffer[0] = (uint8_t)(value >> 8);
+	buffer[1] = (uint8_t)(value & 0xFF);
+}
+
+/*****************************************************************************************
+* SOMEIP_WriteUint32() - write 32 bit value to buffer in big-endian order.
+*
+* Parameters:
+* @buffer: pointer to place of first byte of value.
+* @value: written value.
+*
+*****************************************************************************************/
+void SOMEIP_WriteUint32(uint8_t *buffer, uint32_t value)
+{
+	buffer[0] = (uint8_t)((value >> 24) & 0xFF);
+	buffer[1] = (uint8_t)((value >> 16) & 0xFF);
+	buffer[2] = (uint8_t)((value >> 8) & 0xFF);
+	buffer[3] = (uint8_t)(value & 0xFF);
+}
+
+/*****************************************************************************************
+* SOMEIP_ValidateRxMessage() - check that buffer contain correct SOME/IP message(length,
+* versions, message type and CRC if extension is enabled). After validation fields of
+* message can be read directly from buffer by SOMEIP_GetServiceId, SOMEIP_GetMethodId,
+* SOMEIP_GetMessageType, SOMEIP_GetPayload and SOMEIP_GetPayloadSize. Bytes of CRC and
+* one byte after message are cleared during validation.
+*
+* Parameters:
+* @rxBuffer: pointer to buffer which hold raw SOME/IP message.
+* @rxBufferSize: size of data in rxBuffer.
+*
+* Return: Return true if data stored in rxBuffer is correct otherwise return false.
+*****************************************************************************************/
+bool SOMEIP_ValidateRxMessage(uint8_t *rxBuffer, uint16_t rxBufferSize)
+{
+	uint32_t someIpLength = 0;
+#if SOME_IP_CRC_EXTENSION
+	uint16_t someIpCrc = 0;
+#endif
+
+	//check that received frame can be validated(minimal length is fulfiled)
+	if(rxBufferSize < SOME_IP_MINIMAL_MESSAGE_SIZE)
+	{
+		return false;
+	}
+
+	//validate length in SOME/IP header
+	someIpLength = SOMEIP_ReadUint32(&rxBuffer[SOME_IP_HEADER_LENGTH_FIELD_BEGIN]);
+
+	if(rxBufferSize != (someIpLength + SOME_IP_HEADER_LENGTH))
+	{
+		return false;
+	}
+
+	//validete protocol version and interface version
+	if((rxBuffer[SOME_IP_PROTOCOL_VERSION_FIELD_BEGIN] != SOME_IP_SUPPORTED_PROTOCOL_VERSION)
+		|| (rxBuffer[SOME_IP_PROTOCOL_VERSION_FIELD_BEGIN] != SOME_IP_SUPPORTED_INTERFACE_VERSION))
+	{
+		return false;
+	}
+
+	//validate message type
+	if((rxBuffer[SOME_IP_MESSAGE_TYPE_FIELD_BEGIN] != SOME_IP_REQUEST_CODE)
+		&& (rxBuffer[SOME_IP_MESSAGE_TYPE_FIELD_BEGIN] != SOME_IP_NOTIFICATION_CODE)
+		&& (rxBuffer[SOME_IP_MESSAGE_TYPE_FIELD_BEGIN] != SOME_IP_RESPONSE_CODE))
+	{
+		return false;
+	}
+
+#if SOME_IP_CRC_EXTENSION
+	//additional CRC protection code part
+	if(rxBufferSize >= (SOME_IP_MINIMAL_MESSAGE_SIZE + 2))
+	{
+		uint16_t someIpCalculatedCrc = 0;
+
+		/* on every request at end will be added two bytes of CRC16 calculated from
+	  	  whole packets(this isn't standard SOME/IP behaviour but additional protection) */
+		someIpCrc = SOMEIP_ReadUint16(&rxBuffer[rxBufferSize - 2]);
+
+		memset(&rxBuffer[rxBufferSize - 2], 0, 3);
+
+		if(rxBufferSize % 2 != 0)
+		{
+			someIpCalculatedCrc = Chip_CRC_CRC16((uint16_t*)rxBuffer, (rxBufferSize - 1)/2);
+		}
+		else
+		{
+			someIpCalculatedCrc = Chip_CRC_CRC16((uint16_t*)rxBuffer, (rxBufferSize - 2)/2);
+		}
+
+		if(someIpCrc != someIpCalculatedCrc)
+		{
+			return false;
+		}
+	}
+	else
+	{
+		return false;
+	}
+#endif
+
+	return true;
+}
+
+/*****************************************************************************************
+* SOMEIP_GetServiceId() - read service ID from header of validated message.
+*
+* Parameters:
+* @message: pointer to buffer with message.
+*
+* Return: service ID.
+*****************************************************************************************/
+uint16_t SOMEIP_GetServiceId(const uint8_t *message)
+{
+	return SOMEIP_ReadUint16(&message[SOME_IP_SERVICE_ID_FIELD_BEGIN]);
+}
+
+/*****************************************************************************************
+* SOMEIP_GetMethodId() - read method ID from header of validated message.
+*
+* Parameters:
+* @message: pointer to buffer with message.
+*
+* Return: method ID.
+*****************************************************************************************/
+uint16_t SOMEIP_GetMethodId(const uint8_t *message)
+{
+	return SOMEIP_ReadUint16(&message[SOME_IP_METHOD_ID_FIELD_BEGIN]);
+}
+
+/*****************************************************************************************
+* SOMEIP_GetMessageType() - read message type from header of validated message.
+*
+* Parameters:
+* @message: pointer to buffer with message.
+*
+* Return: message type.
+*****************************************************************************************/
+uint8_t SOMEIP_GetMessageType(const uint8_t *message)
+{
+	return message[SOME_IP_MESSAGE_TYPE_FIELD_BEGIN];
+}
+
+/*****************************************************************************************
+* SOMEIP_GetPayload() - return pointer to payload of validated message. If message buffer
+* is aligned to 4 bytes then payload is aligned too.
+*
+* Parameters:
+* @message: pointer to buffer with message.
+*
+* Return: pointer to first byte of payload.
+*****************************************************************************************/
+uint8_t* SOMEIP_GetPayload(uint8_t *message)
+{
+	return &message[SOME_IP_MINIMAL_MESSAGE_SIZE];
+}
+
+/*****************************************************************************************
+* SOMEIP_GetPayloadSize() - calculate size of payload of validated message from length
+* field. CRC of extension isn't treat as part of payload.
+*
+* Parameters:
+* @message: pointer to buffer with message.
+*
+* Return: number of bytes of payload.
+*****************************************************************************************/
+uint16_t SOMEIP_GetPayloadSize(const uint8_t *message)
+{
+	uint16_t payloadSize = SOMEIP_ReadUint32(&message[SOME_IP_HEADER_LENGTH_FIELD_BEGIN])
+		- (SOME_IP_MINIMAL_MESSAGE_SIZE - SOME_IP_HEADER_LENGTH);
+
+#if SOME_IP_CRC_EXTENSION
+	payloadSize -= SOME_IP_CRC_SIZE;
+#endif
+
+	return payloadSize;
+}
+
+/*****************************************************************************************
+* SOMEIP_DecodeRxMessage() - Decode SOME/IP message and copy result to SomeIpMessage
+* structure.
+*
+* Parameters:
+* @someIpRxMessage: pointer to.SomeIpMessage structure which will be initiated by data inside
+*  rxBuffer if those data will be correct.
+* @externalBufferPointer: Pointer to destination buffer. If this pointer will be different than
+*  null then decoded data will be copied to pointed memory area and information about buffer
+*  location will be assigned to structure pointed by someIpRxMessage pointer.
+* @rxBuffer: pointer to buffer which hold raw SOME/IP message.
+* @rxBufferSize: size of data in rxBuffer.
+*
+* Return: Return true if data stored in rxBuffer is correct otherwise return false.
+*****************************************************************************************/
+bool SOMEIP_DecodeRxMessage(SomeIpMessage *someIpRxMessage, uint8_t *externalBufferPointer, uint8_t *rxBuffer, uint16_t rxBufferSize)
+{
+	uint8_t *bufferPointerTmp = someIpRxMessage->payload;
+
+	if(SOMEIP_ValidateRxMessage(rxBuffer, rxBufferSize) == false)
+	{
+		return false;
+	}
+
+	/****************************************************************
+	 *	after validation initialize fields of SOME/IP message
+	 ****************************************************************/
+	someIpRxMessage->serviceId = SOMEIP_GetServiceId(rxBuffer);
+	someIpRxMessage->methodId = SOMEIP_GetMethodId(rxBuffer);
+	someIpRxMessage->messageType = SOMEIP_GetMessageType(rxBuffer);
+	someIpRxMessage->externalPayloadBufferPointer = externalBufferPointer;
+	someIpRxMessage->payloadSize = SOMEIP_GetPayloadSize(rxBuffer);
+	/****************************************************************
+	 *	copy payload
+	 ****************************************************************/
+	if(someIpRxMessage->externalPayloadBufferPointer == NULL)
+	{
+		if(someIpRxMessage->payloadSize > SOME_IP_MESSAGE_PAYLOAD_SIZE)
+		{
+			someIpRxMessage->payloadSize = SOME_IP_MESSAGE_PAYLOAD_SIZE;
+		}
+	}
+	else
+	{
+		bufferPointerTmp = someIpRxMessage->externalPayloadBufferPointer;
+	}
+
+	for(uint16_t i = 0; i < someIpRxMessage->payloadSize; i++)
+	{
+		bufferPointerTmp[i] = rxBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE + i];
+	}
+
+	return true;
+}
+
+/*****************************************************************************************
+* SOMEIP_CodeTxMessage() - Code SOME/IP message and copy to someIpTxMessageBuffer buffer.
+*
+* Parameters:
+* @serviceId: value of service id which will be copied to beggining of header.
+* @methodId: value of method id which will be copied to beggining of header.
+* @messageType: possible values of message type field was defined in SOME_IP_MESSAGE_TYPE
+* 	enum. Request code is SOME_IP_REQUEST_CODE value and response code is SOME_IP_RESPONSE_CODE
+* 	value.
+* @returnCode: few typical value of response code was defined in SOMEIP_Layer.h file. Example
+* 	typical value is SOME_IP_RETURN_CODE_E_OK_VALUE. User can define own return code.
+* @someIpTxMessageBuffer: pointer to address where SOME/IP message will be asembled.
+* @payloadPointer: pointer to SOME/IP message payload which isn't required because message
+* 	can be empty(contain only SOME/IP header). If pointer is NULL and payloadSize isn't zero
+* 	then payload must be already placed in buffer after SOME/IP header.
+* @payloadSize: number of bytes which will be copied as SOME/IP message payload. If value will
+* 	be equal zero then will be send only SOME/IP header without SOME/IP payload which is allowed.
+*
+* Return: Return size of generated SOME/IP message.
+*****************************************************************************************/
+uint16_t SOMEIP_CodeTxMessage(uint16_t serviceId, uint16_t methodId, uint8_t messageType, uint8_t returnCode,
+		uint8_t *someIpTxMessageBuffer, uint8_t *payloadPointer, uint16_t payloadSize)
+{
+	uint16_t crcValue = 0;
+	uint16_t someIpLength = 0;
+
+	//clear
+	memset(someIpTxMessageBuffer, 0, SOME_IP_MINIMAL_MESSAGE_SIZE);
+
+	//service ID
+	SOMEIP_WriteUint16(&someIpTxMessageBuffer[SOME_IP_SERVICE_ID_FIELD_BEGIN], serviceId);
+
+	//method ID
+	SOMEIP_WriteUint16(&someIpTxMessageBuffer[SOME_IP_METHOD_ID_FIELD_BEGIN], methodId);
+
+	//client ID and sesion ID will be set as zero(value was set during start clearing)
+
+	//set protocol version field, interface version field, type field and return code field
+	someIpTxMessageBuffer[SOME_IP_PROTOCOL_VERSION_FIELD_BEGIN] = SOME_IP_SUPPORTED_PROTOCOL_VERSION;
+	someIpTxMessageBuffer[SOME_IP_INTERFACE_VERSION_FIELD_BEGIN] = SOME_IP_SUPPORTED_INTERFACE_VERSION;
+	someIpTxMessageBuffer[SOME_IP_MESSAGE_TYPE_FIELD_BEGIN] = messageType;
+	someIpTxMessageBuffer[SOME_IP_RETURN_CODE_FIELD_BEGIN] = returnCode;
+
+	//copy payload after header
+	if((payloadSize > 0) && (payloadPointer!= NULL))
+	{
+		memcpy(&someIpTxMessageBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE], payloadPointer, payloadSize);
+	}
+
+	someIpLength = (SOME_IP_MINIMAL_MESSAGE_SIZE - 8) + payloadSize;
+
+#if SOME_IP_CRC_EXTENSION
+	//add CRC field length
+	someIpLength += 2;
+#endif
+
+	//length
+	SOMEIP_WriteUint32(&someIpTxMessageBuffer[SOME_IP_HEADER_LENGTH_FIELD_BEGIN], someIpLength);
+
+#if SOME_IP_CRC_EXTENSION
+	memset(&someIpTxMessageBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE + payloadSize], 0, 3);
+
+	if(payloadSize > 0 && payloadSize % 2 != 0)
+	{
+		crcValue = Chip_CRC_CRC16((uint16_t*)someIpTxMessageBuffer, (SOME_IP_MINIMAL_MESSAGE_SIZE + payloadSize + 1)/2);
+	}
+	else
+	{
+		crcValue = Chip_CRC_CRC16((uint16_t*)someIpTxMessageBuffer, (SOME_IP_MINIMAL_MESSAGE_SIZE + payloadSize)/2);
+	}
+
+	SOMEIP_WriteUint16(&someIpTxMessageBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE + payloadSize], crcValue);
+#endif
+
+	return (someIpLength + 8);
+}
+
+/*****************************************************************************************
+* SOMEIP_CodeTpTxMessage() - Code segment of SOME/IP message and copy to
+* someIpTxMessageBuffer buffer. TP header is placed before payload and SOME_IP_TP_FLAG is
+* added to message type.
+*
+* Parameters:
+* @serviceId: value of service id which will be copied to beggining of header.
+* @methodId: value of method id which will be copied to beggining of header.
+* @messageType: message type without SOME_IP_TP_FLAG for example SOME_IP_RESPONSE_CODE.
+* @returnCode: value of return code field.
+* @someIpTxMessageBuffer: pointer to address where SOME/IP message will be asembled.
+* @segmentOffset: position of segment in original payload in bytes. Value must be multiply
+* 	of SOME_IP_TP_OFFSET_UNIT.
+* @moreSegments: true if segment isn't last.
+* @payloadPointer: pointer to data of segment. If pointer is NULL then data must be already
+* 	placed in buffer after SOME/IP header and TP header.
+* @payloadSize: number of bytes of segment. If segment isn't last then value must be
+* 	multiply of SOME_IP_TP_OFFSET_UNIT.
+*
+* Return: Return size of generated SOME/IP message.
+*****************************************************************************************/
+uint16_t SOMEIP_CodeTpTxMessage(uint16_t serviceId, uint16_t methodId, uint8_t messageType, uint8_t returnCode,
+		uint8_t *someIpTxMessageBuffer, uint32_t segmentOffset, bool moreSegments, uint8_t *payloadPointer,
+		uint16_t payloadSize)
+{
+	uint8_t *tpHeaderPointer = &someIpTxMessageBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE];
+	//offset is stored in 28 upper bits in 16 bytes units so it is equal offset in bytes with cleared 4 lower bits
+	uint32_t tpHeaderValue = segmentOffset & ~(uint32_t)(SOME_IP_TP_OFFSET_UNIT - 1);
+
+	if(moreSegments)
+	{
+		tpHeaderValue |= SOME_IP_TP_MORE_SEGMENTS_FLAG;
+	}
+
+	if((payloadSize > 0) && (payloadPointer != NULL))
+	{
+		memcpy(&tpHeaderPointer[SOME_IP_TP_HEADER_SIZE], payloadPointer, payloadSize);
+	}
+
+	SOMEIP_WriteUint32(tpHeaderPointer, tpHeaderValue);
+
+	//TP header is treat as part of payload
+	return SOMEIP_CodeTxMessage(serviceId, methodId, messageType | SOME_IP_TP_FLAG, returnCode,
+			someIpTxMessageBuffer, NULL, payloadSize + SOME_IP_TP_HEADER_SIZE);
+}
+
+/*****************************************************************************************
+* SOMEIP_InitWriter() - prepare writer which build payload of message directly in TX
+* buffer after place of SOME/IP header. Space for CRC of extension is reserved.
+*
+* Parameters:
+* @writer: pointer to initialized writer.
+* @someIpTxMessageBuffer: pointer to address where SOME/IP message will be asembled.
+* @bufferSize: size of buffer in bytes.
+*
+*****************************************************************************************/
+void SOMEIP_InitWriter(SomeIpWriter *writer, uint8_t *someIpTxMessageBuffer, uint16_t bufferSize)
+{
+	writer->someIpTxMessageBuffer = someIpTxMessageBuffer;
+	writer->payloadSize = 0;
+	writer->overflow = false;
+
+	//SOMEIP_CodeTxMessage clear one byte after CRC
+	if(bufferSize > (SOME_IP_MINIMAL_MESSAGE_SIZE + SOME_IP_CRC_SIZE + 1))
+	{
+		writer->maxPayloadSize = bufferSize - (SOME_IP_MINIMAL_MESSAGE_SIZE + SOME_IP_CRC_SIZE + 1);
+	}
+	else
+	{
+		writer->maxPayloadSize = 0;
+	}
+}
+
+/*****************************************************************************************
+* SOMEIP_WriterReserve() - reserve place for next bytes of payload. Place can be filled by
+* user, for example as structure because payload begin 16 bytes after begin of buffer.
+*
+* Parameters:
+* @writer: pointer to writer.
+* @size: number of reserved bytes.
+*
+* Return: pointer to reserved place or NULL if payload would exceed buffer. After
+*  overflow next calls return NULL and message can't be finished.
+*****************************************************************************************/
+uint8_t* SOMEIP_WriterReserve(SomeIpWriter *writer, uint16_t size)
+{
+	uint8_t *reservedPointer = NULL;
+
+	if(writer->overflow || (size > (writer->maxPayloadSize - writer->payloadSize)))
+	{
+		writer->overflow = true;
+
+		return NULL;
+	}
+
+	reservedPointer = &writer->someIpTxMessageBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE + writer->payloadSize];
+	writer->payloadSize += size;
+
+	return reservedPointer;
+}
+
+/*****************************************************************************************
+* SOMEIP_WriteBytes() - append bytes to payload.
+*
+* Parameters:
+* @writer: pointer to writer.
+* @data: pointer to appended bytes.
+* @size: number of appended bytes.
+*
+* Return: false if payload would exceed buffer.
+*****************************************************************************************/
+bool SOMEIP_WriteBytes(SomeIpWriter *writer, const uint8_t *data, uint16_t size)
+{
+	uint8_t *reservedPointer = SOMEIP_WriterReserve(writer, size);
+
+	if(reservedPointer == NULL)
+		return false;
+
+	memcpy(reservedPointer, data, size);
+
+	return true;
+}
+
+/*****************************************************************************************
+* SOMEIP_WriterFinish() - code SOME/IP header and CRC around payload built by writer.
+*
+* Parameters:
+* @writer: pointer to writer.
+* @serviceId: value of service id.
+* @methodId: value of method id.
+* @messageType: value of message type field.
+* @returnCode: value of return code field.
+*
+* Return: size of generated SOME/IP message or 0 if payload exceeded buffer.
+*****************************************************************************************/
+uint16_t SOMEIP_WriterFinish(SomeIpWriter *writer, uint16_t serviceId, uint16_t methodId, uint8_t messageType,
+		uint8_t returnCode)
+{
+	if(writer->overflow)
+		return 0;
+
+	return SOMEIP_CodeTxMessage(serviceId, methodId, messageType, returnCode, writer->someIpTxMessageBuffer,
+			NULL, writer->payloadSize);
+}
@@ -0,0 +1,291 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/* Generated by GenerateSomeIpInterface.py from SomeIpInterface.json, don't edit. */
+
+#include "SomeIpInterface.h"
+#include <string.h>
+
+#define METHOD_KEY(serviceId, methodId)	((((uint32_t)(serviceId)) << 16) | (methodId))
+
+/*
+ * Supported methods sorted by service ID and first method ID, WIFI_FindMethodDescriptor
+ * use binary search. One entry can describe range of methods with the same payload.
+ */
+const WifiMethodDescriptorType MethodDescriptorTable[NUMBER_OF_METHOD_DESCRIPTORS] = {
+	{SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET,
+		SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET_PAYLOAD_SIZE, false, WIFI_ClockStatusSetHandler},
+	{SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET,
+		0, false, WIFI_ClockStatusGetHandler},
+	{SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE,
+		SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE_PAYLOAD_SIZE, false, WIFI_ClockStatusSubscribeHandler},
+	{SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE,
+		SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE_PAYLOAD_SIZE, false, WIFI_ClockStatusSubscribeHandler},
+	{SOME_IP_SERVICE_DAY_MEASUREMENT, 0, SOME_IP_SERVICE_DAY_MEASUREMENT_NUMBER_OF_PARTS - 1,
+		SOME_IP_SERVICE_DAY_MEASUREMENT_REQ_PAYLOAD_SIZE, true, WIFI_DayMeasurementHandler},
+	{SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_GET_SEGMENTED, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_GET_SEGMENTED,
+		SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENTED_REQ_PAYLOAD_SIZE, true, WIFI_DayMeasurementHandler},
+	{SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_RANGE_QUERY, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_RANGE_QUERY,
+		SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_REQ_PAYLOAD_SIZE, true, WIFI_RangeQueryHandler},
+	{SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST,
+		SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_REQ_PAYLOAD_SIZE, true, WIFI_RangeQueryHandler},
+	{SOME_IP_SERVICE_DAY_SUMMARY, SOME_IP_SERVICE_DAY_SUMMARY_METHOD_GET, SOME_IP_SERVICE_DAY_SUMMARY_METHOD_GET,
+		SOME_IP_SERVICE_DAY_MEASUREMENT_REQ_PAYLOAD_SIZE, true, WIFI_DayMeasurementHandler},
+#if WIFI_FRAM_IMAGE_SERVICE
+	{SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_EXPORT, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_EXPORT,
+		SOME_IP_SERVICE_FRAM_IMAGE_EXPORT_REQ_PAYLOAD_SIZE, true, WIFI_FramImageExportHandler},
+	{SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_IMPORT, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_IMPORT,
+		SOME_IP_SERVICE_FRAM_IMAGE_IMPORT_REQ_PAYLOAD_SIZE, true, WIFI_FramImageImportHandler},
+	{SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_VALIDATE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_VALIDATE,
+		0, true, WIFI_FramImageValidateHandler},
+#endif
+};
+
+//range of each method and order of table, identifiers don't depend on conditions of services
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET)
+	< METHOD_KEY(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET), "CLOCK_STATUS GET must be after CLOCK_STATUS SET");
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET)
+	< METHOD_KEY(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE), "CLOCK_STATUS SUBSCRIBE must be after CLOCK_STATUS GET");
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE)
+	< METHOD_KEY(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE), "CLOCK_STATUS UNSUBSCRIBE must be after CLOCK_STATUS SUBSCRIBE");
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE)
+	< METHOD_KEY(SOME_IP_SERVICE_DAY_MEASUREMENT, 0), "DAY_MEASUREMENT PART must be after CLOCK_STATUS UNSUBSCRIBE");
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_DAY_MEASUREMENT, 0)
+	<= METHOD_KEY(SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_NUMBER_OF_PARTS - 1), "DAY_MEASUREMENT PART has empty range");
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_NUMBER_OF_PARTS - 1)
+	< METHOD_KEY(SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_GET_SEGMENTED), "DAY_MEASUREMENT GET_SEGMENTED must be after DAY_MEASUREMENT PART");
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_GET_SEGMENTED)
+	< METHOD_KEY(SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_RANGE_QUERY), "DAY_MEASUREMENT RANGE_QUERY must be after DAY_MEASUREMENT GET_SEGMENTED");
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_RANGE_QUERY)
+	< METHOD_KEY(SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST), "DAY_MEASUREMENT MANIFEST must be after DAY_MEASUREMENT RANGE_QUERY");
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST)
+	< METHOD_KEY(SOME_IP_SERVICE_DAY_SUMMARY, SOME_IP_SERVICE_DAY_SUMMARY_METHOD_GET), "DAY_SUMMARY GET must be after DAY_MEASUREMENT MANIFEST");
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_DAY_SUMMARY, SOME_IP_SERVICE_DAY_SUMMARY_METHOD_GET)
+	< METHOD_KEY(SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_EXPORT), "FRAM_IMAGE EXPORT must be after DAY_SUMMARY GET");
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_EXPORT)
+	< METHOD_KEY(SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_IMPORT), "FRAM_IMAGE IMPORT must be after FRAM_IMAGE EXPORT");
+_Static_assert(METHOD_KEY(SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_IMPORT)
+	< METHOD_KEY(SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_VALIDATE), "FRAM_IMAGE VALIDATE must be after FRAM_IMAGE IMPORT");
+
+/*****************************************************************************************
+* SomeIpInterface_DecodeClockStatusSetRequest() - read request payload of CLOCK_STATUS
+* SET.
+*
+* Parameters:
+* @payload: pointer to payload with checked size.
+* @structure: pointer to structure filled by fields of payload.
+*
+*****************************************************************************************/
+void SomeIpInterface_DecodeClockStatusSetRequest(const uint8_t* payload, SomeIpClockStatusSetRequestMethodPayload* structure)
+{
+	structure->minute = payload[0];
+	structure->hour = payload[1];
+	structure->day = payload[2];
+	structure->month = payload[3];
+	structure->year = payload[4];
+}
+
+/*****************************************************************************************
+* SomeIpInterface_DecodeClockStatusSubscribeRequest() - read request payload of
+* CLOCK_STATUS SUBSCRIBE.
+*
+* Parameters:
+* @payload: pointer to payload with checked size.
+* @structure: pointer to structure filled by fields of payload.
+*
+*****************************************************************************************/
+void SomeIpInterface_DecodeClockStatusSubscribeRequest(const uint8_t* payload, SomeIpClockStatusSubscribeRequestMethodPayload* structure)
+{
+	structure->eventgroupMask = payload[0];
+	structure->reserved = payload[1];
+	structure->minimumInterval = (uint16_t)payload[2] | ((uint16_t)payload[3] << 8);
+}
+
+/*****************************************************************************************
+* SomeIpInterface_DecodeClockStatusUnsubscribeRequest() - read request payload of
+* CLOCK_STATUS UNSUBSCRIBE.
+*
+* Parameters:
+* @payload: pointer to payload with checked size.
+* @structure: pointer to structure filled by fields of payload.
+*
+*****************************************************************************************/
+void SomeIpInterface_DecodeClockStatusUnsubscribeRequest(const uint8_t* payload, SomeIpClockStatusSubscribeRequestMethodPayload* structure)
+{
+	memset(structure, 0, sizeof(SomeIpClockStatusSubscribeRequestMethodPayload));
+
+	structure->eventgroupMask = payload[0];
+}
+
+/*****************************************************************************************
+* SomeIpInterface_DecodeDayMeasurementPartRequest() - read request payload of
+* DAY_MEASUREMENT PART.
+*
+* Parameters:
+* @payload: pointer to payload with checked size.
+* @structure: pointer to structure filled by fields of payload.
+*
+*****************************************************************************************/
+void SomeIpInterface_DecodeDayMeasurementPartRequest(const uint8_t* payload, SomeIpDayMeasurmentRequestPayload* structure)
+{
+	structure->source = payload[0];
+	structure->day = payload[1];
+	structure->month = payload[2];
+	structure->year = payload[3];
+}
+
+/*****************************************************************************************
+* SomeIpInterface_DecodeDayMeasurementGetSegmentedRequest() - read request payload of
+* DAY_MEASUREMENT GET_SEGMENTED.
+*
+* Parameters:
+* @payload: pointer to payload with checked size.
+* @structure: pointer to structure filled by fields of payload.
+*
+*****************************************************************************************/
+void SomeIpInterface_DecodeDayMeasurementGetSegmentedRequest(const uint8_t* payload, SomeIpDayMeasurmentSegmentedRequestPayload* structure)
+{
+	structure->source = payload[0];
+	structure->day = payload[1];
+	structure->month = payload[2];
+	structure->year = payload[3];
+	structure->requestedSegmentsMask = (uint32_t)payload[4] | ((uint32_t)payload[5] << 8) | ((uint32_t)payload[6] << 16) | ((uint32_t)payload[7] << 24);
+}
+
+/*****************************************************************************************
+* SomeIpInterface_DecodeDayMeasurementRangeQueryRequest() - read request payload of
+* DAY_MEASUREMENT RANGE_QUERY.
+*
+* Parameters:
+* @payload: pointer to payload with checked size.
+* @structure: pointer to structure filled by fields of payload.
+*
+*****************************************************************************************/
+void SomeIpInterface_DecodeDayMeasurementRangeQueryRequest(const uint8_t* payload, SomeIpRangeQueryRequestPayload* structure)
+{
+	structure->sourceMask = payload[0];
+	structure->firstDay = payload[1];
+	structure->firstMonth = payload[2];
+	structure->firstYear = payload[3];
+	structure->step = payload[4];
+	structure->lastDay = payload[5];
+	structure->lastMonth = payload[6];
+	structure->lastYear = payload[7];
+}
+
+#if WIFI_FRAM_IMAGE_SERVICE
+/*****************************************************************************************
+* SomeIpInterface_DecodeFramImageExportRequest() - read request payload of FRAM_IMAGE
+* EXPORT.
+*
+* Parameters:
+* @payload: pointer to payload with checked size.
+* @structure: pointer to structure filled by fields of payload.
+*
+*****************************************************************************************/
+void SomeIpInterface_DecodeFramImageExportRequest(const uint8_t* payload, SomeIpFramImageExportRequestPayload* structure)
+{
+	structure->firstBlockIndex = (uint16_t)payload[0] | ((uint16_t)payload[1] << 8);
+	structure->numberOfBlocks = (uint16_t)payload[2] | ((uint16_t)payload[3] << 8);
+}
+#endif
+
+#if WIFI_FRAM_IMAGE_SERVICE
+/*****************************************************************************************
+* SomeIpInterface_DecodeFramImageImportRequest() - read request payload of FRAM_IMAGE
+* IMPORT.
+*
+* Parameters:
+* @payload: pointer to payload with checked size.
+* @structure: pointer to structure filled by fields of payload.
+*
+*****************************************************************************************/
+void SomeIpInterface_DecodeFramImageImportRequest(const uint8_t* payload, SomeIpFramImageImportRequestPayload* structure)
+{
+	structure->blockIndex = (uint16_t)payload[0] | ((uint16_t)payload[1] << 8);
+	structure->crc16Value = (uint16_t)payload[2] | ((uint16_t)payload[3] << 8);
+	memcpy(structure->data, &payload[4], WIFI_FRAM_IMAGE_BLOCK_SIZE);
+}
+#endif
+
+/*****************************************************************************************
+* SomeIpInterface_EncodeClockStatusGetResponse() - write response payload of CLOCK_STATUS
+* GET.
+*
+* Parameters:
+* @payload: pointer to payload with size SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET_PAYLOAD_SIZE.
+* @structure: pointer to structure with values of fields.
+*
+*****************************************************************************************/
+void SomeIpInterface_EncodeClockStatusGetResponse(uint8_t* payload, const SomeIpClockStatusGetResponseMethodPayload* structure)
+{
+	payload[0] = structure->minute;
+	payload[1] = structure->hour;
+	payload[2] = structure->day;
+	payload[3] = structure->month;
+	payload[4] = structure->year;
+	payload[5] = structure->reserved;
+	payload[6] = (uint8_t)structure->temperatureOutside;
+	payload[7] = (uint8_t)(structure->temperatureOutside >> 8);
+	payload[8] = (uint8_t)structure->temperatureInside;
+	payload[9] = (uint8_t)(structure->temperatureInside >> 8);
+	payload[10] = (uint8_t)structure->temperatureFurnace;
+	payload[11] = (uint8_t)(structure->temperatureFurnace >> 8);
+}
+
+/*****************************************************************************************
+* SomeIpInterface_EncodeDaySummaryGetResponse() - write response payload of DAY_SUMMARY
+* GET.
+*
+* Parameters:
+* @payload: pointer to payload with size SOME_IP_SERVICE_DAY_SUMMARY_RESP_PAYLOAD_SIZE.
+* @structure: pointer to structure with values of fields.
+*
+*****************************************************************************************/
+void SomeIpInterface_EncodeDaySummaryGetResponse(uint8_t* payload, const SomeIpDaySummaryResponsePayload* structure)
+{
+	payload[0] = (uint8_t)structure->minTemperature;
+	payload[1] = (uint8_t)(structure->minTemperature >> 8);
+	payload[2] = (uint8_t)structure->maxTemperature;
+	payload[3] = (uint8_t)(structure->maxTemperature >> 8);
+	payload[4] = (uint8_t)structure->averageTemperature;
+	payload[5] = (uint8_t)(structure->averageTemperature >> 8);
+	payload[6] = (uint8_t)structure->numberOfTemperatures;
+	payload[7] = (uint8_t)(structure->numberOfTemperatures >> 8);
+}
+
+#if WIFI_FRAM_IMAGE_SERVICE
+/*****************************************************************************************
+* SomeIpInterface_EncodeFramImageValidateResponse() - write response payload of FRAM_IMAGE
+* VALIDATE.
+*
+* Parameters:
+* @payload: pointer to payload with size SOME_IP_SERVICE_FRAM_IMAGE_VALIDATE_RESP_PAYLOAD_SIZE.
+* @structure: pointer to structure with values of fields.
+*
+*****************************************************************************************/
+void SomeIpInterface_EncodeFramImageValidateResponse(uint8_t* payload, const SomeIpFramImageValidateResponsePayload* structure)
+{
+	payload[0] = (uint8_t)structure->numberOfValidRecords;
+	payload[1] = (uint8_t)(structure->numberOfValidRecords >> 8);
+	payload[2] = (uint8_t)structure->numberOfDamagedRecords;
+	payload[3] = (uint8_t)(structure->numberOfDamagedRecords >> 8);
+	payload[4] = (uint8_t)structure->numberOfEmptyRecords;
+	payload[5] = (uint8_t)(structure->numberOfEmptyRecords >> 8);
+}
+#endif
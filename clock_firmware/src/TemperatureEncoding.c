@@ -0,0 +1,118 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "TemperatureEncoding.h"
+
+/*****************************************************************************************
+* TemperatureEncoding_EncodeDelta() - code values as zig-zag varint differences between
+* consecutive values. Coding is stopped when next value don't fit in buffer so caller can
+* send rest of values in next message.
+*
+* Parameters:
+* @values: pointer to table of coded values.
+* @numberOfValues: number of values in table.
+* @buffer: pointer to buffer where coded values will be stored.
+* @bufferSize: size of buffer.
+* @numberOfEncodedValues: pointer to variable where number of values which fit in buffer
+*  will be stored.
+*
+* Return: number of bytes used in buffer.
+*****************************************************************************************/
+uint16_t TemperatureEncoding_EncodeDelta(const uint16_t *values, uint8_t numberOfValues, uint8_t *buffer,
+		uint16_t bufferSize, uint8_t *numberOfEncodedValues)
+{
+	uint16_t previousValue = 0;
+	uint16_t usedBytes = 0;
+	uint8_t i = 0;
+
+	for(i = 0; i < numberOfValues; i++)
+	{
+		int16_t difference = (int16_t)(values[i] - previousValue);
+		uint16_t zigZagValue = (uint16_t)((uint16_t)difference << 1) ^ (uint16_t)(difference >> 15);
+		uint8_t codedBytes[TEMPERATURE_ENCODING_MAX_VALUE_SIZE];
+		uint8_t codedSize = 0;
+
+		do
+		{
+			codedBytes[codedSize] = zigZagValue & 0x7F;
+			zigZagValue >>= 7;
+
+			if(zigZagValue != 0)
+			{
+				codedBytes[codedSize] |= 0x80;
+			}
+
+			codedSize++;
+		}while(zigZagValue != 0);
+
+		if((usedBytes + codedSize) > bufferSize)
+			break;
+
+		for(uint8_t j = 0; j < codedSize; j++)
+		{
+			buffer[usedBytes++] = codedBytes[j];
+		}
+
+		previousValue = values[i];
+	}
+
+	*numberOfEncodedValues = i;
+
+	return usedBytes;
+}
+
+/*****************************************************************************************
+* TemperatureEncoding_DecodeDelta() - decode values coded by TemperatureEncoding_EncodeDelta.
+*
+* Parameters:
+* @buffer: pointer to coded values.
+* @bufferSize: number of bytes of coded values.
+* @values: pointer to table where decoded values will be stored.
+* @maxNumberOfValues: size of table for decoded values.
+*
+* Return: number of decoded values. Incomplete value at end of buffer is ignored.
+*****************************************************************************************/
+uint8_t TemperatureEncoding_DecodeDelta(const uint8_t *buffer, uint16_t bufferSize, uint16_t *values,
+		uint8_t maxNumberOfValues)
+{
+	uint16_t previousValue = 0;
+	uint16_t position = 0;
+	uint8_t numberOfValues = 0;
+
+	while((position < bufferSize) && (numberOfValues < maxNumberOfValues))
+	{
+		uint16_t zigZagValue = 0;
+		uint8_t shift = 0;
+		uint8_t codedByte = 0;
+
+		do
+		{
+			if((position >= bufferSize) || (shift >= (7 * TEMPERATURE_ENCODING_MAX_VALUE_SIZE)))
+				return numberOfValues;
+
+			codedByte = buffer[position++];
+			zigZagValue |= (uint16_t)((codedByte & 0x7F) << shift);
+			shift += 7;
+		}while(codedByte & 0x80);
+
+		previousValue += (uint16_t)((zigZagValue >> 1) ^ (uint16_t)(-(int16_t)(zigZagValue & 1)));
+		values[numberOfValues++] = previousValue;
+	}
+
+	return numberOfValues;
+}
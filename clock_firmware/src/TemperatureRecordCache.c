@@ -0,0 +1,307 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "TemperatureRecordCache.h"
+
+static TemperatureRecordCacheEntryType TemperatureRecordCacheTable[TEMPERATURE_RECORD_CACHE_SIZE];
+
+/*****************************************************************************************
+* returnCacheEntry() - find cache entry which contain day measurement under pointer passed
+* as parameter.
+*
+* Parameters:
+* @record: pointer to day measurement.
+*
+* Return: pointer to cache entry or NULL if record don't belong to cache(for example
+*  present day measurement from TemperatureSingleDay table).
+*****************************************************************************************/
+static TemperatureRecordCacheEntryType* returnCacheEntry(TemperatureSingleDayRecordType *record)
+{
+	for(uint8_t i = 0; i < TEMPERATURE_RECORD_CACHE_SIZE; i++)
+	{
+		if(record == &TemperatureRecordCacheTable[i].singleRecord)
+		{
+			return &TemperatureRecordCacheTable[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************************
+* markEntryAsUsed() - mark entry as most recently used. Usage ranks of all entries always
+* create permutation of values from 0 to TEMPERATURE_RECORD_CACHE_SIZE - 1 so entries
+* which were used after marked entry are moved one position closer to end of LRU order.
+* Demotion of marked entry is cancelled.
+*
+* Parameters:
+* @cacheEntry: pointer to used cache entry.
+*
+*****************************************************************************************/
+static void markEntryAsUsed(TemperatureRecordCacheEntryType *cacheEntry)
+{
+	for(uint8_t i = 0; i < TEMPERATURE_RECORD_CACHE_SIZE; i++)
+	{
+		if(TemperatureRecordCacheTable[i].usageRank < cacheEntry->usageRank)
+		{
+			TemperatureRecordCacheTable[i].usageRank++;
+		}
+	}
+
+	cacheEntry->usageRank = 0;
+	cacheEntry->demotedFlag = false;
+}
+
+/*****************************************************************************************
+* entryIsUsedByGraphBuffer() - check that day measurement from cache entry is pointed by
+* one of available elements of graph buffer.
+*
+* Parameters:
+* @cacheEntry: pointer to tested cache entry.
+*
+* Return: true if entry is used by graph buffer otherwise false.
+*****************************************************************************************/
+static bool entryIsUsedByGraphBuffer(TemperatureRecordCacheEntryType *cacheEntry)
+{
+	for(uint8_t i = 0; i < READ_TEMP_FRAM_BUFFER_SIZE; i++)
+	{
+		if(ReadFramTempBufferTable[i].availabilityFlag
+			&& (ReadFramTempBufferTable[i].singleRecord == &cacheEntry->singleRecord))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*****************************************************************************************
+* TemperatureRecordCache_Init() - mark all entries of cache as invalid and unlocked.
+*****************************************************************************************/
+void TemperatureRecordCache_Init(void)
+{
+	for(uint8_t i = 0; i < TEMPERATURE_RECORD_CACHE_SIZE; i++)
+	{
+		TemperatureRecordCacheTable[i].validFlag = false;
+		TemperatureRecordCacheTable[i].lockCounter = 0;
+		TemperatureRecordCacheTable[i].usageRank = i;
+		TemperatureRecordCacheTable[i].framIndex = 0;
+		TemperatureRecordCacheTable[i].demotedFlag = false;
+	}
+}
+
+/*****************************************************************************************
+* TemperatureRecordCache_Find() - search day measurement with appropriate source and date.
+* If searched day is present day and record of this source is enabled then structure from
+* TemperatureSingleDay table is returned because it contain newest data. Otherwise valid
+* entries of cache are checked. Found entry is marked as most recently used.
+*
+* Parameters:
+* @source: type of temperature sensor.
+* @day: searched day.
+* @month: searched month.
+* @year: searched year.
+* @framIndex: pointer to variable where FRAM index of found day measurement will be stored.
+*
+* Return: pointer to found day measurement or NULL if it isn't available in RAM.
+*****************************************************************************************/
+TemperatureSingleDayRecordType* TemperatureRecordCache_Find(uint8_t source, uint8_t day, uint8_t month, uint8_t year,
+		uint16_t *framIndex)
+{
+	if(source >= NUM_OF_TEMPERATURE_SOURCE)
+		return NULL;
+
+	//present day
+	if(ClockState.TemperatureSensorTable[source].recordTemperature
+		&& (TemperatureSingleDay[source].day == day)
+		&& (TemperatureSingleDay[source].month == month)
+		&& (TemperatureSingleDay[source].year == year))
+	{
+		*framIndex = ClockState.TemperatureSensorTable[source].temperatureFramIndex;
+
+		return &TemperatureSingleDay[source];
+	}
+
+	for(uint8_t i = 0; i < TEMPERATURE_RECORD_CACHE_SIZE; i++)
+	{
+		TemperatureRecordCacheEntryType *cacheEntry = &TemperatureRecordCacheTable[i];
+
+		if(cacheEntry->validFlag
+			&& (cacheEntry->singleRecord.source == source)
+			&& (cacheEntry->singleRecord.day == day)
+			&& (cacheEntry->singleRecord.month == month)
+			&& (cacheEntry->singleRecord.year == year))
+		{
+			markEntryAsUsed(cacheEntry);
+			*framIndex = cacheEntry->framIndex;
+
+			return &cacheEntry->singleRecord;
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************************
+* TemperatureRecordCache_Reserve() - choose entry which will be used to load new day
+* measurement. Chosen is entry which isn't locked and isn't used by graph buffer. Invalid
+* entries are chosen first, then least recently used. Returned entry is invalidated and
+* locked so caller must call TemperatureRecordCache_Unlock when buffer isn't necessary.
+*
+* Return: pointer to buffer or NULL if all entries are used.
+*****************************************************************************************/
+TemperatureSingleDayRecordType* TemperatureRecordCache_Reserve(void)
+{
+	TemperatureRecordCacheEntryType *chosenEntry = NULL;
+
+	for(uint8_t i = 0; i < TEMPERATURE_RECORD_CACHE_SIZE; i++)
+	{
+		TemperatureRecordCacheEntryType *cacheEntry = &TemperatureRecordCacheTable[i];
+
+		if((cacheEntry->lockCounter != 0) || entryIsUsedByGraphBuffer(cacheEntry))
+			continue;
+
+		if(cacheEntry->validFlag == false)
+		{
+			chosenEntry = cacheEntry;
+			break;
+		}
+
+		if((chosenEntry == NULL)
+			|| (cacheEntry->demotedFlag && (chosenEntry->demotedFlag == false))
+			|| ((cacheEntry->demotedFlag == chosenEntry->demotedFlag) && (cacheEntry->usageRank > chosenEntry->usageRank)))
+		{
+			chosenEntry = cacheEntry;
+		}
+	}
+
+	if(chosenEntry == NULL)
+		return NULL;
+
+	chosenEntry->validFlag = false;
+	chosenEntry->demotedFlag = false;
+	chosenEntry->lockCounter = 1;
+
+	return &chosenEntry->singleRecord;
+}
+
+/*****************************************************************************************
+* TemperatureRecordCache_Commit() - mark reserved entry as valid. Data in buffer must be
+* verified before call of this function. Statistics of day measurement stored by previous
+* firmware are calculated here so all users get the same data. Lock taken by
+* TemperatureRecordCache_Reserve isn't released.
+*
+* Parameters:
+* @record: pointer to buffer returned by TemperatureRecordCache_Reserve.
+* @framIndex: index in FRAM from where data was loaded.
+*
+*****************************************************************************************/
+void TemperatureRecordCache_Commit(TemperatureSingleDayRecordType *record, uint16_t framIndex)
+{
+	TemperatureRecordCacheEntryType *cacheEntry = returnCacheEntry(record);
+
+	if(cacheEntry == NULL)
+		return;
+
+	GUI_CheckTemperatureStatistics(record);
+
+	cacheEntry->framIndex = framIndex;
+	cacheEntry->validFlag = true;
+	markEntryAsUsed(cacheEntry);
+}
+
+/*****************************************************************************************
+* TemperatureRecordCache_Lock() - protect day measurement against reuse of entry by
+* TemperatureRecordCache_Reserve. Pointers which don't belong to cache are ignored.
+*
+* Parameters:
+* @record: pointer to day measurement.
+*
+*****************************************************************************************/
+void TemperatureRecordCache_Lock(TemperatureSingleDayRecordType *record)
+{
+	TemperatureRecordCacheEntryType *cacheEntry = returnCacheEntry(record);
+
+	if(cacheEntry != NULL)
+		cacheEntry->lockCounter++;
+}
+
+/*****************************************************************************************
+* TemperatureRecordCache_Unlock() - release lock taken by TemperatureRecordCache_Lock or
+* TemperatureRecordCache_Reserve. Pointers which don't belong to cache are ignored.
+*
+* Parameters:
+* @record: pointer to day measurement.
+*
+*****************************************************************************************/
+void TemperatureRecordCache_Unlock(TemperatureSingleDayRecordType *record)
+{
+	TemperatureRecordCacheEntryType *cacheEntry = returnCacheEntry(record);
+
+	if((cacheEntry != NULL) && (cacheEntry->lockCounter != 0))
+		cacheEntry->lockCounter--;
+}
+
+/*****************************************************************************************
+* TemperatureRecordCache_Demote() - mark day measurement so it will be reused before all
+* other valid entries. Data stay valid until entry will be reserved, demotion is cancelled
+* when entry is returned by TemperatureRecordCache_Find.
+*
+* Parameters:
+* @source: type of temperature sensor.
+* @day: day of demoted day measurement.
+* @month: month of demoted day measurement.
+* @year: year of demoted day measurement.
+*
+*****************************************************************************************/
+void TemperatureRecordCache_Demote(uint8_t source, uint8_t day, uint8_t month, uint8_t year)
+{
+	for(uint8_t i = 0; i < TEMPERATURE_RECORD_CACHE_SIZE; i++)
+	{
+		TemperatureRecordCacheEntryType *cacheEntry = &TemperatureRecordCacheTable[i];
+
+		if(cacheEntry->validFlag
+			&& (cacheEntry->singleRecord.source == source)
+			&& (cacheEntry->singleRecord.day == day)
+			&& (cacheEntry->singleRecord.month == month)
+			&& (cacheEntry->singleRecord.year == year))
+		{
+			cacheEntry->demotedFlag = true;
+		}
+	}
+}
+
+/*****************************************************************************************
+* TemperatureRecordCache_InvalidateFramIndex() - invalidate entries loaded from FRAM index
+* which will be overwritten by new day measurement. Users which hold pointer to entry can
+* still use data but entry will not be returned by TemperatureRecordCache_Find.
+*
+* Parameters:
+* @framIndex: index in FRAM which will be reused.
+*
+*****************************************************************************************/
+void TemperatureRecordCache_InvalidateFramIndex(uint16_t framIndex)
+{
+	for(uint8_t i = 0; i < TEMPERATURE_RECORD_CACHE_SIZE; i++)
+	{
+		if(TemperatureRecordCacheTable[i].framIndex == framIndex)
+		{
+			TemperatureRecordCacheTable[i].validFlag = false;
+		}
+	}
+}
@@ -1,1131 +1,2595 @@
-/*
-
-clock_firmware
-Copyright (C) 2019 Adrian Chemicz
-
-This program is free software: you can redistribute it and/or modify
-it under the terms of the GNU General Public License as published by
-the Free Software Foundation, either version 3 of the License, or
-(at your option) any later version.
-
-This program is distributed in the hope that it will be useful,
-but WITHOUT ANY WARRANTY; without even the implied warranty of
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-GNU General Public License for more details.
-
-You should have received a copy of the GNU General Public License
-along with this program. If not, see <http://www.gnu.org/licenses/>. */
-
-#include "Thread.h"
-
-static ClockStateType ClockStateFramBuffer;
-static TemperatureSingleDayRecordType TemperatureSingleDayRecordBuffer;
-static uint8_t clearFramData[CLEAR_BLOCK_SIZE];
-static const uint8_t SoundAlarmTable[LENGHT_OF_SOUND_ALARM_TABLE] = {0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1};
-static WifiStateType WifiStateStructure;
-
-/*****************************************************************************************
-* convertFramIndexToAddress() - calculate FRAM memory address using index of block with
-* temperature per day structure.
-*
-* Parameters:
-* @index: value in range from 0 to MAX_RECORD_IN_FRAM with number of selected
-*  TemperatureSingleDayRecordType structure in FRAM.
-*
-* Return: FRAM memory address where index of TemperatureSingleDayRecordType structure
-* is located.
-*****************************************************************************************/
-static uint16_t convertFramIndexToAddress(uint16_t index)
-{
-	return (FRAM_MEASUREMENT_DATA_BEGIN + (sizeof(TemperatureSingleDayRecordType)*index));
-}
-
-/*****************************************************************************************
-* nextDayTemperatureStructureInit() - increase date about one day in TemperatureSingleDayRecordType
-* structure located in memory address hold by pointerToStructure argument. Function also
-* initialize all temperature values in TemperatureSingleDayRecordType structure as
-* INVALID_READ_SENSOR_VALUE.
-*
-* Parameters:
-* @pointerToStructure: pointer to TemperatureSingleDayRecordType which will be modified.
-*
-*****************************************************************************************/
-static void nextDayTemperatureStructureInit(TemperatureSingleDayRecordType *pointerToStructure)
-{
-	//use values from previous block to calculate new block
-	GUI_IncrementDay(&pointerToStructure->day, &pointerToStructure->month, &pointerToStructure->year);
-
-	//fill temperatures record using invalid temperature value
-	for(uint16_t i = 0; i < MAX_TEMP_RECORD_PER_DAY; i++)
-	{
-		pointerToStructure->temperatureValues[i] = INVALID_READ_SENSOR_VALUE;
-	}
-}
-
-/*****************************************************************************************
-* verifyTemperatureRecord() - verify that TemperatureSingleDayRecordType structure under
-* memory hold by temperatureSingleDay pointer is correct. Correctness mean that values of
-* fields day, month, year and source of temperature sensor is the same like parameters of
-* this function. This function also check CRC field to confirm that data ins structure is
-* valid.
-*
-* Parameters:
-* @temperatureSingleDay: pointer to TemperatureSingleDayRecordType which will be verified.
-* @sourceTemperature: type of temperature sensor used to comarison with tested structure.
-* @day: day number used to comarison with tested structure.
-* @month: month number used to comarison with tested structure.
-* @year: year number used to comarison with tested structure.
-*
-* Return: true if tested structure is valid otherwise false.
-*****************************************************************************************/
-bool verifyTemperatureRecord(TemperatureSingleDayRecordType *temperatureSingleDay,
-		uint8_t sourceTemperature, uint8_t day, uint8_t month, uint8_t year)
-{
-	//calculate and compare checksums
-	uint16_t checkSumValue = Chip_CRC_CRC16((uint16_t*)temperatureSingleDay, (offsetof(TemperatureSingleDayRecordType, CRC16Value)/2));
-
-	if(checkSumValue != temperatureSingleDay->CRC16Value)
-		return false;
-
-	if(temperatureSingleDay->day == day
-		&& temperatureSingleDay->month == month
-		&& temperatureSingleDay->year == year
-		&& temperatureSingleDay->source == sourceTemperature)
-	{
-		return true;
-	}
-	else
-	{
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* temperatureRecordLoader() - load temperature structure from address set as paramatere to
-* memory address hold by temperatureSingleDay pointer. Loaded TemperatureSingleDayRecordType
-* structure fields will be checked that fields are correct. Timestamp in structure will be
-* compared with current timestamp hold by ClockState structure. Function also check that
-* tested structure not contain only zeroes as fields values. This function is blocking
-* and is call on startup procedure.
-*
-* Parameters:
-* @address: FRAM memory address where TemperatureSingleDayRecordType structure is stored.
-* @temperatureSingleDay: pointer to RAM memory where TemperatureSingleDayRecordType
-*  structure will be loaded.
-* @sourceTemperature: type of temperature sensor used to comarison with tested structure.
-*
-* Return: true if tested structure is valid otherwise false.
-*****************************************************************************************/
-static bool temperatureRecordLoader(uint16_t address, TemperatureSingleDayRecordType *temperatureSingleDay,
-		uint8_t sourceTemperature)
-{
-	FRAM_Read(address, sizeof(TemperatureSingleDayRecordType), (uint8_t*)temperatureSingleDay);
-
-	for(int i = 0; i<100000; i++)
-	{
-		if(FRAM_Process())
-		{
-			i = 100000;
-		}
-		ClockSleep(1);
-	}
-
-	//if temperatureSingleDay contain only zeros treat as invalid
-	bool emptyStructure = true;
-	for(uint16_t i = 0; i < (uint16_t)(sizeof(TemperatureSingleDayRecordType)); i++)
-	{
-		uint8_t* temperatureDataPointer = (uint8_t*)(temperatureSingleDay);
-		if(temperatureDataPointer[i] != 0)
-		{
-			emptyStructure = false;
-			break;
-		}
-	}
-
-	if(emptyStructure == true)
-		return false;
-
-	//validate structure content - checksum, timestamp, temperature source
-	return verifyTemperatureRecord(temperatureSingleDay, sourceTemperature, ClockState.day, ClockState.month, ClockState.year);
-}
-
-/*****************************************************************************************
-* initTemperatureBlock() - load last temperature day structure from FRAM memory and
-* verified correctness. FRAM index before using will be checked that is corrected.
-* If data pointed by FRAM index will be incorrect that in second atempt is loaded and
-* tested data from FRAM_MEASUREMENT_BACKUP_COPY address. Function call is performed on
-* beginning of startup process and procedure is blocking which not cause problem beacuse
-* call is performed just once for all sensors. This function is directly call from
-* Thread_Init function and call chain of above functions.
-*
-* Parameters:
-* @temperatureSingleDay: pointer to RAM memory where TemperatureSingleDayRecordType
-*  structure will be loaded.
-* @temperatureFramIndex: value in range from 0 to MAX_RECORD_IN_FRAM with number of
-*  selected TemperatureSingleDayRecordType structure in FRAM.
-* @sourceTemperature: type of temperature sensor used to comarison with tested structure.
-*
-*****************************************************************************************/
-static void initTemperatureBlock(TemperatureSingleDayRecordType *temperatureSingleDay, uint16_t *temperatureFramIndex, uint8_t sourceTemperature)
-{
-	//FRAM index should be initialized
-	if(*temperatureFramIndex != NOT_INITIALIZED_FRAM_INDEX_VALUE)
-	{
-		//load data from FRAM and validate structure
-		if(temperatureRecordLoader(convertFramIndexToAddress(*temperatureFramIndex), temperatureSingleDay, sourceTemperature))
-		{
-
-		}
-		//if previous data was wrong then check backup FRAM sector
-		else if(temperatureRecordLoader(FRAM_MEASUREMENT_BACKUP_COPY, temperatureSingleDay, sourceTemperature))
-		{
-
-		}
-		else
-		{
-			//if in two source data is incorrect then reinit structure
-			GUI_InitTemperatureStructure(sourceTemperature, ClockState.day,
-				ClockState.month, ClockState.year, temperatureSingleDay);
-		}
-	}
-	else
-	{
-		GUI_InitTemperatureStructure(sourceTemperature, ClockState.day,
-			ClockState.month, ClockState.year, temperatureSingleDay);
-
-		*temperatureFramIndex = GUI_ReturnNewFramIndex();
-	}
-}
-
-/*****************************************************************************************
-* lockSharedSpiPort() - check that SPI port shared between touchscreen and FRAM can be
-* used by FRAM transaction. FRAM is locked to perform appropriate operation when touch
-* screen isn't pressed(pin state which inform about touch state is checked) and other
-* FRAM transaction isn't processed.
-*
-* Parameters:
-* @selectedSpiType: type of SPI transaction which will be used as lock flag if lock
-*  operation will be possible.
-*
-* Return: true if lock operation can be possible othervise return false.
-*****************************************************************************************/
-static bool lockSharedSpiPort(SHARED_SPI_STATE_TYPE selectedSpiType)
-{
-	//check SPI availability and PENIRQ on lcd is on high state(screen wasn't pressed)
-	if( (ClockState.sharedSpiState == NOT_USED)
-		&& (GPIO_GetState(TOUCH_PANEL_PIN_PENIRQ_GPIO_PORT, TOUCH_PANEL_PIN_PENIRQ_GPIO_PIN) == true))
-	{
-		//lock SPI
-		ClockState.sharedSpiState = selectedSpiType;
-
-		return true;
-	}
-	else
-	{
-		return false;
-	}
-}
-
-/*****************************************************************************************
-* processWriteTemperature() - copied data from day buffer located in RAM memory to FRAM
-* memory. Write to FRAM memory is prformed only if recordTemperature flag is set to
-* true. Multiply temperature source can have this flag set as true and parallel
-* temperature store in FRAM will be performed(when first store will be finished then next
-* temperature store process will be performed). This function is non blocking and mus be
-* call cyclically.
-*
-* Parameters:
-* @temperatureFramTransaction: pointer to structure with variable necessary for perform
-*  copy to FRAM process. All temperature sensor must have separate structure. This
-*  structure hold few temperature measurements which will be used to calculate average
-*  value.
-*
-*****************************************************************************************/
-static void processWriteTemperature(TemperatureFramWriteTransactionPackageType *temperatureFramTransaction)
-{
-	//check that record temperature is ON
-	if(ClockState.TemperatureSensorTable[temperatureFramTransaction->source].recordTemperature == true)
-	{
-		//store temperature in table
-		if((((ClockState.currentTimeMinute + (uint8_t)1)%3) == 0)
-			&& (ClockState.currentTimeMinute != temperatureFramTransaction->previousAssignFilter))
-		{
-			temperatureFramTransaction->previousAssignFilter = ClockState.currentTimeMinute;
-
-			//this if statememnt protect about exceed memory which can happen when user dynamic change current clock minute
-			if(temperatureFramTransaction->valuesCounter < NUMBER_OF_MEASUREMENTS_IN_FILTER_TABLE)
-			{
-				temperatureFramTransaction->temperatureTableFilter[temperatureFramTransaction->valuesCounter]
-				    = ClockState.TemperatureSensorTable[temperatureFramTransaction->source].temperatureValue;
-				temperatureFramTransaction->valuesCounter++;
-			}
-		}
-
-		//update structure and send request to start FRAM store process
-		if((((ClockState.currentTimeMinute + (uint8_t)1)%15) == 0)
-			&& (ClockState.currentTimeMinute != temperatureFramTransaction->previousAssignStore))
-		{
-			temperatureFramTransaction->previousAssignStore = ClockState.currentTimeMinute;
-
-			uint16_t filteredValueTmp = 0;
-			uint8_t correctValuesCounter = 0;
-
-			for(uint8_t i = 0; i < temperatureFramTransaction->valuesCounter;i++)
-			{
-				if(temperatureFramTransaction->temperatureTableFilter[i] != INVALID_READ_SENSOR_VALUE)
-				{
-					filteredValueTmp += temperatureFramTransaction->temperatureTableFilter[i];
-					correctValuesCounter++;
-				}
-			}
-
-			if(correctValuesCounter > 0)
-			{
-				filteredValueTmp /= correctValuesCounter;
-			}
-			else
-			{
-				filteredValueTmp = INVALID_READ_SENSOR_VALUE;
-			}
-
-			temperatureFramTransaction->valuesCounter = 0;
-
-			//recalculate index
-			temperatureFramTransaction->temperatureIndex = (((ClockState.currentTimeHour*60) + ClockState.currentTimeMinute + 1) / 15) - 1;
-			TemperatureSingleDay[temperatureFramTransaction->source].temperatureValues[temperatureFramTransaction->temperatureIndex] = filteredValueTmp;
-			temperatureFramTransaction->startTemperatureTransaction = true;
-		}
-	}/* if(ClockState.TemperatureSensorTable[temperatureFramTransaction->source].recordTemperature == true) */
-
-	if(temperatureFramTransaction->startTemperatureTransaction && lockSharedSpiPort(FRAM_USAGE))
-	{
-		ClockState.FramTransactionIdentifier = temperatureFramTransaction->transactionId;
-
-		//copy to local buffer and calculate CRC
-		TemperatureSingleDayRecordBuffer = TemperatureSingleDay[temperatureFramTransaction->source];
-		TemperatureSingleDayRecordBuffer.CRC16Value = Chip_CRC_CRC16((uint16_t*)&TemperatureSingleDayRecordBuffer, (offsetof(TemperatureSingleDayRecordType, CRC16Value)/2));
-
-		//send FRAM write request to copy all day measurement to backup area
-		FRAM_Write(FRAM_MEASUREMENT_BACKUP_COPY, sizeof(TemperatureSingleDayRecordType), (uint8_t*)&TemperatureSingleDayRecordBuffer);
-		temperatureFramTransaction->transactionStep = TRANSACTION_COPY_TO_BACKUP;
-	}
-
-	//when copy to backup area will be finished then start copy to dedicated area
-	if((ClockState.FramTransactionIdentifier == temperatureFramTransaction->transactionId)
-		&& (temperatureFramTransaction->transactionStep == TRANSACTION_COPY_TO_BACKUP) && FRAM_Process())
-	{
-		FRAM_Write(FRAM_MEASUREMENT_DATA_BEGIN + (sizeof(TemperatureSingleDayRecordType)*(ClockState.TemperatureSensorTable[temperatureFramTransaction->source].temperatureFramIndex)),
-			sizeof(TemperatureSingleDayRecordType), (uint8_t*)&TemperatureSingleDayRecordBuffer);
-		temperatureFramTransaction->transactionStep = TRANSACTION_COPY_TO_DEDICATED_AREA;
-	}
-
-	//when copy to dedicated area will be finished unlock SPI port
-	if((ClockState.FramTransactionIdentifier == temperatureFramTransaction->transactionId)
-		&& (temperatureFramTransaction->transactionStep == TRANSACTION_COPY_TO_DEDICATED_AREA) && FRAM_Process())
-	{
-		ClockState.sharedSpiState = NOT_USED;
-		ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
-		temperatureFramTransaction->transactionStep = TRANSACTION_NOT_DEFINED;
-		temperatureFramTransaction->startTemperatureTransaction = false;
-
-		//if last element of table was assigned then create new table with values for new day
-		if((ClockState.TemperatureSensorTable[temperatureFramTransaction->source].recordTemperature == true)
-			&& (temperatureFramTransaction->temperatureIndex == (MAX_TEMP_RECORD_PER_DAY - 1)))
-		{
-			nextDayTemperatureStructureInit(&TemperatureSingleDay[temperatureFramTransaction->source]);
-			ClockState.TemperatureSensorTable[temperatureFramTransaction->source].temperatureFramIndex = GUI_ReturnNewFramIndex();
-		}
-	}
-}
-
-/*****************************************************************************************
-* processReadTemperature() - copied data from FRAN memory to RAM buffer. Function is used
-* to gather data from FRAM which will be used to draw graph. Function in one cycle operate
-* on one sensor data source. TemperatureFramReadTransactionPackageType structure used as
-* input parameter is initialized when window with temperature visualization
-* (temperatureWindow) is opended. Global BufferCursor structure is trigered from GUI level
-* and contain cotrol data for this function. RAM buffer used to load temperature structures
-* contain previous buffer, next buffer and current pointed structure. All RAM buffer
-* objects is organized as table with ReadFramTempBufferType structures where appropriate
-* pointers hold address of next and previous element of table. Overall size of table
-* describe define READ_TEMP_FRAM_BUFFER_SIZE which is calculated from two defines with size
-* of previous buffer and next buffer. Those defines are READ_TEMP_FRAM_BUFFER_PREVIOUS and
-* READ_TEMP_FRAM_BUFFER_NEXT. This function is non blocking and mus be call cyclically.
-*
-* Parameters:
-* @temperatureFramTransaction: pointer to structure with data which decide about load
-*  process. Structure under pointer memory contain temporary data like day measueremnt
-*  structure and FRAM index which will be assigned to RAM buffer object if searched data
-*  will match.
-*
-*****************************************************************************************/
-static void processReadTemperature(TemperatureFramReadTransactionPackageType *temperatureFramTransaction)
-{
-	//check flag which is set in GUI thread when temperature widow is opened and other precondition is fulfiled
-	if(BufferCursor.loadDataFlag == true || temperatureFramTransaction->startReadTransaction == true)
-	{
-		if(temperatureFramTransaction->startReadTransaction == false)
-		{
-			temperatureFramTransaction->pointerToStructureTmp = BufferCursor.structPointer;
-
-			//check that data in previous structure from cursor is available
-			for(int i = 0; i < READ_TEMP_FRAM_BUFFER_PREVIOUS; i++)
-			{
-				uint16_t framIndexFromCurrentStructure = temperatureFramTransaction->pointerToStructureTmp->framIndex;
-				uint16_t framIndexFromPreviousStructure = ((ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp->pointerToPreviousElement)->framIndex;
-
-				//get day value of time stamp in current structure
-				temperatureFramTransaction->dayTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord.day;
-				temperatureFramTransaction->monthTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord.month;
-				temperatureFramTransaction->yearTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord.year;
-
-				temperatureFramTransaction->pointerToStructureTmp = (ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp->pointerToPreviousElement;
-
-				if( ((ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp)->notExistFlag == true)
-				{
-					break;
-				}
-
-				//test that FRAM index value in previous structure is correct(pass rule mean that it isn't correct)
-				if( ((ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp->availabilityFlag == false)
-					|| (framIndexFromCurrentStructure < framIndexFromPreviousStructure)
-					|| ( (framIndexFromCurrentStructure > (MAX_RECORD_IN_FRAM - SEARCH_RADIUS))
-						&& (framIndexFromPreviousStructure < SEARCH_RADIUS) ) )
-				{
-					//exception of rule - correct occurence
-					if( (((ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp)->availabilityFlag == true)
-						&& (framIndexFromPreviousStructure > (MAX_RECORD_IN_FRAM - SEARCH_RADIUS))
-						&& (framIndexFromCurrentStructure < SEARCH_RADIUS) )
-					{
-
-					}
-					else
-					{
-						//get position where search of next day will be started
-						temperatureFramTransaction->searchFramIndexPosition = GUI_GetDecrementedFramIndex(framIndexFromCurrentStructure);
-
-						//calculate value which will be used during search
-						GUI_DecrementDay(&temperatureFramTransaction->dayTmp, &temperatureFramTransaction->monthTmp, &temperatureFramTransaction->yearTmp);
-
-						temperatureFramTransaction->startReadTransaction = true;
-						temperatureFramTransaction->moveBackward = true;
-						temperatureFramTransaction->searchCounter = 0;
-
-						goto endCheck;
-					}
-				}
-			}/* for(int i = 0; i < READ_TEMP_FRAM_BUFFER_PREVIOUS; i++) */
-
-			//verify that current max index isn't equal as present day
-			if(BufferCursor.structPointer->framIndex != ClockState.TemperatureSensorTable[BufferCursor.source].temperatureFramIndex)
-			{
-				temperatureFramTransaction->pointerToStructureTmp = BufferCursor.structPointer;
-
-				//check that data in previous structure from cursor is available
-				for(int i = 0; i < READ_TEMP_FRAM_BUFFER_NEXT; i++)
-				{
-					uint16_t framIndexFromCurrentStructure = temperatureFramTransaction->pointerToStructureTmp->framIndex;
-					uint16_t framIndexFromNextStructure = ((ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp->pointerToNextElement)->framIndex;
-
-					//get day value of time stamp in current structure
-					temperatureFramTransaction->dayTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord.day;
-					temperatureFramTransaction->monthTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord.month;
-					temperatureFramTransaction->yearTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord.year;
-
-					temperatureFramTransaction->pointerToStructureTmp = (ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp->pointerToNextElement;
-
-					//next structure is equal as present day structure value
-					if(framIndexFromNextStructure == ClockState.TemperatureSensorTable[BufferCursor.source].temperatureFramIndex)
-					{
-						goto endCheck;
-					}
-
-					//test that FRAM index value in next structure is correct(pass rule mean that it isn't correct)
-					if( (framIndexFromCurrentStructure > framIndexFromNextStructure)
-						|| ( (framIndexFromCurrentStructure < SEARCH_RADIUS)
-							&& (framIndexFromNextStructure > (MAX_RECORD_IN_FRAM - SEARCH_RADIUS)) ) )
-					{
-						//exception of rule - correct occurence
-						if((framIndexFromCurrentStructure > (MAX_RECORD_IN_FRAM - SEARCH_RADIUS))
-							&& (framIndexFromNextStructure < SEARCH_RADIUS))
-						{
-
-						}
-						else
-						{
-							//get position where search of next day will be started
-							temperatureFramTransaction->searchFramIndexPosition = GUI_GetIncrementedFramIndex(framIndexFromCurrentStructure);
-
-							//calculate value which will be used during search
-							GUI_IncrementDay(&temperatureFramTransaction->dayTmp, &temperatureFramTransaction->monthTmp, &temperatureFramTransaction->yearTmp);
-
-							temperatureFramTransaction->startReadTransaction = true;
-							temperatureFramTransaction->moveBackward = false;
-							temperatureFramTransaction->searchCounter = 0;
-
-							goto endCheck;
-						}
-					}
-				}/* for(int i = 0; i < READ_TEMP_FRAM_BUFFER_NEXT; i++) */
-			}/* if(BufferCursor.structPointer->framIndex != ClockState.TemperatureSensorTable[BufferCursor.source].temperatureFramIndex) */
-endCheck:
-			;
-		}
-		else//if forward load is necessary
-		{
-			if(lockSharedSpiPort(FRAM_USAGE))
-			{
-				ClockState.FramTransactionIdentifier = FRAM_ID_READ_TEMPERATURE;
-
-				//start searchin place pointed by index searchFramIndexPosition
-				FRAM_Read(convertFramIndexToAddress(temperatureFramTransaction->searchFramIndexPosition),
-					sizeof(TemperatureSingleDayRecordType), (uint8_t*)&temperatureFramTransaction->temperatureSingleDayTmp);
-			}
-
-			if((ClockState.sharedSpiState == FRAM_USAGE)
-				&& (ClockState.FramTransactionIdentifier == FRAM_ID_READ_TEMPERATURE) && FRAM_Process())
-			{
-				//call verify function which return state
-				if(verifyTemperatureRecord(&temperatureFramTransaction->temperatureSingleDayTmp, BufferCursor.source,
-					temperatureFramTransaction->dayTmp, temperatureFramTransaction->monthTmp, temperatureFramTransaction->yearTmp))
-				{
-					//value is correct assign it to appropriate place
-					temperatureFramTransaction->pointerToStructureTmp->availabilityFlag = true;
-					temperatureFramTransaction->pointerToStructureTmp->notExistFlag = false;
-					temperatureFramTransaction->pointerToStructureTmp->singleRecord = temperatureFramTransaction->temperatureSingleDayTmp;
-					temperatureFramTransaction->pointerToStructureTmp->framIndex = temperatureFramTransaction->searchFramIndexPosition;
-
-					temperatureFramTransaction->startReadTransaction = false;
-				}
-				else
-				{
-					//change value of index where search must be performed
-					if(temperatureFramTransaction->moveBackward == true)
-						temperatureFramTransaction->searchFramIndexPosition = GUI_GetDecrementedFramIndex(temperatureFramTransaction->searchFramIndexPosition);
-					else
-						temperatureFramTransaction->searchFramIndexPosition = GUI_GetIncrementedFramIndex(temperatureFramTransaction->searchFramIndexPosition);
-					temperatureFramTransaction->searchCounter++;
-
-					if(temperatureFramTransaction->searchCounter == SEARCH_RADIUS)
-					{
-						//mark this area as broken and assign index
-						temperatureFramTransaction->pointerToStructureTmp->availabilityFlag = false;
-						temperatureFramTransaction->pointerToStructureTmp->notExistFlag = true;
-						temperatureFramTransaction->pointerToStructureTmp->framIndex = temperatureFramTransaction->searchFramIndexPosition;
-
-						temperatureFramTransaction->startReadTransaction = false;
-					}
-				}
-
-				//unlock SPI
-				ClockState.sharedSpiState = NOT_USED;
-				ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
-			}
-		}
-	}/* if(BufferCursor.loadDataFlag == true || temperatureFramTransaction->startReadTransaction == true) */
-}
-
-/*****************************************************************************************
-* wifiProcessFramSearchRequest() - search FRAM if appropriate request from WIFI module
-* will be send. About search decide searchState variable in WifiStateType structure
-* passed to function by pointer. This function work different then processReadTemperature
-* because it don't search radius from previous element but search all FRAM memory. During
-* search process is only loaded four first bytes of day measurement structure. Those bytes
-* contain day, month, year and temperature source. If bytes will be the same like begining
-* of searched structure then rest of data will be loaded. When complete day measurement
-* structure will be loaded then it will be verified by checing checksum that data is
-* correct. If new search request will be send function will check previous loaded structure.
-* When structure will be same like searched then FRAM will not be searched. Function on
-* final step generate SOME/IP response payload. This function is non blocking and must be
-* call cyclically.
-*
-* Parameters:
-* @wifiStateStructure: pointer to WifiStateType structure with data for handle all WIFI
-*  module. This function use only part of fields from this structure(parts necessary
-*  for load data from FRAM and data to asembly TX message).
-*
-*****************************************************************************************/
-static void wifiProcessFramSearchRequest(WifiStateType* wifiStateStructure)
-{
-	switch(wifiStateStructure->searchState)
-	{
-	case SEARCH_NOT_REQUESTED:
-		break;
-
-	case SEARCH_REQUESTED:
-		if(lockSharedSpiPort(FRAM_USAGE))
-		{
-			ClockState.FramTransactionIdentifier = FRAM_ID_SEARCH_TEMPERATURE;
-
-			//initialize variable in structure necessary for search
-			wifiStateStructure->readFramWasRequested = false;
-			wifiStateStructure->searchFramIndex = 0;
-
-			wifiStateStructure->searchState = SEARCH_PENDING;
-		}
-
-		break;
-
-	case SEARCH_PENDING:
-		if(wifiStateStructure->readFramWasRequested == false)
-		{
-			FRAM_Read(convertFramIndexToAddress(wifiStateStructure->searchFramIndex),
-				DAY_MEASUREMENT_HEADER_SIZE, (uint8_t*)&wifiStateStructure->TemperatureSingleDayRecordTmp);
-
-			wifiStateStructure->readFramWasRequested = true;
-		}
-		else
-		{
-			if(FRAM_Process())
-			{
-				wifiStateStructure->readFramWasRequested = false;
-				wifiStateStructure->searchState = SEARCH_PENDING_READ_READY;
-			}
-		}
-
-		break;
-
-	case SEARCH_PENDING_READ_READY:
-		//compare structure headers
-		if((wifiStateStructure->SearchedDayMeasurementHeader.day == wifiStateStructure->TemperatureSingleDayRecordTmp.day)
-			&& (wifiStateStructure->SearchedDayMeasurementHeader.month == wifiStateStructure->TemperatureSingleDayRecordTmp.month)
-			&& (wifiStateStructure->SearchedDayMeasurementHeader.year == wifiStateStructure->TemperatureSingleDayRecordTmp.year)
-			&& (wifiStateStructure->SearchedDayMeasurementHeader.source == wifiStateStructure->TemperatureSingleDayRecordTmp.source))
-		{
-			FRAM_Read(convertFramIndexToAddress(wifiStateStructure->searchFramIndex), sizeof(TemperatureSingleDayRecordType),
-				(uint8_t*)&wifiStateStructure->TemperatureSingleDayRecordTmp);
-
-			wifiStateStructure->searchState = SEARCH_HEADER_MATCH;
-		}
-		else
-		{
-			//case when all FRAM was searched and searched structure don't exist
-			if(wifiStateStructure->searchFramIndex >= MAX_RECORD_IN_FRAM)
-			{
-				wifiStateStructure->searchedStructureExist = false;
-
-				wifiStateStructure->searchState = SEARCH_FINISHED;
-			}
-			else
-			{
-				wifiStateStructure->searchFramIndex++;
-				wifiStateStructure->searchState = SEARCH_PENDING;
-			}
-		}
-
-		break;
-
-	case SEARCH_HEADER_MATCH:
-		if(FRAM_Process())
-		{
-			uint16_t checkSumValue = Chip_CRC_CRC16((uint16_t*)&wifiStateStructure->TemperatureSingleDayRecordTmp, (offsetof(TemperatureSingleDayRecordType, CRC16Value)/2));
-
-			if(checkSumValue != wifiStateStructure->TemperatureSingleDayRecordTmp.CRC16Value)
-			{
-				wifiStateStructure->searchState = SEARCH_PENDING;
-			}
-			else//this case mean that searched structure is correct
-			{
-				//init all fields in global structure
-				wifiStateStructure->TemperatureSingleDayRecordLoadedBuffer = wifiStateStructure->TemperatureSingleDayRecordTmp;
-				wifiStateStructure->temperatureStructureIsValid = true;
-				wifiStateStructure->searchedStructureExist = true;
-
-				wifiStateStructure->searchState = SEARCH_FINISHED;
-			}
-		}
-
-		break;
-
-	case SEARCH_FINISHED:
-
-		//unlock SPI
-		ClockState.sharedSpiState = NOT_USED;
-		ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
-
-		//send SOME/IP message
-		if(wifiStateStructure->searchedStructureExist)
-		{
-			uint16_t someIpPayloadSizeTmp = sizeof(TemperatureSingleDayRecordType) - (wifiStateStructure->someIpReceivedMessage.methodId * SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE);
-			uint8_t* dataStructurePointerTmp = ((uint8_t*)&wifiStateStructure->TemperatureSingleDayRecordLoadedBuffer);
-
-			if(someIpPayloadSizeTmp > SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE)
-			{
-				someIpPayloadSizeTmp = SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE;
-			}
-
-			wifiStateStructure->TxMessageTable[0].payloadSize = SOMEIP_CodeTxMessage(
-					wifiStateStructure->someIpReceivedMessage.serviceId,
-					wifiStateStructure->someIpReceivedMessage.methodId,
-					SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE,
-					wifiStateStructure->TxMessageTable[0].payload,
-					&dataStructurePointerTmp[wifiStateStructure->someIpReceivedMessage.methodId * SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE],
-					someIpPayloadSizeTmp);
-		}
-		else//send SOME/IP response without payload - it mean that structure don't exist
-		{
-			wifiStateStructure->TxMessageTable[0].payloadSize = SOMEIP_CodeTxMessage(
-					wifiStateStructure->someIpReceivedMessage.serviceId,
-					wifiStateStructure->someIpReceivedMessage.methodId,
-					SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE,
-					wifiStateStructure->TxMessageTable[0].payload, NULL, 0);
-		}
-
-		wifiStateStructure->TxMessageTable[0].lockFlag = true;
-
-		wifiStateStructure->searchState = SEARCH_NOT_REQUESTED;
-		break;
-	}/* switch(wifiStateStructure->searchState) */
-}
-
-/*****************************************************************************************
-* calculateFurnaceTemperature() - calculate furnace temperature by add to temperature from
-* sensor temperature offset set by GUI interface. If temperature will be invalid
-* calculation will not be performed.
-*
-* Return: calculating temperature
-*****************************************************************************************/
-static uint16_t calculateFurnaceTemperature(void)
-{
-	if(ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValid)
-	{
-		int32_t temperatureTmp = (int32_t)(ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValue)
-			+ (int32_t)(ClockState.temperatureFurnaceOffset * 10);
-
-		return ((uint16_t)temperatureTmp);
-	}
-	else
-	{
-		return INVALID_READ_SENSOR_VALUE;
-	}
-}
-
-/*****************************************************************************************
-* processAlarm() - function decide about raising alarm by checking three possible source
-* of alarm condition. If alarm is raised then also PWM for buzzer is activated. Buzzer
-* melody is controlled by this function.
-*****************************************************************************************/
-static void processAlarm(void)
-{
-	if(gui.active_window != &clockSettingsWindow)
-	{
-		if(ClockState.firstAlarmActive)
-		{
-			static bool firstAlarmActivationStep = true;
-
-			if(firstAlarmActivationStep == true
-				&& ClockState.firstAlarmHour == ClockState.currentTimeHour
-				&& ClockState.firstAlarmMinute == ClockState.currentTimeMinute)
-			{
-				firstAlarmActivationStep = false;
-				ClockState.firstAlarmRaised = true;
-			}
-
-			if(ClockState.firstAlarmHour != ClockState.currentTimeHour
-				|| ClockState.firstAlarmMinute != ClockState.currentTimeMinute)
-			{
-				firstAlarmActivationStep = true;
-			}
-		}
-
-		if(ClockState.secondAlarmActive)
-		{
-			static bool secondAlarmActivationStep = true;
-
-			if(secondAlarmActivationStep == true
-				&& ClockState.secondAlarmHour == ClockState.currentTimeHour
-				&& ClockState.secondAlarmMinute == ClockState.currentTimeMinute)
-			{
-				secondAlarmActivationStep = false;
-				ClockState.secondAlarmRaised = true;
-			}
-
-			if(ClockState.secondAlarmHour != ClockState.currentTimeHour
-				|| ClockState.secondAlarmMinute != ClockState.currentTimeMinute)
-			{
-				secondAlarmActivationStep = true;
-			}
-		}
-	}
-
-	if((gui.active_window != &temperatureWindow) && ClockState.temperatureFurnaceAlarmActive)
-	{
-		static bool temperatureFurnaceAlarmActivationStep = true;
-
-		if(temperatureFurnaceAlarmActivationStep && ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValid
-			&& (ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValue < ClockState.temperatureFurnaceAlarmThreshold))
-		{
-			temperatureFurnaceAlarmActivationStep = false;
-			ClockState.temperatureFurnaceAlarmRaised = true;
-		}
-
-		if(ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValid
-			&& (ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValue > ClockState.temperatureFurnaceAlarmThreshold))
-		{
-			temperatureFurnaceAlarmActivationStep = true;
-		}
-	}
-
-	//increment sound piezo step if at least one of three alarm is active
-	if(ClockState.firstAlarmRaised == true || ClockState.secondAlarmRaised == true
-		|| ClockState.temperatureFurnaceAlarmRaised)
-	{
-		static uint8_t soundThreadCounter = 0;
-
-		if(soundThreadCounter >= LENGHT_OF_INCREMENT_SOUND_STEP)
-		{
-			Buzzer_TurnOff();
-			Buzzer_SetOctave(SoundAlarmTable[ClockState.alarmSoundAnimationStep]);
-			Buzzer_TurnOn();
-
-			ClockState.alarmSoundAnimationStep++;
-
-			if(ClockState.alarmSoundAnimationStep >= LENGHT_OF_SOUND_ALARM_TABLE)
-				ClockState.alarmSoundAnimationStep = 0;
-
-			soundThreadCounter = 0;
-		}
-		else
-		{
-			soundThreadCounter++;
-		}
-	}
-	else
-	{
-		ClockState.alarmSoundAnimationStep = 0;
-	}
-}
-
-/*****************************************************************************************
-* Thread_Init() - initiate data for single Thread responsible for many thing like handle
-* FRAM. In initialization process is set timer(responsible for cyclic call Thread), FRAM
-* temperature measurement block and I2C bus expander.
-*****************************************************************************************/
-void Thread_Init(void)
-{
-
-	/**********************************
-	*	configure measurements blocks
-	***********************************/
-	{
-		for(uint16_t i = 0; i < NUM_OF_TEMPERATURE_SOURCE; i++)
-		{
-			if(ClockState.TemperatureSensorTable[i].recordTemperature == true)
-			{
-				initTemperatureBlock(&TemperatureSingleDay[i], &ClockState.TemperatureSensorTable[i].temperatureFramIndex, i);
-			}
-		}
-	}
-	/**********************************
-	*	configure temperature FRAM structures necessary to store measurements
-	***********************************/
-	//temperature outside
-	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].transactionId = FRAM_ID_MOVE_TEMPERATURE_OUTSIDE;
-	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].previousAssignFilter = 0;
-	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].previousAssignStore = 0;
-	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].startTemperatureTransaction = false;
-	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].temperatureIndex = 0;
-	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].source = OUTSIDE_TEMPERATURE;
-
-	//temperature inside
-	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].transactionId = FRAM_ID_MOVE_TEMPERATURE_INSIDE;
-	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].previousAssignFilter = 0;
-	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].previousAssignStore = 0;
-	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].startTemperatureTransaction = false;
-	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].temperatureIndex = 0;
-	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].source = INSIDE_TEMPERATURE;
-
-	//temperature furnace
-	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].transactionId = FRAM_ID_MOVE_TEMPERATURE_FURNACE;
-	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].previousAssignFilter = 0;
-	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].previousAssignStore = 0;
-	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].startTemperatureTransaction = false;
-	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].temperatureIndex = 0;
-	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].source = FURNACE_TEMPERATURE;
-
-	/**********************************
-	*	configure temperature FRAM structure necessary to read measurements
-	***********************************/
-	TemperatureFramReadTransaction.searchCounter = 0;
-	TemperatureFramReadTransaction.startReadTransaction = false;
-
-	/**********************************
-	*	configure temperature sensor
-	***********************************/
-	TemperatureSensor_ChoseSensor(CN6_TEMP_INSIDE);
-
-	TemperatureSensor_StartMeasurement();
-
-	/**********************************
-	*	configure WifiState structure
-	***********************************/
-	WifiStateStructure.connectToApnCounter = ONE_SECONDS*30;
-	WifiStateStructure.getApnCounter = ONE_SECONDS*12;
-
-	/**********************************
-	*	init timer
-	***********************************/
-	//connect CT16B0 to AHB
-	LPC_SYSCON->SYSAHBCLKCTRL |= (1<<7);
-
-#if 0//configuration for 12MHz
-	//configure prescaller
-	LPC_TIMER16_0->PR=120;
-
-	//this register will max value of counter
-	LPC_TIMER16_0->MR[0]=2000;
-#else//configuration for 48MHz
-	//configure prescaller
-	LPC_TIMER16_0->PR=480;
-
-	//this register will max value of counter
-	LPC_TIMER16_0->MR[0]=2000;
-#endif
-	//Reset on MR0 and generate interrupt(set MR0R bit and MR0I)
-	LPC_TIMER16_0->MCR=3;
-
-	//Reset Timer
-	LPC_TIMER16_0->TCR = 0x2;
-
-	//Enable timer (set CEN bit)
-	LPC_TIMER16_0->TCR=1;
-
-	//set interrupt timer priority
-	NVIC_SetPriority(TIMER_16_0_IRQn, 3);
-
-	//allow for interruptions from timer
-	NVIC_EnableIRQ(TIMER_16_0_IRQn);
-}
-
-/*****************************************************************************************
-* Thread_Call() - function is call every 20 ms. All things inside is asynchronous
-* executed(task isn't block execution for longer period).
-*****************************************************************************************/
-void Thread_Call(void)
-{
-	/**********************************
-	*	read temperature from three sensors
-	***********************************/
-	{
-		static uint16_t* tempValuePointer = &ClockState.TemperatureSensorTable[INSIDE_TEMPERATURE].temperatureValue;
-		static bool* tempValueValidFlagPointer = &ClockState.TemperatureSensorTable[INSIDE_TEMPERATURE].temperatureValid;
-		static uint8_t nextTempSensor = 1;
-		static uint16_t refreshGuiCounter = (3*ONE_SECONDS);
-
-		TemperatureSensor_Process();
-
-		if(TemperatureSensor_CheckMeasurementStatus() == I2C_DATA_IS_READY)
-		{
-			*tempValuePointer = TemperatureSensor_ReturnTemperature();
-
-			if(*tempValuePointer == INVALID_READ_SENSOR_VALUE)
-				*tempValueValidFlagPointer = false;
-			else
-				*tempValueValidFlagPointer = true;
-
-			//calculate furnace temperature using offset value
-			if(nextTempSensor == 3)
-				*tempValuePointer = calculateFurnaceTemperature();
-		}
-
-		if (TemperatureSensor_CheckMeasurementStatus() == I2C_WAITING_FOR_REQUEST)
-		{
-			nextTempSensor++;
-			if(nextTempSensor == 4)
-				nextTempSensor = 1;
-
-			switch(nextTempSensor)
-			{
-			case 1:
-				tempValuePointer = &ClockState.TemperatureSensorTable[INSIDE_TEMPERATURE].temperatureValue;
-				tempValueValidFlagPointer = &ClockState.TemperatureSensorTable[INSIDE_TEMPERATURE].temperatureValid;
-				TemperatureSensor_ChoseSensor(CN6_TEMP_INSIDE);
-				break;
-
-			case 2:
-				tempValuePointer = &ClockState.TemperatureSensorTable[OUTSIDE_TEMPERATURE].temperatureValue;
-				tempValueValidFlagPointer = &ClockState.TemperatureSensorTable[OUTSIDE_TEMPERATURE].temperatureValid;
-				TemperatureSensor_ChoseSensor(CN5_TEMP_OUTSIDE);
-				break;
-
-			case 3:
-				tempValuePointer = &ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValue;
-				tempValueValidFlagPointer = &ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValid;
-
-				TemperatureSensor_ChoseSensor(CN4_TEMP_FURNACE);
-				break;
-
-			default:
-				break;
-			}
-
-			TemperatureSensor_StartMeasurement();
-		}
-
-		//refresh GUI temp values every 5s
-		if(refreshGuiCounter >= (5*ONE_SECONDS))
-		{
-			if(ClockState.refreshTemperatureValues == WAITING_FOR_REQUEST)
-			{
-				ClockState.refreshTemperatureValues = REFRESH;
-			}
-			else if(ClockState.refreshTemperatureValues == REFRESH_PERFORMED)
-			{
-				refreshGuiCounter = 0;
-				ClockState.refreshTemperatureValues = WAITING_FOR_REQUEST;
-			}
-		}
-		else
-		{
-			refreshGuiCounter++;
-		}
-	}
-
-	/**********************************
-	*	move temperature to FRAM
-	***********************************/
-	processWriteTemperature(&TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE]);
-
-	processWriteTemperature(&TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE]);
-
-	processWriteTemperature(&TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE]);
-
-	/**********************************
-	*	check button responsible for Factory reset
-	***********************************/
-	static bool framClearFlag = false;
-
-	{
-		static uint16_t framClearCounter = 0;
-
-		if(GPIO_GetState(RESET_BUTTON_GPIO_PORT, RESET_BUTTON_GPIO_PIN) == false)
-			framClearCounter++;
-		else
-			framClearCounter = 0;
-
-		if( ((framClearCounter >= (ONE_SECONDS*3)) || (ClockState.factoryResetViaGui == true))
-			&& lockSharedSpiPort(FRAM_USAGE))
-		{
-			ClockState.FramTransactionIdentifier = FRAM_ID_FACTORY_RESET;
-
-			framClearFlag = true;
-		}
-
-		//clear two block in FRAM memory
-		if(framClearFlag && (ClockState.FramTransactionIdentifier == FRAM_ID_FACTORY_RESET))
-		{
-			static bool startWriteSequence = true;
-			static uint8_t indexOfBlock = 0;
-
-			if(startWriteSequence)
-			{
-				FRAM_Write(CLEAR_BLOCK_SIZE*indexOfBlock, CLEAR_BLOCK_SIZE, clearFramData);
-				startWriteSequence = false;
-			}
-
-			if(FRAM_Process() == true)
-			{
-				indexOfBlock++;
-				startWriteSequence = true;
-			}
-
-			if(indexOfBlock == MAX_INDEX)
-			{
-				NVIC_SystemReset();
-			}
-		}
-	}
-	/**********************************
-	*	store clock state structure
-	***********************************/
-	{
-		static uint16_t clockStateToFramCounter = 0;
-		static uint8_t blockNumberInFram = 0;
-
-		if((clockStateToFramCounter >= ONE_SECONDS) && (framClearFlag == false))
-		{
-			if(lockSharedSpiPort(FRAM_USAGE))
-			{
-				ClockState.FramTransactionIdentifier = FRAM_ID_CLOCKSTATE;
-
-				//copy clockState to local buffer
-				ClockStateFramBuffer = ClockState;
-
-				//calculate crc16
-				ClockStateFramBuffer.CRC16Value = Chip_CRC_CRC16((uint16_t*)&ClockStateFramBuffer, (offsetof(ClockStateType, CRC16Value)/2));
-
-				if(blockNumberInFram == 0)
-				{
-					//start transmision
-					FRAM_Write(FRAM_CLOCK_STATE_FIRST_COPY, sizeof(ClockStateFramBuffer),
-							(uint8_t*)&ClockStateFramBuffer);
-					blockNumberInFram = 1;
-				}
-				else
-				{
-					FRAM_Write(FRAM_CLOCK_STATE_SECOND_COPY, sizeof(ClockStateFramBuffer),
-							(uint8_t*)&ClockStateFramBuffer);
-					blockNumberInFram = 0;
-				}
-			}
-			else if((ClockState.sharedSpiState == FRAM_USAGE)
-				&& (ClockState.FramTransactionIdentifier == FRAM_ID_CLOCKSTATE))
-			{
-				if(FRAM_Process() == true)
-				{
-					clockStateToFramCounter = 0;
-					ClockState.sharedSpiState = NOT_USED;
-					ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
-				}
-			}
-		}
-		else
-		{
-			clockStateToFramCounter++;
-		}
-	}
-	/**********************************
-	*	GUI manager
-	***********************************/
-	{
-		if(ClockState.refreshGuiCounter <= 10*ONE_SECONDS)
-		{
-			ClockState.refreshGuiCounter++;
-		}
-	}
-	/**********************************
-	*	copy temperature data to read buffer
-	***********************************/
-	processReadTemperature(&TemperatureFramReadTransaction);
-
-	/**********************************
-	*	alarm
-	***********************************/
-	processAlarm();
-
-	/**********************************
-	*	wifi
-	***********************************/
-	{
-		if(ClockState.wifiReady == false)
-		{
-			WIFI_Init();
-		}
-		else
-		{
-			WIFI_Process(&WifiStateStructure);
-
-			wifiProcessFramSearchRequest(&WifiStateStructure);
-		}
-	}
-}
-
-/*****************************************************************************************
-* TIMER16_0_IRQHandler() - function for handle microcontroller interuption from timer,
-*****************************************************************************************/
-void TIMER16_0_IRQHandler(void)
-{
-	Thread_Call();
-
-	LPC_TIMER16_0->IR = 1;
-}
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "Thread.h"
+#include "SomeIpInterface.h"
+#include <string.h>
+
+static ClockStateType ClockStateFramBuffer;
+static TemperatureSingleDayRecordType TemperatureSingleDayRecordBuffer;
+static uint8_t clearFramData[CLEAR_BLOCK_SIZE];
+static const uint8_t SoundAlarmTable[LENGHT_OF_SOUND_ALARM_TABLE] = {0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1};
+static WifiStateType WifiStateStructure;
+static TemperaturePrefetchPackageType TemperaturePrefetch;
+static TemperatureStatisticsMigrationPackageType TemperatureStatisticsMigration;
+static uint16_t DownsampledTemperatureTable[MAX_TEMP_RECORD_PER_DAY];
+
+/*****************************************************************************************
+* convertFramIndexToAddress() - calculate FRAM memory address using index of block with
+* temperature per day structure.
+*
+* Parameters:
+* @index: value in range from 0 to MAX_RECORD_IN_FRAM with number of selected
+*  TemperatureSingleDayRecordType structure in FRAM.
+*
+* Return: FRAM memory address where index of TemperatureSingleDayRecordType structure
+* is located.
+*****************************************************************************************/
+static uint16_t convertFramIndexToAddress(uint16_t index)
+{
+	return (FRAM_MEASUREMENT_DATA_BEGIN + (sizeof(TemperatureSingleDayRecordType)*index));
+}
+
+/*****************************************************************************************
+* nextDayTemperatureStructureInit() - increase date about one day in TemperatureSingleDayRecordType
+* structure located in memory address hold by pointerToStructure argument. Function also
+* initialize all temperature values in TemperatureSingleDayRecordType structure as
+* INVALID_READ_SENSOR_VALUE and clear statistics of day.
+*
+* Parameters:
+* @pointerToStructure: pointer to TemperatureSingleDayRecordType which will be modified.
+*
+*****************************************************************************************/
+static void nextDayTemperatureStructureInit(TemperatureSingleDayRecordType *pointerToStructure)
+{
+	//use values from previous block to calculate new block
+	GUI_IncrementDay(&pointerToStructure->day, &pointerToStructure->month, &pointerToStructure->year);
+
+	//fill temperatures record using invalid temperature value
+	for(uint16_t i = 0; i < MAX_TEMP_RECORD_PER_DAY; i++)
+	{
+		pointerToStructure->temperatureValues[i] = INVALID_READ_SENSOR_VALUE;
+	}
+
+	GUI_ClearTemperatureStatistics(pointerToStructure);
+}
+
+/*****************************************************************************************
+* verifyTemperatureRecord() - verify that TemperatureSingleDayRecordType structure under
+* memory hold by temperatureSingleDay pointer is correct. Correctness mean that values of
+* fields day, month, year and source of temperature sensor is the same like parameters of
+* this function. This function also check CRC field to confirm that data ins structure is
+* valid.
+*
+* Parameters:
+* @temperatureSingleDay: pointer to TemperatureSingleDayRecordType which will be verified.
+* @sourceTemperature: type of temperature sensor used to comarison with tested structure.
+* @day: day number used to comarison with tested structure.
+* @month: month number used to comarison with tested structure.
+* @year: year number used to comarison with tested structure.
+*
+* Return: true if tested structure is valid otherwise false.
+*****************************************************************************************/
+bool verifyTemperatureRecord(TemperatureSingleDayRecordType *temperatureSingleDay,
+		uint8_t sourceTemperature, uint8_t day, uint8_t month, uint8_t year)
+{
+	//calculate and compare checksums
+	uint16_t checkSumValue = Chip_CRC_CRC16((uint16_t*)temperatureSingleDay, (offsetof(TemperatureSingleDayRecordType, CRC16Value)/2));
+
+	if(checkSumValue != temperatureSingleDay->CRC16Value)
+		return false;
+
+	if(temperatureSingleDay->day == day
+		&& temperatureSingleDay->month == month
+		&& temperatureSingleDay->year == year
+		&& temperatureSingleDay->source == sourceTemperature)
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* temperatureRecordLoader() - load temperature structure from address set as paramatere to
+* memory address hold by temperatureSingleDay pointer. Loaded TemperatureSingleDayRecordType
+* structure fields will be checked that fields are correct. Timestamp in structure will be
+* compared with current timestamp hold by ClockState structure. Function also check that
+* tested structure not contain only zeroes as fields values. This function is blocking
+* and is call on startup procedure.
+*
+* Parameters:
+* @address: FRAM memory address where TemperatureSingleDayRecordType structure is stored.
+* @temperatureSingleDay: pointer to RAM memory where TemperatureSingleDayRecordType
+*  structure will be loaded.
+* @sourceTemperature: type of temperature sensor used to comarison with tested structure.
+*
+* Return: true if tested structure is valid otherwise false.
+*****************************************************************************************/
+static bool temperatureRecordLoader(uint16_t address, TemperatureSingleDayRecordType *temperatureSingleDay,
+		uint8_t sourceTemperature)
+{
+	FRAM_Read(address, sizeof(TemperatureSingleDayRecordType), (uint8_t*)temperatureSingleDay);
+
+	for(int i = 0; i<100000; i++)
+	{
+		if(FRAM_Process())
+		{
+			i = 100000;
+		}
+		ClockSleep(1);
+	}
+
+	//if temperatureSingleDay contain only zeros treat as invalid
+	bool emptyStructure = true;
+	for(uint16_t i = 0; i < (uint16_t)(sizeof(TemperatureSingleDayRecordType)); i++)
+	{
+		uint8_t* temperatureDataPointer = (uint8_t*)(temperatureSingleDay);
+		if(temperatureDataPointer[i] != 0)
+		{
+			emptyStructure = false;
+			break;
+		}
+	}
+
+	if(emptyStructure == true)
+		return false;
+
+	//validate structure content - checksum, timestamp, temperature source
+	if(verifyTemperatureRecord(temperatureSingleDay, sourceTemperature, ClockState.day, ClockState.month, ClockState.year))
+	{
+		GUI_CheckTemperatureStatistics(temperatureSingleDay);
+
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* initTemperatureBlock() - load last temperature day structure from FRAM memory and
+* verified correctness. FRAM index before using will be checked that is corrected.
+* If data pointed by FRAM index will be incorrect that in second atempt is loaded and
+* tested data from FRAM_MEASUREMENT_BACKUP_COPY address. Function call is performed on
+* beginning of startup process and procedure is blocking which not cause problem beacuse
+* call is performed just once for all sensors. This function is directly call from
+* Thread_Init function and call chain of above functions.
+*
+* Parameters:
+* @temperatureSingleDay: pointer to RAM memory where TemperatureSingleDayRecordType
+*  structure will be loaded.
+* @temperatureFramIndex: value in range from 0 to MAX_RECORD_IN_FRAM with number of
+*  selected TemperatureSingleDayRecordType structure in FRAM.
+* @sourceTemperature: type of temperature sensor used to comarison with tested structure.
+*
+*****************************************************************************************/
+static void initTemperatureBlock(TemperatureSingleDayRecordType *temperatureSingleDay, uint16_t *temperatureFramIndex, uint8_t sourceTemperature)
+{
+	//FRAM index should be initialized
+	if(*temperatureFramIndex != NOT_INITIALIZED_FRAM_INDEX_VALUE)
+	{
+		//load data from FRAM and validate structure
+		if(temperatureRecordLoader(convertFramIndexToAddress(*temperatureFramIndex), temperatureSingleDay, sourceTemperature))
+		{
+
+		}
+		//if previous data was wrong then check backup FRAM sector
+		else if(temperatureRecordLoader(FRAM_MEASUREMENT_BACKUP_COPY, temperatureSingleDay, sourceTemperature))
+		{
+
+		}
+		else
+		{
+			//if in two source data is incorrect then reinit structure
+			GUI_InitTemperatureStructure(sourceTemperature, ClockState.day,
+				ClockState.month, ClockState.year, temperatureSingleDay);
+		}
+	}
+	else
+	{
+		GUI_InitTemperatureStructure(sourceTemperature, ClockState.day,
+			ClockState.month, ClockState.year, temperatureSingleDay);
+
+		*temperatureFramIndex = GUI_ReturnNewFramIndex();
+	}
+}
+
+/*****************************************************************************************
+* lockSharedSpiPort() - check that SPI port shared between touchscreen and FRAM can be
+* used by FRAM transaction. FRAM is locked to perform appropriate operation when touch
+* screen isn't pressed(pin state which inform about touch state is checked) and other
+* FRAM transaction isn't processed.
+*
+* Parameters:
+* @selectedSpiType: type of SPI transaction which will be used as lock flag if lock
+*  operation will be possible.
+*
+* Return: true if lock operation can be possible othervise return false.
+*****************************************************************************************/
+static bool lockSharedSpiPort(SHARED_SPI_STATE_TYPE selectedSpiType)
+{
+	//check SPI availability and PENIRQ on lcd is on high state(screen wasn't pressed)
+	if( (ClockState.sharedSpiState == NOT_USED)
+		&& (GPIO_GetState(TOUCH_PANEL_PIN_PENIRQ_GPIO_PORT, TOUCH_PANEL_PIN_PENIRQ_GPIO_PIN) == true))
+	{
+		//lock SPI
+		ClockState.sharedSpiState = selectedSpiType;
+
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+/*****************************************************************************************
+* assignRecordToGraphBuffer() - assign day measurement to element of graph buffer and
+* mark element as available. Pointer to day measurement is assigned before availability
+* flag because buffer is used in parallel by GUI.
+*
+* Parameters:
+* @graphBufferElement: pointer to element of ReadFramTempBufferTable.
+* @record: pointer to day measurement from cache or TemperatureSingleDay table.
+* @framIndex: index in FRAM where day measurement is stored.
+*
+*****************************************************************************************/
+static void assignRecordToGraphBuffer(ReadFramTempBufferType *graphBufferElement,
+		TemperatureSingleDayRecordType *record, uint16_t framIndex)
+{
+	graphBufferElement->singleRecord = record;
+	graphBufferElement->framIndex = framIndex;
+	graphBufferElement->notExistFlag = false;
+	graphBufferElement->availabilityFlag = true;
+}
+
+/*****************************************************************************************
+* storeFinishedDayInCache() - copy day measurement which was just stored in FRAM as last
+* measurement of day to cache. Present day structure will be reinitialized for next day
+* so elements of graph buffer which point to present day are switched to copy in cache.
+* If cache don't have free entry then graph buffer element is marked as not available.
+*
+* Parameters:
+* @source: type of temperature sensor.
+*
+*****************************************************************************************/
+static void storeFinishedDayInCache(uint8_t source)
+{
+	TemperatureSingleDayRecordType *recordTmp = TemperatureRecordCache_Reserve();
+
+	if(recordTmp != NULL)
+	{
+		//local buffer contain the same data like FRAM including checksum
+		*recordTmp = TemperatureSingleDayRecordBuffer;
+		TemperatureRecordCache_Commit(recordTmp, ClockState.TemperatureSensorTable[source].temperatureFramIndex);
+	}
+
+	for(uint8_t i = 0; i < READ_TEMP_FRAM_BUFFER_SIZE; i++)
+	{
+		if(ReadFramTempBufferTable[i].availabilityFlag
+			&& (ReadFramTempBufferTable[i].singleRecord == &TemperatureSingleDay[source]))
+		{
+			if(recordTmp != NULL)
+				ReadFramTempBufferTable[i].singleRecord = recordTmp;
+			else
+				ReadFramTempBufferTable[i].availabilityFlag = false;
+		}
+	}
+
+	//entry is protected by graph buffer or can be reused
+	TemperatureRecordCache_Unlock(recordTmp);
+}
+
+/*****************************************************************************************
+* processWriteTemperature() - copied data from day buffer located in RAM memory to FRAM
+* memory. Write to FRAM memory is prformed only if recordTemperature flag is set to
+* true. Multiply temperature source can have this flag set as true and parallel
+* temperature store in FRAM will be performed(when first store will be finished then next
+* temperature store process will be performed). This function is non blocking and mus be
+* call cyclically.
+*
+* Parameters:
+* @temperatureFramTransaction: pointer to structure with variable necessary for perform
+*  copy to FRAM process. All temperature sensor must have separate structure. This
+*  structure hold few temperature measurements which will be used to calculate average
+*  value.
+*
+*****************************************************************************************/
+static void processWriteTemperature(TemperatureFramWriteTransactionPackageType *temperatureFramTransaction)
+{
+	//check that record temperature is ON
+	if(ClockState.TemperatureSensorTable[temperatureFramTransaction->source].recordTemperature == true)
+	{
+		//store temperature in table
+		if((((ClockState.currentTimeMinute + (uint8_t)1)%3) == 0)
+			&& (ClockState.currentTimeMinute != temperatureFramTransaction->previousAssignFilter))
+		{
+			temperatureFramTransaction->previousAssignFilter = ClockState.currentTimeMinute;
+
+			//this if statememnt protect about exceed memory which can happen when user dynamic change current clock minute
+			if(temperatureFramTransaction->valuesCounter < NUMBER_OF_MEASUREMENTS_IN_FILTER_TABLE)
+			{
+				temperatureFramTransaction->temperatureTableFilter[temperatureFramTransaction->valuesCounter]
+				    = ClockState.TemperatureSensorTable[temperatureFramTransaction->source].temperatureValue;
+				temperatureFramTransaction->valuesCounter++;
+			}
+		}
+
+		//update structure and send request to start FRAM store process
+		if((((ClockState.currentTimeMinute + (uint8_t)1)%15) == 0)
+			&& (ClockState.currentTimeMinute != temperatureFramTransaction->previousAssignStore))
+		{
+			temperatureFramTransaction->previousAssignStore = ClockState.currentTimeMinute;
+
+			uint16_t filteredValueTmp = 0;
+			uint8_t correctValuesCounter = 0;
+
+			for(uint8_t i = 0; i < temperatureFramTransaction->valuesCounter;i++)
+			{
+				if(temperatureFramTransaction->temperatureTableFilter[i] != INVALID_READ_SENSOR_VALUE)
+				{
+					filteredValueTmp += temperatureFramTransaction->temperatureTableFilter[i];
+					correctValuesCounter++;
+				}
+			}
+
+			if(correctValuesCounter > 0)
+			{
+				filteredValueTmp /= correctValuesCounter;
+			}
+			else
+			{
+				filteredValueTmp = INVALID_READ_SENSOR_VALUE;
+			}
+
+			temperatureFramTransaction->valuesCounter = 0;
+
+			//recalculate index
+			temperatureFramTransaction->temperatureIndex = (((ClockState.currentTimeHour*60) + ClockState.currentTimeMinute + 1) / 15) - 1;
+			GUI_StoreTemperatureValue(&TemperatureSingleDay[temperatureFramTransaction->source],
+				temperatureFramTransaction->temperatureIndex, filteredValueTmp);
+			temperatureFramTransaction->startTemperatureTransaction = true;
+
+			//new 15 minutes temperature is send to collector if UDP telemetry is enabled
+			WifiStateStructure.telemetryPending = true;
+		}
+	}/* if(ClockState.TemperatureSensorTable[temperatureFramTransaction->source].recordTemperature == true) */
+
+	//during import of FRAM image write is delayed so it isn't overwritten by imported blocks
+	if(temperatureFramTransaction->startTemperatureTransaction
+		&& (WifiStateStructure.framImageImportActive == false) && lockSharedSpiPort(FRAM_USAGE))
+	{
+		ClockState.FramTransactionIdentifier = temperatureFramTransaction->transactionId;
+
+		//copy to local buffer and calculate CRC
+		TemperatureSingleDayRecordBuffer = TemperatureSingleDay[temperatureFramTransaction->source];
+		TemperatureSingleDayRecordBuffer.CRC16Value = Chip_CRC_CRC16((uint16_t*)&TemperatureSingleDayRecordBuffer, (offsetof(TemperatureSingleDayRecordType, CRC16Value)/2));
+
+		//send FRAM write request to copy all day measurement to backup area
+		FRAM_Write(FRAM_MEASUREMENT_BACKUP_COPY, sizeof(TemperatureSingleDayRecordType), (uint8_t*)&TemperatureSingleDayRecordBuffer);
+		temperatureFramTransaction->transactionStep = TRANSACTION_COPY_TO_BACKUP;
+	}
+
+	//when copy to backup area will be finished then start copy to dedicated area
+	if((ClockState.FramTransactionIdentifier == temperatureFramTransaction->transactionId)
+		&& (temperatureFramTransaction->transactionStep == TRANSACTION_COPY_TO_BACKUP) && FRAM_Process())
+	{
+		FRAM_Write(FRAM_MEASUREMENT_DATA_BEGIN + (sizeof(TemperatureSingleDayRecordType)*(ClockState.TemperatureSensorTable[temperatureFramTransaction->source].temperatureFramIndex)),
+			sizeof(TemperatureSingleDayRecordType), (uint8_t*)&TemperatureSingleDayRecordBuffer);
+		temperatureFramTransaction->transactionStep = TRANSACTION_COPY_TO_DEDICATED_AREA;
+	}
+
+	//when copy to dedicated area will be finished unlock SPI port
+	if((ClockState.FramTransactionIdentifier == temperatureFramTransaction->transactionId)
+		&& (temperatureFramTransaction->transactionStep == TRANSACTION_COPY_TO_DEDICATED_AREA) && FRAM_Process())
+	{
+		ClockState.sharedSpiState = NOT_USED;
+		ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
+		temperatureFramTransaction->transactionStep = TRANSACTION_NOT_DEFINED;
+		temperatureFramTransaction->startTemperatureTransaction = false;
+
+		//if last element of table was assigned then create new table with values for new day
+		if((ClockState.TemperatureSensorTable[temperatureFramTransaction->source].recordTemperature == true)
+			&& (temperatureFramTransaction->temperatureIndex == (MAX_TEMP_RECORD_PER_DAY - 1)))
+		{
+			storeFinishedDayInCache(temperatureFramTransaction->source);
+			nextDayTemperatureStructureInit(&TemperatureSingleDay[temperatureFramTransaction->source]);
+			ClockState.TemperatureSensorTable[temperatureFramTransaction->source].temperatureFramIndex = GUI_ReturnNewFramIndex();
+		}
+	}
+}
+
+/*****************************************************************************************
+* loadGraphRecordFromCache() - try to assign searched day measurement from cache instead
+* of load it from FRAM. Day measurement from cache is used only when FRAM search started
+* from searchFramIndexPosition would find it in SEARCH_RADIUS so order of FRAM indexes in
+* graph buffer is the same like after load from FRAM.
+*
+* Parameters:
+* @temperatureFramTransaction: pointer to structure with searched day, month, year, start
+*  position of search and graph buffer element which should be filled.
+*
+* Return: true if day measurement was assigned otherwise false.
+*****************************************************************************************/
+static bool loadGraphRecordFromCache(TemperatureFramReadTransactionPackageType *temperatureFramTransaction)
+{
+	uint16_t framIndexTmp = 0;
+	uint16_t searchFramIndexTmp = temperatureFramTransaction->searchFramIndexPosition;
+	TemperatureSingleDayRecordType *recordTmp = TemperatureRecordCache_Find(BufferCursor.source, temperatureFramTransaction->dayTmp,
+		temperatureFramTransaction->monthTmp, temperatureFramTransaction->yearTmp, &framIndexTmp);
+
+	if(recordTmp == NULL)
+		return false;
+
+	for(uint8_t i = 0; i < SEARCH_RADIUS; i++)
+	{
+		if(searchFramIndexTmp == framIndexTmp)
+		{
+			assignRecordToGraphBuffer(temperatureFramTransaction->pointerToStructureTmp, recordTmp, framIndexTmp);
+
+			return true;
+		}
+
+		if(temperatureFramTransaction->moveBackward == true)
+			searchFramIndexTmp = GUI_GetDecrementedFramIndex(searchFramIndexTmp);
+		else
+			searchFramIndexTmp = GUI_GetIncrementedFramIndex(searchFramIndexTmp);
+	}
+
+	return false;
+}
+
+/*****************************************************************************************
+* processReadTemperature() - copied data from FRAN memory to RAM buffer. Function is used
+* to gather data from FRAM which will be used to draw graph. Function in one cycle operate
+* on one sensor data source. TemperatureFramReadTransactionPackageType structure used as
+* input parameter is initialized when window with temperature visualization
+* (temperatureWindow) is opended. Global BufferCursor structure is trigered from GUI level
+* and contain cotrol data for this function. RAM buffer used to load temperature structures
+* contain previous buffer, next buffer and current pointed structure. All RAM buffer
+* objects is organized as table with ReadFramTempBufferType structures where appropriate
+* pointers hold address of next and previous element of table. Overall size of table
+* describe define READ_TEMP_FRAM_BUFFER_SIZE which is calculated from two defines with size
+* of previous buffer and next buffer. Those defines are READ_TEMP_FRAM_BUFFER_PREVIOUS and
+* READ_TEMP_FRAM_BUFFER_NEXT. Elements of table point to day measurements stored in
+* TemperatureRecordCache module so FRAM is searched only if searched day isn't available
+* in cache. This function is non blocking and mus be call cyclically.
+*
+* Parameters:
+* @temperatureFramTransaction: pointer to structure with data which decide about load
+*  process. Structure under pointer memory contain temporary data like day measueremnt
+*  structure and FRAM index which will be assigned to RAM buffer object if searched data
+*  will match.
+*
+*****************************************************************************************/
+static void processReadTemperature(TemperatureFramReadTransactionPackageType *temperatureFramTransaction)
+{
+	//check flag which is set in GUI thread when temperature widow is opened and other precondition is fulfiled
+	if(BufferCursor.loadDataFlag == true || temperatureFramTransaction->startReadTransaction == true)
+	{
+		if(temperatureFramTransaction->startReadTransaction == false)
+		{
+			temperatureFramTransaction->pointerToStructureTmp = BufferCursor.structPointer;
+
+			//check that data in previous structure from cursor is available
+			for(int i = 0; i < READ_TEMP_FRAM_BUFFER_PREVIOUS; i++)
+			{
+				uint16_t framIndexFromCurrentStructure = temperatureFramTransaction->pointerToStructureTmp->framIndex;
+				uint16_t framIndexFromPreviousStructure = ((ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp->pointerToPreviousElement)->framIndex;
+
+				//get day value of time stamp in current structure
+				temperatureFramTransaction->dayTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord->day;
+				temperatureFramTransaction->monthTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord->month;
+				temperatureFramTransaction->yearTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord->year;
+
+				temperatureFramTransaction->pointerToStructureTmp = (ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp->pointerToPreviousElement;
+
+				if( ((ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp)->notExistFlag == true)
+				{
+					break;
+				}
+
+				//test that FRAM index value in previous structure is correct(pass rule mean that it isn't correct)
+				if( ((ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp->availabilityFlag == false)
+					|| (framIndexFromCurrentStructure < framIndexFromPreviousStructure)
+					|| ( (framIndexFromCurrentStructure > (MAX_RECORD_IN_FRAM - SEARCH_RADIUS))
+						&& (framIndexFromPreviousStructure < SEARCH_RADIUS) ) )
+				{
+					//exception of rule - correct occurence
+					if( (((ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp)->availabilityFlag == true)
+						&& (framIndexFromPreviousStructure > (MAX_RECORD_IN_FRAM - SEARCH_RADIUS))
+						&& (framIndexFromCurrentStructure < SEARCH_RADIUS) )
+					{
+
+					}
+					else
+					{
+						//get position where search of next day will be started
+						temperatureFramTransaction->searchFramIndexPosition = GUI_GetDecrementedFramIndex(framIndexFromCurrentStructure);
+
+						//calculate value which will be used during search
+						GUI_DecrementDay(&temperatureFramTransaction->dayTmp, &temperatureFramTransaction->monthTmp, &temperatureFramTransaction->yearTmp);
+
+						temperatureFramTransaction->moveBackward = true;
+						temperatureFramTransaction->searchCounter = 0;
+
+						//FRAM is searched only if day measurement isn't available in cache
+						if(loadGraphRecordFromCache(temperatureFramTransaction) == false)
+						{
+							temperatureFramTransaction->startReadTransaction = true;
+						}
+
+						goto endCheck;
+					}
+				}
+			}/* for(int i = 0; i < READ_TEMP_FRAM_BUFFER_PREVIOUS; i++) */
+
+			//verify that current max index isn't equal as present day
+			if(BufferCursor.structPointer->framIndex != ClockState.TemperatureSensorTable[BufferCursor.source].temperatureFramIndex)
+			{
+				temperatureFramTransaction->pointerToStructureTmp = BufferCursor.structPointer;
+
+				//check that data in previous structure from cursor is available
+				for(int i = 0; i < READ_TEMP_FRAM_BUFFER_NEXT; i++)
+				{
+					uint16_t framIndexFromCurrentStructure = temperatureFramTransaction->pointerToStructureTmp->framIndex;
+					uint16_t framIndexFromNextStructure = ((ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp->pointerToNextElement)->framIndex;
+
+					//get day value of time stamp in current structure
+					temperatureFramTransaction->dayTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord->day;
+					temperatureFramTransaction->monthTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord->month;
+					temperatureFramTransaction->yearTmp = temperatureFramTransaction->pointerToStructureTmp->singleRecord->year;
+
+					temperatureFramTransaction->pointerToStructureTmp = (ReadFramTempBufferType*)temperatureFramTransaction->pointerToStructureTmp->pointerToNextElement;
+
+					//next structure is equal as present day structure value
+					if(framIndexFromNextStructure == ClockState.TemperatureSensorTable[BufferCursor.source].temperatureFramIndex)
+					{
+						goto endCheck;
+					}
+
+					//test that FRAM index value in next structure is correct(pass rule mean that it isn't correct)
+					if( (framIndexFromCurrentStructure > framIndexFromNextStructure)
+						|| ( (framIndexFromCurrentStructure < SEARCH_RADIUS)
+							&& (framIndexFromNextStructure > (MAX_RECORD_IN_FRAM - SEARCH_RADIUS)) ) )
+					{
+						//exception of rule - correct occurence
+						if((framIndexFromCurrentStructure > (MAX_RECORD_IN_FRAM - SEARCH_RADIUS))
+							&& (framIndexFromNextStructure < SEARCH_RADIUS))
+						{
+
+						}
+						else
+						{
+							//get position where search of next day will be started
+							temperatureFramTransaction->searchFramIndexPosition = GUI_GetIncrementedFramIndex(framIndexFromCurrentStructure);
+
+							//calculate value which will be used during search
+							GUI_IncrementDay(&temperatureFramTransaction->dayTmp, &temperatureFramTransaction->monthTmp, &temperatureFramTransaction->yearTmp);
+
+							temperatureFramTransaction->moveBackward = false;
+							temperatureFramTransaction->searchCounter = 0;
+
+							//FRAM is searched only if day measurement isn't available in cache
+							if(loadGraphRecordFromCache(temperatureFramTransaction) == false)
+							{
+								temperatureFramTransaction->startReadTransaction = true;
+							}
+
+							goto endCheck;
+						}
+					}
+				}/* for(int i = 0; i < READ_TEMP_FRAM_BUFFER_NEXT; i++) */
+			}/* if(BufferCursor.structPointer->framIndex != ClockState.TemperatureSensorTable[BufferCursor.source].temperatureFramIndex) */
+endCheck:
+			;
+		}
+		else//if forward load is necessary
+		{
+			//reserve buffer in cache before FRAM will be locked
+			if(temperatureFramTransaction->temperatureSingleDayTmp == NULL)
+			{
+				temperatureFramTransaction->temperatureSingleDayTmp = TemperatureRecordCache_Reserve();
+			}
+
+			if((temperatureFramTransaction->temperatureSingleDayTmp != NULL) && lockSharedSpiPort(FRAM_USAGE))
+			{
+				ClockState.FramTransactionIdentifier = FRAM_ID_READ_TEMPERATURE;
+
+				//start searchin place pointed by index searchFramIndexPosition
+				FRAM_Read(convertFramIndexToAddress(temperatureFramTransaction->searchFramIndexPosition),
+					sizeof(TemperatureSingleDayRecordType), (uint8_t*)temperatureFramTransaction->temperatureSingleDayTmp);
+			}
+
+			if((ClockState.sharedSpiState == FRAM_USAGE)
+				&& (ClockState.FramTransactionIdentifier == FRAM_ID_READ_TEMPERATURE) && FRAM_Process())
+			{
+				//call verify function which return state
+				if(verifyTemperatureRecord(temperatureFramTransaction->temperatureSingleDayTmp, BufferCursor.source,
+					temperatureFramTransaction->dayTmp, temperatureFramTransaction->monthTmp, temperatureFramTransaction->yearTmp))
+				{
+					//value is correct so store it in cache and assign it to appropriate place
+					TemperatureRecordCache_Commit(temperatureFramTransaction->temperatureSingleDayTmp,
+						temperatureFramTransaction->searchFramIndexPosition);
+					assignRecordToGraphBuffer(temperatureFramTransaction->pointerToStructureTmp,
+						temperatureFramTransaction->temperatureSingleDayTmp, temperatureFramTransaction->searchFramIndexPosition);
+
+					//entry is protected by graph buffer so reservation can be released
+					TemperatureRecordCache_Unlock(temperatureFramTransaction->temperatureSingleDayTmp);
+					temperatureFramTransaction->temperatureSingleDayTmp = NULL;
+
+					temperatureFramTransaction->startReadTransaction = false;
+				}
+				else
+				{
+					//change value of index where search must be performed
+					if(temperatureFramTransaction->moveBackward == true)
+						temperatureFramTransaction->searchFramIndexPosition = GUI_GetDecrementedFramIndex(temperatureFramTransaction->searchFramIndexPosition);
+					else
+						temperatureFramTransaction->searchFramIndexPosition = GUI_GetIncrementedFramIndex(temperatureFramTransaction->searchFramIndexPosition);
+					temperatureFramTransaction->searchCounter++;
+
+					if(temperatureFramTransaction->searchCounter == SEARCH_RADIUS)
+					{
+						//mark this area as broken and assign index
+						temperatureFramTransaction->pointerToStructureTmp->availabilityFlag = false;
+						temperatureFramTransaction->pointerToStructureTmp->notExistFlag = true;
+						temperatureFramTransaction->pointerToStructureTmp->framIndex = temperatureFramTransaction->searchFramIndexPosition;
+
+						TemperatureRecordCache_Unlock(temperatureFramTransaction->temperatureSingleDayTmp);
+						temperatureFramTransaction->temperatureSingleDayTmp = NULL;
+
+						temperatureFramTransaction->startReadTransaction = false;
+					}
+				}
+
+				//unlock SPI
+				ClockState.sharedSpiState = NOT_USED;
+				ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
+			}
+		}
+	}/* if(BufferCursor.loadDataFlag == true || temperatureFramTransaction->startReadTransaction == true) */
+}
+
+/*****************************************************************************************
+* updatePrefetchDirection() - calculate direction and velocity of cursor move from
+* counters incremented by GUI. Velocity is number of cursor moves in one second and decide
+* how many days behind edge of graph buffer will be loaded to cache. When direction change
+* then days loaded in opposite direction are demoted in cache because they will be reused
+* first.
+*
+* Parameters:
+* @prefetch: pointer to structure with state of prefetch.
+*
+*****************************************************************************************/
+static void updatePrefetchDirection(TemperaturePrefetchPackageType *prefetch)
+{
+	uint8_t backwardMoves = BufferCursor.moveBackwardCounter - prefetch->previousMoveBackwardCounter;
+	uint8_t forwardMoves = BufferCursor.moveForwardCounter - prefetch->previousMoveForwardCounter;
+	uint8_t newDirection = prefetch->direction;
+
+	prefetch->previousMoveBackwardCounter = BufferCursor.moveBackwardCounter;
+	prefetch->previousMoveForwardCounter = BufferCursor.moveForwardCounter;
+
+	if(backwardMoves > forwardMoves)
+		newDirection = PREFETCH_DIRECTION_BACKWARD;
+	else if(forwardMoves > backwardMoves)
+		newDirection = PREFETCH_DIRECTION_FORWARD;
+
+	if(newDirection != prefetch->direction)
+	{
+		for(uint8_t i = 0; i < prefetch->numberOfPrefetchedDays; i++)
+		{
+			TemperatureRecordCache_Demote(BufferCursor.source, prefetch->prefetchedDays[i][0],
+				prefetch->prefetchedDays[i][1], prefetch->prefetchedDays[i][2]);
+		}
+
+		prefetch->numberOfPrefetchedDays = 0;
+		prefetch->searchFailedFlag = false;
+		prefetch->direction = newDirection;
+		prefetch->depth = 1;
+		prefetch->movesInPeriod = 0;
+		prefetch->periodCounter = 0;
+	}
+
+	if((uint16_t)prefetch->movesInPeriod + backwardMoves + forwardMoves < UINT8_MAX)
+		prefetch->movesInPeriod += backwardMoves + forwardMoves;
+	else
+		prefetch->movesInPeriod = UINT8_MAX;
+
+	prefetch->periodCounter++;
+
+	if(prefetch->periodCounter >= ONE_SECONDS)
+	{
+		//when cursor stopped then depth calculated in previous period is kept
+		if(prefetch->movesInPeriod != 0)
+		{
+			prefetch->depth = 1 + (prefetch->movesInPeriod / PREFETCH_MOVES_PER_DEPTH_STEP);
+
+			if(prefetch->depth > PREFETCH_MAX_DEPTH)
+				prefetch->depth = PREFETCH_MAX_DEPTH;
+		}
+
+		prefetch->movesInPeriod = 0;
+		prefetch->periodCounter = 0;
+	}
+}
+
+/*****************************************************************************************
+* startPrefetchSearch() - find first day behind edge of graph buffer in direction of cursor
+* move which isn't available in cache. Search is started only when all elements of graph
+* buffer in this direction are loaded. Days in FRAM are searched from FRAM index of
+* previous day in the same way like in processReadTemperature.
+*
+* Parameters:
+* @prefetch: pointer to structure with state of prefetch.
+*
+* Return: true if FRAM search should be started otherwise false.
+*****************************************************************************************/
+static bool startPrefetchSearch(TemperaturePrefetchPackageType *prefetch)
+{
+	ReadFramTempBufferType *edgeElement = BufferCursor.structPointer;
+	uint8_t bufferDepth = READ_TEMP_FRAM_BUFFER_NEXT;
+	uint16_t presentDayFramIndex = ClockState.TemperatureSensorTable[BufferCursor.source].temperatureFramIndex;
+	uint16_t framIndexTmp = 0;
+	uint8_t dayTmp;
+	uint8_t monthTmp;
+	uint8_t yearTmp;
+
+	if(prefetch->direction == PREFETCH_DIRECTION_BACKWARD)
+		bufferDepth = READ_TEMP_FRAM_BUFFER_PREVIOUS;
+
+	//find last element of graph buffer in direction of cursor move
+	for(uint8_t i = 0; i < bufferDepth; i++)
+	{
+		ReadFramTempBufferType *nextElement;
+
+		dayTmp = edgeElement->singleRecord->day;
+		monthTmp = edgeElement->singleRecord->month;
+		yearTmp = edgeElement->singleRecord->year;
+
+		if(prefetch->direction == PREFETCH_DIRECTION_BACKWARD)
+		{
+			nextElement = (ReadFramTempBufferType*)edgeElement->pointerToPreviousElement;
+			GUI_DecrementDay(&dayTmp, &monthTmp, &yearTmp);
+		}
+		else
+		{
+			//there isn't any data after present day
+			if(edgeElement->framIndex == presentDayFramIndex)
+				return false;
+
+			nextElement = (ReadFramTempBufferType*)edgeElement->pointerToNextElement;
+			GUI_IncrementDay(&dayTmp, &monthTmp, &yearTmp);
+		}
+
+		//older data not exist or graph buffer isn't loaded yet
+		if((nextElement->notExistFlag == true) || (nextElement->availabilityFlag == false))
+			return false;
+
+		//element contain data from other position of cursor which will be replaced by processReadTemperature
+		if((nextElement->singleRecord->day != dayTmp) || (nextElement->singleRecord->month != monthTmp)
+			|| (nextElement->singleRecord->year != yearTmp))
+			return false;
+
+		edgeElement = nextElement;
+	}
+
+	dayTmp = edgeElement->singleRecord->day;
+	monthTmp = edgeElement->singleRecord->month;
+	yearTmp = edgeElement->singleRecord->year;
+	framIndexTmp = edgeElement->framIndex;
+
+	for(uint8_t i = 0; i < prefetch->depth; i++)
+	{
+		uint16_t foundFramIndex = 0;
+		TemperatureSingleDayRecordType *recordTmp;
+
+		if(prefetch->direction == PREFETCH_DIRECTION_BACKWARD)
+			GUI_DecrementDay(&dayTmp, &monthTmp, &yearTmp);
+		else
+			GUI_IncrementDay(&dayTmp, &monthTmp, &yearTmp);
+
+		recordTmp = TemperatureRecordCache_Find(BufferCursor.source, dayTmp, monthTmp, yearTmp, &foundFramIndex);
+
+		//present day is never loaded from FRAM
+		if(recordTmp == &TemperatureSingleDay[BufferCursor.source])
+			return false;
+
+		if(recordTmp != NULL)
+		{
+			framIndexTmp = foundFramIndex;
+			continue;
+		}
+
+		//day which wasn't found previously isn't searched again
+		if(prefetch->searchFailedFlag && (prefetch->dayTmp == dayTmp)
+			&& (prefetch->monthTmp == monthTmp) && (prefetch->yearTmp == yearTmp))
+			return false;
+
+		prefetch->dayTmp = dayTmp;
+		prefetch->monthTmp = monthTmp;
+		prefetch->yearTmp = yearTmp;
+		prefetch->searchCounter = 0;
+		prefetch->searchFailedFlag = false;
+		prefetch->searchDirection = prefetch->direction;
+
+		if(prefetch->direction == PREFETCH_DIRECTION_BACKWARD)
+			prefetch->searchFramIndexPosition = GUI_GetDecrementedFramIndex(framIndexTmp);
+		else
+			prefetch->searchFramIndexPosition = GUI_GetIncrementedFramIndex(framIndexTmp);
+
+		return true;
+	}
+
+	return false;
+}
+
+/*****************************************************************************************
+* finishPrefetchSearch() - release buffer reserved in cache and finish FRAM search.
+*
+* Parameters:
+* @prefetch: pointer to structure with state of prefetch.
+*
+*****************************************************************************************/
+static void finishPrefetchSearch(TemperaturePrefetchPackageType *prefetch)
+{
+	TemperatureRecordCache_Unlock(prefetch->temperatureSingleDayTmp);
+	prefetch->temperatureSingleDayTmp = NULL;
+	prefetch->searchActive = false;
+}
+
+/*****************************************************************************************
+* processPrefetchTemperature() - load to cache day measurements which will be necessary
+* for graph buffer after next moves of cursor. Direction and number of loaded days depend
+* on direction and velocity of cursor move. Prefetch use FRAM only when processReadTemperature
+* don't load data so it never delay load of data visible on graph. Loaded days are stored
+* only in cache(TemperatureRecordCache module) and processReadTemperature take them from
+* there instead of FRAM. This function is non blocking and must be call cyclically after
+* processReadTemperature.
+*
+* Parameters:
+* @prefetch: pointer to structure with state of prefetch.
+*
+*****************************************************************************************/
+static void processPrefetchTemperature(TemperaturePrefetchPackageType *prefetch)
+{
+	if(prefetch->searchActive == false)
+	{
+		if(BufferCursor.loadDataFlag == false)
+		{
+			prefetch->direction = PREFETCH_DIRECTION_NONE;
+			prefetch->numberOfPrefetchedDays = 0;
+			prefetch->searchFailedFlag = false;
+			prefetch->previousMoveBackwardCounter = BufferCursor.moveBackwardCounter;
+			prefetch->previousMoveForwardCounter = BufferCursor.moveForwardCounter;
+
+			return;
+		}
+
+		updatePrefetchDirection(prefetch);
+
+		if((prefetch->direction == PREFETCH_DIRECTION_NONE)
+			|| (TemperatureFramReadTransaction.startReadTransaction == true)
+			|| (ClockState.sharedSpiState != NOT_USED))
+			return;
+
+		prefetch->searchActive = startPrefetchSearch(prefetch);
+	}
+	else
+	{
+		if(BufferCursor.loadDataFlag == true)
+		{
+			updatePrefetchDirection(prefetch);
+		}
+
+		//day behind edge in old direction isn't necessary, search is aborted unless FRAM read is pending
+		if((prefetch->searchDirection != prefetch->direction)
+			&& (ClockState.FramTransactionIdentifier != FRAM_ID_PREFETCH_TEMPERATURE))
+		{
+			finishPrefetchSearch(prefetch);
+
+			return;
+		}
+
+		//reserve buffer in cache before FRAM will be locked
+		if(prefetch->temperatureSingleDayTmp == NULL)
+		{
+			prefetch->temperatureSingleDayTmp = TemperatureRecordCache_Reserve();
+		}
+
+		//load of graph buffer has higher priority so new read isn't started when it is active
+		if((prefetch->temperatureSingleDayTmp != NULL)
+			&& (TemperatureFramReadTransaction.startReadTransaction == false) && lockSharedSpiPort(FRAM_USAGE))
+		{
+			ClockState.FramTransactionIdentifier = FRAM_ID_PREFETCH_TEMPERATURE;
+
+			FRAM_Read(convertFramIndexToAddress(prefetch->searchFramIndexPosition),
+				sizeof(TemperatureSingleDayRecordType), (uint8_t*)prefetch->temperatureSingleDayTmp);
+		}
+
+		if((ClockState.sharedSpiState == FRAM_USAGE)
+			&& (ClockState.FramTransactionIdentifier == FRAM_ID_PREFETCH_TEMPERATURE) && FRAM_Process())
+		{
+			if(verifyTemperatureRecord(prefetch->temperatureSingleDayTmp, BufferCursor.source,
+				prefetch->dayTmp, prefetch->monthTmp, prefetch->yearTmp))
+			{
+				TemperatureRecordCache_Commit(prefetch->temperatureSingleDayTmp, prefetch->searchFramIndexPosition);
+
+				//direction changed during read so day is demoted immediately
+				if(prefetch->searchDirection != prefetch->direction)
+				{
+					TemperatureRecordCache_Demote(BufferCursor.source, prefetch->dayTmp,
+						prefetch->monthTmp, prefetch->yearTmp);
+				}
+				else
+				{
+					//remember day so it can be demoted when direction change
+					if(prefetch->numberOfPrefetchedDays == PREFETCH_MAX_DEPTH)
+					{
+						for(uint8_t i = 1; i < PREFETCH_MAX_DEPTH; i++)
+						{
+							prefetch->prefetchedDays[i - 1][0] = prefetch->prefetchedDays[i][0];
+							prefetch->prefetchedDays[i - 1][1] = prefetch->prefetchedDays[i][1];
+							prefetch->prefetchedDays[i - 1][2] = prefetch->prefetchedDays[i][2];
+						}
+
+						prefetch->numberOfPrefetchedDays--;
+					}
+
+					prefetch->prefetchedDays[prefetch->numberOfPrefetchedDays][0] = prefetch->dayTmp;
+					prefetch->prefetchedDays[prefetch->numberOfPrefetchedDays][1] = prefetch->monthTmp;
+					prefetch->prefetchedDays[prefetch->numberOfPrefetchedDays][2] = prefetch->yearTmp;
+					prefetch->numberOfPrefetchedDays++;
+				}
+
+				finishPrefetchSearch(prefetch);
+			}
+			else
+			{
+				if(prefetch->searchDirection == PREFETCH_DIRECTION_BACKWARD)
+					prefetch->searchFramIndexPosition = GUI_GetDecrementedFramIndex(prefetch->searchFramIndexPosition);
+				else
+					prefetch->searchFramIndexPosition = GUI_GetIncrementedFramIndex(prefetch->searchFramIndexPosition);
+				prefetch->searchCounter++;
+
+				if(prefetch->searchCounter == SEARCH_RADIUS)
+				{
+					prefetch->searchFailedFlag = true;
+					finishPrefetchSearch(prefetch);
+				}
+			}
+
+			//unlock SPI
+			ClockState.sharedSpiState = NOT_USED;
+			ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
+		}
+	}
+}
+
+/*****************************************************************************************
+* processStatisticsMigration() - write statistics to day measurements stored in FRAM by
+* previous firmware. Statistics of such day measurements are calculated in RAM by
+* GUI_CheckTemperatureStatistics during every load so without this process CRC16Value in
+* FRAM and in RAM would be different and manifest of range query would never match data
+* send to client. All FRAM indexes are checked once after start and after import of FRAM
+* image. Day measurement is read to buffer reserved in cache and if statistics was
+* calculated then part of structure from minTemperature field is written back. SPI stays
+* locked between read and write so day measurement can't be overwritten in the meantime.
+* Present day isn't migrated because it is written from RAM during next temperature store.
+* Migration has the lowest priority and is paused when graph buffer or prefetch load data.
+* This function is non blocking and must be call cyclically.
+*
+* Parameters:
+* @migration: pointer to structure with state of migration.
+*
+*****************************************************************************************/
+static void processStatisticsMigration(TemperatureStatisticsMigrationPackageType *migration)
+{
+	TemperatureSingleDayRecordType *recordTmp = migration->temperatureSingleDayTmp;
+
+	if(migration->framIndex >= MAX_RECORD_IN_FRAM)
+		return;
+
+	if(ClockState.FramTransactionIdentifier != FRAM_ID_STATISTICS_MIGRATION)
+	{
+		if((TemperatureFramReadTransaction.startReadTransaction == true) || TemperaturePrefetch.searchActive)
+			return;
+
+		//reserve buffer in cache before FRAM will be locked
+		if(migration->temperatureSingleDayTmp == NULL)
+		{
+			migration->temperatureSingleDayTmp = TemperatureRecordCache_Reserve();
+		}
+
+		if((migration->temperatureSingleDayTmp != NULL) && lockSharedSpiPort(FRAM_USAGE))
+		{
+			ClockState.FramTransactionIdentifier = FRAM_ID_STATISTICS_MIGRATION;
+
+			FRAM_Read(convertFramIndexToAddress(migration->framIndex), sizeof(TemperatureSingleDayRecordType),
+				(uint8_t*)migration->temperatureSingleDayTmp);
+			migration->writeStarted = false;
+		}
+
+		return;
+	}
+
+	if(FRAM_Process() == false)
+		return;
+
+	if((migration->writeStarted == false) && (recordTmp->source < NUM_OF_TEMPERATURE_SOURCE)
+		&& verifyTemperatureRecord(recordTmp, recordTmp->source, recordTmp->day, recordTmp->month, recordTmp->year)
+		&& ((ClockState.TemperatureSensorTable[recordTmp->source].recordTemperature == false)
+			|| (ClockState.TemperatureSensorTable[recordTmp->source].temperatureFramIndex != migration->framIndex)))
+	{
+		uint16_t crc16ValueTmp = recordTmp->CRC16Value;
+
+		GUI_CheckTemperatureStatistics(recordTmp);
+
+		//checksum is changed only when statistics was calculated
+		if(crc16ValueTmp != recordTmp->CRC16Value)
+		{
+			FRAM_Write(convertFramIndexToAddress(migration->framIndex) + offsetof(TemperatureSingleDayRecordType, minTemperature),
+				sizeof(TemperatureSingleDayRecordType) - offsetof(TemperatureSingleDayRecordType, minTemperature),
+				(uint8_t*)&recordTmp->minTemperature);
+			migration->writeStarted = true;
+
+			return;
+		}
+	}
+
+	//buffer wasn't committed so entry in cache stay invalid
+	TemperatureRecordCache_Unlock(recordTmp);
+	migration->temperatureSingleDayTmp = NULL;
+	migration->framIndex++;
+
+	//unlock SPI
+	ClockState.sharedSpiState = NOT_USED;
+	ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
+}
+
+/*****************************************************************************************
+* fillDaySummary() - fill summary of day with statistics stored in day measurement.
+*
+* Parameters:
+* @daySummary: pointer to filled summary.
+* @temperatureSingleDay: pointer to day measurement.
+*
+*****************************************************************************************/
+static void fillDaySummary(SomeIpDaySummaryResponsePayload *daySummary, TemperatureSingleDayRecordType *temperatureSingleDay)
+{
+	daySummary->minTemperature = temperatureSingleDay->minTemperature;
+	daySummary->maxTemperature = temperatureSingleDay->maxTemperature;
+	daySummary->numberOfTemperatures = temperatureSingleDay->numberOfTemperatures;
+
+	if(temperatureSingleDay->numberOfTemperatures != 0)
+	{
+		daySummary->averageTemperature = temperatureSingleDay->sumOfTemperatures / temperatureSingleDay->numberOfTemperatures;
+	}
+	else
+	{
+		daySummary->averageTemperature = INVALID_READ_SENSOR_VALUE;
+	}
+}
+
+/*****************************************************************************************
+* calculateDownsampledTemperature() - calculate average of valid temperatures from
+* consecutive samples of day measurement.
+*
+* Parameters:
+* @temperatureSingleDay: pointer to day measurement.
+* @firstSample: index of first averaged sample.
+* @numberOfSamples: number of averaged samples.
+*
+* Return: average temperature or INVALID_READ_SENSOR_VALUE if all samples are invalid.
+*****************************************************************************************/
+static uint16_t calculateDownsampledTemperature(TemperatureSingleDayRecordType *temperatureSingleDay,
+		uint8_t firstSample, uint8_t numberOfSamples)
+{
+	uint32_t sumOfTemperaturesTmp = 0;
+	uint8_t numberOfTemperaturesTmp = 0;
+
+	for(uint8_t i = firstSample; (i < (firstSample + numberOfSamples)) && (i < MAX_TEMP_RECORD_PER_DAY); i++)
+	{
+		if(temperatureSingleDay->temperatureValues[i] != INVALID_READ_SENSOR_VALUE)
+		{
+			sumOfTemperaturesTmp += temperatureSingleDay->temperatureValues[i];
+			numberOfTemperaturesTmp++;
+		}
+	}
+
+	if(numberOfTemperaturesTmp == 0)
+		return INVALID_READ_SENSOR_VALUE;
+
+	return (uint16_t)(sumOfTemperaturesTmp / numberOfTemperaturesTmp);
+}
+
+/*****************************************************************************************
+* wifiStartRangeQueryMessage() - take free TX buffer for entries of range query if it
+* wasn't taken yet and reserve place for header of response message.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with range query data.
+*
+* Return: true if TX buffer is available for entries.
+*****************************************************************************************/
+static bool wifiStartRangeQueryMessage(WifiStateType* wifiStateStructure)
+{
+	SocketMessage* txMessage = NULL;
+	SomeIpRangeQueryResponseHeader* responseHeader = NULL;
+
+	if(wifiStateStructure->rangeQueryTxMessage != NULL)
+		return true;
+
+	txMessage = WIFI_GetFreeTxMessage(wifiStateStructure);
+
+	if(txMessage == NULL)
+		return false;
+
+	//buffer isn't free until message will be queued
+	WIFI_HoldTxMessage(txMessage);
+	wifiStateStructure->rangeQueryTxMessage = txMessage;
+
+	SOMEIP_InitWriter(&wifiStateStructure->rangeQueryWriter, txMessage->payload, MAX_SIZE_OF_SOCKET_BUFFER);
+	responseHeader = (SomeIpRangeQueryResponseHeader*)SOMEIP_WriterReserve(&wifiStateStructure->rangeQueryWriter,
+		SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_RESP_HEADER_SIZE);
+
+	responseHeader->messageIndex = wifiStateStructure->rangeQueryMessageIndex++;
+	responseHeader->moreMessages = true;
+	responseHeader->numberOfEntries = 0;
+
+	return true;
+}
+
+/*****************************************************************************************
+* wifiSendRangeQueryMessage() - code header of response message with entries of range query
+* and pass TX buffer to send.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with range query data.
+* @moreMessages: false if it is last message of range query.
+*
+*****************************************************************************************/
+static void wifiSendRangeQueryMessage(WifiStateType* wifiStateStructure, bool moreMessages)
+{
+	SocketMessage* txMessage = wifiStateStructure->rangeQueryTxMessage;
+
+	((SomeIpRangeQueryResponseHeader*)SOMEIP_GetPayload(txMessage->payload))->moreMessages = moreMessages;
+
+	txMessage->payloadSize = SOMEIP_WriterFinish(&wifiStateStructure->rangeQueryWriter,
+			wifiStateStructure->searchedServiceId,
+			wifiStateStructure->searchedMethodId,
+			SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE);
+
+	WIFI_QueueTxMessage(wifiStateStructure, txMessage, wifiStateStructure->searchedSocketId);
+	wifiStateStructure->rangeQueryTxMessage = NULL;
+}
+
+/*****************************************************************************************
+* wifiWriteEncodedSamplesEntry() - write entry with downsampled samples of loaded day
+* measurement coded by TemperatureEncoding module. If coded samples wouldn't be smaller
+* than raw samples then raw little-endian values are written. Data of entry is coded
+* directly in TX buffer and place for it is reserved in writer when size of data is known.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with range query data.
+*
+* Return: true if whole day measurement was written, false if message is full.
+*****************************************************************************************/
+static bool wifiWriteEncodedSamplesEntry(WifiStateType* wifiStateStructure)
+{
+	SomeIpWriter* writer = &wifiStateStructure->rangeQueryWriter;
+	SomeIpRangeQueryResponseHeader* responseHeader = (SomeIpRangeQueryResponseHeader*)SOMEIP_GetPayload(
+		wifiStateStructure->rangeQueryTxMessage->payload);
+	SomeIpRangeQueryEncodedSamplesEntry* encodedEntry = NULL;
+	uint8_t step = wifiStateStructure->RangeQueryRequest.step;
+	uint8_t numberOfSamplesTmp = (MAX_TEMP_RECORD_PER_DAY + step - 1) / step;
+	uint8_t remainingSamplesTmp = numberOfSamplesTmp - wifiStateStructure->rangeQuerySampleIndex;
+	uint16_t freeSpaceTmp = writer->maxPayloadSize - writer->payloadSize;
+	uint16_t dataSizeTmp = 0;
+	uint8_t writtenSamplesTmp = 0;
+
+	if(freeSpaceTmp < (SOME_IP_SERVICE_DAY_MEASUREMENT_ENCODED_SAMPLES_ENTRY_HEADER_SIZE + TEMPERATURE_ENCODING_MAX_VALUE_SIZE))
+		return false;
+
+	//size of data is stored in one byte
+	freeSpaceTmp -= SOME_IP_SERVICE_DAY_MEASUREMENT_ENCODED_SAMPLES_ENTRY_HEADER_SIZE;
+
+	if(freeSpaceTmp > UINT8_MAX)
+	{
+		freeSpaceTmp = UINT8_MAX;
+	}
+
+	for(uint8_t i = 0; i < remainingSamplesTmp; i++)
+	{
+		DownsampledTemperatureTable[i] = calculateDownsampledTemperature(wifiStateStructure->temperatureSingleDayRecordPointer,
+			(wifiStateStructure->rangeQuerySampleIndex + i) * step, step);
+	}
+
+	encodedEntry = (SomeIpRangeQueryEncodedSamplesEntry*)&writer->someIpTxMessageBuffer[SOME_IP_MINIMAL_MESSAGE_SIZE + writer->payloadSize];
+
+	dataSizeTmp = TemperatureEncoding_EncodeDelta(DownsampledTemperatureTable, remainingSamplesTmp, encodedEntry->data,
+		freeSpaceTmp, &writtenSamplesTmp);
+	encodedEntry->encoding = TEMPERATURE_ENCODING_DELTA_VARINT;
+
+	if(dataSizeTmp >= (writtenSamplesTmp * sizeof(uint16_t)))
+	{
+		writtenSamplesTmp = remainingSamplesTmp;
+
+		if(writtenSamplesTmp > (freeSpaceTmp / sizeof(uint16_t)))
+		{
+			writtenSamplesTmp = freeSpaceTmp / sizeof(uint16_t);
+		}
+
+		//entry isn't aligned so values are written byte by byte
+		for(uint8_t i = 0; i < writtenSamplesTmp; i++)
+		{
+			encodedEntry->data[2*i] = DownsampledTemperatureTable[i] & 0xFF;
+			encodedEntry->data[(2*i) + 1] = DownsampledTemperatureTable[i] >> 8;
+		}
+
+		dataSizeTmp = writtenSamplesTmp * sizeof(uint16_t);
+		encodedEntry->encoding = TEMPERATURE_ENCODING_RAW;
+	}
+
+	memcpy(&encodedEntry->header, wifiStateStructure->temperatureSingleDayRecordPointer, DAY_MEASUREMENT_HEADER_SIZE);
+	encodedEntry->firstSampleIndex = wifiStateStructure->rangeQuerySampleIndex;
+	encodedEntry->numberOfSamples = writtenSamplesTmp;
+	encodedEntry->dataSize = dataSizeTmp;
+
+	SOMEIP_WriterReserve(writer, SOME_IP_SERVICE_DAY_MEASUREMENT_ENCODED_SAMPLES_ENTRY_HEADER_SIZE + dataSizeTmp);
+
+	wifiStateStructure->rangeQuerySampleIndex += writtenSamplesTmp;
+	responseHeader->numberOfEntries++;
+
+	return (wifiStateStructure->rangeQuerySampleIndex >= numberOfSamplesTmp);
+}
+
+/*****************************************************************************************
+* wifiWriteRangeQueryEntry() - write entry with loaded day measurement to response message
+* of range query. When step from request is 0 then entry contain summary of day, otherwise
+* averages of step consecutive samples. Samples which don't fit in message are send in next
+* message from index hold by rangeQuerySampleIndex. Manifest entry contain only CRC stored
+* in rangeQueryCrc16Value. Samples are coded when client allowed compact encoding.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with range query data.
+*
+* Return: true if whole day measurement was written, false if message is full.
+*****************************************************************************************/
+static bool wifiWriteRangeQueryEntry(WifiStateType* wifiStateStructure)
+{
+	TemperatureSingleDayRecordType* loadedRecordPointerTmp = wifiStateStructure->temperatureSingleDayRecordPointer;
+	SomeIpWriter* writer = &wifiStateStructure->rangeQueryWriter;
+	SomeIpRangeQueryResponseHeader* responseHeader = (SomeIpRangeQueryResponseHeader*)SOMEIP_GetPayload(
+		wifiStateStructure->rangeQueryTxMessage->payload);
+	uint8_t step = wifiStateStructure->RangeQueryRequest.step;
+	//free place is checked before reservation because overflow of writer would discard whole message
+	uint16_t freeSpaceTmp = writer->maxPayloadSize - writer->payloadSize;
+
+	if(wifiStateStructure->rangeQueryManifest)
+	{
+		SomeIpManifestEntry* manifestEntry = NULL;
+
+		if(freeSpaceTmp < SOME_IP_SERVICE_DAY_MEASUREMENT_MANIFEST_ENTRY_SIZE)
+			return false;
+
+		manifestEntry = (SomeIpManifestEntry*)SOMEIP_WriterReserve(writer, SOME_IP_SERVICE_DAY_MEASUREMENT_MANIFEST_ENTRY_SIZE);
+
+		memcpy(&manifestEntry->header, &wifiStateStructure->SearchedDayMeasurementHeader, DAY_MEASUREMENT_HEADER_SIZE);
+		manifestEntry->crc16Value = wifiStateStructure->rangeQueryCrc16Value;
+		responseHeader->numberOfEntries++;
+
+		return true;
+	}
+	else if((step != 0) && (wifiStateStructure->RangeQueryRequest.sourceMask & SOME_IP_RANGE_QUERY_COMPACT_ENCODING_FLAG))
+	{
+		return wifiWriteEncodedSamplesEntry(wifiStateStructure);
+	}
+	else if(step == 0)
+	{
+		SomeIpRangeQuerySummaryEntry* summaryEntry = NULL;
+
+		if(freeSpaceTmp < SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_SUMMARY_ENTRY_SIZE)
+			return false;
+
+		summaryEntry = (SomeIpRangeQuerySummaryEntry*)SOMEIP_WriterReserve(writer,
+			SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_SUMMARY_ENTRY_SIZE);
+
+		memcpy(&summaryEntry->header, loadedRecordPointerTmp, DAY_MEASUREMENT_HEADER_SIZE);
+		fillDaySummary(&summaryEntry->summary, loadedRecordPointerTmp);
+		responseHeader->numberOfEntries++;
+
+		return true;
+	}
+	else
+	{
+		SomeIpRangeQuerySamplesEntry* samplesEntry = NULL;
+		uint8_t numberOfSamplesTmp = (MAX_TEMP_RECORD_PER_DAY + step - 1) / step;
+		uint16_t writtenSamplesTmp = numberOfSamplesTmp - wifiStateStructure->rangeQuerySampleIndex;
+
+		if(freeSpaceTmp < (SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_SAMPLES_ENTRY_HEADER_SIZE + sizeof(uint16_t)))
+			return false;
+
+		if(writtenSamplesTmp > ((freeSpaceTmp - SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_SAMPLES_ENTRY_HEADER_SIZE) / sizeof(uint16_t)))
+		{
+			writtenSamplesTmp = (freeSpaceTmp - SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_SAMPLES_ENTRY_HEADER_SIZE) / sizeof(uint16_t);
+		}
+
+		samplesEntry = (SomeIpRangeQuerySamplesEntry*)SOMEIP_WriterReserve(writer,
+			SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_SAMPLES_ENTRY_HEADER_SIZE + (writtenSamplesTmp * sizeof(uint16_t)));
+
+		memcpy(&samplesEntry->header, loadedRecordPointerTmp, DAY_MEASUREMENT_HEADER_SIZE);
+		samplesEntry->firstSampleIndex = wifiStateStructure->rangeQuerySampleIndex;
+		samplesEntry->numberOfSamples = writtenSamplesTmp;
+
+		for(uint8_t i = 0; i < writtenSamplesTmp; i++)
+		{
+			samplesEntry->temperatureValues[i] = calculateDownsampledTemperature(loadedRecordPointerTmp,
+				(wifiStateStructure->rangeQuerySampleIndex + i) * step, step);
+		}
+
+		wifiStateStructure->rangeQuerySampleIndex += writtenSamplesTmp;
+		responseHeader->numberOfEntries++;
+
+		return (wifiStateStructure->rangeQuerySampleIndex >= numberOfSamplesTmp);
+	}
+}
+
+/*****************************************************************************************
+* wifiFinishRangeQueryEntry() - release day measurement which was send(or wasn't found) and
+* choose next entry of range query.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with range query data.
+*
+*****************************************************************************************/
+static void wifiFinishRangeQueryEntry(WifiStateType* wifiStateStructure)
+{
+	TemperatureRecordCache_Unlock(wifiStateStructure->temperatureSingleDayRecordPointer);
+	wifiStateStructure->temperatureSingleDayRecordPointer = NULL;
+
+	if(WIFI_SelectNextRangeQueryEntry(wifiStateStructure))
+	{
+		wifiStateStructure->searchState = SEARCH_RANGE_NEXT_ENTRY;
+	}
+	else
+	{
+		wifiStateStructure->searchState = SEARCH_RANGE_FINISHED;
+	}
+}
+
+#if WIFI_FRAM_IMAGE_SERVICE
+/*****************************************************************************************
+* wifiCheckImportedRecord() - classify day measurement loaded during validation of
+* imported FRAM image and update result of validation. For valid day measurements is
+* remembered the newest date and index of present day of each source.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with validation data.
+* @temperatureSingleDay: pointer to loaded day measurement.
+*
+*****************************************************************************************/
+static void wifiCheckImportedRecord(WifiStateType* wifiStateStructure, TemperatureSingleDayRecordType *temperatureSingleDay)
+{
+	uint16_t framIndexTmp = wifiStateStructure->framImageBlockIndex;
+	DayMeasurementHeader* newestHeaderTmp = &wifiStateStructure->FramImageNewestHeader;
+	uint32_t dateKeyTmp = 0;
+	uint32_t newestDateKeyTmp = 0;
+
+	//never used index of FRAM is filled by zeros
+	if((temperatureSingleDay->source == 0) && (temperatureSingleDay->day == 0)
+		&& (temperatureSingleDay->month == 0) && (temperatureSingleDay->year == 0))
+	{
+		wifiStateStructure->FramImageValidationResult.numberOfEmptyRecords++;
+		return;
+	}
+
+	if((temperatureSingleDay->source >= NUM_OF_TEMPERATURE_SOURCE)
+		|| (verifyTemperatureRecord(temperatureSingleDay, temperatureSingleDay->source, temperatureSingleDay->day,
+			temperatureSingleDay->month, temperatureSingleDay->year) == false))
+	{
+		wifiStateStructure->FramImageValidationResult.numberOfDamagedRecords++;
+		return;
+	}
+
+	wifiStateStructure->FramImageValidationResult.numberOfValidRecords++;
+
+	//present day is continued in imported day measurement
+	if((temperatureSingleDay->day == TemperatureSingleDay[temperatureSingleDay->source].day)
+		&& (temperatureSingleDay->month == TemperatureSingleDay[temperatureSingleDay->source].month)
+		&& (temperatureSingleDay->year == TemperatureSingleDay[temperatureSingleDay->source].year)
+		&& (wifiStateStructure->FramImagePresentDayIndexTable[temperatureSingleDay->source] == NOT_INITIALIZED_FRAM_INDEX_VALUE))
+	{
+		wifiStateStructure->FramImagePresentDayIndexTable[temperatureSingleDay->source] = framIndexTmp;
+	}
+
+	dateKeyTmp = ((uint32_t)temperatureSingleDay->year << 16) | ((uint32_t)temperatureSingleDay->month << 8)
+		| temperatureSingleDay->day;
+	newestDateKeyTmp = ((uint32_t)newestHeaderTmp->year << 16) | ((uint32_t)newestHeaderTmp->month << 8)
+		| newestHeaderTmp->day;
+
+	/* day measurements of different sources from the same day are stored one after another so
+	from them is chosen last one(when FRAM was wrapped first one is placed at end of FRAM) */
+	if((wifiStateStructure->framImageNewestIndex == NOT_INITIALIZED_FRAM_INDEX_VALUE)
+		|| (dateKeyTmp > newestDateKeyTmp)
+		|| ((dateKeyTmp == newestDateKeyTmp) && (framIndexTmp == (wifiStateStructure->framImageNewestIndex + 1))))
+	{
+		newestHeaderTmp->source = temperatureSingleDay->source;
+		newestHeaderTmp->day = temperatureSingleDay->day;
+		newestHeaderTmp->month = temperatureSingleDay->month;
+		newestHeaderTmp->year = temperatureSingleDay->year;
+
+		wifiStateStructure->framImageNewestIndex = framIndexTmp;
+	}
+}
+
+/*****************************************************************************************
+* wifiRebaseFramIndexes() - set FRAM indexes used by write of day measurements after
+* import of FRAM image. Next free index is placed after the newest imported day measurement
+* so imported history will be overwritten from the oldest day. Present day is continued in
+* imported day measurement of present day otherwise new index is assigned. Data of present
+* day from RAM will be written to assigned index during next write of temperature.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with validation data.
+*
+*****************************************************************************************/
+static void wifiRebaseFramIndexes(WifiStateType* wifiStateStructure)
+{
+	if(wifiStateStructure->framImageNewestIndex != NOT_INITIALIZED_FRAM_INDEX_VALUE)
+	{
+		ClockState.currentFramIndex = wifiStateStructure->framImageNewestIndex + 1;
+
+		if(ClockState.currentFramIndex >= MAX_RECORD_IN_FRAM)
+		{
+			ClockState.currentFramIndex = 0;
+		}
+	}
+
+	for(uint8_t i = 0; i < NUM_OF_TEMPERATURE_SOURCE; i++)
+	{
+		if(ClockState.TemperatureSensorTable[i].recordTemperature == false)
+			continue;
+
+		if(wifiStateStructure->FramImagePresentDayIndexTable[i] != NOT_INITIALIZED_FRAM_INDEX_VALUE)
+		{
+			ClockState.TemperatureSensorTable[i].temperatureFramIndex = wifiStateStructure->FramImagePresentDayIndexTable[i];
+		}
+		else
+		{
+			ClockState.TemperatureSensorTable[i].temperatureFramIndex = GUI_ReturnNewFramIndex();
+		}
+	}
+}
+#endif
+
+/*****************************************************************************************
+* wifiProcessFramSearchRequest() - search FRAM if appropriate request from WIFI module
+* will be send. About search decide searchState variable in WifiStateType structure
+* passed to function by pointer. This function work different then processReadTemperature
+* because it don't search radius from previous element but search all FRAM memory. During
+* search process is only loaded four first bytes of day measurement structure. Those bytes
+* contain day, month, year and temperature source. If bytes will be the same like begining
+* of searched structure then rest of data will be loaded to buffer reserved in cache. When
+* complete day measurement structure will be loaded then it will be verified by checing
+* checksum that data is correct. Request for present day or day which is already stored in
+* cache is finished without FRAM search(it is checked in WIFI_ProcessRequest). Function on
+* final step generate SOME/IP response payload(part of structure, summary of day or
+* SOME/IP-TP segment). In segmented transfer search of next requested day is started when
+* segment was placed in TX buffer so FRAM is searched during send of previous segment.
+* Range query read headers of all FRAM only once and remember FRAM index of each requested
+* day measurement, next day measurements are loaded directly from remembered index in order
+* of date and source and are send as entries of response stream(manifest read only CRC of
+* day measurement). SPI is released between loads. Blocks of FRAM image are read, written
+* and validated one by one with release of SPI after each FRAM access so temperature
+* writes and graph loads aren't blocked during transfer of image. This function is non
+* blocking and must be call cyclically.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with data for handle all WIFI
+*  module. This function use only part of fields from this structure(parts necessary
+*  for load data from FRAM and data to asembly TX message).
+*
+*****************************************************************************************/
+static void wifiProcessFramSearchRequest(WifiStateType* wifiStateStructure)
+{
+	SocketMessage* txMessage = NULL;
+	SomeIpWriter writer;
+
+	switch(wifiStateStructure->searchState)
+	{
+	case SEARCH_NOT_REQUESTED:
+		break;
+
+	case SEARCH_REQUESTED:
+		//reserve buffer in cache before FRAM will be locked
+		if(wifiStateStructure->temperatureSingleDayRecordPointer == NULL)
+		{
+			wifiStateStructure->temperatureSingleDayRecordPointer = TemperatureRecordCache_Reserve();
+		}
+
+		if((wifiStateStructure->temperatureSingleDayRecordPointer != NULL) && lockSharedSpiPort(FRAM_USAGE))
+		{
+			ClockState.FramTransactionIdentifier = FRAM_ID_SEARCH_TEMPERATURE;
+
+			//initialize variable in structure necessary for search
+			wifiStateStructure->readFramWasRequested = false;
+			wifiStateStructure->searchFramIndex = 0;
+
+			wifiStateStructure->searchState = SEARCH_PENDING;
+		}
+
+		break;
+
+	case SEARCH_PENDING:
+		if(wifiStateStructure->readFramWasRequested == false)
+		{
+			FRAM_Read(convertFramIndexToAddress(wifiStateStructure->searchFramIndex),
+				DAY_MEASUREMENT_HEADER_SIZE, (uint8_t*)&wifiStateStructure->ReadDayMeasurementHeader);
+
+			wifiStateStructure->readFramWasRequested = true;
+		}
+		else
+		{
+			if(FRAM_Process())
+			{
+				wifiStateStructure->readFramWasRequested = false;
+				wifiStateStructure->searchState = SEARCH_PENDING_READ_READY;
+			}
+		}
+
+		break;
+
+	case SEARCH_PENDING_READ_READY:
+		//compare structure headers
+		if((wifiStateStructure->SearchedDayMeasurementHeader.day == wifiStateStructure->ReadDayMeasurementHeader.day)
+			&& (wifiStateStructure->SearchedDayMeasurementHeader.month == wifiStateStructure->ReadDayMeasurementHeader.month)
+			&& (wifiStateStructure->SearchedDayMeasurementHeader.year == wifiStateStructure->ReadDayMeasurementHeader.year)
+			&& (wifiStateStructure->SearchedDayMeasurementHeader.source == wifiStateStructure->ReadDayMeasurementHeader.source))
+		{
+			FRAM_Read(convertFramIndexToAddress(wifiStateStructure->searchFramIndex), sizeof(TemperatureSingleDayRecordType),
+				(uint8_t*)wifiStateStructure->temperatureSingleDayRecordPointer);
+
+			wifiStateStructure->searchState = SEARCH_HEADER_MATCH;
+		}
+		else
+		{
+			//case when all FRAM was searched and searched structure don't exist
+			if(wifiStateStructure->searchFramIndex >= MAX_RECORD_IN_FRAM)
+			{
+				wifiStateStructure->searchedStructureExist = false;
+
+				wifiStateStructure->searchState = SEARCH_FINISHED;
+			}
+			else
+			{
+				wifiStateStructure->searchFramIndex++;
+				wifiStateStructure->searchState = SEARCH_PENDING;
+			}
+		}
+
+		break;
+
+	case SEARCH_HEADER_MATCH:
+		if(FRAM_Process())
+		{
+			if(verifyTemperatureRecord(wifiStateStructure->temperatureSingleDayRecordPointer,
+				wifiStateStructure->SearchedDayMeasurementHeader.source, wifiStateStructure->SearchedDayMeasurementHeader.day,
+				wifiStateStructure->SearchedDayMeasurementHeader.month, wifiStateStructure->SearchedDayMeasurementHeader.year))
+			{
+				//searched structure is correct so store it in cache - buffer stay locked until response will be send
+				TemperatureRecordCache_Commit(wifiStateStructure->temperatureSingleDayRecordPointer, wifiStateStructure->searchFramIndex);
+				wifiStateStructure->searchedStructureExist = true;
+
+				wifiStateStructure->searchState = SEARCH_FINISHED;
+			}
+			//continue search from next index
+			else if(wifiStateStructure->searchFramIndex >= MAX_RECORD_IN_FRAM)
+			{
+				wifiStateStructure->searchedStructureExist = false;
+
+				wifiStateStructure->searchState = SEARCH_FINISHED;
+			}
+			else
+			{
+				wifiStateStructure->searchFramIndex++;
+				wifiStateStructure->searchState = SEARCH_PENDING;
+			}
+		}
+
+		break;
+
+	case SEARCH_FINISHED:
+
+		//unlock SPI if it was locked by search(data from cache don't require FRAM access)
+		if(ClockState.FramTransactionIdentifier == FRAM_ID_SEARCH_TEMPERATURE)
+		{
+			ClockState.sharedSpiState = NOT_USED;
+			ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
+		}
+
+		//wait until one of TX buffers will be free
+		txMessage = WIFI_GetFreeTxMessage(wifiStateStructure);
+
+		if(txMessage == NULL)
+			break;
+
+		//send part of day measurement from range as SOME/IP-TP segment
+		if(wifiStateStructure->segmentedTransfer)
+		{
+			uint8_t* segmentPointerTmp = &txMessage->payload[SOME_IP_MINIMAL_MESSAGE_SIZE + SOME_IP_TP_HEADER_SIZE];
+			uint16_t recordOffsetTmp = (wifiStateStructure->segmentIndex % SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENTS_PER_DAY)
+				* SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENT_SIZE;
+			uint16_t recordPartSizeTmp = sizeof(TemperatureSingleDayRecordType) - recordOffsetTmp;
+
+			if(recordPartSizeTmp > SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENT_SIZE)
+			{
+				recordPartSizeTmp = SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENT_SIZE;
+			}
+
+			//day measurement which doesn't exist is send as zeros so client will not request it again
+			memset(segmentPointerTmp, 0, SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENT_SIZE);
+
+			if(wifiStateStructure->searchedStructureExist)
+			{
+				memcpy(segmentPointerTmp, &((uint8_t*)wifiStateStructure->temperatureSingleDayRecordPointer)[recordOffsetTmp],
+					recordPartSizeTmp);
+			}
+
+			wifiStateStructure->pendingSegmentMask &= ~(1UL << wifiStateStructure->segmentIndex);
+
+			txMessage->payloadSize = SOMEIP_CodeTpTxMessage(
+					wifiStateStructure->searchedServiceId,
+					wifiStateStructure->searchedMethodId,
+					SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE,
+					txMessage->payload,
+					(uint32_t)wifiStateStructure->segmentIndex * SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENT_SIZE,
+					(wifiStateStructure->pendingSegmentMask != 0), NULL, SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENT_SIZE);
+
+			WIFI_QueueTxMessage(wifiStateStructure, txMessage, wifiStateStructure->searchedSocketId);
+
+			//next day is searched during transmission of segment
+			if(WIFI_SelectNextSegment(wifiStateStructure) == false)
+			{
+				TemperatureRecordCache_Unlock(wifiStateStructure->temperatureSingleDayRecordPointer);
+				wifiStateStructure->temperatureSingleDayRecordPointer = NULL;
+
+				wifiStateStructure->segmentedTransfer = false;
+				wifiStateStructure->searchState = SEARCH_NOT_REQUESTED;
+			}
+
+			break;
+		}
+
+		//send SOME/IP message with statistics stored in header of day measurement
+		if(wifiStateStructure->searchedStructureExist
+			&& (wifiStateStructure->searchedServiceId == SOME_IP_SERVICE_DAY_SUMMARY))
+		{
+			SomeIpDaySummaryResponsePayload daySummary;
+
+			//payload is coded directly in TX buffer
+			SOMEIP_InitWriter(&writer, txMessage->payload, MAX_SIZE_OF_SOCKET_BUFFER);
+			fillDaySummary(&daySummary, wifiStateStructure->temperatureSingleDayRecordPointer);
+			SomeIpInterface_EncodeDaySummaryGetResponse(SOMEIP_WriterReserve(&writer,
+				SOME_IP_SERVICE_DAY_SUMMARY_RESP_PAYLOAD_SIZE), &daySummary);
+
+			txMessage->payloadSize = SOMEIP_WriterFinish(&writer,
+					wifiStateStructure->searchedServiceId,
+					wifiStateStructure->searchedMethodId,
+					SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE);
+		}
+		//send SOME/IP message
+		else if(wifiStateStructure->searchedStructureExist)
+		{
+			uint16_t someIpPayloadSizeTmp = sizeof(TemperatureSingleDayRecordType) - (wifiStateStructure->searchedMethodId * SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE);
+			uint8_t* dataStructurePointerTmp = ((uint8_t*)wifiStateStructure->temperatureSingleDayRecordPointer);
+
+			if(someIpPayloadSizeTmp > SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE)
+			{
+				someIpPayloadSizeTmp = SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE;
+			}
+
+			txMessage->payloadSize = SOMEIP_CodeTxMessage(
+					wifiStateStructure->searchedServiceId,
+					wifiStateStructure->searchedMethodId,
+					SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE,
+					txMessage->payload,
+					&dataStructurePointerTmp[wifiStateStructure->searchedMethodId * SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE],
+					someIpPayloadSizeTmp);
+		}
+		else//send SOME/IP response without payload - it mean that structure don't exist
+		{
+			txMessage->payloadSize = SOMEIP_CodeTxMessage(
+					wifiStateStructure->searchedServiceId,
+					wifiStateStructure->searchedMethodId,
+					SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE,
+					txMessage->payload, NULL, 0);
+		}
+
+		WIFI_QueueTxMessage(wifiStateStructure, txMessage, wifiStateStructure->searchedSocketId);
+
+		//response contain copy of data so entry in cache can be reused
+		TemperatureRecordCache_Unlock(wifiStateStructure->temperatureSingleDayRecordPointer);
+		wifiStateStructure->temperatureSingleDayRecordPointer = NULL;
+
+		wifiStateStructure->searchState = SEARCH_NOT_REQUESTED;
+		break;
+
+	case SEARCH_RANGE_REQUESTED:
+		if(lockSharedSpiPort(FRAM_USAGE))
+		{
+			ClockState.FramTransactionIdentifier = FRAM_ID_SEARCH_TEMPERATURE;
+
+			wifiStateStructure->readFramWasRequested = false;
+			wifiStateStructure->searchFramIndex = 0;
+
+			wifiStateStructure->searchState = SEARCH_RANGE_SCAN;
+		}
+
+		break;
+
+	case SEARCH_RANGE_SCAN:
+		if(wifiStateStructure->readFramWasRequested == false)
+		{
+			FRAM_Read(convertFramIndexToAddress(wifiStateStructure->searchFramIndex),
+				DAY_MEASUREMENT_HEADER_SIZE, (uint8_t*)&wifiStateStructure->ReadDayMeasurementHeader);
+
+			wifiStateStructure->readFramWasRequested = true;
+		}
+		else if(FRAM_Process())
+		{
+			uint8_t dayIndexTmp = WIFI_GetRangeQueryDayIndex(wifiStateStructure, &wifiStateStructure->ReadDayMeasurementHeader);
+
+			wifiStateStructure->readFramWasRequested = false;
+
+			//first found day measurement is used like in search of single day
+			if((dayIndexTmp < WIFI_RANGE_INDEX_TABLE_DAYS)
+				&& (wifiStateStructure->RangeQueryFramIndexTable[dayIndexTmp][wifiStateStructure->ReadDayMeasurementHeader.source]
+					== WIFI_RANGE_QUERY_INDEX_NOT_FOUND))
+			{
+				wifiStateStructure->RangeQueryFramIndexTable[dayIndexTmp][wifiStateStructure->ReadDayMeasurementHeader.source]
+					= wifiStateStructure->searchFramIndex;
+			}
+
+			wifiStateStructure->searchFramIndex++;
+
+			//all headers was read so SPI is released until load of day measurement
+			if(wifiStateStructure->searchFramIndex >= MAX_RECORD_IN_FRAM)
+			{
+				ClockState.sharedSpiState = NOT_USED;
+				ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
+
+				wifiStateStructure->searchState = SEARCH_RANGE_NEXT_ENTRY;
+			}
+		}
+
+		break;
+
+	case SEARCH_RANGE_NEXT_ENTRY:
+	{
+		DayMeasurementHeader* searchedHeaderTmp = &wifiStateStructure->SearchedDayMeasurementHeader;
+		uint16_t framIndexTmp = 0;
+
+		wifiStateStructure->rangeQuerySampleIndex = 0;
+
+		//present day and day measurements already loaded to cache don't require FRAM access
+		wifiStateStructure->temperatureSingleDayRecordPointer = TemperatureRecordCache_Find(searchedHeaderTmp->source,
+			searchedHeaderTmp->day, searchedHeaderTmp->month, searchedHeaderTmp->year, &framIndexTmp);
+
+		//CRC16Value of present day isn't updated in RAM so CRC of manifest is always calculated
+		if((wifiStateStructure->temperatureSingleDayRecordPointer != NULL) && wifiStateStructure->rangeQueryManifest)
+		{
+			wifiStateStructure->rangeQueryCrc16Value = Chip_CRC_CRC16((uint16_t*)wifiStateStructure->temperatureSingleDayRecordPointer,
+				(offsetof(TemperatureSingleDayRecordType, CRC16Value)/2));
+			wifiStateStructure->temperatureSingleDayRecordPointer = NULL;
+
+			wifiStateStructure->searchState = SEARCH_RANGE_SEND;
+		}
+		else if(wifiStateStructure->temperatureSingleDayRecordPointer != NULL)
+		{
+			TemperatureRecordCache_Lock(wifiStateStructure->temperatureSingleDayRecordPointer);
+
+			wifiStateStructure->searchState = SEARCH_RANGE_SEND;
+		}
+		//day measurement which doesn't exist isn't send
+		else if(wifiStateStructure->RangeQueryFramIndexTable[wifiStateStructure->rangeQueryDayIndex][searchedHeaderTmp->source]
+			== WIFI_RANGE_QUERY_INDEX_NOT_FOUND)
+		{
+			wifiFinishRangeQueryEntry(wifiStateStructure);
+		}
+		else
+		{
+			wifiStateStructure->searchState = SEARCH_RANGE_LOAD_REQUESTED;
+		}
+
+		break;
+	}
+
+	case SEARCH_RANGE_LOAD_REQUESTED:
+		//manifest require only CRC so from FRAM is read only CRC16Value field
+		if(wifiStateStructure->rangeQueryManifest)
+		{
+			//CRC16Value in FRAM is the same like in RAM only after migration of statistics
+			if((TemperatureStatisticsMigration.framIndex >= MAX_RECORD_IN_FRAM) && lockSharedSpiPort(FRAM_USAGE))
+			{
+				ClockState.FramTransactionIdentifier = FRAM_ID_SEARCH_TEMPERATURE;
+
+				wifiStateStructure->searchFramIndex = wifiStateStructure->RangeQueryFramIndexTable[wifiStateStructure->rangeQueryDayIndex]
+					[wifiStateStructure->SearchedDayMeasurementHeader.source];
+
+				FRAM_Read(convertFramIndexToAddress(wifiStateStructure->searchFramIndex) + offsetof(TemperatureSingleDayRecordType, CRC16Value),
+					sizeof(uint16_t), (uint8_t*)&wifiStateStructure->rangeQueryCrc16Value);
+
+				wifiStateStructure->searchState = SEARCH_RANGE_LOAD;
+			}
+
+			break;
+		}
+
+		//reserve buffer in cache before FRAM will be locked
+		if(wifiStateStructure->temperatureSingleDayRecordPointer == NULL)
+		{
+			wifiStateStructure->temperatureSingleDayRecordPointer = TemperatureRecordCache_Reserve();
+		}
+
+		if((wifiStateStructure->temperatureSingleDayRecordPointer != NULL) && lockSharedSpiPort(FRAM_USAGE))
+		{
+			ClockState.FramTransactionIdentifier = FRAM_ID_SEARCH_TEMPERATURE;
+
+			wifiStateStructure->searchFramIndex = wifiStateStructure->RangeQueryFramIndexTable[wifiStateStructure->rangeQueryDayIndex]
+				[wifiStateStructure->SearchedDayMeasurementHeader.source];
+
+			FRAM_Read(convertFramIndexToAddress(wifiStateStructure->searchFramIndex), sizeof(TemperatureSingleDayRecordType),
+				(uint8_t*)wifiStateStructure->temperatureSingleDayRecordPointer);
+
+			wifiStateStructure->searchState = SEARCH_RANGE_LOAD;
+		}
+
+		break;
+
+	case SEARCH_RANGE_LOAD:
+		if(FRAM_Process())
+		{
+			ClockState.sharedSpiState = NOT_USED;
+			ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
+
+			if(wifiStateStructure->rangeQueryManifest)
+			{
+				wifiStateStructure->searchState = SEARCH_RANGE_SEND;
+			}
+			else if(verifyTemperatureRecord(wifiStateStructure->temperatureSingleDayRecordPointer,
+				wifiStateStructure->SearchedDayMeasurementHeader.source, wifiStateStructure->SearchedDayMeasurementHeader.day,
+				wifiStateStructure->SearchedDayMeasurementHeader.month, wifiStateStructure->SearchedDayMeasurementHeader.year))
+			{
+				TemperatureRecordCache_Commit(wifiStateStructure->temperatureSingleDayRecordPointer, wifiStateStructure->searchFramIndex);
+
+				wifiStateStructure->searchState = SEARCH_RANGE_SEND;
+			}
+			else//damaged day measurement is skipped like day measurement which doesn't exist
+			{
+				wifiFinishRangeQueryEntry(wifiStateStructure);
+			}
+		}
+
+		break;
+
+	case SEARCH_RANGE_SEND:
+		//wait until one of TX buffers will be free
+		if(wifiStartRangeQueryMessage(wifiStateStructure) == false)
+			break;
+
+		if(wifiWriteRangeQueryEntry(wifiStateStructure))
+		{
+			wifiFinishRangeQueryEntry(wifiStateStructure);
+		}
+		else//rest of day measurement is written to next message
+		{
+			wifiSendRangeQueryMessage(wifiStateStructure, true);
+		}
+
+		break;
+
+	case SEARCH_RANGE_FINISHED:
+		//last message is send also when it don't contain entries
+		if(wifiStartRangeQueryMessage(wifiStateStructure) == false)
+			break;
+
+		wifiSendRangeQueryMessage(wifiStateStructure, false);
+
+		wifiStateStructure->searchState = SEARCH_NOT_REQUESTED;
+		break;
+
+#if WIFI_FRAM_IMAGE_SERVICE
+	case SEARCH_IMAGE_EXPORT_REQUESTED:
+	{
+		SomeIpFramImageBlock* imageBlockTmp = NULL;
+
+		//wait until one of TX buffers will be free
+		txMessage = WIFI_GetFreeTxMessage(wifiStateStructure);
+
+		if((txMessage == NULL) || (lockSharedSpiPort(FRAM_USAGE) == false))
+			break;
+
+		ClockState.FramTransactionIdentifier = FRAM_ID_FRAM_IMAGE;
+
+		//buffer isn't free until message will be queued so it is hold like buffer of range query
+		WIFI_HoldTxMessage(txMessage);
+		wifiStateStructure->rangeQueryTxMessage = txMessage;
+
+		SOMEIP_InitWriter(&wifiStateStructure->rangeQueryWriter, txMessage->payload, MAX_SIZE_OF_SOCKET_BUFFER);
+		imageBlockTmp = (SomeIpFramImageBlock*)SOMEIP_WriterReserve(&wifiStateStructure->rangeQueryWriter,
+			SOME_IP_SERVICE_FRAM_IMAGE_BLOCK_HEADER_SIZE + WIFI_GetFramImageBlockSize(wifiStateStructure->framImageBlockIndex));
+
+		//data of block is read directly to TX buffer
+		FRAM_Read(FRAM_MEASUREMENT_DATA_BEGIN + (wifiStateStructure->framImageBlockIndex * WIFI_FRAM_IMAGE_BLOCK_SIZE),
+			WIFI_GetFramImageBlockSize(wifiStateStructure->framImageBlockIndex), imageBlockTmp->data);
+
+		wifiStateStructure->searchState = SEARCH_IMAGE_EXPORT_READ;
+		break;
+	}
+
+	case SEARCH_IMAGE_EXPORT_READ:
+		if(FRAM_Process())
+		{
+			SomeIpFramImageBlock* imageBlockTmp = (SomeIpFramImageBlock*)SOMEIP_GetPayload(wifiStateStructure->rangeQueryTxMessage->payload);
+			uint16_t blockSizeTmp = WIFI_GetFramImageBlockSize(wifiStateStructure->framImageBlockIndex);
+
+			ClockState.sharedSpiState = NOT_USED;
+			ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
+
+			imageBlockTmp->blockIndex = wifiStateStructure->framImageBlockIndex;
+			imageBlockTmp->numberOfBlocks = WIFI_FRAM_IMAGE_NUMBER_OF_BLOCKS;
+			imageBlockTmp->crc16Value = Chip_CRC_CRC16((uint16_t*)imageBlockTmp->data, blockSizeTmp/2);
+			imageBlockTmp->reserved = 0;
+
+			wifiStateStructure->framImageBlockIndex++;
+			imageBlockTmp->moreMessages = (wifiStateStructure->framImageBlockIndex < wifiStateStructure->framImageLastBlockIndex);
+
+			txMessage = wifiStateStructure->rangeQueryTxMessage;
+			txMessage->payloadSize = SOMEIP_WriterFinish(&wifiStateStructure->rangeQueryWriter,
+					wifiStateStructure->searchedServiceId,
+					wifiStateStructure->searchedMethodId,
+					SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE);
+
+			WIFI_QueueTxMessage(wifiStateStructure, txMessage, wifiStateStructure->searchedSocketId);
+			wifiStateStructure->rangeQueryTxMessage = NULL;
+
+			//next block is read during transmission of previous one
+			if(imageBlockTmp->moreMessages)
+			{
+				wifiStateStructure->searchState = SEARCH_IMAGE_EXPORT_REQUESTED;
+			}
+			else
+			{
+				wifiStateStructure->searchState = SEARCH_NOT_REQUESTED;
+			}
+		}
+
+		break;
+
+	case SEARCH_IMAGE_IMPORT_REQUESTED:
+		if(lockSharedSpiPort(FRAM_USAGE))
+		{
+			ClockState.FramTransactionIdentifier = FRAM_ID_FRAM_IMAGE;
+
+			FRAM_Write(FRAM_MEASUREMENT_DATA_BEGIN + (wifiStateStructure->framImageBlockIndex * WIFI_FRAM_IMAGE_BLOCK_SIZE),
+				WIFI_GetFramImageBlockSize(wifiStateStructure->framImageBlockIndex), wifiStateStructure->FramImageBlock);
+
+			wifiStateStructure->searchState = SEARCH_IMAGE_IMPORT_WRITE;
+		}
+
+		break;
+
+	case SEARCH_IMAGE_IMPORT_WRITE:
+		if(FRAM_Process())
+		{
+			uint16_t blockOffsetTmp = wifiStateStructure->framImageBlockIndex * WIFI_FRAM_IMAGE_BLOCK_SIZE;
+			uint16_t lastByteOffsetTmp = blockOffsetTmp + WIFI_GetFramImageBlockSize(wifiStateStructure->framImageBlockIndex) - 1;
+
+			ClockState.sharedSpiState = NOT_USED;
+			ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
+
+			//day measurements loaded to cache from overwritten indexes are out of date
+			for(uint16_t i = blockOffsetTmp/sizeof(TemperatureSingleDayRecordType);
+				(i <= lastByteOffsetTmp/sizeof(TemperatureSingleDayRecordType)) && (i < MAX_RECORD_IN_FRAM); i++)
+			{
+				TemperatureRecordCache_InvalidateFramIndex(i);
+			}
+
+			wifiStateStructure->searchState = SEARCH_IMAGE_IMPORT_FINISHED;
+		}
+
+		break;
+
+	case SEARCH_IMAGE_IMPORT_FINISHED:
+		//wait until one of TX buffers will be free
+		txMessage = WIFI_GetFreeTxMessage(wifiStateStructure);
+
+		if(txMessage == NULL)
+			break;
+
+		txMessage->payloadSize = SOMEIP_CodeTxMessage(
+				wifiStateStructure->searchedServiceId,
+				wifiStateStructure->searchedMethodId,
+				SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE,
+				txMessage->payload, NULL, 0);
+
+		WIFI_QueueTxMessage(wifiStateStructure, txMessage, wifiStateStructure->searchedSocketId);
+
+		wifiStateStructure->searchState = SEARCH_NOT_REQUESTED;
+		break;
+
+	case SEARCH_IMAGE_VALIDATE_REQUESTED:
+		//reserve buffer in cache before FRAM will be locked
+		if(wifiStateStructure->temperatureSingleDayRecordPointer == NULL)
+		{
+			wifiStateStructure->temperatureSingleDayRecordPointer = TemperatureRecordCache_Reserve();
+		}
+
+		if((wifiStateStructure->temperatureSingleDayRecordPointer != NULL) && lockSharedSpiPort(FRAM_USAGE))
+		{
+			ClockState.FramTransactionIdentifier = FRAM_ID_FRAM_IMAGE;
+
+			FRAM_Read(convertFramIndexToAddress(wifiStateStructure->framImageBlockIndex), sizeof(TemperatureSingleDayRecordType),
+				(uint8_t*)wifiStateStructure->temperatureSingleDayRecordPointer);
+
+			wifiStateStructure->searchState = SEARCH_IMAGE_VALIDATE_READ;
+		}
+
+		break;
+
+	case SEARCH_IMAGE_VALIDATE_READ:
+		if(FRAM_Process())
+		{
+			ClockState.sharedSpiState = NOT_USED;
+			ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
+
+			wifiCheckImportedRecord(wifiStateStructure, wifiStateStructure->temperatureSingleDayRecordPointer);
+
+			wifiStateStructure->framImageBlockIndex++;
+
+			if(wifiStateStructure->framImageBlockIndex >= MAX_RECORD_IN_FRAM)
+			{
+				wifiStateStructure->searchState = SEARCH_IMAGE_VALIDATE_FINISHED;
+			}
+			else
+			{
+				wifiStateStructure->searchState = SEARCH_IMAGE_VALIDATE_REQUESTED;
+			}
+		}
+
+		break;
+
+	case SEARCH_IMAGE_VALIDATE_FINISHED:
+		//wait until one of TX buffers will be free
+		txMessage = WIFI_GetFreeTxMessage(wifiStateStructure);
+
+		if(txMessage == NULL)
+			break;
+
+		//buffer wasn't committed so entry in cache stay invalid
+		TemperatureRecordCache_Unlock(wifiStateStructure->temperatureSingleDayRecordPointer);
+		wifiStateStructure->temperatureSingleDayRecordPointer = NULL;
+
+		wifiRebaseFramIndexes(wifiStateStructure);
+		wifiStateStructure->framImageImportActive = false;
+
+		//imported day measurements can be stored by previous firmware
+		TemperatureStatisticsMigration.framIndex = 0;
+
+		SOMEIP_InitWriter(&writer, txMessage->payload, MAX_SIZE_OF_SOCKET_BUFFER);
+		SomeIpInterface_EncodeFramImageValidateResponse(SOMEIP_WriterReserve(&writer,
+			SOME_IP_SERVICE_FRAM_IMAGE_VALIDATE_RESP_PAYLOAD_SIZE), &wifiStateStructure->FramImageValidationResult);
+
+		txMessage->payloadSize = SOMEIP_WriterFinish(&writer,
+				wifiStateStructure->searchedServiceId,
+				wifiStateStructure->searchedMethodId,
+				SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE);
+
+		WIFI_QueueTxMessage(wifiStateStructure, txMessage, wifiStateStructure->searchedSocketId);
+
+		wifiStateStructure->searchState = SEARCH_NOT_REQUESTED;
+		break;
+#endif
+	}/* switch(wifiStateStructure->searchState) */
+}
+
+/*****************************************************************************************
+* calculateFurnaceTemperature() - calculate furnace temperature by add to temperature from
+* sensor temperature offset set by GUI interface. If temperature will be invalid
+* calculation will not be performed.
+*
+* Return: calculating temperature
+*****************************************************************************************/
+static uint16_t calculateFurnaceTemperature(void)
+{
+	if(ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValid)
+	{
+		int32_t temperatureTmp = (int32_t)(ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValue)
+			+ (int32_t)(ClockState.temperatureFurnaceOffset * 10);
+
+		return ((uint16_t)temperatureTmp);
+	}
+	else
+	{
+		return INVALID_READ_SENSOR_VALUE;
+	}
+}
+
+/*****************************************************************************************
+* processAlarm() - function decide about raising alarm by checking three possible source
+* of alarm condition. If alarm is raised then also PWM for buzzer is activated. Buzzer
+* melody is controlled by this function.
+*****************************************************************************************/
+static void processAlarm(void)
+{
+	if(gui.active_window != &clockSettingsWindow)
+	{
+		if(ClockState.firstAlarmActive)
+		{
+			static bool firstAlarmActivationStep = true;
+
+			if(firstAlarmActivationStep == true
+				&& ClockState.firstAlarmHour == ClockState.currentTimeHour
+				&& ClockState.firstAlarmMinute == ClockState.currentTimeMinute)
+			{
+				firstAlarmActivationStep = false;
+				ClockState.firstAlarmRaised = true;
+			}
+
+			if(ClockState.firstAlarmHour != ClockState.currentTimeHour
+				|| ClockState.firstAlarmMinute != ClockState.currentTimeMinute)
+			{
+				firstAlarmActivationStep = true;
+			}
+		}
+
+		if(ClockState.secondAlarmActive)
+		{
+			static bool secondAlarmActivationStep = true;
+
+			if(secondAlarmActivationStep == true
+				&& ClockState.secondAlarmHour == ClockState.currentTimeHour
+				&& ClockState.secondAlarmMinute == ClockState.currentTimeMinute)
+			{
+				secondAlarmActivationStep = false;
+				ClockState.secondAlarmRaised = true;
+			}
+
+			if(ClockState.secondAlarmHour != ClockState.currentTimeHour
+				|| ClockState.secondAlarmMinute != ClockState.currentTimeMinute)
+			{
+				secondAlarmActivationStep = true;
+			}
+		}
+	}
+
+	if((gui.active_window != &temperatureWindow) && ClockState.temperatureFurnaceAlarmActive)
+	{
+		static bool temperatureFurnaceAlarmActivationStep = true;
+
+		if(temperatureFurnaceAlarmActivationStep && ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValid
+			&& (ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValue < ClockState.temperatureFurnaceAlarmThreshold))
+		{
+			temperatureFurnaceAlarmActivationStep = false;
+			ClockState.temperatureFurnaceAlarmRaised = true;
+		}
+
+		if(ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValid
+			&& (ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValue > ClockState.temperatureFurnaceAlarmThreshold))
+		{
+			temperatureFurnaceAlarmActivationStep = true;
+		}
+	}
+
+	//increment sound piezo step if at least one of three alarm is active
+	if(ClockState.firstAlarmRaised == true || ClockState.secondAlarmRaised == true
+		|| ClockState.temperatureFurnaceAlarmRaised)
+	{
+		static uint8_t soundThreadCounter = 0;
+
+		if(soundThreadCounter >= LENGHT_OF_INCREMENT_SOUND_STEP)
+		{
+			Buzzer_TurnOff();
+			Buzzer_SetOctave(SoundAlarmTable[ClockState.alarmSoundAnimationStep]);
+			Buzzer_TurnOn();
+
+			ClockState.alarmSoundAnimationStep++;
+
+			if(ClockState.alarmSoundAnimationStep >= LENGHT_OF_SOUND_ALARM_TABLE)
+				ClockState.alarmSoundAnimationStep = 0;
+
+			soundThreadCounter = 0;
+		}
+		else
+		{
+			soundThreadCounter++;
+		}
+	}
+	else
+	{
+		ClockState.alarmSoundAnimationStep = 0;
+	}
+}
+
+/*****************************************************************************************
+* Thread_Init() - initiate data for single Thread responsible for many thing like handle
+* FRAM. In initialization process is set timer(responsible for cyclic call Thread), FRAM
+* temperature measurement block and I2C bus expander.
+*****************************************************************************************/
+void Thread_Init(void)
+{
+	TemperatureRecordCache_Init();
+
+	/**********************************
+	*	configure measurements blocks
+	***********************************/
+	{
+		for(uint16_t i = 0; i < NUM_OF_TEMPERATURE_SOURCE; i++)
+		{
+			if(ClockState.TemperatureSensorTable[i].recordTemperature == true)
+			{
+				initTemperatureBlock(&TemperatureSingleDay[i], &ClockState.TemperatureSensorTable[i].temperatureFramIndex, i);
+			}
+		}
+	}
+	/**********************************
+	*	configure temperature FRAM structures necessary to store measurements
+	***********************************/
+	//temperature outside
+	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].transactionId = FRAM_ID_MOVE_TEMPERATURE_OUTSIDE;
+	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].previousAssignFilter = 0;
+	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].previousAssignStore = 0;
+	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].startTemperatureTransaction = false;
+	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].temperatureIndex = 0;
+	TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE].source = OUTSIDE_TEMPERATURE;
+
+	//temperature inside
+	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].transactionId = FRAM_ID_MOVE_TEMPERATURE_INSIDE;
+	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].previousAssignFilter = 0;
+	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].previousAssignStore = 0;
+	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].startTemperatureTransaction = false;
+	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].temperatureIndex = 0;
+	TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE].source = INSIDE_TEMPERATURE;
+
+	//temperature furnace
+	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].transactionId = FRAM_ID_MOVE_TEMPERATURE_FURNACE;
+	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].previousAssignFilter = 0;
+	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].previousAssignStore = 0;
+	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].startTemperatureTransaction = false;
+	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].temperatureIndex = 0;
+	TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE].source = FURNACE_TEMPERATURE;
+
+	/**********************************
+	*	configure temperature FRAM structure necessary to read measurements
+	***********************************/
+	TemperatureFramReadTransaction.searchCounter = 0;
+	TemperatureFramReadTransaction.startReadTransaction = false;
+	TemperatureFramReadTransaction.temperatureSingleDayTmp = NULL;
+
+	TemperaturePrefetch.direction = PREFETCH_DIRECTION_NONE;
+	TemperaturePrefetch.numberOfPrefetchedDays = 0;
+	TemperaturePrefetch.searchActive = false;
+	TemperaturePrefetch.searchDirection = PREFETCH_DIRECTION_NONE;
+	TemperaturePrefetch.searchFailedFlag = false;
+	TemperaturePrefetch.temperatureSingleDayTmp = NULL;
+
+	TemperatureStatisticsMigration.framIndex = 0;
+	TemperatureStatisticsMigration.writeStarted = false;
+	TemperatureStatisticsMigration.temperatureSingleDayTmp = NULL;
+
+	/**********************************
+	*	configure temperature sensor
+	***********************************/
+	TemperatureSensor_ChoseSensor(CN6_TEMP_INSIDE);
+
+	TemperatureSensor_StartMeasurement();
+
+	/**********************************
+	*	configure WifiState structure
+	***********************************/
+	WifiStateStructure.connectToApnCounter = ONE_SECONDS*30;
+	WifiStateStructure.getApnCounter = ONE_SECONDS*12;
+
+	/**********************************
+	*	init timer
+	***********************************/
+	//connect CT16B0 to AHB
+	LPC_SYSCON->SYSAHBCLKCTRL |= (1<<7);
+
+#if 0//configuration for 12MHz
+	//configure prescaller
+	LPC_TIMER16_0->PR=120;
+
+	//this register will max value of counter
+	LPC_TIMER16_0->MR[0]=2000;
+#else//configuration for 48MHz
+	//configure prescaller
+	LPC_TIMER16_0->PR=480;
+
+	//this register will max value of counter
+	LPC_TIMER16_0->MR[0]=2000;
+#endif
+	//Reset on MR0 and generate interrupt(set MR0R bit and MR0I)
+	LPC_TIMER16_0->MCR=3;
+
+	//Reset Timer
+	LPC_TIMER16_0->TCR = 0x2;
+
+	//Enable timer (set CEN bit)
+	LPC_TIMER16_0->TCR=1;
+
+	//set interrupt timer priority
+	NVIC_SetPriority(TIMER_16_0_IRQn, 3);
+
+	//allow for interruptions from timer
+	NVIC_EnableIRQ(TIMER_16_0_IRQn);
+}
+
+/*****************************************************************************************
+* Thread_Call() - function is call every 20 ms. All things inside is asynchronous
+* executed(task isn't block execution for longer period).
+*****************************************************************************************/
+void Thread_Call(void)
+{
+	/**********************************
+	*	read temperature from three sensors
+	***********************************/
+	{
+		static uint16_t* tempValuePointer = &ClockState.TemperatureSensorTable[INSIDE_TEMPERATURE].temperatureValue;
+		static bool* tempValueValidFlagPointer = &ClockState.TemperatureSensorTable[INSIDE_TEMPERATURE].temperatureValid;
+		static uint8_t nextTempSensor = 1;
+		static uint16_t refreshGuiCounter = (3*ONE_SECONDS);
+
+		TemperatureSensor_Process();
+
+		if(TemperatureSensor_CheckMeasurementStatus() == I2C_DATA_IS_READY)
+		{
+			uint16_t previousTemperatureValue = *tempValuePointer;
+
+			*tempValuePointer = TemperatureSensor_ReturnTemperature();
+
+			if(*tempValuePointer == INVALID_READ_SENSOR_VALUE)
+				*tempValueValidFlagPointer = false;
+			else
+				*tempValueValidFlagPointer = true;
+
+			//calculate furnace temperature using offset value
+			if(nextTempSensor == 3)
+				*tempValuePointer = calculateFurnaceTemperature();
+
+			if(*tempValuePointer != previousTemperatureValue)
+				WIFI_ClockStatusChanged();
+		}
+
+		if (TemperatureSensor_CheckMeasurementStatus() == I2C_WAITING_FOR_REQUEST)
+		{
+			nextTempSensor++;
+			if(nextTempSensor == 4)
+				nextTempSensor = 1;
+
+			switch(nextTempSensor)
+			{
+			case 1:
+				tempValuePointer = &ClockState.TemperatureSensorTable[INSIDE_TEMPERATURE].temperatureValue;
+				tempValueValidFlagPointer = &ClockState.TemperatureSensorTable[INSIDE_TEMPERATURE].temperatureValid;
+				TemperatureSensor_ChoseSensor(CN6_TEMP_INSIDE);
+				break;
+
+			case 2:
+				tempValuePointer = &ClockState.TemperatureSensorTable[OUTSIDE_TEMPERATURE].temperatureValue;
+				tempValueValidFlagPointer = &ClockState.TemperatureSensorTable[OUTSIDE_TEMPERATURE].temperatureValid;
+				TemperatureSensor_ChoseSensor(CN5_TEMP_OUTSIDE);
+				break;
+
+			case 3:
+				tempValuePointer = &ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValue;
+				tempValueValidFlagPointer = &ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValid;
+
+				TemperatureSensor_ChoseSensor(CN4_TEMP_FURNACE);
+				break;
+
+			default:
+				break;
+			}
+
+			TemperatureSensor_StartMeasurement();
+		}
+
+		//refresh GUI temp values every 5s
+		if(refreshGuiCounter >= (5*ONE_SECONDS))
+		{
+			if(ClockState.refreshTemperatureValues == WAITING_FOR_REQUEST)
+			{
+				ClockState.refreshTemperatureValues = REFRESH;
+			}
+			else if(ClockState.refreshTemperatureValues == REFRESH_PERFORMED)
+			{
+				refreshGuiCounter = 0;
+				ClockState.refreshTemperatureValues = WAITING_FOR_REQUEST;
+			}
+		}
+		else
+		{
+			refreshGuiCounter++;
+		}
+	}
+
+	/**********************************
+	*	move temperature to FRAM
+	***********************************/
+	processWriteTemperature(&TemperatureFramTransactionSensorTable[OUTSIDE_TEMPERATURE]);
+
+	processWriteTemperature(&TemperatureFramTransactionSensorTable[INSIDE_TEMPERATURE]);
+
+	processWriteTemperature(&TemperatureFramTransactionSensorTable[FURNACE_TEMPERATURE]);
+
+	/**********************************
+	*	check button responsible for Factory reset
+	***********************************/
+	static bool framClearFlag = false;
+
+	{
+		static uint16_t framClearCounter = 0;
+
+		if(GPIO_GetState(RESET_BUTTON_GPIO_PORT, RESET_BUTTON_GPIO_PIN) == false)
+			framClearCounter++;
+		else
+			framClearCounter = 0;
+
+		if( ((framClearCounter >= (ONE_SECONDS*3)) || (ClockState.factoryResetViaGui == true))
+			&& lockSharedSpiPort(FRAM_USAGE))
+		{
+			ClockState.FramTransactionIdentifier = FRAM_ID_FACTORY_RESET;
+
+			framClearFlag = true;
+		}
+
+		//clear two block in FRAM memory
+		if(framClearFlag && (ClockState.FramTransactionIdentifier == FRAM_ID_FACTORY_RESET))
+		{
+			static bool startWriteSequence = true;
+			static uint8_t indexOfBlock = 0;
+
+			if(startWriteSequence)
+			{
+				FRAM_Write(CLEAR_BLOCK_SIZE*indexOfBlock, CLEAR_BLOCK_SIZE, clearFramData);
+				startWriteSequence = false;
+			}
+
+			if(FRAM_Process() == true)
+			{
+				indexOfBlock++;
+				startWriteSequence = true;
+			}
+
+			if(indexOfBlock == MAX_INDEX)
+			{
+				NVIC_SystemReset();
+			}
+		}
+	}
+	/**********************************
+	*	store clock state structure
+	***********************************/
+	{
+		static uint16_t clockStateToFramCounter = 0;
+		static uint8_t blockNumberInFram = 0;
+
+		if((clockStateToFramCounter >= ONE_SECONDS) && (framClearFlag == false))
+		{
+			if(lockSharedSpiPort(FRAM_USAGE))
+			{
+				ClockState.FramTransactionIdentifier = FRAM_ID_CLOCKSTATE;
+
+				//copy clockState to local buffer
+				ClockStateFramBuffer = ClockState;
+
+				//calculate crc16
+				ClockStateFramBuffer.CRC16Value = Chip_CRC_CRC16((uint16_t*)&ClockStateFramBuffer, (offsetof(ClockStateType, CRC16Value)/2));
+
+				if(blockNumberInFram == 0)
+				{
+					//start transmision
+					FRAM_Write(FRAM_CLOCK_STATE_FIRST_COPY, sizeof(ClockStateFramBuffer),
+							(uint8_t*)&ClockStateFramBuffer);
+					blockNumberInFram = 1;
+				}
+				else
+				{
+					FRAM_Write(FRAM_CLOCK_STATE_SECOND_COPY, sizeof(ClockStateFramBuffer),
+							(uint8_t*)&ClockStateFramBuffer);
+					blockNumberInFram = 0;
+				}
+			}
+			else if((ClockState.sharedSpiState == FRAM_USAGE)
+				&& (ClockState.FramTransactionIdentifier == FRAM_ID_CLOCKSTATE))
+			{
+				if(FRAM_Process() == true)
+				{
+					clockStateToFramCounter = 0;
+					ClockState.sharedSpiState = NOT_USED;
+					ClockState.FramTransactionIdentifier = FRAM_ID_NOP;
+				}
+			}
+		}
+		else
+		{
+			clockStateToFramCounter++;
+		}
+	}
+	/**********************************
+	*	GUI manager
+	***********************************/
+	{
+		if(ClockState.refreshGuiCounter <= 10*ONE_SECONDS)
+		{
+			ClockState.refreshGuiCounter++;
+		}
+	}
+	/**********************************
+	*	copy temperature data to read buffer
+	***********************************/
+	processReadTemperature(&TemperatureFramReadTransaction);
+
+	/**********************************
+	*	load to cache days which will be shown after next cursor moves
+	***********************************/
+	processPrefetchTemperature(&TemperaturePrefetch);
+
+	/**********************************
+	*	write statistics to day measurements stored by previous firmware
+	***********************************/
+	processStatisticsMigration(&TemperatureStatisticsMigration);
+
+	/**********************************
+	*	alarm
+	***********************************/
+	processAlarm();
+
+	/**********************************
+	*	wifi
+	***********************************/
+	{
+		if(ClockState.wifiReady == false)
+		{
+			WIFI_Init();
+		}
+		else
+		{
+			WIFI_Process(&WifiStateStructure);
+
+			wifiProcessFramSearchRequest(&WifiStateStructure);
+		}
+	}
+}
+
+/*****************************************************************************************
+* TIMER16_0_IRQHandler() - function for handle microcontroller interuption from timer,
+*****************************************************************************************/
+void TIMER16_0_IRQHandler(void)
+{
+	Thread_Call();
+
+	LPC_TIMER16_0->IR = 1;
+}
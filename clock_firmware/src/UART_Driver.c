@@ -1,168 +1,310 @@
-/*
- * Copyright (c) 2018, 2019, Adrian Chemicz
- * All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *    1. Redistributions of source code must retain the above copyright
- *       notice, this list of conditions and the following disclaimer.
- *    2. Redistributions in binary form must reproduce the above copyright
- *       notice, this list of conditions and the following disclaimer in the
- *       documentation and/or other materials provided with the distribution.
- *    3. Neither the name of contributors may be used to endorse or promote products
- *       derived from this software without specific prior written permission.
-
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
- * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
- * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
- * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
- * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-
-#include "UART_Driver.h"
-#include "chip.h"
-
-static uint8_t AhbClkDivider;
-static uint8_t DivisorLatchMSB;//DLM
-static uint8_t DivisorLatchLSB;//DLL
-static uint8_t FractionalDivider;// MULVAL<<4 | DIVADDVAL
-
-static uint32_t* UART_GetBaseAddress(uint8_t portNumber)
-{
-	uint32_t* basePointer = 0;
-	switch(portNumber)
-	{
-	case 0:
-		basePointer = (uint32_t*)LPC_USART0_BASE;
-		break;
-	default:
-		basePointer = 0;
-		break;
-	}
-
-	return basePointer;
-}
-
-static void UART_SetClockPrescalers(uint32_t baudrate)
-{
-	/*must be defined by user  */
-	switch(baudrate)
-	{
-	case 9600://TODO
-		AhbClkDivider = 4;
-		DivisorLatchMSB = 0;
-		DivisorLatchLSB = 1;
-		FractionalDivider = 0x10;
-		break;
-	case 115200://TODO
-		AhbClkDivider = 4;
-		DivisorLatchMSB = 0;
-		DivisorLatchLSB = 4;
-		FractionalDivider = 0x85;
-		break;
-	case 74880:
-		AhbClkDivider = 4;
-		DivisorLatchMSB = 0;
-		DivisorLatchLSB = 10;
-		FractionalDivider = 0x10;
-		break;
-	default:
-		break;
-	}
-}
-
-void UART_DriverInit(uint8_t portNumber, uint32_t baudrate, WORD_LENGTH length, STOP_BITS stopBits, PARITY parity)
-{
-	LPC_USART0_T *UART_Port = (LPC_USART0_T*)UART_GetBaseAddress(portNumber);
-
-	//turn on options responsible for change GPIO purpose like UART, ADC or SPI
-	LPC_SYSCON->SYSAHBCLKCTRL |= (1<<16);
-
-	UART_SetClockPrescalers(baudrate);
-
-	if(portNumber == 0)
-	{
-		NVIC_DisableIRQ(USART0_IRQn);
-
-		//configure GPIO pin which is used by UART0
-		//RXD
-		LPC_IOCON->PIO0[18] |= 1;
-		//TXD
-		LPC_IOCON->PIO0[19] |= 1;
-
-		//connect UART0 to AHB bus
-		LPC_SYSCON->SYSAHBCLKCTRL |= (1<<12);
-		//UART AHB divider
-		LPC_SYSCON->USART0CLKDIV = AhbClkDivider;
-	}
-
-	//stop bits, frame length, activate divisor latch
-	UART_Port->LCR = ENABLE_DIVISOR_LATCH|(stopBits<<2)|length;
-
-	//configure parity if was enabled
-	if(parity != NONE_PARITY)
-		UART_Port->LCR = (UART_Port->LCR)|(parity<<4)|(1<<3);
-
-	UART_Port->DLM = DivisorLatchMSB;
-	UART_Port->DLL = DivisorLatchLSB;
-	UART_Port->FDR = FractionalDivider;
-
-	//deactivate divisor latch
-	UART_Port->LCR = (UART_Port->LCR)&(DISABLE_DIVISOR_LATCH);
-
-	//configure FIFO
-	UART_Port->FCR = ENABLE_AND_RESET_FIFO|SET_RX_TRIGGER_LEVEL_AS_3;
-
-	//clear RX FIFO
-	for(int d=0,tmp=0;d<UART_BUFFER_SIZE;d++)
-		tmp = UART_Port->TER;
-
-	//enable interrupts from Enables the Receive Data Available
-#if 1
-	UART_Port->IER = 1;
-#endif
-
-	NVIC_SetPriority(USART0_IRQn, 0);
-	NVIC_EnableIRQ(USART0_IRQn);
-}
-
-void UART_PutByteToTransmitter(uint8_t portNumber, uint8_t byte)
-{
-	LPC_USART0_T *UART_Port = (LPC_USART0_T*)UART_GetBaseAddress(portNumber);
-	UART_Port->THR = byte;
-}
-
-uint8_t UART_ReadByteFromTrasmitter(uint8_t portNumber)
-{
-	LPC_USART0_T *UART_Port = (LPC_USART0_T*)UART_GetBaseAddress(portNumber);
-	return UART_Port->RBR;
-}
-
-UART_Status UART_ReturnStatusRegister(uint8_t portNumber)
-{
-	LPC_USART0_T *UART_Port = (LPC_USART0_T*)UART_GetBaseAddress(portNumber);
-	UART_Status status = *((UART_Status*)&(UART_Port->LSR));
-	return status;
-}
-
-void UART_EnableInterrupts(uint8_t portNumber)
-{
-	if(portNumber == 0)
-	{
-		NVIC_EnableIRQ(USART0_IRQn);
-	}
-}
-
-void UART_DisableInterrupts(uint8_t portNumber)
-{
-	if(portNumber == 0)
-	{
-		NVIC_DisableIRQ(USART0_IRQn);
-	}
-}
-
+/*
+ * Copyright (c) 2018, 2019, Adrian Chemicz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "UART_Driver.h"
+#include "chip.h"
+
+static uint8_t AhbClkDivider;
+static uint8_t DivisorLatchMSB;//DLM
+static uint8_t DivisorLatchLSB;//DLL
+static uint8_t FractionalDivider;// MULVAL<<4 | DIVADDVAL
+
+//TX ring of UART0(only this port is supported). Head is written by UART_Write and tail by interrupt.
+static uint8_t TxRing[UART_TX_RING_SIZE];
+static volatile uint16_t TxRingHead;
+static volatile uint16_t TxRingTail;
+
+static uint32_t* UART_GetBaseAddress(uint8_t portNumber)
+{
+	uint32_t* basePointer = 0;
+	switch(portNumber)
+	{
+	case 0:
+		basePointer = (uint32_t*)LPC_USART0_BASE;
+		break;
+	default:
+		basePointer = 0;
+		break;
+	}
+
+	return basePointer;
+}
+
+bool UART_CalculateBaudrateDividers(uint32_t peripheralClock, uint32_t baudrate, UART_BaudrateDividers* dividers)
+{
+	uint32_t bestError = UINT32_MAX;
+
+	//divisor latch must be equal at least 1 so max baudrate is peripheralClock/16
+	if((baudrate == 0) || (baudrate > peripheralClock/16))
+		return false;
+
+	/* baudrate = peripheralClock/(16*DL*(1 + DIVADDVAL/MULVAL)) where DL = DLM<<8 | DLL,
+	 * 1 <= MULVAL <= 15 and 0 <= DIVADDVAL < MULVAL. Fractional divider equal 1 is checked
+	 * only once for MULVAL = 1. */
+	for(uint8_t mulVal = 1; mulVal <= 15; mulVal++)
+	{
+		for(uint8_t divAddVal = (mulVal == 1) ? 0 : 1; divAddVal < mulVal; divAddVal++)
+		{
+			uint32_t numerator = peripheralClock * mulVal;
+			uint32_t denominator = 16 * baudrate * (mulVal + divAddVal);
+			uint32_t divisorLatch = (numerator + denominator/2) / denominator;
+			int64_t realBaudrateError;
+			uint32_t absoluteError;
+
+			//when fractional divider is used DL must be equal at least 3
+			if((divisorLatch == 0) || (divisorLatch > UINT16_MAX)
+				|| ((divAddVal != 0) && (divisorLatch < 3)))
+				continue;
+
+			realBaudrateError = ((int64_t)numerator * 1000000) / (16 * divisorLatch * (mulVal + divAddVal))
+				- (int64_t)baudrate * 1000000;
+			realBaudrateError /= (int64_t)baudrate;
+			absoluteError = (realBaudrateError < 0) ? -realBaudrateError : realBaudrateError;
+
+			if(absoluteError < bestError)
+			{
+				bestError = absoluteError;
+				dividers->divisorLatch = divisorLatch;
+				dividers->divAddVal = divAddVal;
+				dividers->mulVal = mulVal;
+				dividers->errorPpm = realBaudrateError;
+			}
+		}
+	}
+
+	return bestError <= UART_MAX_BAUDRATE_ERROR_PPM;
+}
+
+static bool UART_SetClockPrescalers(uint32_t baudrate)
+{
+	UART_BaudrateDividers dividers;
+	bool result;
+
+	AhbClkDivider = UART_CLOCK_DIVIDER;
+
+	result = UART_CalculateBaudrateDividers(Chip_Clock_GetMainClockRate()/AhbClkDivider, baudrate, &dividers);
+
+	if(result)
+	{
+		DivisorLatchMSB = dividers.divisorLatch >> 8;
+		DivisorLatchLSB = dividers.divisorLatch & 0xFF;
+		FractionalDivider = (dividers.mulVal << 4) | dividers.divAddVal;
+	}
+
+	return result;
+}
+
+bool UART_DriverInit(uint8_t portNumber, uint32_t baudrate, WORD_LENGTH length, STOP_BITS stopBits, PARITY parity)
+{
+	LPC_USART0_T *UART_Port = (LPC_USART0_T*)UART_GetBaseAddress(portNumber);
+
+	//port isn't touched when baudrate can't be reached, so previous configuration is kept
+	if((UART_Port == 0) || (UART_SetClockPrescalers(baudrate) == false))
+		return false;
+
+	//turn on options responsible for change GPIO purpose like UART, ADC or SPI
+	LPC_SYSCON->SYSAHBCLKCTRL |= (1<<16);
+
+	if(portNumber == 0)
+	{
+		NVIC_DisableIRQ(USART0_IRQn);
+
+		//configure GPIO pin which is used by UART0
+		//RXD
+		LPC_IOCON->PIO0[18] |= 1;
+		//TXD
+		LPC_IOCON->PIO0[19] |= 1;
+
+		//connect UART0 to AHB bus
+		LPC_SYSCON->SYSAHBCLKCTRL |= (1<<12);
+		//UART AHB divider
+		LPC_SYSCON->USART0CLKDIV = AhbClkDivider;
+	}
+
+	//stop bits, frame length, activate divisor latch
+	UART_Port->LCR = ENABLE_DIVISOR_LATCH|(stopBits<<2)|length;
+
+	//configure parity if was enabled
+	if(parity != NONE_PARITY)
+		UART_Port->LCR = (UART_Port->LCR)|(parity<<4)|(1<<3);
+
+	UART_Port->DLM = DivisorLatchMSB;
+	UART_Port->DLL = DivisorLatchLSB;
+	UART_Port->FDR = FractionalDivider;
+
+	//deactivate divisor latch
+	UART_Port->LCR = (UART_Port->LCR)&(DISABLE_DIVISOR_LATCH);
+
+	//configure FIFO
+	UART_Port->FCR = ENABLE_AND_RESET_FIFO|SET_RX_TRIGGER_LEVEL_AS_3;
+
+	//clear RX FIFO
+	for(int d=0,tmp=0;d<UART_BUFFER_SIZE;d++)
+		tmp = UART_Port->TER;
+
+	TxRingHead = 0;
+	TxRingTail = 0;
+
+	//enable interrupts from Enables the Receive Data Available. THRE interrupt is enabled by UART_Write
+#if 1
+	UART_Port->IER = RDA_INTERRUPT_ENABLE;
+#endif
+
+	NVIC_SetPriority(USART0_IRQn, 0);
+	NVIC_EnableIRQ(USART0_IRQn);
+
+	return true;
+}
+
+bool UART_ChangeBaudrate(uint8_t portNumber, uint32_t baudrate)
+{
+	LPC_USART0_T *UART_Port = (LPC_USART0_T*)UART_GetBaseAddress(portNumber);
+
+	if((UART_Port == 0) || (UART_SetClockPrescalers(baudrate) == false))
+		return false;
+
+	UART_DisableInterrupts(portNumber);
+
+	UART_Port->LCR = (UART_Port->LCR)|ENABLE_DIVISOR_LATCH;
+
+	UART_Port->DLM = DivisorLatchMSB;
+	UART_Port->DLL = DivisorLatchLSB;
+	UART_Port->FDR = FractionalDivider;
+
+	UART_Port->LCR = (UART_Port->LCR)&(DISABLE_DIVISOR_LATCH);
+
+	UART_EnableInterrupts(portNumber);
+
+	return true;
+}
+
+bool UART_IsBaudrateSupported(uint32_t baudrate)
+{
+	UART_BaudrateDividers dividers;
+
+	return UART_CalculateBaudrateDividers(Chip_Clock_GetMainClockRate()/UART_CLOCK_DIVIDER, baudrate, &dividers);
+}
+
+void UART_PutByteToTransmitter(uint8_t portNumber, uint8_t byte)
+{
+	LPC_USART0_T *UART_Port = (LPC_USART0_T*)UART_GetBaseAddress(portNumber);
+	UART_Port->THR = byte;
+}
+
+uint8_t UART_ReadByteFromTrasmitter(uint8_t portNumber)
+{
+	LPC_USART0_T *UART_Port = (LPC_USART0_T*)UART_GetBaseAddress(portNumber);
+	return UART_Port->RBR;
+}
+
+UART_Status UART_ReturnStatusRegister(uint8_t portNumber)
+{
+	LPC_USART0_T *UART_Port = (LPC_USART0_T*)UART_GetBaseAddress(portNumber);
+	UART_Status status = *((UART_Status*)&(UART_Port->LSR));
+	return status;
+}
+
+static void UART_FillTransmitter(LPC_USART0_T *UART_Port)
+{
+	//TX FIFO is empty so max 16 byte can be copied
+	for(uint32_t i = 0; (i < UART_BUFFER_SIZE) && (TxRingTail != TxRingHead); i++)
+	{
+		UART_Port->THR = TxRing[TxRingTail];
+		TxRingTail = (TxRingTail + 1) & (UART_TX_RING_SIZE - 1);
+	}
+
+	if(TxRingTail == TxRingHead)
+	{
+		UART_Port->IER &= ~THRE_INTERRUPT_ENABLE;
+	}
+}
+
+uint16_t UART_Write(uint8_t portNumber, const uint8_t* data, uint16_t size)
+{
+	LPC_USART0_T *UART_Port = (LPC_USART0_T*)UART_GetBaseAddress(portNumber);
+	uint16_t queuedBytes = 0;
+
+	if(UART_Port == 0)
+		return 0;
+
+	for(; queuedBytes < size; queuedBytes++)
+	{
+		uint16_t nextHead = (TxRingHead + 1) & (UART_TX_RING_SIZE - 1);
+
+		if(nextHead == TxRingTail)
+			break;
+
+		TxRing[TxRingHead] = data[queuedBytes];
+		TxRingHead = nextHead;
+	}
+
+	//start transmission if interrupt don't send data now
+	UART_DisableInterrupts(portNumber);
+
+	if((UART_Port->IER & THRE_INTERRUPT_ENABLE) == 0)
+	{
+		UART_Port->IER |= THRE_INTERRUPT_ENABLE;
+
+		if(UART_ReturnStatusRegister(portNumber).THRE == 1)
+			UART_FillTransmitter(UART_Port);
+	}
+
+	UART_EnableInterrupts(portNumber);
+
+	return queuedBytes;
+}
+
+bool UART_IsTransmitFinished(uint8_t portNumber)
+{
+	return (TxRingTail == TxRingHead) && (UART_ReturnStatusRegister(portNumber).TEMT == 1);
+}
+
+void UART_ProcessTransmitInterrupt(uint8_t portNumber)
+{
+	LPC_USART0_T *UART_Port = (LPC_USART0_T*)UART_GetBaseAddress(portNumber);
+
+	if((UART_Port->IER & THRE_INTERRUPT_ENABLE) && (UART_ReturnStatusRegister(portNumber).THRE == 1))
+	{
+		UART_FillTransmitter(UART_Port);
+	}
+}
+
+void UART_EnableInterrupts(uint8_t portNumber)
+{
+	if(portNumber == 0)
+	{
+		NVIC_EnableIRQ(USART0_IRQn);
+	}
+}
+
+void UART_DisableInterrupts(uint8_t portNumber)
+{
+	if(portNumber == 0)
+	{
+		NVIC_DisableIRQ(USART0_IRQn);
+	}
+}
+
@@ -1,616 +1,1803 @@
-/*
-
-clock_firmware
-Copyright (C) 2019 Adrian Chemicz
-
-This program is free software: you can redistribute it and/or modify
-it under the terms of the GNU General Public License as published by
-the Free Software Foundation, either version 3 of the License, or
-(at your option) any later version.
-
-This program is distributed in the hope that it will be useful,
-but WITHOUT ANY WARRANTY; without even the implied warranty of
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-GNU General Public License for more details.
-
-You should have received a copy of the GNU General Public License
-along with this program. If not, see <http://www.gnu.org/licenses/>. */
-
-#include "WIFI_InteractionLayer.h"
-#include "Thread.h"
-#include "UART_Driver.h"
-#include <string.h>
-
-static uint16_t MaxMethodIdInServiceDayMeasurement = 0;
-
-/*****************************************************************************************
-* WIFI_Init() - function initialize WiFi module by check availability, reset and set
-* appropriate mode. Inside this function WifiStateType structure isn't used but more
-* important result of WiFi initialization is stored in ClockState.
-*****************************************************************************************/
-void WIFI_Init(void)
-{
-	static bool sendRequestFlag = false;
-	static uint8_t sequenceCommandState = WIFI_STARTUP_WAIT;
-
-	//initialize variable
-	if(MaxMethodIdInServiceDayMeasurement == 0)
-	{
-		MaxMethodIdInServiceDayMeasurement = sizeof(TemperatureSingleDayRecordType) / SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE;
-
-		if(sizeof(TemperatureSingleDayRecordType)%SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE != 0)
-		{
-			MaxMethodIdInServiceDayMeasurement++;
-		}
-	}
-
-	if(sendRequestFlag == false)
-	{
-		switch(sequenceCommandState)
-		{
-		case WIFI_STARTUP_WAIT://wait two second for clear RX buffer
-		case WIFI_RESET_WAIT://wait two second for clear RX buffer
-		case WIFI_DEVICE_DONT_DETECTED:
-
-			break;
-
-		case WIFI_SEND_FIRST_REQUEST:
-			ESP_SendDetectDeviceRequest();
-			break;
-
-		case WIFI_SEND_RESET:
-			ESP_SendResetRequest();
-			break;
-
-		case WIFI_SEND_ESP_MODE:
-			ESP_SendWifiModeRequest(AT_STATION_MODE);
-			break;
-
-		case WIFI_SEND_DETECT_REQUEST:
-			ESP_SendDetectDeviceRequest();
-			break;
-
-		default:
-
-			break;
-
-		}
-
-		sendRequestFlag = true;
-	}/* if(sendRequestFlag == false) */
-
-	if((sequenceCommandState == WIFI_STARTUP_WAIT)
-		|| (sequenceCommandState == WIFI_RESET_WAIT))
-	{
-		static uint16_t wifiDelayCounter = 0;
-
-		wifiDelayCounter++;
-
-		if(wifiDelayCounter > 2*ONE_SECONDS)
-		{
-			ESP_ClearRxBuffer();
-
-			sequenceCommandState++;
-			wifiDelayCounter = 0;
-			sendRequestFlag = false;
-
-			return;
-		}
-	}
-	else
-	{
-		ESP_Process();
-
-		if(ESP_GetRequestState() == RESPONSE_RECEIVED)
-		{
-			bool returnRequestState = ESP_ProcessGaneralFormatResponse();
-
-			if(sequenceCommandState == WIFI_SEND_DETECT_REQUEST)
-			{
-				ClockState.wifiReady = returnRequestState;
-			}
-
-			sequenceCommandState++;
-			sendRequestFlag = false;
-		}
-	}
-}
-
-/*****************************************************************************************
-* WIFI_ProcessRequest() - function is only call from WIFI_Process and is only responsible for
-*	process SOME/IP request. If SOME/IP message is correct(correct SOME/IP message header
-*	and CRC if this extension was set) then payload is processed. Inside this function is
-*	performed request validation like chech that service and method is supported and data
-*	for dedicated request is correct.
-*
-* Parameters:
-* @wifiStateStructure: pointer to WifiStateType structure which contain data like txBuffers,
-*  request data and buffer used for FRAM requests proces.
-*
-*****************************************************************************************/
-static void WIFI_ProcessRequest(WifiStateType* wifiStateStructure)
-{
-	if(ClockState.wifiConnected && wifiStateStructure->initSocketFlag
-		&& wifiStateStructure->messageIsReceived)
-	{
-		//check that received message contain SOME_IP_REQUEST_CODE
-		if(wifiStateStructure->someIpReceivedMessage.messageType == SOME_IP_REQUEST_CODE)
-		{
-			switch(wifiStateStructure->someIpReceivedMessage.serviceId)
-			{
-			case SOME_IP_SERVICE_CLOCK_STATUS:
-				switch(wifiStateStructure->someIpReceivedMessage.methodId)
-				{
-				case SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET:
-					//validate set request
-					{
-						bool someIpPayloadErrorOccur = false;
-						SomeIpClockStatusSetRequestMethodPayload *requestPayloadStructure = (SomeIpClockStatusSetRequestMethodPayload*)wifiStateStructure->someIpReceivedMessage.payload;
-
-						if(wifiStateStructure->someIpReceivedMessage.payloadSize != SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET_PAYLOAD_SIZE)
-						{
-							someIpPayloadErrorOccur = true;
-						}
-						else
-						{
-							if(requestPayloadStructure->minute > 60 || requestPayloadStructure->hour > 23
-									|| requestPayloadStructure->month > 12 || requestPayloadStructure->year > 254)
-							{
-								someIpPayloadErrorOccur = true;
-							}
-							else
-							{
-								uint8_t dayTmp = GUI_ReturnMaxDayInMonth(requestPayloadStructure->month, requestPayloadStructure->year);
-
-								if(dayTmp < requestPayloadStructure->day)
-								{
-									someIpPayloadErrorOccur = true;
-								}
-							}
-						}
-
-						if(someIpPayloadErrorOccur)
-						{
-							wifiStateStructure->TxMessageTable[0].payloadSize = SOMEIP_CodeTxMessage(
-									wifiStateStructure->someIpReceivedMessage.serviceId,
-									wifiStateStructure->someIpReceivedMessage.methodId,
-									SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE,
-									wifiStateStructure->TxMessageTable[0].payload , NULL, 0);
-
-							wifiStateStructure->TxMessageTable[0].lockFlag = true;
-						}
-						else
-						{
-							ClockState.currentTimeSecond = 0;
-							ClockState.currentTimeMinute = requestPayloadStructure->minute;
-							ClockState.currentTimeHour = requestPayloadStructure->hour;
-							ClockState.day = requestPayloadStructure->day;
-							ClockState.month = requestPayloadStructure->month;
-							ClockState.year = requestPayloadStructure->year;
-
-							wifiStateStructure->TxMessageTable[0].payloadSize = SOMEIP_CodeTxMessage(
-									wifiStateStructure->someIpReceivedMessage.serviceId,
-									wifiStateStructure->someIpReceivedMessage.methodId,
-									SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE,
-									wifiStateStructure->TxMessageTable[0].payload , NULL, 0);
-
-							wifiStateStructure->TxMessageTable[0].lockFlag = true;
-						}
-					}
-					break;
-
-				case SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET:
-					{
-						SomeIpClockStatusGetResponseMethodPayload getResponseMethodPayload;
-
-						getResponseMethodPayload.minute = ClockState.currentTimeMinute;
-						getResponseMethodPayload.hour = ClockState.currentTimeHour;
-						getResponseMethodPayload.day = ClockState.day;
-						getResponseMethodPayload.month = ClockState.month;
-						getResponseMethodPayload.year = ClockState.year;
-						getResponseMethodPayload.reserved = 0;
-						getResponseMethodPayload.temperatureOutside = ClockState.TemperatureSensorTable[OUTSIDE_TEMPERATURE].temperatureValue;
-						getResponseMethodPayload.temperatureInside = ClockState.TemperatureSensorTable[INSIDE_TEMPERATURE].temperatureValue;
-						getResponseMethodPayload.temperatureFurnace = ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValue;
-
-						wifiStateStructure->TxMessageTable[0].payloadSize = SOMEIP_CodeTxMessage(
-								wifiStateStructure->someIpReceivedMessage.serviceId,
-								wifiStateStructure->someIpReceivedMessage.methodId,
-								SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE,
-								wifiStateStructure->TxMessageTable[0].payload , (uint8_t *)&getResponseMethodPayload,
-								SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET_PAYLOAD_SIZE);
-
-						wifiStateStructure->TxMessageTable[0].lockFlag = true;
-					}
-					break;
-					//not supported method ID
-				default:
-					wifiStateStructure->TxMessageTable[0].payloadSize = SOMEIP_CodeTxMessage(
-							wifiStateStructure->someIpReceivedMessage.serviceId,
-							wifiStateStructure->someIpReceivedMessage.methodId,
-							SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE,
-							wifiStateStructure->TxMessageTable[0].payload , NULL, 0);
-
-					wifiStateStructure->TxMessageTable[0].lockFlag = true;
-
-					break;
-				}
-				break;
-
-			case SOME_IP_SERVICE_DAY_MEASUREMENT:
-				//validate get temperature request
-				{
-					bool someIpPayloadErrorOccur = false;
-					SomeIpDayMeasurmentRequestPayload *requestPayloadStructure = (SomeIpDayMeasurmentRequestPayload*)wifiStateStructure->someIpReceivedMessage.payload;
-
-					if(wifiStateStructure->someIpReceivedMessage.payloadSize != SOME_IP_SERVICE_DAY_MEASUREMENT_REQ_PAYLOAD_SIZE)
-					{
-						someIpPayloadErrorOccur = true;
-					}
-					else
-					{
-						if(requestPayloadStructure->month > 12 || requestPayloadStructure->year > 254)
-						{
-							someIpPayloadErrorOccur = true;
-						}
-						else
-						{
-							uint8_t dayTmp = GUI_ReturnMaxDayInMonth(requestPayloadStructure->month, requestPayloadStructure->year);
-
-							if(dayTmp < requestPayloadStructure->day)
-							{
-								someIpPayloadErrorOccur = true;
-							}
-						}
-					}
-
-					if(someIpPayloadErrorOccur)
-					{
-						wifiStateStructure->TxMessageTable[0].payloadSize = SOMEIP_CodeTxMessage(
-								wifiStateStructure->someIpReceivedMessage.serviceId,
-								wifiStateStructure->someIpReceivedMessage.methodId,
-								SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE,
-								wifiStateStructure->TxMessageTable[0].payload , NULL, 0);
-
-						wifiStateStructure->TxMessageTable[0].lockFlag = true;
-					}
-					else
-					{
-						/*
-						 * Method ID is used as index of structure. Structure is too big to send
-						 * in one message so is send as parts. Size of message is defined by define
-						 * SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE. If method ID
-						 * multiply with above define exceed structure size then it must be raise
-						 * as unknown method.
-						 */
-						if(wifiStateStructure->someIpReceivedMessage.methodId > MaxMethodIdInServiceDayMeasurement)
-						{
-							wifiStateStructure->TxMessageTable[0].payloadSize = SOMEIP_CodeTxMessage(
-									wifiStateStructure->someIpReceivedMessage.serviceId,
-									wifiStateStructure->someIpReceivedMessage.methodId,
-									SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_UNKNOWN_METHOD,
-									wifiStateStructure->TxMessageTable[0].payload , NULL, 0);
-
-							wifiStateStructure->TxMessageTable[0].lockFlag = true;
-
-							break;
-						}
-
-						//copy searched header from request
-						memcpy(&wifiStateStructure->SearchedDayMeasurementHeader, requestPayloadStructure, DAY_MEASUREMENT_HEADER_SIZE);
-
-						//check that searched structure don't belong to current day and record this type of structure is enable
-						if((ClockState.day == wifiStateStructure->SearchedDayMeasurementHeader.day)
-							&& (ClockState.month == wifiStateStructure->SearchedDayMeasurementHeader.month)
-							&& (ClockState.year == wifiStateStructure->SearchedDayMeasurementHeader.year)
-							&& ClockState.TemperatureSensorTable[wifiStateStructure->SearchedDayMeasurementHeader.source].recordTemperature)
-						{
-							wifiStateStructure->TemperatureSingleDayRecordLoadedBuffer
-								= TemperatureSingleDay[wifiStateStructure->SearchedDayMeasurementHeader.source];
-							wifiStateStructure->temperatureStructureIsValid = true;
-
-							wifiStateStructure->searchState = SEARCH_FINISHED;
-						}
-						//check that searched structure isn't stored in buffer
-						else if(wifiStateStructure->temperatureStructureIsValid
-							&& (wifiStateStructure->TemperatureSingleDayRecordLoadedBuffer.day
-								== wifiStateStructure->SearchedDayMeasurementHeader.day)
-							&& (wifiStateStructure->TemperatureSingleDayRecordLoadedBuffer.month
-								== wifiStateStructure->SearchedDayMeasurementHeader.month)
-							&& (wifiStateStructure->TemperatureSingleDayRecordLoadedBuffer.year
-								== wifiStateStructure->SearchedDayMeasurementHeader.year)
-							&& (wifiStateStructure->TemperatureSingleDayRecordLoadedBuffer.source
-								== wifiStateStructure->SearchedDayMeasurementHeader.source))
-						{
-							wifiStateStructure->searchState = SEARCH_FINISHED;
-						}
-						else
-						{
-							wifiStateStructure->searchState = SEARCH_REQUESTED;
-						}
-					}
-				}
-				break;
-
-				//service isn't supported
-			default:
-
-				wifiStateStructure->TxMessageTable[0].payloadSize = SOMEIP_CodeTxMessage(
-						wifiStateStructure->someIpReceivedMessage.serviceId,
-						wifiStateStructure->someIpReceivedMessage.methodId,
-						SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_UNKNOWN_SERVICE,
-						wifiStateStructure->TxMessageTable[0].payload , NULL, 0);
-
-				wifiStateStructure->TxMessageTable[0].lockFlag = true;
-
-				break;
-			}
-
-			wifiStateStructure->messageIsReceived = false;
-		}/* if(wifiStateStructure->someIpReceivedMessage.messageType == SOME_IP_REQUEST_CODE) */
-	}/* if(ClockState.wifiConnected && wifiStateStructure->initSocketFlag
-		&& wifiStateStructure->messageIsReceived) */
-}
-
-/*****************************************************************************************
-* WIFI_Process() - function must be call cyclically after initialization process with correct
-*	result. Information about get connection status, assigned IP address and available APN
-*	is performed inside this function. Inside this part is also performed log to APN if
-*	password was set.
-*
-* Parameters:
-* @wifiStateStructure: pointer to.WifiStateType structure with data like counters used to
-*  decide when send get access points or check connection status.
-*
-*****************************************************************************************/
-void WIFI_Process(WifiStateType* wifiStateStructure)
-{
-	//manage connection state
-	if(wifiStateStructure->processedRequest == (uint8_t)WIFI_REQUEST_NONE)
-	{
-		//Connect to APN
-		if((ClockState.wifiConnected == false)
-			&& (strlen(ClockState.ssidOfAssignedApn) != 0)
-			&& (wifiStateStructure->connectToApnCounter > ONE_SECONDS*30)
-			&& ESP_SendConnectToApnRequest(ClockState.ssidOfAssignedApn, ClockState.passwordToAssignedApn))
-		{
-			wifiStateStructure->processedRequest = (uint8_t)WIFI_REQUEST_CONNECT_TO_APN;
-			wifiStateStructure->connectToApnCounter = 0;
-		}
-		//send get APN list request
-		else if((gui.active_window == &wifiSettingsWindow)
-				&& (wifiStateStructure->getApnCounter > ONE_SECONDS*15)
-				&& ESP_SendApnListRequest())
-		{
-			wifiStateStructure->processedRequest = (uint8_t)WIFI_REQUEST_GET_APN;
-			wifiStateStructure->getApnCounter = 0;
-		}
-		//check that disconnect request isn't active
-		else if(ClockState.wifiStartDisconnect
-				&& ESP_SendDisconnectRequest())
-		{
-			wifiStateStructure->processedRequest = (uint8_t)WIFI_REQUEST_DISCONNECT;
-		}
-		//get IP address
-		else if(ClockState.wifiConnected && ClockState.ipAddressAssignedToDevice[0] == 0
-				&& ESP_GetAssignedIpAddress())
-		{
-			wifiStateStructure->processedRequest = (uint8_t)WIFI_REQUEST_GET_IP_ADDRESS;
-		}
-		//check connection status
-		else if(ClockState.wifiConnected && (wifiStateStructure->checkConnectionCounter > ONE_SECONDS*10)
-				&& ESP_GetConnectionStatus())
-		{
-			wifiStateStructure->processedRequest = (uint8_t)WIFI_REQUEST_CONNECTION_STATUS;
-			wifiStateStructure->checkConnectionCounter = 0;
-		}
-		//after succesfut connection initialize sockets
-		else if(ClockState.wifiConnected && (wifiStateStructure->initSocketFlag == false))
-		{
-			switch(wifiStateStructure->initSocketPhase)
-			{
-			case WIFI_INIT_MULTIPLY_CONNECTION:
-				if(ESP_SendAcceptMultipleConnectionRequest())
-				{
-					wifiStateStructure->processedRequest = (uint8_t)WIFI_REQUEST_ACCEPT_MULLTIPLY_CONNECTION;
-				}
-				break;
-
-			case WIFI_CREATE_TCP_SERVER:
-				if(ESP_SendServerCommandRequest(true, TCP_SERVER_PORT_NUMBER))
-				{
-					wifiStateStructure->processedRequest = (uint8_t)WIFI_REQUEST_CREATE_TCP_SERVER;
-				}
-
-				break;
-
-			default:
-				break;
-			}
-		}
-	}/* if(wifiStateStructure->processedRequest == (uint8_t)WIFI_REQUEST_NONE) */
-
-	//process data received and send by device
-	if(ClockState.wifiConnected && wifiStateStructure->initSocketFlag
-		&& (wifiStateStructure->processedRequest == (uint8_t)WIFI_REQUEST_NONE))
-	{
-		//search new request
-		for(uint16_t i = 0; i < MAX_NUMBER_OF_RX_BUFFER; i++)
-		{
-			if(RxMessageTable[i].lockFlag == true)
-			{
-				SomeIpMessage someIpMessageTmp;
-
-				if(SOMEIP_DecodeRxMessage(&someIpMessageTmp, NULL, RxMessageTable[i].payload, RxMessageTable[i].payloadSize))
-				{
-					if(wifiStateStructure->messageIsReceived == false)
-					{
-						wifiStateStructure->someIpReceivedMessage = someIpMessageTmp;
-						wifiStateStructure->someIpReceivedMessage.socketId = RxMessageTable[i].socketId;
-						wifiStateStructure->messageIsReceived = true;
-					}
-					else
-					{
-
-					}
-				}
-
-				RxMessageTable[i].lockFlag = false;
-			}/* if(RxMessageTable[i].lockFlag == true) */
-		}/* for(int i = 0; i < MAX_NUMBER_OF_RX_BUFFER; i++) */
-	}/* if(ClockState.wifiConnected && wifiStateStructure->initSocketFlag) */
-
-	WIFI_ProcessRequest(wifiStateStructure);
-
-	if((wifiStateStructure->processedRequest == (uint8_t)WIFI_REQUEST_NONE)
-		&& ClockState.wifiConnected && wifiStateStructure->initSocketFlag)
-	{
-		for(uint16_t i = 0; i < MAX_NUMBER_OF_TX_BUFFER; i++)
-		{
-			if(wifiStateStructure->TxMessageTable[i].lockFlag == true)
-			{
-				if(ESP_SendWriteDataRequest(wifiStateStructure->TxMessageTable[i].socketId,
-					wifiStateStructure->TxMessageTable[i].payloadSize))
-				{
-					wifiStateStructure->processedRequest = (uint8_t)WIFI_REQUEST_SEND_RESPONSE_MESSAGE;
-					wifiStateStructure->sendTxMessageNumber = i;
-				}
-
-				break;
-			}
-		}
-	}/* if((wifiStateStructure->processedRequest == (uint8_t)WIFI_REQUEST_NONE)
-		&& ClockState.wifiConnected && wifiStateStructure->initSocketFlag) */
-
-	wifiStateStructure->connectToApnCounter++;
-	wifiStateStructure->getApnCounter++;
-
-	if(ClockState.wifiConnected)
-	{
-		wifiStateStructure->checkConnectionCounter++;
-	}
-
-	UART_DisableInterrupts(ESP_GetUartPortNumber());
-	ESP_Process();
-	UART_EnableInterrupts(ESP_GetUartPortNumber());
-
-	if(ESP_GetRequestState() == (uint8_t)RESPONSE_RECEIVED)
-	{
-		switch(wifiStateStructure->processedRequest)
-		{
-		case WIFI_REQUEST_CONNECT_TO_APN:
-			ClockState.wifiConnected = ESP_ProcessGaneralFormatResponse();
-
-			if(ClockState.wifiConnected)
-			{
-				wifiStateStructure->checkConnectionCounter = 0;
-			}
-			break;
-
-		case WIFI_REQUEST_GET_APN:
-			ClockState.wifiApnReceived = ESP_ProcessApnListResponse();
-			break;
-
-		case WIFI_REQUEST_DISCONNECT:
-			if(ESP_ProcessApnListResponse())
-			{
-				ClockState.wifiStartDisconnect = false;
-			}
-			else
-			{
-				wifiStateStructure->diconnectRepetitionCounter++;
-
-				//case when call disconnect isn't possible few time
-				if(wifiStateStructure->diconnectRepetitionCounter > 3)
-				{
-					ClockState.wifiStartDisconnect = false;
-					wifiStateStructure->diconnectRepetitionCounter = 0;
-				}
-			}
-			break;
-
-		case WIFI_REQUEST_GET_IP_ADDRESS:
-			ESP_ProcessGetAssignedIpResponse(ClockState.ipAddressAssignedToDevice);
-			break;
-
-		case WIFI_REQUEST_CONNECTION_STATUS:
-			ESP_ProcessConnectionStatus(&ClockState.wifiConnected);
-			wifiStateStructure->checkConnectionCounter = 0;
-
-			//connection was lost
-			if(ClockState.wifiConnected == false)
-			{
-				memset(ClockState.ipAddressAssignedToDevice, 0, 4);
-				ClockState.wifiStartDisconnect = false;
-			}
-			break;
-
-		case WIFI_REQUEST_ACCEPT_MULLTIPLY_CONNECTION:
-			if(ESP_ProcessGaneralFormatResponse())
-			{
-				wifiStateStructure->initSocketPhase = WIFI_CREATE_TCP_SERVER;
-			}
-			break;
-
-		case WIFI_REQUEST_CREATE_TCP_SERVER:
-			if(ESP_ProcessGaneralFormatResponse())
-			{
-				wifiStateStructure->initSocketFlag = true;
-			}
-			break;
-
-		case WIFI_REQUEST_SEND_RESPONSE_MESSAGE:
-			if(ESP_ProcessGaneralFormatResponse())
-			{
-				if(wifiStateStructure->sendTxFirstStepWasPerformed == false)
-				{
-					ESP_Write(wifiStateStructure->TxMessageTable[wifiStateStructure->sendTxMessageNumber].payload,
-						wifiStateStructure->TxMessageTable[wifiStateStructure->sendTxMessageNumber].payloadSize);
-
-					wifiStateStructure->sendTxFirstStepWasPerformed = true;
-
-					return;
-				}
-				else//transmission was performed with success
-				{
-					wifiStateStructure->TxMessageTable[wifiStateStructure->sendTxMessageNumber].lockFlag = false;
-
-					//clear thing for send state machine
-					wifiStateStructure->sendTxMessageNumber = 0;
-					wifiStateStructure->sendTxFirstStepWasPerformed = false;
-					wifiStateStructure->sendTxErrorCounter = 0;
-				}
-			}
-			else
-			{
-				wifiStateStructure->sendTxErrorCounter++;
-
-				//transmition was repeated few times but without success
-				if(wifiStateStructure->sendTxErrorCounter > WIFI_SEND_DATA_REPETITION)
-				{
-
-					wifiStateStructure->TxMessageTable[wifiStateStructure->sendTxMessageNumber].lockFlag = false;
-
-					//clear thing for send state machine
-					wifiStateStructure->sendTxMessageNumber = 0;
-					wifiStateStructure->sendTxFirstStepWasPerformed = false;
-					wifiStateStructure->sendTxErrorCounter = 0;
-				}
-				else
-				{
-					ESP_SendWriteDataRequest(wifiStateStructure->TxMessageTable[wifiStateStructure->sendTxMessageNumber].socketId,
-						wifiStateStructure->TxMessageTable[wifiStateStructure->sendTxMessageNumber].payloadSize);
-
-					return;
-				}
-			}
-			break;
-
-		default:
-
-			break;
-		}
-
-		wifiStateStructure->processedRequest = (uint8_t)WIFI_REQUEST_NONE;
-	}/* if(ESP_GetRequestState() == (uint8_t)RESPONSE_RECEIVED) */
-}
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "WIFI_InteractionLayer.h"
+#include "SomeIpInterface.h"
+#include "Thread.h"
+#include "UART_Driver.h"
+#include "TemperatureRecordCache.h"
+#include <string.h>
+
+#if WIFI_PASSTHROUGH_MODE
+static const uint8_t PassthroughServerIpAddress[IP_ADDRESS_BYTE_LENGTH] = WIFI_PASSTHROUGH_SERVER_IP_ADDRESS;
+#endif
+
+#if WIFI_TELEMETRY_MODE
+#if WIFI_PASSTHROUGH_MODE
+#error "UDP telemetry require multiple connection mode which isn't used in passthrough mode"
+#endif
+static const uint8_t TelemetryCollectorIpAddress[IP_ADDRESS_BYTE_LENGTH] = WIFI_TELEMETRY_COLLECTOR_IP_ADDRESS;
+#endif
+
+#if (WIFI_HIGH_SPEED_BAUDRATE > ESP_MAX_LINK_BAUDRATE)
+#error "RX ring of ESP layer is too small for WIFI_HIGH_SPEED_BAUDRATE - increase ESP_MAX_LINK_BAUDRATE"
+#endif
+
+#if WIFI_SERIAL_LINK_MODE
+#if (WIFI_SERIAL_LINK_BAUDRATE > ESP_MAX_LINK_BAUDRATE)
+#error "RX ring of ESP layer is too small for WIFI_SERIAL_LINK_BAUDRATE - set ESP_MAX_LINK_BAUDRATE to 1000000"
+#endif
+#if WIFI_PASSTHROUGH_MODE || WIFI_TELEMETRY_MODE
+#error "serial link replace ESP8266 so passthrough mode and UDP telemetry can't be used"
+#endif
+#if (SOME_IP_CRC_EXTENSION == 0)
+#error "messages of serial link are checked only by CRC of SOME/IP extension"
+#endif
+#endif
+
+//incremented after change of ClockState fields send in response of SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET
+static volatile uint16_t ClockStatusGeneration = 0;
+
+/*****************************************************************************************
+* WIFI_Init() - function initialize WiFi module by check availability, reset and set
+* appropriate mode. After that baudrate is switched to WIFI_HIGH_SPEED_BAUDRATE. Module
+* use new baudrate already after response to AT+UART_CUR so when UART port can't be
+* switched or module don't response with new baudrate then module is reset(AT+UART_CUR
+* isn't stored in flash), UART port is switched back to default baudrate and sequence is
+* repeated from reset without change of baudrate. Inside this
+* function WifiStateType structure isn't used but more important result of WiFi
+* initialization is stored in ClockState. If WIFI_SERIAL_LINK_MODE is set then only
+* baudrate is changed and ESP layer is switched to serial link mode.
+*****************************************************************************************/
+void WIFI_Init(void)
+{
+#if WIFI_SERIAL_LINK_MODE
+	if(ESP_ChangeBaudrate(WIFI_SERIAL_LINK_BAUDRATE))
+	{
+		ESP_StartSerialLink();
+		ClockState.wifiReady = true;
+	}
+
+	return;
+#endif
+
+	static bool sendRequestFlag = false;
+	static uint8_t sequenceCommandState = WIFI_STARTUP_WAIT;
+	static uint32_t defaultBaudrate = 0;//baudrate set by ESP_Init, used by module after reset
+	static bool highSpeedFailed = false;//set when module don't work with WIFI_HIGH_SPEED_BAUDRATE
+
+	if(sendRequestFlag == false)
+	{
+		switch(sequenceCommandState)
+		{
+		case WIFI_STARTUP_WAIT://wait two second for clear RX buffer
+		case WIFI_RESET_WAIT://wait two second for clear RX buffer
+		case WIFI_DEVICE_DONT_DETECTED:
+
+			break;
+
+		case WIFI_SEND_FIRST_REQUEST:
+			ESP_SendDetectDeviceRequest();
+			break;
+
+		case WIFI_SEND_RESET:
+			ESP_SendResetRequest();
+			break;
+
+		case WIFI_SEND_ESP_MODE:
+			ESP_SendWifiModeRequest(AT_STATION_MODE);
+			break;
+
+		case WIFI_SEND_UART_CONFIGURATION:
+			//module stay with default baudrate when UART port can't use high speed
+			if(highSpeedFailed || (UART_IsBaudrateSupported(WIFI_HIGH_SPEED_BAUDRATE) == false))
+			{
+				sequenceCommandState++;
+				return;
+			}
+
+			defaultBaudrate = ESP_GetBaudrate();
+			ESP_SendUartConfigurationRequest(WIFI_HIGH_SPEED_BAUDRATE);
+			break;
+
+		case WIFI_SEND_DETECT_REQUEST:
+			ESP_SendDetectDeviceRequest();
+			break;
+
+		default:
+
+			break;
+
+		}
+
+		sendRequestFlag = true;
+	}/* if(sendRequestFlag == false) */
+
+	if((sequenceCommandState == WIFI_STARTUP_WAIT)
+		|| (sequenceCommandState == WIFI_RESET_WAIT))
+	{
+		static uint16_t wifiDelayCounter = 0;
+
+		wifiDelayCounter++;
+
+		if(wifiDelayCounter > 2*ONE_SECONDS)
+		{
+			ESP_ClearRxBuffer();
+
+			sequenceCommandState++;
+			wifiDelayCounter = 0;
+			sendRequestFlag = false;
+
+			return;
+		}
+	}
+	else
+	{
+		ESP_Process();
+
+		if(ESP_GetRequestState() == RESPONSE_RECEIVED)
+		{
+			bool returnRequestState = ESP_ProcessGaneralFormatResponse();
+
+			if(sequenceCommandState == WIFI_SEND_UART_CONFIGURATION)
+			{
+				//ESP8266 use new baudrate after send response so UART port must be switched too
+				if(returnRequestState && (ESP_ChangeBaudrate(WIFI_HIGH_SPEED_BAUDRATE) == false))
+				{
+					//reset is tried also with default baudrate, module which don't receive it isn't detected
+					highSpeedFailed = true;
+					sequenceCommandState = WIFI_SEND_RESET;
+					sendRequestFlag = false;
+
+					return;
+				}
+			}
+			else if(sequenceCommandState == WIFI_SEND_RESET)
+			{
+				//after reset module use default baudrate
+				if(highSpeedFailed && (ESP_GetBaudrate() != defaultBaudrate))
+				{
+					ESP_ChangeBaudrate(defaultBaudrate);
+				}
+			}
+			else if(sequenceCommandState == WIFI_SEND_DETECT_REQUEST)
+			{
+				//link don't work with new baudrate so module is reset by request send with new baudrate
+				if((returnRequestState == false) && (highSpeedFailed == false)
+					&& (ESP_GetBaudrate() == WIFI_HIGH_SPEED_BAUDRATE))
+				{
+					highSpeedFailed = true;
+					sequenceCommandState = WIFI_SEND_RESET;
+					sendRequestFlag = false;
+
+					return;
+				}
+
+				ClockState.wifiReady = returnRequestState;
+			}
+
+			sequenceCommandState++;
+			sendRequestFlag = false;
+		}
+	}
+}
+
+/*****************************************************************************************
+* WIFI_GetNumberOfFreeSocketBuffers() - count buffers of SocketBufferTable which aren't
+* used by ESP layer or by this layer.
+*
+* Return: number of free buffers.
+*****************************************************************************************/
+static uint8_t WIFI_GetNumberOfFreeSocketBuffers(void)
+{
+	uint8_t numberOfFreeBuffers = 0;
+
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET_BUFFER; i++)
+	{
+		if((SocketBufferTable[i].lockFlag == false) && (SocketBufferTable[i].receptionFlag == false))
+		{
+			numberOfFreeBuffers++;
+		}
+	}
+
+	return numberOfFreeBuffers;
+}
+
+/*****************************************************************************************
+* WIFI_GetFreeTxMessage() - return buffer of SocketBufferTable which isn't used. Buffer is
+* returned only when WIFI_RECEPTION_SOCKET_BUFFERS other buffers stay free for reception.
+* Buffer stay free until WIFI_QueueTxMessage or WIFI_HoldTxMessage will be call so caller
+* can resign from use of it, but ESP layer can reserve it in next ESP_Process call.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure.
+*
+* Return: pointer to free buffer or NULL if buffers are used.
+*****************************************************************************************/
+SocketMessage* WIFI_GetFreeTxMessage(WifiStateType* wifiStateStructure)
+{
+	if(WIFI_GetNumberOfFreeSocketBuffers() <= WIFI_RECEPTION_SOCKET_BUFFERS)
+		return NULL;
+
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET_BUFFER; i++)
+	{
+		if((SocketBufferTable[i].lockFlag == false) && (SocketBufferTable[i].receptionFlag == false))
+		{
+			return &SocketBufferTable[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************************
+* WIFI_HoldTxMessage() - keep buffer returned by WIFI_GetFreeTxMessage when message is
+* filled during few calls(entries of range query or block of FRAM image). Held buffer isn't
+* used for reception and isn't send until WIFI_QueueTxMessage will be call.
+*
+* Parameters:
+* @txMessage: buffer returned by WIFI_GetFreeTxMessage.
+*
+*****************************************************************************************/
+void WIFI_HoldTxMessage(SocketMessage* txMessage)
+{
+	txMessage->transmitFlag = false;
+	txMessage->acceptedFlag = true;
+	txMessage->lockFlag = true;
+}
+
+/*****************************************************************************************
+* WIFI_QueueTxMessage() - mark buffer with coded SOME/IP message as ready to send.
+* Buffers are send in order of call of this function.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure.
+* @txMessage: buffer returned by WIFI_GetFreeTxMessage or buffer of request where response
+*  was coded.
+* @socketId: number of socket where message will be send.
+*
+*****************************************************************************************/
+void WIFI_QueueTxMessage(WifiStateType* wifiStateStructure, SocketMessage* txMessage, uint8_t socketId)
+{
+	txMessage->socketId = socketId;
+	txMessage->sequenceNumber = wifiStateStructure->txSequenceNumber++;
+	txMessage->transmitFlag = true;
+	txMessage->acceptedFlag = true;
+	txMessage->lockFlag = true;
+}
+
+/*****************************************************************************************
+* WIFI_StartDayMeasurementSearch() - start search of day measurement described by
+* SearchedDayMeasurementHeader. If day measurement is present day or was already loaded
+* to cache then search is finished immediately otherwise FRAM search is requested.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with searched header.
+*
+*****************************************************************************************/
+static void WIFI_StartDayMeasurementSearch(WifiStateType* wifiStateStructure)
+{
+	uint16_t framIndexTmp = 0;
+
+	wifiStateStructure->temperatureSingleDayRecordPointer = TemperatureRecordCache_Find(
+		wifiStateStructure->SearchedDayMeasurementHeader.source, wifiStateStructure->SearchedDayMeasurementHeader.day,
+		wifiStateStructure->SearchedDayMeasurementHeader.month, wifiStateStructure->SearchedDayMeasurementHeader.year,
+		&framIndexTmp);
+
+	if(wifiStateStructure->temperatureSingleDayRecordPointer != NULL)
+	{
+		//protect entry until response will be send
+		TemperatureRecordCache_Lock(wifiStateStructure->temperatureSingleDayRecordPointer);
+		wifiStateStructure->searchedStructureExist = true;
+
+		wifiStateStructure->searchState = SEARCH_FINISHED;
+	}
+	else
+	{
+		wifiStateStructure->searchState = SEARCH_REQUESTED;
+	}
+}
+
+/*****************************************************************************************
+* WIFI_IncrementDate() - move date in day measurement header to next day.
+*
+* Parameters:
+* @header: pointer to header with modified date.
+*
+*****************************************************************************************/
+static void WIFI_IncrementDate(DayMeasurementHeader* header)
+{
+	header->day++;
+
+	if(header->day > GUI_ReturnMaxDayInMonth(header->month, header->year))
+	{
+		header->day = 1;
+		header->month++;
+
+		if(header->month > 12)
+		{
+			header->month = 1;
+			header->year++;
+		}
+	}
+}
+
+/*****************************************************************************************
+* WIFI_SelectNextSegment() - choose next segment from range of segmented day measurement
+* request which wasn't send yet. If segment belong to day measurement which is already
+* loaded then it can be send immediately. Otherwise day measurement used by previous segment
+* is released, date in SearchedDayMeasurementHeader is moved to day of chosen segment and
+* search of day measurement is started.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with segmented transfer data.
+*
+* Return: true if next segment was chosen, false if all requested segments was send.
+*****************************************************************************************/
+bool WIFI_SelectNextSegment(WifiStateType* wifiStateStructure)
+{
+	DayMeasurementHeader *searchedHeader = &wifiStateStructure->SearchedDayMeasurementHeader;
+	uint8_t dayIndex = wifiStateStructure->segmentIndex / SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENTS_PER_DAY;
+
+	if(wifiStateStructure->pendingSegmentMask == 0)
+		return false;
+
+	while((wifiStateStructure->pendingSegmentMask & (1UL << wifiStateStructure->segmentIndex)) == 0)
+	{
+		wifiStateStructure->segmentIndex++;
+	}
+
+	//segment from the same day as previous one
+	if((wifiStateStructure->searchState == SEARCH_FINISHED)
+		&& ((wifiStateStructure->segmentIndex / SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENTS_PER_DAY) == dayIndex))
+	{
+		return true;
+	}
+
+	TemperatureRecordCache_Unlock(wifiStateStructure->temperatureSingleDayRecordPointer);
+	wifiStateStructure->temperatureSingleDayRecordPointer = NULL;
+
+	for(; dayIndex < (wifiStateStructure->segmentIndex / SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENTS_PER_DAY); dayIndex++)
+	{
+		WIFI_IncrementDate(searchedHeader);
+	}
+
+	WIFI_StartDayMeasurementSearch(wifiStateStructure);
+
+	return true;
+}
+
+/*****************************************************************************************
+* WIFI_GetRangeQueryDayIndex() - check that day measurement header read from FRAM belong to
+* range query and return position of its day in range.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with range query request.
+* @header: header of day measurement.
+*
+* Return: index of day in range or WIFI_RANGE_INDEX_TABLE_DAYS if source wasn't requested or
+*  date is outside of range.
+*****************************************************************************************/
+uint8_t WIFI_GetRangeQueryDayIndex(WifiStateType* wifiStateStructure, DayMeasurementHeader* header)
+{
+	SomeIpRangeQueryRequestPayload *request = &wifiStateStructure->RangeQueryRequest;
+	DayMeasurementHeader dateTmp = {header->source, request->firstDay, request->firstMonth, request->firstYear};
+	uint32_t dateKey = ((uint32_t)header->year << 16) | ((uint32_t)header->month << 8) | header->day;
+
+	if((header->source >= NUM_OF_TEMPERATURE_SOURCE) || ((request->sourceMask & (1 << header->source)) == 0))
+		return WIFI_RANGE_INDEX_TABLE_DAYS;
+
+	//most of headers are rejected without count of days
+	if((dateKey < (((uint32_t)request->firstYear << 16) | ((uint32_t)request->firstMonth << 8) | request->firstDay))
+		|| (dateKey > (((uint32_t)request->lastYear << 16) | ((uint32_t)request->lastMonth << 8) | request->lastDay)))
+		return WIFI_RANGE_INDEX_TABLE_DAYS;
+
+	for(uint8_t dayIndex = 0; dayIndex < wifiStateStructure->rangeQueryNumberOfDays; dayIndex++)
+	{
+		if((dateTmp.day == header->day) && (dateTmp.month == header->month) && (dateTmp.year == header->year))
+			return dayIndex;
+
+		WIFI_IncrementDate(&dateTmp);
+	}
+
+	return WIFI_RANGE_INDEX_TABLE_DAYS;
+}
+
+/*****************************************************************************************
+* WIFI_SelectNextRangeQueryEntry() - move SearchedDayMeasurementHeader to next requested
+* source of the same day or to first requested source of next day in range.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with range query data.
+*
+* Return: true if next entry was chosen, false if all days of range was send.
+*****************************************************************************************/
+bool WIFI_SelectNextRangeQueryEntry(WifiStateType* wifiStateStructure)
+{
+	DayMeasurementHeader *searchedHeader = &wifiStateStructure->SearchedDayMeasurementHeader;
+
+	do
+	{
+		searchedHeader->source++;
+
+		if(searchedHeader->source >= NUM_OF_TEMPERATURE_SOURCE)
+		{
+			searchedHeader->source = 0;
+			wifiStateStructure->rangeQueryDayIndex++;
+
+			if(wifiStateStructure->rangeQueryDayIndex >= wifiStateStructure->rangeQueryNumberOfDays)
+				return false;
+
+			WIFI_IncrementDate(searchedHeader);
+		}
+	}while((wifiStateStructure->RangeQueryRequest.sourceMask & (1 << searchedHeader->source)) == 0);
+
+	return true;
+}
+
+/*****************************************************************************************
+* WIFI_GetFramImageBlockSize() - return number of bytes of FRAM image block. All blocks
+* except last have WIFI_FRAM_IMAGE_BLOCK_SIZE bytes.
+*
+* Parameters:
+* @blockIndex: index of block lower than WIFI_FRAM_IMAGE_NUMBER_OF_BLOCKS.
+*
+* Return: size of block in bytes.
+*****************************************************************************************/
+uint16_t WIFI_GetFramImageBlockSize(uint16_t blockIndex)
+{
+	uint16_t blockBeginTmp = FRAM_MEASUREMENT_DATA_BEGIN + (blockIndex * WIFI_FRAM_IMAGE_BLOCK_SIZE);
+
+	if((FRAM_MEMORY_SIZE - blockBeginTmp) < WIFI_FRAM_IMAGE_BLOCK_SIZE)
+		return (FRAM_MEMORY_SIZE - blockBeginTmp);
+
+	return WIFI_FRAM_IMAGE_BLOCK_SIZE;
+}
+
+/*****************************************************************************************
+* WIFI_ValidateDate() - check that date from request payload exist.
+*
+* Parameters:
+* @day: day of month.
+* @month: month.
+* @year: year counted from 2000.
+*
+* Return: true if date is correct.
+*****************************************************************************************/
+static bool WIFI_ValidateDate(uint8_t day, uint8_t month, uint8_t year)
+{
+	if((month == 0) || (month > 12) || (year > 254) || (day == 0))
+	{
+		return false;
+	}
+
+	return (day <= GUI_ReturnMaxDayInMonth(month, year));
+}
+
+/*****************************************************************************************
+* Handlers of methods from MethodDescriptorTable. Size of request payload was already
+* checked by WIFI_ProcessRequest and payload is read by generated decoder of
+* SomeIpInterface.c. Handler validate content of payload, write payload of
+* response by responseWriter and return SOME/IP return code of response. If returned code
+* isn't SOME_IP_RETURN_CODE_E_OK_VALUE then response is send without payload.
+* WIFI_RESPONSE_DEFERRED mean that response will be send after FRAM search.
+* WIFI_RESPONSE_COMPLETE mean that handler copied whole coded message to buffer of writer.
+*****************************************************************************************/
+uint8_t WIFI_ClockStatusSetHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter)
+{
+	SomeIpClockStatusSetRequestMethodPayload requestPayloadStructure;
+
+	SomeIpInterface_DecodeClockStatusSetRequest(SOMEIP_GetPayload(request->payload), &requestPayloadStructure);
+
+	if((requestPayloadStructure.minute > 59) || (requestPayloadStructure.hour > 23)
+		|| (WIFI_ValidateDate(requestPayloadStructure.day, requestPayloadStructure.month, requestPayloadStructure.year) == false))
+	{
+		return SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE;
+	}
+
+	ClockState.currentTimeSecond = 0;
+	ClockState.currentTimeMinute = requestPayloadStructure.minute;
+	ClockState.currentTimeHour = requestPayloadStructure.hour;
+	ClockState.day = requestPayloadStructure.day;
+	ClockState.month = requestPayloadStructure.month;
+	ClockState.year = requestPayloadStructure.year;
+	WIFI_ClockStatusChanged();
+
+	return SOME_IP_RETURN_CODE_E_OK_VALUE;
+}
+
+uint8_t WIFI_ClockStatusGetHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter)
+{
+	//code response again only if ClockState fields were changed since last request
+	if((wifiStateStructure->clockStatusResponseSize == 0)
+		|| (wifiStateStructure->clockStatusResponseGeneration != ClockStatusGeneration))
+	{
+		SomeIpClockStatusGetResponseMethodPayload getResponseMethodPayload;
+		uint8_t codedPayload[SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET_PAYLOAD_SIZE];
+
+		//generation is read before fields so change during coding will be detected by next request
+		wifiStateStructure->clockStatusResponseGeneration = ClockStatusGeneration;
+
+		getResponseMethodPayload.minute = ClockState.currentTimeMinute;
+		getResponseMethodPayload.hour = ClockState.currentTimeHour;
+		getResponseMethodPayload.day = ClockState.day;
+		getResponseMethodPayload.month = ClockState.month;
+		getResponseMethodPayload.year = ClockState.year;
+		getResponseMethodPayload.reserved = 0;
+		getResponseMethodPayload.temperatureOutside = ClockState.TemperatureSensorTable[OUTSIDE_TEMPERATURE].temperatureValue;
+		getResponseMethodPayload.temperatureInside = ClockState.TemperatureSensorTable[INSIDE_TEMPERATURE].temperatureValue;
+		getResponseMethodPayload.temperatureFurnace = ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValue;
+		SomeIpInterface_EncodeClockStatusGetResponse(codedPayload, &getResponseMethodPayload);
+
+		wifiStateStructure->clockStatusResponseSize = SOMEIP_CodeTxMessage(SOME_IP_SERVICE_CLOCK_STATUS,
+			SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET, SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE,
+			wifiStateStructure->ClockStatusResponseCache, codedPayload, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET_PAYLOAD_SIZE);
+	}
+
+	//client ID and session ID of response are always zero so message is send without change
+	memcpy(responseWriter->someIpTxMessageBuffer, wifiStateStructure->ClockStatusResponseCache,
+		wifiStateStructure->clockStatusResponseSize);
+
+	return WIFI_RESPONSE_COMPLETE;
+}
+
+uint8_t WIFI_ClockStatusSubscribeHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter)
+{
+	WifiSubscriptionType *subscription = &wifiStateStructure->SubscriptionTable[request->socketId];
+	SomeIpClockStatusSubscribeRequestMethodPayload requestPayloadStructure;
+	bool subscribeRequest = (SOMEIP_GetMethodId(request->payload) == SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE);
+
+	//unsubscribe request contain only eventgroup mask
+	if(subscribeRequest)
+	{
+		SomeIpInterface_DecodeClockStatusSubscribeRequest(SOMEIP_GetPayload(request->payload), &requestPayloadStructure);
+	}
+	else
+	{
+		SomeIpInterface_DecodeClockStatusUnsubscribeRequest(SOMEIP_GetPayload(request->payload), &requestPayloadStructure);
+	}
+
+	if((requestPayloadStructure.eventgroupMask == 0)
+		|| (requestPayloadStructure.eventgroupMask >= (1 << WIFI_NUMBER_OF_EVENTGROUPS))
+		|| (requestPayloadStructure.minimumInterval > WIFI_EVENT_MAX_MINIMUM_INTERVAL))
+	{
+		return SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE;
+	}
+
+	if(subscribeRequest)
+	{
+		subscription->eventgroupMask |= requestPayloadStructure.eventgroupMask;
+		subscription->minimumInterval = requestPayloadStructure.minimumInterval * ONE_SECONDS;
+
+		//initial notification with present state is send immediately
+		subscription->pendingEventgroupMask |= requestPayloadStructure.eventgroupMask;
+		subscription->intervalCounter = subscription->minimumInterval;
+	}
+	else
+	{
+		subscription->eventgroupMask &= ~requestPayloadStructure.eventgroupMask;
+		subscription->pendingEventgroupMask &= subscription->eventgroupMask;
+	}
+
+	return SOME_IP_RETURN_CODE_E_OK_VALUE;
+}
+
+uint8_t WIFI_DayMeasurementHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter)
+{
+	uint16_t serviceId = SOMEIP_GetServiceId(request->payload);
+	uint16_t methodId = SOMEIP_GetMethodId(request->payload);
+	bool segmentedRequest = (serviceId == SOME_IP_SERVICE_DAY_MEASUREMENT)
+		&& (methodId == SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_GET_SEGMENTED);
+	SomeIpDayMeasurmentRequestPayload requestPayloadStructure;
+	SomeIpDayMeasurmentSegmentedRequestPayload segmentedRequestPayloadStructure = {0};
+
+	//summary and segmented request begin with the same payload
+	SomeIpInterface_DecodeDayMeasurementPartRequest(SOMEIP_GetPayload(request->payload), &requestPayloadStructure);
+
+	if(segmentedRequest)
+	{
+		SomeIpInterface_DecodeDayMeasurementGetSegmentedRequest(SOMEIP_GetPayload(request->payload), &segmentedRequestPayloadStructure);
+	}
+
+	if(WIFI_ValidateDate(requestPayloadStructure.day, requestPayloadStructure.month, requestPayloadStructure.year) == false)
+	{
+		return SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE;
+	}
+
+	//at least one segment must be requested
+	if(segmentedRequest && (segmentedRequestPayloadStructure.requestedSegmentsMask == 0))
+	{
+		return SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE;
+	}
+
+	//next requests can be processed during search so header of response is stored
+	wifiStateStructure->searchedServiceId = serviceId;
+	wifiStateStructure->searchedMethodId = methodId;
+	wifiStateStructure->searchedSocketId = request->socketId;
+
+	//copy searched header from request
+	memcpy(&wifiStateStructure->SearchedDayMeasurementHeader, &requestPayloadStructure, DAY_MEASUREMENT_HEADER_SIZE);
+
+	//segments of next days are send by wifiProcessFramSearchRequest after previous one
+	if(segmentedRequest)
+	{
+		wifiStateStructure->segmentedTransfer = true;
+		wifiStateStructure->segmentIndex = 0;
+		wifiStateStructure->pendingSegmentMask = segmentedRequestPayloadStructure.requestedSegmentsMask;
+
+		WIFI_SelectNextSegment(wifiStateStructure);
+	}
+	else
+	{
+		WIFI_StartDayMeasurementSearch(wifiStateStructure);
+	}
+
+	return WIFI_RESPONSE_DEFERRED;
+}
+
+uint8_t WIFI_RangeQueryHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter)
+{
+	SomeIpRangeQueryRequestPayload requestPayloadStructure;
+	DayMeasurementHeader dateTmp = {0};
+	uint8_t numberOfDaysTmp = 1;
+	uint8_t sourceMaskTmp = 0;
+	//manifest entry is much smaller than day measurement so manifest can cover longer range
+	uint8_t maxNumberOfDaysTmp = (SOMEIP_GetMethodId(request->payload) == SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST)
+		? WIFI_MANIFEST_MAX_DAYS : WIFI_RANGE_QUERY_MAX_DAYS;
+
+	//manifest has the same request so it use decoder of range query
+	SomeIpInterface_DecodeDayMeasurementRangeQueryRequest(SOMEIP_GetPayload(request->payload), &requestPayloadStructure);
+	sourceMaskTmp = requestPayloadStructure.sourceMask & ~SOME_IP_RANGE_QUERY_COMPACT_ENCODING_FLAG;
+	dateTmp.day = requestPayloadStructure.firstDay;
+	dateTmp.month = requestPayloadStructure.firstMonth;
+	dateTmp.year = requestPayloadStructure.firstYear;
+
+	if((sourceMaskTmp == 0)
+		|| (sourceMaskTmp >= (1 << NUM_OF_TEMPERATURE_SOURCE))
+		|| (requestPayloadStructure.step > MAX_TEMP_RECORD_PER_DAY)
+		|| (WIFI_ValidateDate(requestPayloadStructure.firstDay, requestPayloadStructure.firstMonth,
+			requestPayloadStructure.firstYear) == false)
+		|| (WIFI_ValidateDate(requestPayloadStructure.lastDay, requestPayloadStructure.lastMonth,
+			requestPayloadStructure.lastYear) == false))
+	{
+		return SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE;
+	}
+
+	//last day must be reached in maxNumberOfDaysTmp days, it also reject last day before first one
+	while((dateTmp.day != requestPayloadStructure.lastDay) || (dateTmp.month != requestPayloadStructure.lastMonth)
+		|| (dateTmp.year != requestPayloadStructure.lastYear))
+	{
+		if(numberOfDaysTmp >= maxNumberOfDaysTmp)
+			return SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE;
+
+		WIFI_IncrementDate(&dateTmp);
+		numberOfDaysTmp++;
+	}
+
+	wifiStateStructure->searchedServiceId = SOMEIP_GetServiceId(request->payload);
+	wifiStateStructure->searchedMethodId = SOMEIP_GetMethodId(request->payload);
+	wifiStateStructure->searchedSocketId = request->socketId;
+
+	wifiStateStructure->RangeQueryRequest = requestPayloadStructure;
+	wifiStateStructure->rangeQueryManifest = (wifiStateStructure->searchedMethodId == SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST);
+	wifiStateStructure->rangeQueryNumberOfDays = numberOfDaysTmp;
+	wifiStateStructure->rangeQueryDayIndex = 0;
+	wifiStateStructure->rangeQueryMessageIndex = 0;
+
+	for(uint8_t i = 0; i < numberOfDaysTmp; i++)
+	{
+		for(uint8_t j = 0; j < NUM_OF_TEMPERATURE_SOURCE; j++)
+		{
+			wifiStateStructure->RangeQueryFramIndexTable[i][j] = WIFI_RANGE_QUERY_INDEX_NOT_FOUND;
+		}
+	}
+
+	//first entry is first requested source of first day
+	wifiStateStructure->SearchedDayMeasurementHeader.source = 0;
+	wifiStateStructure->SearchedDayMeasurementHeader.day = requestPayloadStructure.firstDay;
+	wifiStateStructure->SearchedDayMeasurementHeader.month = requestPayloadStructure.firstMonth;
+	wifiStateStructure->SearchedDayMeasurementHeader.year = requestPayloadStructure.firstYear;
+
+	while((requestPayloadStructure.sourceMask & (1 << wifiStateStructure->SearchedDayMeasurementHeader.source)) == 0)
+	{
+		wifiStateStructure->SearchedDayMeasurementHeader.source++;
+	}
+
+	//entries are send by wifiProcessFramSearchRequest after read of FRAM headers
+	wifiStateStructure->searchState = SEARCH_RANGE_REQUESTED;
+
+	return WIFI_RESPONSE_DEFERRED;
+}
+
+#if WIFI_FRAM_IMAGE_SERVICE
+uint8_t WIFI_FramImageExportHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter)
+{
+	SomeIpFramImageExportRequestPayload requestPayloadStructure;
+	uint32_t lastBlockIndexTmp = WIFI_FRAM_IMAGE_NUMBER_OF_BLOCKS;
+
+	SomeIpInterface_DecodeFramImageExportRequest(SOMEIP_GetPayload(request->payload), &requestPayloadStructure);
+
+	if(requestPayloadStructure.firstBlockIndex >= WIFI_FRAM_IMAGE_NUMBER_OF_BLOCKS)
+		return SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE;
+
+	//export is finished on end of FRAM also when more blocks was requested
+	if((requestPayloadStructure.numberOfBlocks != 0)
+		&& (((uint32_t)requestPayloadStructure.firstBlockIndex + requestPayloadStructure.numberOfBlocks) < lastBlockIndexTmp))
+	{
+		lastBlockIndexTmp = (uint32_t)requestPayloadStructure.firstBlockIndex + requestPayloadStructure.numberOfBlocks;
+	}
+
+	wifiStateStructure->searchedServiceId = SOMEIP_GetServiceId(request->payload);
+	wifiStateStructure->searchedMethodId = SOMEIP_GetMethodId(request->payload);
+	wifiStateStructure->searchedSocketId = request->socketId;
+
+	wifiStateStructure->framImageBlockIndex = requestPayloadStructure.firstBlockIndex;
+	wifiStateStructure->framImageLastBlockIndex = (uint16_t)lastBlockIndexTmp;
+
+	//blocks are read and send by wifiProcessFramSearchRequest
+	wifiStateStructure->searchState = SEARCH_IMAGE_EXPORT_REQUESTED;
+
+	return WIFI_RESPONSE_DEFERRED;
+}
+
+uint8_t WIFI_FramImageImportHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter)
+{
+	SomeIpFramImageImportRequestPayload requestPayloadStructure;
+	uint16_t blockSizeTmp = 0;
+
+	SomeIpInterface_DecodeFramImageImportRequest(SOMEIP_GetPayload(request->payload), &requestPayloadStructure);
+
+	if(requestPayloadStructure.blockIndex >= WIFI_FRAM_IMAGE_NUMBER_OF_BLOCKS)
+		return SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE;
+
+	blockSizeTmp = WIFI_GetFramImageBlockSize(requestPayloadStructure.blockIndex);
+
+	//damaged block isn't written so client can send it again
+	if(Chip_CRC_CRC16((uint16_t*)requestPayloadStructure.data, blockSizeTmp/2) != requestPayloadStructure.crc16Value)
+		return SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE;
+
+	wifiStateStructure->searchedServiceId = SOMEIP_GetServiceId(request->payload);
+	wifiStateStructure->searchedMethodId = SOMEIP_GetMethodId(request->payload);
+	wifiStateStructure->searchedSocketId = request->socketId;
+
+	//first import open session which block write of temperatures to FRAM until validation
+	if(wifiStateStructure->framImageImportActive == false)
+	{
+		wifiStateStructure->framImageImportActive = true;
+		wifiStateStructure->framImageSessionCounter = 0;
+	}
+
+	//RX buffer is released after return so data is copied until end of FRAM write
+	wifiStateStructure->framImageBlockIndex = requestPayloadStructure.blockIndex;
+	memcpy(wifiStateStructure->FramImageBlock, requestPayloadStructure.data, blockSizeTmp);
+
+	wifiStateStructure->searchState = SEARCH_IMAGE_IMPORT_REQUESTED;
+
+	return WIFI_RESPONSE_DEFERRED;
+}
+
+uint8_t WIFI_FramImageValidateHandler(WifiStateType* wifiStateStructure, SocketMessage* request,
+		SomeIpWriter* responseWriter)
+{
+	wifiStateStructure->searchedServiceId = SOMEIP_GetServiceId(request->payload);
+	wifiStateStructure->searchedMethodId = SOMEIP_GetMethodId(request->payload);
+	wifiStateStructure->searchedSocketId = request->socketId;
+
+	//during validation framImageBlockIndex is index of checked day measurement
+	wifiStateStructure->framImageBlockIndex = 0;
+	wifiStateStructure->framImageNewestIndex = NOT_INITIALIZED_FRAM_INDEX_VALUE;
+	memset(&wifiStateStructure->FramImageValidationResult, 0, sizeof(SomeIpFramImageValidateResponsePayload));
+
+	for(uint8_t i = 0; i < NUM_OF_TEMPERATURE_SOURCE; i++)
+	{
+		wifiStateStructure->FramImagePresentDayIndexTable[i] = NOT_INITIALIZED_FRAM_INDEX_VALUE;
+	}
+
+	wifiStateStructure->searchState = SEARCH_IMAGE_VALIDATE_REQUESTED;
+
+	return WIFI_RESPONSE_DEFERRED;
+}
+#endif
+
+/*****************************************************************************************
+* WIFI_FindMethodDescriptor() - find descriptor of method by binary search in sorted
+* MethodDescriptorTable.
+*
+* Parameters:
+* @serviceId: service ID of request.
+* @methodId: method ID of request.
+*
+* Return: pointer to descriptor or NULL if method isn't supported.
+*****************************************************************************************/
+static const WifiMethodDescriptorType* WIFI_FindMethodDescriptor(uint16_t serviceId, uint16_t methodId)
+{
+	uint32_t searchedKey = ((uint32_t)serviceId << 16) | methodId;
+	int16_t low = 0;
+	int16_t high = NUMBER_OF_METHOD_DESCRIPTORS - 1;
+	int16_t foundIndex = -1;
+
+	//find last descriptor which begin before searched method
+	while(low <= high)
+	{
+		int16_t middle = (low + high) / 2;
+		uint32_t middleKey = ((uint32_t)MethodDescriptorTable[middle].serviceId << 16) | MethodDescriptorTable[middle].firstMethodId;
+
+		if(middleKey <= searchedKey)
+		{
+			foundIndex = middle;
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle - 1;
+		}
+	}
+
+	if((foundIndex >= 0) && (MethodDescriptorTable[foundIndex].serviceId == serviceId)
+		&& (methodId <= MethodDescriptorTable[foundIndex].lastMethodId))
+	{
+		return &MethodDescriptorTable[foundIndex];
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************************
+* WIFI_ServiceIsSupported() - check that MethodDescriptorTable contain any method of
+* service. It is used only to choose return code of unsupported method.
+*
+* Parameters:
+* @serviceId: service ID of request.
+*
+* Return: true if service is supported.
+*****************************************************************************************/
+static bool WIFI_ServiceIsSupported(uint16_t serviceId)
+{
+	for(uint8_t i = 0; i < NUMBER_OF_METHOD_DESCRIPTORS; i++)
+	{
+		if(MethodDescriptorTable[i].serviceId == serviceId)
+			return true;
+	}
+
+	return false;
+}
+
+/*****************************************************************************************
+* WIFI_ProcessRequest() - function is only call from WIFI_DispatchRequest and is only
+*	responsible for process SOME/IP request. Message was already validated(correct SOME/IP
+*	message header and CRC if this extension was set) so fields are read directly from
+*	buffer. Size of payload is checked and handler of method is called. Response with
+*	return code of handler is coded in the same buffer and is queued for send, handlers
+*	read whole request before they write response. If response will be send after FRAM
+*	search then buffer is released.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure which contain data like request
+*  data and buffer used for FRAM requests proces.
+* @request: buffer of SocketBufferTable with request.
+* @methodDescriptor: descriptor of requested method found in MethodDescriptorTable or NULL
+*  if method isn't supported.
+*
+*****************************************************************************************/
+static void WIFI_ProcessRequest(WifiStateType* wifiStateStructure, SocketMessage* request,
+		const WifiMethodDescriptorType* methodDescriptor)
+{
+	uint16_t serviceId = SOMEIP_GetServiceId(request->payload);
+	uint16_t methodId = SOMEIP_GetMethodId(request->payload);
+	uint8_t returnCode = SOME_IP_RETURN_CODE_E_OK_VALUE;
+	SomeIpWriter writer;
+
+	SOMEIP_InitWriter(&writer, request->payload, MAX_SIZE_OF_SOCKET_BUFFER);
+
+	if(methodDescriptor == NULL)
+	{
+		returnCode = WIFI_ServiceIsSupported(serviceId) ?
+			SOME_IP_RETURN_CODE_E_UNKNOWN_METHOD : SOME_IP_RETURN_CODE_E_UNKNOWN_SERVICE;
+	}
+	else
+	{
+		if(SOMEIP_GetPayloadSize(request->payload) != methodDescriptor->requestPayloadSize)
+		{
+			returnCode = SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE;
+		}
+		else
+		{
+			returnCode = methodDescriptor->handler(wifiStateStructure, request, &writer);
+		}
+	}
+
+	if(returnCode == WIFI_RESPONSE_DEFERRED)
+	{
+		//header of response was stored by handler
+		request->lockFlag = false;
+
+		return;
+	}
+
+	if(returnCode == WIFI_RESPONSE_COMPLETE)
+	{
+		request->payloadSize = SOME_IP_HEADER_LENGTH
+			+ SOMEIP_ReadUint32(&request->payload[SOME_IP_HEADER_LENGTH_FIELD_BEGIN]);
+	}
+	else if(returnCode == SOME_IP_RETURN_CODE_E_OK_VALUE)
+	{
+		request->payloadSize = SOMEIP_WriterFinish(&writer, serviceId, methodId, SOME_IP_RESPONSE_CODE, returnCode);
+	}
+	else
+	{
+		request->payloadSize = SOMEIP_CodeTxMessage(serviceId, methodId, SOME_IP_RESPONSE_CODE, returnCode,
+			request->payload, NULL, 0);
+	}
+
+	WIFI_QueueTxMessage(wifiStateStructure, request, request->socketId);
+}
+
+/*****************************************************************************************
+* WIFI_ReceiveRequests() - validate messages received by ESP layer in order of receive and
+* add requests to queue of socket which send it. Request isn't copied, queue hold pointer
+* to buffer in SocketBufferTable where response will be coded. Request which can wait in
+* queue(queue isn't empty or request wait for end of FRAM search) is added only if
+* WIFI_RECEPTION_SOCKET_BUFFERS buffers and one buffer for response created after search
+* stay free, so waiting requests can't block search. Other requests are processed in the
+* same call and their buffers are released after send. If queue is full or buffers are used then
+* request is rejected by SOME/IP error with SOME_IP_RETURN_CODE_E_NOT_READY code coded in
+* place of request. Messages which were dropped by ESP layer because all buffers were used
+* are rejected the same way by their headers when free buffer is available.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with request queues.
+*
+*****************************************************************************************/
+static void WIFI_ReceiveRequests(WifiStateType* wifiStateStructure)
+{
+	for(SocketMessage* rxMessage = ESP_GetReceivedMessage(); rxMessage != NULL; rxMessage = ESP_GetReceivedMessage())
+	{
+		WifiRequestQueueType* requestQueue = &wifiStateStructure->RequestQueueTable[rxMessage->socketId];
+		const WifiMethodDescriptorType* methodDescriptor = NULL;
+
+		//message without request code don't require response
+		if((SOMEIP_ValidateRxMessage(rxMessage->payload, rxMessage->payloadSize) == false)
+			|| (SOMEIP_GetMessageType(rxMessage->payload) != SOME_IP_REQUEST_CODE))
+		{
+			rxMessage->lockFlag = false;
+
+			continue;
+		}
+
+		methodDescriptor = WIFI_FindMethodDescriptor(SOMEIP_GetServiceId(rxMessage->payload),
+			SOMEIP_GetMethodId(rxMessage->payload));
+
+		if((requestQueue->size < WIFI_REQUEST_QUEUE_SIZE)
+			&& (((requestQueue->size == 0) && ((methodDescriptor == NULL) || (methodDescriptor->searchInFram == false)))
+				|| (WIFI_GetNumberOfFreeSocketBuffers() > WIFI_RECEPTION_SOCKET_BUFFERS)))
+		{
+			rxMessage->acceptedFlag = true;
+			requestQueue->requestTable[(requestQueue->head + requestQueue->size) % WIFI_REQUEST_QUEUE_SIZE] = rxMessage;
+			requestQueue->size++;
+		}
+		else
+		{
+			rxMessage->payloadSize = SOMEIP_CodeTxMessage(SOMEIP_GetServiceId(rxMessage->payload),
+				SOMEIP_GetMethodId(rxMessage->payload), SOME_IP_ERROR_CODE, SOME_IP_RETURN_CODE_E_NOT_READY,
+				rxMessage->payload, NULL, 0);
+
+			WIFI_QueueTxMessage(wifiStateStructure, rxMessage, rxMessage->socketId);
+		}
+	}
+
+	for(SocketMessage* txMessage = WIFI_GetFreeTxMessage(wifiStateStructure); txMessage != NULL;
+		txMessage = WIFI_GetFreeTxMessage(wifiStateStructure))
+	{
+		ESP_DroppedMessage droppedMessage;
+
+		if(ESP_GetDroppedMessage(&droppedMessage) == false)
+			break;
+
+		txMessage->payloadSize = SOMEIP_CodeTxMessage(SOMEIP_GetServiceId(droppedMessage.header),
+			SOMEIP_GetMethodId(droppedMessage.header), SOME_IP_ERROR_CODE, SOME_IP_RETURN_CODE_E_NOT_READY,
+			txMessage->payload, NULL, 0);
+
+		WIFI_QueueTxMessage(wifiStateStructure, txMessage, droppedMessage.socketId);
+	}
+}
+
+/*****************************************************************************************
+* WIFI_DispatchRequest() - choose next request from queues of sockets and process it.
+* Queues are checked in round robin order starting from socket after socket which was
+* served last time. Day measurement request wait in queue when previous one is searched in
+* FRAM but requests of other sockets are processed.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with request queues.
+*
+* Return: true if request was processed, false if there isn't request which can be
+*  processed.
+*****************************************************************************************/
+static bool WIFI_DispatchRequest(WifiStateType* wifiStateStructure)
+{
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
+	{
+		uint8_t socketId = (wifiStateStructure->nextServedSocket + i) % MAX_NUMBER_OF_SOCKET;
+		WifiRequestQueueType* requestQueue = &wifiStateStructure->RequestQueueTable[socketId];
+		SocketMessage* request = requestQueue->requestTable[requestQueue->head];
+		const WifiMethodDescriptorType* methodDescriptor = NULL;
+
+		if(requestQueue->size == 0)
+			continue;
+
+		methodDescriptor = WIFI_FindMethodDescriptor(SOMEIP_GetServiceId(request->payload),
+			SOMEIP_GetMethodId(request->payload));
+
+		if((methodDescriptor != NULL) && methodDescriptor->searchInFram
+			&& (wifiStateStructure->searchState != SEARCH_NOT_REQUESTED))
+			continue;
+
+		requestQueue->head = (requestQueue->head + 1) % WIFI_REQUEST_QUEUE_SIZE;
+		requestQueue->size--;
+		wifiStateStructure->nextServedSocket = (socketId + 1) % MAX_NUMBER_OF_SOCKET;
+
+		WIFI_ProcessRequest(wifiStateStructure, request, methodDescriptor);
+
+		return true;
+	}
+
+	return false;
+}
+
+/*****************************************************************************************
+* WIFI_CodeEventPayload() - fill payload of notification with present state of ClockState
+* fields which belong to eventgroup.
+*
+* Parameters:
+* @eventgroup: one of WIFI_EVENTGROUP values.
+* @payload: buffer with size SOME_IP_SERVICE_CLOCK_STATUS_EVENT_MAX_PAYLOAD_SIZE.
+*
+* Return: size of payload.
+*****************************************************************************************/
+static uint16_t WIFI_CodeEventPayload(uint8_t eventgroup, uint8_t* payload)
+{
+	memset(payload, 0, SOME_IP_SERVICE_CLOCK_STATUS_EVENT_MAX_PAYLOAD_SIZE);
+
+	switch(eventgroup)
+	{
+	case WIFI_EVENTGROUP_TIME:
+		{
+			SomeIpClockStatusTimeEventPayload *timePayload = (SomeIpClockStatusTimeEventPayload*)payload;
+
+			timePayload->minute = ClockState.currentTimeMinute;
+			timePayload->hour = ClockState.currentTimeHour;
+			timePayload->day = ClockState.day;
+			timePayload->month = ClockState.month;
+			timePayload->year = ClockState.year;
+
+			return sizeof(SomeIpClockStatusTimeEventPayload);
+		}
+
+	case WIFI_EVENTGROUP_TEMPERATURE:
+		{
+			SomeIpClockStatusTemperatureEventPayload *temperaturePayload = (SomeIpClockStatusTemperatureEventPayload*)payload;
+
+			temperaturePayload->temperatureOutside = ClockState.TemperatureSensorTable[OUTSIDE_TEMPERATURE].temperatureValue;
+			temperaturePayload->temperatureInside = ClockState.TemperatureSensorTable[INSIDE_TEMPERATURE].temperatureValue;
+			temperaturePayload->temperatureFurnace = ClockState.TemperatureSensorTable[FURNACE_TEMPERATURE].temperatureValue;
+
+			return sizeof(SomeIpClockStatusTemperatureEventPayload);
+		}
+
+	case WIFI_EVENTGROUP_ALARM:
+		{
+			SomeIpClockStatusAlarmEventPayload *alarmPayload = (SomeIpClockStatusAlarmEventPayload*)payload;
+
+			alarmPayload->firstAlarmHour = ClockState.firstAlarmHour;
+			alarmPayload->firstAlarmMinute = ClockState.firstAlarmMinute;
+			alarmPayload->secondAlarmHour = ClockState.secondAlarmHour;
+			alarmPayload->secondAlarmMinute = ClockState.secondAlarmMinute;
+			alarmPayload->alarmFlags = (ClockState.firstAlarmActive ? 0x01 : 0)
+				| (ClockState.firstAlarmRaised ? 0x02 : 0)
+				| (ClockState.secondAlarmActive ? 0x04 : 0)
+				| (ClockState.secondAlarmRaised ? 0x08 : 0)
+				| (ClockState.temperatureFurnaceAlarmActive ? 0x10 : 0)
+				| (ClockState.temperatureFurnaceAlarmRaised ? 0x20 : 0);
+			alarmPayload->temperatureFurnaceAlarmThreshold = ClockState.temperatureFurnaceAlarmThreshold;
+
+			return sizeof(SomeIpClockStatusAlarmEventPayload);
+		}
+
+	default:
+		return 0;
+	}
+}
+
+/*****************************************************************************************
+* WIFI_UpdateEvents() - compare present state of each eventgroup with state stored in
+* EventPayloadTable and mark changed eventgroups as pending for all its subscribers.
+* Subscriptions of closed sockets are removed.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with subscriptions.
+*
+*****************************************************************************************/
+static void WIFI_UpdateEvents(WifiStateType* wifiStateStructure)
+{
+	uint8_t changedEventgroupMask = 0;
+
+	for(uint8_t i = 0; i < WIFI_NUMBER_OF_EVENTGROUPS; i++)
+	{
+		uint8_t eventPayloadTmp[SOME_IP_SERVICE_CLOCK_STATUS_EVENT_MAX_PAYLOAD_SIZE];
+
+		WIFI_CodeEventPayload(i, eventPayloadTmp);
+
+		if(memcmp(eventPayloadTmp, wifiStateStructure->EventPayloadTable[i], SOME_IP_SERVICE_CLOCK_STATUS_EVENT_MAX_PAYLOAD_SIZE) != 0)
+		{
+			memcpy(wifiStateStructure->EventPayloadTable[i], eventPayloadTmp, SOME_IP_SERVICE_CLOCK_STATUS_EVENT_MAX_PAYLOAD_SIZE);
+			changedEventgroupMask |= (1 << i);
+		}
+	}
+
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
+	{
+		WifiSubscriptionType *subscription = &wifiStateStructure->SubscriptionTable[i];
+
+#if (WIFI_PASSTHROUGH_MODE == 0) && (WIFI_SERIAL_LINK_MODE == 0)
+		//ESP8266 don't report state of link in passthrough mode, serial link is always connected
+		if(ESP_ReturnLinkInformation(i).socketIsOpen == false)
+		{
+			subscription->eventgroupMask = 0;
+		}
+#endif
+
+		subscription->pendingEventgroupMask |= changedEventgroupMask;
+		subscription->pendingEventgroupMask &= subscription->eventgroupMask;
+
+		if(subscription->intervalCounter < subscription->minimumInterval)
+		{
+			subscription->intervalCounter++;
+		}
+	}
+}
+
+/*****************************************************************************************
+* WIFI_SendNotifications() - send notifications of pending eventgroups to subscribers which
+* didn't receive notification during minimum interval. Notification contain present state
+* of eventgroup. If TX buffers are used then rest of notifications is send during
+* next call. Interval is counted from moment when all pending notifications were send.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with subscriptions.
+*
+*****************************************************************************************/
+static void WIFI_SendNotifications(WifiStateType* wifiStateStructure)
+{
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
+	{
+		WifiSubscriptionType *subscription = &wifiStateStructure->SubscriptionTable[i];
+
+		if((subscription->pendingEventgroupMask == 0)
+			|| (subscription->intervalCounter < subscription->minimumInterval))
+			continue;
+
+		for(uint8_t eventgroup = 0; eventgroup < WIFI_NUMBER_OF_EVENTGROUPS; eventgroup++)
+		{
+			SocketMessage* txMessage = NULL;
+			uint16_t eventPayloadSizeTmp = 0;
+
+			if((subscription->pendingEventgroupMask & (1 << eventgroup)) == 0)
+				continue;
+
+			txMessage = WIFI_GetFreeTxMessage(wifiStateStructure);
+
+			if(txMessage == NULL)
+				return;
+
+			//payload is filled directly in TX buffer
+			eventPayloadSizeTmp = WIFI_CodeEventPayload(eventgroup, SOMEIP_GetPayload(txMessage->payload));
+
+			txMessage->payloadSize = SOMEIP_CodeTxMessage(SOME_IP_SERVICE_CLOCK_STATUS,
+				SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TIME + eventgroup, SOME_IP_NOTIFICATION_CODE,
+				SOME_IP_RETURN_CODE_E_OK_VALUE, txMessage->payload, NULL, eventPayloadSizeTmp);
+
+			WIFI_QueueTxMessage(wifiStateStructure, txMessage, i);
+
+			subscription->pendingEventgroupMask &= ~(1 << eventgroup);
+		}
+
+		subscription->intervalCounter = 0;
+	}
+}
+
+#if WIFI_TELEMETRY_MODE
+/*****************************************************************************************
+* WIFI_SendTelemetry() - send notification with present temperatures and last stored 15
+* minutes temperatures to collector by UDP link. Notification is send when minute of clock
+* was changed or when telemetryPending was set after store of temperature in day
+* measurement. If TX buffers are used then notification is send during next call.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure with telemetry data.
+*
+*****************************************************************************************/
+static void WIFI_SendTelemetry(WifiStateType* wifiStateStructure)
+{
+	SocketMessage* txMessage = NULL;
+	SomeIpWriter writer;
+	SomeIpClockStatusTelemetryEventPayload* telemetryPayload = NULL;
+
+	//link is opened again when it was closed by ESP8266
+	if(ESP_ReturnLinkInformation(WIFI_TELEMETRY_LINK_ID).socketIsOpen == false)
+	{
+		wifiStateStructure->telemetryLinkReady = false;
+	}
+
+	if(ClockState.currentTimeMinute != wifiStateStructure->telemetryMinute)
+	{
+		wifiStateStructure->telemetryMinute = ClockState.currentTimeMinute;
+		wifiStateStructure->telemetryPending = true;
+	}
+
+	if((wifiStateStructure->telemetryPending == false) || (wifiStateStructure->telemetryLinkReady == false))
+		return;
+
+	txMessage = WIFI_GetFreeTxMessage(wifiStateStructure);
+
+	if(txMessage == NULL)
+		return;
+
+	//payload is filled directly in TX buffer
+	SOMEIP_InitWriter(&writer, txMessage->payload, MAX_SIZE_OF_SOCKET_BUFFER);
+	telemetryPayload = (SomeIpClockStatusTelemetryEventPayload*)SOMEIP_WriterReserve(&writer,
+		SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TELEMETRY_PAYLOAD_SIZE);
+
+	telemetryPayload->hour = ClockState.currentTimeHour;
+	telemetryPayload->minute = ClockState.currentTimeMinute;
+	telemetryPayload->reserved[0] = 0;
+	telemetryPayload->reserved[1] = 0;
+
+	for(uint8_t i = 0; i < NUM_OF_TEMPERATURE_SOURCE; i++)
+	{
+		uint16_t temperatureIndexTmp = TemperatureFramTransactionSensorTable[i].temperatureIndex;
+
+		telemetryPayload->temperatureTable[i] = ClockState.TemperatureSensorTable[i].temperatureValue;
+		telemetryPayload->aggregateTable[i] = INVALID_READ_SENSOR_VALUE;
+
+		if(ClockState.TemperatureSensorTable[i].recordTemperature && (temperatureIndexTmp < MAX_TEMP_RECORD_PER_DAY))
+		{
+			telemetryPayload->aggregateTable[i] = TemperatureSingleDay[i].temperatureValues[temperatureIndexTmp];
+		}
+	}
+
+	txMessage->payloadSize = SOMEIP_WriterFinish(&writer, SOME_IP_SERVICE_CLOCK_STATUS,
+		SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TELEMETRY, SOME_IP_NOTIFICATION_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE);
+
+	WIFI_QueueTxMessage(wifiStateStructure, txMessage, WIFI_TELEMETRY_LINK_ID);
+
+	wifiStateStructure->telemetryPending = false;
+}
+#endif
+
+/*****************************************************************************************
+* Request, response and callback functions of commands added to ESP command queue. Context
+* parameter of all functions is pointer to WifiStateType structure.
+*****************************************************************************************/
+static bool WIFI_GeneralResponse(void* context)
+{
+	return ESP_ProcessGaneralFormatResponse();
+}
+
+static bool WIFI_ConnectToApnRequest(void* context)
+{
+	return ESP_SendConnectToApnRequest(ClockState.ssidOfAssignedApn, ClockState.passwordToAssignedApn);
+}
+
+static void WIFI_ConnectToApnFinished(bool result, void* context)
+{
+	ClockState.wifiConnected = result;
+
+	if(ClockState.wifiConnected)
+	{
+		((WifiStateType*)context)->checkConnectionCounter = 0;
+	}
+}
+
+static bool WIFI_GetIpAddressRequest(void* context)
+{
+	return ESP_GetAssignedIpAddress();
+}
+
+static bool WIFI_GetIpAddressResponse(void* context)
+{
+	return ESP_ProcessGetAssignedIpResponse(ClockState.ipAddressAssignedToDevice);
+}
+
+static bool WIFI_GetApnRequest(void* context)
+{
+	return ESP_SendApnListRequest();
+}
+
+static bool WIFI_ApnListResponse(void* context)
+{
+	return ESP_ProcessApnListResponse();
+}
+
+static void WIFI_GetApnFinished(bool result, void* context)
+{
+	ClockState.wifiApnReceived = result;
+}
+
+static bool WIFI_DisconnectRequest(void* context)
+{
+	return ESP_SendDisconnectRequest();
+}
+
+static void WIFI_DisconnectFinished(bool result, void* context)
+{
+	//disconnect isn't repeated after last retry even if it wasn't possible
+	ClockState.wifiStartDisconnect = false;
+}
+
+static bool WIFI_ConnectionStatusRequest(void* context)
+{
+	return ESP_GetConnectionStatus();
+}
+
+static bool WIFI_ConnectionStatusResponse(void* context)
+{
+	return ESP_ProcessConnectionStatus(&ClockState.wifiConnected);
+}
+
+static void WIFI_ConnectionStatusFinished(bool result, void* context)
+{
+	((WifiStateType*)context)->checkConnectionCounter = 0;
+
+	//connection was lost
+	if(ClockState.wifiConnected == false)
+	{
+		memset(ClockState.ipAddressAssignedToDevice, 0, 4);
+		ClockState.wifiStartDisconnect = false;
+	}
+}
+
+static bool WIFI_AcceptMultipleConnectionRequest(void* context)
+{
+	return ESP_SendAcceptMultipleConnectionRequest();
+}
+
+static bool WIFI_CreateTcpServerRequest(void* context)
+{
+	return ESP_SendServerCommandRequest(true, TCP_SERVER_PORT_NUMBER);
+}
+
+static void WIFI_InitSocketFinished(bool result, void* context)
+{
+	((WifiStateType*)context)->initSocketFlag = result;
+}
+
+#if WIFI_PASSTHROUGH_MODE
+static bool WIFI_SingleConnectionRequest(void* context)
+{
+	return ESP_SendSingleConnectionRequest();
+}
+
+static bool WIFI_PassthroughModeRequest(void* context)
+{
+	return ESP_SendTransferModeRequest(true);
+}
+
+static bool WIFI_StartTcpConnectionRequest(void* context)
+{
+	return ESP_SendStartTcpConnectionRequest(PassthroughServerIpAddress, WIFI_PASSTHROUGH_SERVER_PORT_NUMBER);
+}
+
+static bool WIFI_StartPassthroughRequest(void* context)
+{
+	return ESP_SendStartPassthroughRequest();
+}
+#endif
+
+#if WIFI_TELEMETRY_MODE
+static bool WIFI_StartUdpConnectionRequest(void* context)
+{
+	return ESP_SendStartUdpConnectionRequest(WIFI_TELEMETRY_LINK_ID, TelemetryCollectorIpAddress,
+		WIFI_TELEMETRY_COLLECTOR_PORT_NUMBER);
+}
+
+static void WIFI_StartUdpConnectionFinished(bool result, void* context)
+{
+	((WifiStateType*)context)->telemetryLinkReady = result;
+}
+#endif
+
+static bool WIFI_SendResponseRequest(void* context)
+{
+	WifiStateType* wifiStateStructure = (WifiStateType*)context;
+
+	return ESP_SendWriteDataRequest(wifiStateStructure->sendTxMessage->socketId,
+		wifiStateStructure->sendTxMessage->payloadSize);
+}
+
+static bool WIFI_WriteResponseRequest(void* context)
+{
+	WifiStateType* wifiStateStructure = (WifiStateType*)context;
+
+	//message is send directly from buffer where it was coded
+	return ESP_Write(wifiStateStructure->sendTxMessage->payload, wifiStateStructure->sendTxMessage->payloadSize);
+}
+
+static void WIFI_SendResponseFinished(bool result, void* context)
+{
+	WifiStateType* wifiStateStructure = (WifiStateType*)context;
+
+	if(result == false)
+	{
+		wifiStateStructure->sendTxErrorCounter++;
+
+		//transmition will be repeated during next call of WIFI_Process
+		if(wifiStateStructure->sendTxErrorCounter <= WIFI_SEND_DATA_REPETITION)
+		{
+			wifiStateStructure->sendTxPending = false;
+
+			return;
+		}
+	}
+
+	//transmission was performed with success or was repeated few times but without success
+	wifiStateStructure->sendTxMessage->transmitFlag = false;
+	wifiStateStructure->sendTxMessage->lockFlag = false;
+
+	//clear thing for send state machine
+	wifiStateStructure->sendTxMessage = NULL;
+	wifiStateStructure->sendTxErrorCounter = 0;
+	wifiStateStructure->sendTxPending = false;
+}
+
+/*****************************************************************************************
+* WIFI_ProcessStationStateEvent() - update connection state of clock when module report
+* change of station connection. Lost connection is detected immediately so request
+* AT+CIPSTATUS is send only as watchdog. After WIFI DISCONNECT module try to reconnect
+* itself so own connection request is delayed.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure.
+*
+*****************************************************************************************/
+static void WIFI_ProcessStationStateEvent(WifiStateType* wifiStateStructure)
+{
+	ESP_STATION_STATE stationState;
+
+	if(ESP_GetStationStateEvent(&stationState) == false)
+		return;
+
+	if(stationState == ESP_STATION_DISCONNECTED)
+	{
+		ClockState.wifiConnected = false;
+		memset(ClockState.ipAddressAssignedToDevice, 0, 4);
+		ClockState.wifiStartDisconnect = false;
+		wifiStateStructure->connectToApnCounter = 0;
+	}
+	else if(stationState == ESP_STATION_GOT_IP)
+	{
+		//IP address was cleared by WIFI DISCONNECT so it will be read again
+		ClockState.wifiConnected = true;
+		wifiStateStructure->checkConnectionCounter = 0;
+	}
+}
+
+/*****************************************************************************************
+* WIFI_LinkIsReady() - check that SOME/IP messages can be exchanged. Connection to APN and
+* sockets are required only when ESP8266 is used.
+*
+* Parameters:
+* @wifiStateStructure: pointer to WifiStateType structure.
+*
+* Return: true if requests can be received and responses can be send.
+*****************************************************************************************/
+static bool WIFI_LinkIsReady(WifiStateType* wifiStateStructure)
+{
+#if WIFI_SERIAL_LINK_MODE
+	return ESP_SerialLinkIsActive();
+#else
+	return ClockState.wifiConnected && wifiStateStructure->initSocketFlag;
+#endif
+}
+
+/*****************************************************************************************
+* WIFI_GetOldestTxMessage() - find buffer of SocketBufferTable with coded message which wait
+* for send the longest time.
+*
+* Return: pointer to buffer or NULL if any buffer don't wait for send.
+*****************************************************************************************/
+static SocketMessage* WIFI_GetOldestTxMessage(void)
+{
+	SocketMessage* oldestTxMessage = NULL;
+
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET_BUFFER; i++)
+	{
+		if(SocketBufferTable[i].lockFlag && SocketBufferTable[i].transmitFlag
+			&& ((oldestTxMessage == NULL)
+				|| ((int8_t)(SocketBufferTable[i].sequenceNumber - oldestTxMessage->sequenceNumber) < 0)))
+		{
+			oldestTxMessage = &SocketBufferTable[i];
+		}
+	}
+
+	return oldestTxMessage;
+}
+
+/*****************************************************************************************
+* WIFI_Process() - function must be call cyclically after initialization process with correct
+*	result. Information about get connection status, assigned IP address and available APN
+*	is performed inside this function. Connection state is updated by events received from
+*	module and checked by AT+CIPSTATUS every WIFI_CONNECTION_WATCHDOG_PERIOD seconds. Inside this part is also performed log to APN if
+*	password was set. All AT requests are added to ESP command queue as lists of commands,
+*	results are handled by callbacks of commands. New connection request is added only if
+*	queue is empty. If WIFI_PASSTHROUGH_MODE is set then messages are exchanged with remote
+*	device in passthrough mode and AT requests aren't send until disconnect. If
+*	WIFI_TELEMETRY_MODE is set then UDP link to collector is opened and telemetry is send.
+*	If WIFI_SERIAL_LINK_MODE is set then AT requests aren't send and messages are exchanged
+*	by serial link.
+*
+* Parameters:
+* @wifiStateStructure: pointer to.WifiStateType structure with data like counters used to
+*  decide when send get access points or check connection status.
+*
+*****************************************************************************************/
+void WIFI_Process(WifiStateType* wifiStateStructure)
+{
+#if WIFI_PASSTHROUGH_MODE
+	//AT requests can't be send in passthrough mode so session is finished before disconnect
+	if(ClockState.wifiStartDisconnect && ESP_StopPassthrough())
+	{
+		wifiStateStructure->initSocketFlag = false;
+	}
+#endif
+
+	WIFI_ProcessStationStateEvent(wifiStateStructure);
+
+	//manage connection state - AT requests can't be send in passthrough mode and serial link mode
+	if((ESP_GetQueuedCommandNumber() == 0) && (ESP_PassthroughIsActive() == false)
+		&& (ESP_SerialLinkIsActive() == false))
+	{
+		//Connect to APN and read assigned IP address
+		if((ClockState.wifiConnected == false)
+			&& (strlen(ClockState.ssidOfAssignedApn) != 0)
+			&& (wifiStateStructure->connectToApnCounter > ONE_SECONDS*30))
+		{
+			ESP_Command connectSequence[] = {
+				{WIFI_ConnectToApnRequest, WIFI_GeneralResponse, WIFI_ConnectToApnFinished,
+					wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0},
+				{WIFI_GetIpAddressRequest, WIFI_GetIpAddressResponse, NULL,
+					wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0}
+			};
+
+			ESP_QueueCommandSequence(connectSequence, sizeof(connectSequence)/sizeof(ESP_Command));
+			wifiStateStructure->connectToApnCounter = 0;
+		}
+		//send get APN list request
+		else if((gui.active_window == &wifiSettingsWindow)
+				&& (wifiStateStructure->getApnCounter > ONE_SECONDS*15))
+		{
+			ESP_Command getApnCommand = {WIFI_GetApnRequest, WIFI_ApnListResponse, WIFI_GetApnFinished,
+				wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0};
+
+			ESP_QueueCommand(&getApnCommand);
+			wifiStateStructure->getApnCounter = 0;
+		}
+		//check that disconnect request isn't active
+		else if(ClockState.wifiStartDisconnect)
+		{
+			ESP_Command disconnectCommand = {WIFI_DisconnectRequest, WIFI_ApnListResponse, WIFI_DisconnectFinished,
+				wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, WIFI_DISCONNECT_REPETITION};
+
+			ESP_QueueCommand(&disconnectCommand);
+		}
+		//get IP address if it wasn't read after connection
+		else if(ClockState.wifiConnected && ClockState.ipAddressAssignedToDevice[0] == 0)
+		{
+			ESP_Command getIpAddressCommand = {WIFI_GetIpAddressRequest, WIFI_GetIpAddressResponse, NULL,
+				wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0};
+
+			ESP_QueueCommand(&getIpAddressCommand);
+		}
+		//check connection status if any event wasn't lost
+		else if(ClockState.wifiConnected
+				&& (wifiStateStructure->checkConnectionCounter > ONE_SECONDS*WIFI_CONNECTION_WATCHDOG_PERIOD))
+		{
+			ESP_Command connectionStatusCommand = {WIFI_ConnectionStatusRequest, WIFI_ConnectionStatusResponse,
+				WIFI_ConnectionStatusFinished, wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0};
+
+			ESP_QueueCommand(&connectionStatusCommand);
+			wifiStateStructure->checkConnectionCounter = 0;
+		}
+		//after succesfut connection initialize sockets
+		else if(ClockState.wifiConnected && (wifiStateStructure->initSocketFlag == false))
+		{
+#if WIFI_PASSTHROUGH_MODE
+			ESP_Command initSocketSequence[] = {
+				{WIFI_SingleConnectionRequest, WIFI_GeneralResponse, NULL,
+					wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0},
+				{WIFI_PassthroughModeRequest, WIFI_GeneralResponse, NULL,
+					wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0},
+				{WIFI_StartTcpConnectionRequest, WIFI_GeneralResponse, NULL,
+					wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0},
+				{WIFI_StartPassthroughRequest, WIFI_GeneralResponse, WIFI_InitSocketFinished,
+					wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0}
+			};
+#else
+			ESP_Command initSocketSequence[] = {
+				{WIFI_AcceptMultipleConnectionRequest, WIFI_GeneralResponse, NULL,
+					wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0},
+				{WIFI_CreateTcpServerRequest, WIFI_GeneralResponse, WIFI_InitSocketFinished,
+					wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0}
+			};
+#endif
+
+			ESP_QueueCommandSequence(initSocketSequence, sizeof(initSocketSequence)/sizeof(ESP_Command));
+		}
+#if WIFI_TELEMETRY_MODE
+		//open UDP link to collector after creation of TCP server
+		else if(ClockState.wifiConnected && wifiStateStructure->initSocketFlag
+			&& (wifiStateStructure->telemetryLinkReady == false)
+			&& (wifiStateStructure->telemetryLinkCounter > ONE_SECONDS*10))
+		{
+			ESP_Command startUdpConnectionCommand = {WIFI_StartUdpConnectionRequest, WIFI_GeneralResponse,
+				WIFI_StartUdpConnectionFinished, wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0};
+
+			ESP_QueueCommand(&startUdpConnectionCommand);
+			wifiStateStructure->telemetryLinkCounter = 0;
+		}
+#endif
+	}/* if((ESP_GetQueuedCommandNumber() == 0) && (ESP_PassthroughIsActive() == false)
+		&& (ESP_SerialLinkIsActive() == false)) */
+
+	//process data received and send by device
+	if(WIFI_LinkIsReady(wifiStateStructure))
+	{
+		//queued requests are served first so their buffers are released by send before new requests
+		//are received, otherwise clients which repeat rejected requests could starve other sockets
+		for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET_BUFFER; i++)
+		{
+			if(WIFI_DispatchRequest(wifiStateStructure) == false)
+				break;
+		}
+
+		WIFI_ReceiveRequests(wifiStateStructure);
+
+		//response of each new request is coded in its buffer
+		for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET_BUFFER; i++)
+		{
+			if(WIFI_DispatchRequest(wifiStateStructure) == false)
+				break;
+		}
+
+		//responses are send before notifications
+		WIFI_UpdateEvents(wifiStateStructure);
+		WIFI_SendNotifications(wifiStateStructure);
+#if WIFI_TELEMETRY_MODE
+		WIFI_SendTelemetry(wifiStateStructure);
+#endif
+	}/* if(WIFI_LinkIsReady(wifiStateStructure)) */
+	else
+	{
+		ESP_DroppedMessage droppedMessage;
+
+		//requests and subscriptions of closed connections will not be answered
+		while(ESP_GetDroppedMessage(&droppedMessage))
+		{
+		}
+
+		for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
+		{
+			WifiRequestQueueType* requestQueue = &wifiStateStructure->RequestQueueTable[i];
+
+			for(; requestQueue->size > 0; requestQueue->size--)
+			{
+				requestQueue->requestTable[requestQueue->head]->lockFlag = false;
+				requestQueue->head = (requestQueue->head + 1) % WIFI_REQUEST_QUEUE_SIZE;
+			}
+
+			wifiStateStructure->SubscriptionTable[i].eventgroupMask = 0;
+			wifiStateStructure->SubscriptionTable[i].pendingEventgroupMask = 0;
+		}
+
+		wifiStateStructure->telemetryLinkReady = false;
+	}
+
+	if((wifiStateStructure->sendTxPending == false) && WIFI_LinkIsReady(wifiStateStructure))
+	{
+		SocketMessage* txMessage = WIFI_GetOldestTxMessage();
+
+#if WIFI_SERIAL_LINK_MODE || WIFI_PASSTHROUGH_MODE
+		//messages don't wait for confirmation so all TX messages are send while UART TX ring has space
+		while(txMessage != NULL)
+		{
+#if WIFI_SERIAL_LINK_MODE
+			//message is coded by COBS
+			if(ESP_SerialLinkWrite(txMessage->payload, txMessage->payloadSize) == false)
+				break;
+#else
+			//message is send directly without AT+CIPSEND handshake
+			if(ESP_PassthroughWrite(txMessage->payload, txMessage->payloadSize) == false)
+				break;
+#endif
+
+			txMessage->transmitFlag = false;
+			txMessage->lockFlag = false;
+			txMessage = WIFI_GetOldestTxMessage();
+		}
+#else
+		if(txMessage != NULL)
+		{
+			//CIPSEND request and payload are send one after another
+			ESP_Command sendSequence[] = {
+				{WIFI_SendResponseRequest, WIFI_GeneralResponse, NULL,
+					wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0},
+				{WIFI_WriteResponseRequest, WIFI_GeneralResponse, WIFI_SendResponseFinished,
+					wifiStateStructure, ESP_COMMAND_DEFAULT_TIMEOUT, 0}
+			};
+
+			wifiStateStructure->sendTxMessage = txMessage;
+
+			if(ESP_QueueCommandSequence(sendSequence, sizeof(sendSequence)/sizeof(ESP_Command)))
+			{
+				wifiStateStructure->sendTxPending = true;
+			}
+		}
+#endif
+	}/* if((wifiStateStructure->sendTxPending == false) && WIFI_LinkIsReady(wifiStateStructure)) */
+
+	wifiStateStructure->connectToApnCounter++;
+	wifiStateStructure->getApnCounter++;
+	wifiStateStructure->telemetryLinkCounter++;
+
+	if(ClockState.wifiConnected)
+	{
+		wifiStateStructure->checkConnectionCounter++;
+	}
+
+#if WIFI_FRAM_IMAGE_SERVICE
+	//client which don't finish import by validation can't block write of temperatures
+	if(wifiStateStructure->framImageImportActive)
+	{
+		wifiStateStructure->framImageSessionCounter++;
+
+		if(wifiStateStructure->framImageSessionCounter > ONE_SECONDS*WIFI_FRAM_IMAGE_SESSION_MAX_TIME)
+		{
+			wifiStateStructure->framImageImportActive = false;
+		}
+	}
+#endif
+
+	//results of commands are processed by callbacks called inside ESP_Process
+	ESP_Process();
+}
+
+/*****************************************************************************************
+* WIFI_ClockStatusChanged() - inform that time, date or temperature in ClockState was
+* changed so cached response of SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET is outdated. Function
+* can be called from interrupt.
+*****************************************************************************************/
+void WIFI_ClockStatusChanged(void)
+{
+	ClockStatusGeneration++;
+}
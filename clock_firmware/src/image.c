@@ -1,1140 +1,1140 @@
-/*
- * Copyright (c) 2018, Adrian Chemicz
- * All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *    1. Redistributions of source code must retain the above copyright
- *       notice, this list of conditions and the following disclaimer.
- *    2. Redistributions in binary form must reproduce the above copyright
- *       notice, this list of conditions and the following disclaimer in the
- *       documentation and/or other materials provided with the distribution.
- *    3. Neither the name of contributors may be used to endorse or promote products
- *       derived from this software without specific prior written permission.
-
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
- * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
- * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
- * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
- * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-
-#include "image.h"
-
-const uint8_t homePictureOutsideTable[4620] = { 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x13, 0x13, 0x13, 0x13, 0x33, 0x33, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13,
-0x33, 0x33, 0x52, 0x52, 0x6E, 0x4A, 0x69, 0x69, 0x6E, 0x6E, 0x6E, 0x52, 0x52, 0x33, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x17, 0x6E, 0x85, 0x84, 0x84, 0x64, 0x64, 0x84, 0x84, 0x84, 0x64,
-0x64, 0x64, 0x64, 0x52, 0x17, 0x33, 0x33, 0x33, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17,
-0x6E, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x32, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x33, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
-0x64, 0x64, 0x49, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17,
-0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x37, 0x52, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x53, 0x37,
-0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
-0x64, 0x64, 0x49, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x53, 0x8D,
-0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x8E, 0x52, 0x37, 0x17, 0x37, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x17, 0x17, 0x17, 0x53, 0x8E, 0x72, 0x8E, 0x89, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0xA5, 0xA5, 0x85, 0x84,
-0x84, 0x89, 0x8E, 0x8E, 0x72, 0x57, 0x17, 0x17, 0x37, 0x37, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
-0x64, 0x64, 0x49, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x72, 0x8E, 0x89, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x89, 0x72, 0x37, 0x17, 0x37,
-0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x4D, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17,
-0x37, 0x72, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0x85, 0xA5, 0xA5,
-0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x6E, 0x57, 0x17, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
-0x64, 0x64, 0x4D, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x53, 0x8D, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x89, 0x52,
-0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x4D, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x37, 0x72, 0x89,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x85,
-0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x85, 0x6E, 0x89, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
-0x64, 0x64, 0x4D, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x17, 0x17, 0x37, 0x72, 0x77, 0x72, 0x8E, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85,
-0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x4E, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x57, 0x72, 0x8E, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84,
-0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
-0x64, 0x64, 0x4E, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17,
-0x57, 0x89, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5,
-0xA5, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x4E, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x37, 0x72, 0x89, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x85, 0xA5, 0xA9,
-0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
-0x64, 0x64, 0x4E, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x57, 0x8E, 0x85,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x84, 0x85, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x84, 0x84,
-0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x64, 0x85, 0x85, 0x84, 0x64, 0x6D, 0x37, 0x37, 0x37, 0x17, 0x37, 0x37, 0x37,
-0x37, 0x17, 0x17, 0x57, 0x57, 0x57, 0x8E, 0x89, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x84, 0x85,
-0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5,
-0x85, 0x84, 0x84, 0x8D, 0x8E, 0x8E, 0x72, 0x37, 0x17, 0x36, 0x32, 0x52, 0x8E, 0x89, 0xA9, 0x85, 0xA5, 0x85, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85,
-0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x8D, 0x72, 0x48,
-0x88, 0x85, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84,
-0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x84,
-0x85, 0xA5, 0x85, 0x84, 0x89, 0x72, 0x92, 0x72, 0x72, 0x48, 0x68, 0x89, 0x89, 0x69, 0x89, 0xA9, 0x85, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5,
-0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x89, 0x89, 0x89, 0x89, 0x89, 0x72, 0x17, 0x1B, 0x1B, 0x1B, 0x48,
-0x28, 0x28, 0x28, 0x28, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xA9, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0xA5, 0xA9,
-0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x89, 0x89, 0x8D, 0x89, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0xAD, 0x6D, 0x2D, 0x2D, 0x32, 0x32, 0x48, 0x48, 0x48, 0x48, 0x28, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
-0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x85, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x84, 0x89,
-0x89, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x28, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
-0xAD, 0xAD, 0xAD, 0xAD, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0x84,
-0xA5, 0xA9, 0x85, 0x85, 0x89, 0x8D, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xB1, 0xAD, 0xAD, 0xAD, 0xB1,
-0xAD, 0x8D, 0x8D, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
-0xAD, 0xAD, 0xAD, 0xAD, 0xA9, 0xA5, 0xA5, 0x85, 0x85, 0x89, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x89, 0x68, 0x69, 0x49, 0x45, 0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xAD, 0xB1, 0xAD, 0xAD, 0xAD, 0xD1, 0xAD, 0x45, 0x4A, 0x4A, 0x69, 0x69, 0x69, 0x89, 0xAD, 0xAD,
-0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4A, 0x4A, 0x4E, 0x4E, 0x49,
-0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xB1, 0xAD, 0xAD, 0xB1, 0xD1,
-0xAD, 0x69, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4A, 0x8D, 0xAD, 0xAD, 0xAD, 0xB1, 0xB1, 0xAD, 0xAD, 0x64, 0x64, 0x68, 0x68,
-0x89, 0x8D, 0x8D, 0x8D, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x89, 0x68, 0x89, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49, 0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x69, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0x8D, 0xAD,
-0xAD, 0xD1, 0xD1, 0xD1, 0xB1, 0xAD, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x68, 0xAD, 0x8D, 0x8D, 0x8D,
-0x8D, 0x69, 0x49, 0x4A, 0x4A, 0x4A, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49,
-0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
-0xAD, 0x6A, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xAD, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x44, 0x0, 0x44, 0x44,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x89, 0x4A, 0x4E, 0x4E, 0x4F, 0x4A, 0x68, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49, 0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x6A, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x64, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0xAD, 0x8D, 0x8D,
-0x89, 0x4A, 0x4E, 0x4E, 0x4E, 0x4A, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49,
-0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
-0xAD, 0x6A, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44,
-0x44, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0xAD, 0x8D, 0x8D, 0x89, 0x4A, 0x4E, 0x4E, 0x4E, 0x4A, 0x68, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49, 0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x6A, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0xAD, 0x8D, 0x8D,
-0x89, 0x4A, 0x4E, 0x4E, 0x4E, 0x4A, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49,
-0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
-0xAD, 0x6A, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44,
-0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0xAD, 0x8D, 0x8D, 0x89, 0x4A, 0x4E, 0x4E, 0x4E, 0x4A, 0x68, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x45, 0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x69, 0x6F, 0x6F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0xAD, 0x8D, 0x8D,
-0x89, 0x4A, 0x4E, 0x4E, 0x4E, 0x4A, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4A, 0x49, 0x45, 0x65, 0x68,
-0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
-0xB1, 0x8D, 0x89, 0x89, 0x69, 0x69, 0x6A, 0x69, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44,
-0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x89, 0x4A, 0x4E, 0x4E, 0x4F, 0x4A, 0x68, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x89, 0x69, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0xAD, 0xD1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0xB1, 0xB1, 0xAD, 0xAD, 0xB1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D,
-0x89, 0x4A, 0x4A, 0x4A, 0x4A, 0x45, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAD, 0xD1, 0xB1, 0xB1, 0xB1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44,
-0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x89, 0x65, 0x69, 0x68, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0xAD, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
-0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xAD, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0xAD, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
-0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xAD, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x8D, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1,
-0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6D, 0x6D, 0x4D, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x4D, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xB2, 0xB2, 0xB6, 0x92, 0x92, 0x6D, 0x49, 0x49, 0x44, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6E, 0x6D, 0x6D,
-0x49, 0x49, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x48, 0x49, 0x4D,
-0x4D, 0x6D, 0x6D, 0x6E, 0x72, 0x92, 0x92, 0x92, 0x92, 0xB2, 0xB2, 0xB2, 0xB2, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
-0xB6, 0xB6, 0xB6, 0xB2, 0x92, 0x6D, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x4D, 0x4D, 0x4D, 0x6D,
-0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0x92, 0x92, 0x6E, 0x8D, 0xAD, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6E, 0x6D, 0x6D, 0x4D, 0x49, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x4D, 0x72, 0x92, 0xB6, 0xB6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x8E, 0x8D, 0x8D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x4D, 0x49, 0x48, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x4D, 0x92, 0x92, 0xB6,
-0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x4D, 0x4D,
-0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x72, 0x92, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0x92,
-0x72, 0x6D, 0x4D, 0x4D, 0x48, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x49, 0x49, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x48, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x8, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28 };
-
-const UG_BMP homePictureOutside =
-{
-	(void*)homePictureOutsideTable,
-	70,
-	66,
-	BMP_BPP_8,
-	BMP_RGB332
-};
-
-//uint32_t pictureHeigh = 66;
-//uint32_t pictureWeigh = 70;
-const uint8_t homePictureInsideTable[4620] = { 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17,
-0x57, 0x57, 0x77, 0x57, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x32, 0x2E, 0x2E,
-0x2D, 0x32, 0x12, 0x32, 0x52, 0x77, 0x77, 0x97, 0x96, 0xB6, 0xB5, 0xB5, 0xD5, 0xD5, 0xB6, 0xB6, 0xB6, 0xB6, 0x96, 0x77,
-0x77, 0x57, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x36, 0x32, 0x32, 0x2E, 0x2D, 0x28, 0x28, 0x28, 0x48, 0x49, 0x6D, 0x8D, 0x91, 0xB1, 0xB1, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB6, 0xB6, 0xB6, 0x96, 0x97, 0x77, 0x57, 0x37,
-0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x32, 0x4D, 0x29, 0x28, 0x28, 0x48, 0x49, 0x6D, 0x6D, 0x8D, 0xB1, 0xB1, 0xB5,
-0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
-0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xB6, 0xB6, 0xB6, 0x96, 0x77, 0x77, 0x57, 0x37, 0x17, 0x17,
-0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x32, 0x32, 0x32, 0x2D, 0x29, 0x28, 0x28, 0x48, 0x49, 0x6D,
-0x8D, 0x91, 0xB1, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0x8D, 0x8D, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
-0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB6, 0xB6, 0x92, 0x96, 0x97, 0x77, 0x57, 0x37, 0x17, 0x37, 0x37, 0x37, 0x48,
-0x48, 0x48, 0x48, 0x28, 0x6D, 0x8D, 0xB1, 0xB1, 0xB5, 0xB5, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D,
-0x61, 0x61, 0x62, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0xB1, 0xB1,
-0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49,
-0xB5, 0xD5, 0xD5, 0xD6, 0xB6, 0x1B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D, 0x82, 0x82, 0x62, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4A, 0x4A, 0x6A, 0x6A, 0x69, 0x8D, 0x8D, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5,
-0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49, 0xB5, 0xD5, 0xD5, 0xD5, 0xB6, 0x17, 0x3B, 0x3B, 0x3B, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D,
-0x82, 0x82, 0x62, 0x91, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x53,
-0x4F, 0x4F, 0x4F, 0x4F, 0x4A, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49,
-0xB5, 0xD5, 0xD5, 0xD5, 0xB1, 0x2D, 0x2D, 0x32, 0x32, 0x48, 0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D, 0x62, 0x61, 0x62, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x53, 0x4F, 0x4F, 0x4F, 0x53, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5,
-0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49, 0xB5, 0xD5, 0xD5, 0xD5, 0xAD, 0x28, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D,
-0x62, 0x61, 0x62, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x4F,
-0x4F, 0x4F, 0x4F, 0x53, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49,
-0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D, 0x82, 0x61, 0x61, 0x91, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1,
-0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x53, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5,
-0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49, 0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D,
-0x62, 0x82, 0x82, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x4F,
-0x4F, 0x4F, 0x4F, 0x53, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x49,
-0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D, 0x65, 0x65, 0x89, 0x91, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1,
-0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x53, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5,
-0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x49, 0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1,
-0xB1, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x4F,
-0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x49,
-0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1,
-0xB1, 0xB1, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x6A, 0x6F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x91, 0xD5, 0xD5, 0xD5, 0xD5,
-0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x49, 0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xB1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0x8D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0xB1, 0xB1,
-0x8D, 0x8D, 0x8D, 0x6E, 0x6A, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x49,
-0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB1, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xB1,
-0xB1, 0xB1, 0xAD, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5,
-0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x91, 0x91, 0x91, 0x6D, 0x49, 0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB1, 0xB5, 0xB5,
-0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xB5, 0xB5, 0xB5, 0xB1, 0xAD, 0xAD, 0xAD, 0x8D, 0xAD, 0xAD, 0xAD, 0xB1,
-0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49, 0x25, 0x49, 0x29, 0x25, 0x49,
-0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB1, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xB1,
-0xB1, 0xB6, 0xB6, 0xB6, 0xDB, 0xB6, 0xB2, 0xB6, 0xB2, 0xB1, 0xD5, 0xD5, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1,
-0xB1, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x44, 0xB1, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48,
-0x48, 0x48, 0x48, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB1, 0xB5, 0xB5,
-0xB5, 0xB1, 0xB1, 0xB1, 0x8D, 0x8D, 0x88, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x85, 0x8D, 0x8D, 0xB2, 0xB6, 0xDB, 0xB6,
-0xD5, 0xD5, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x8D, 0xAD, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x69,
-0xB1, 0xB5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB1, 0xB1, 0xB1, 0xAD, 0x89, 0x89, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x64, 0x64, 0x64, 0x8D, 0x92, 0xB1, 0xD5, 0xD5, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x8D,
-0xAD, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x6D, 0xB1, 0xB1, 0xD5, 0xD1, 0xAD, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x8D, 0x8D, 0xAD,
-0xAD, 0xAD, 0xAD, 0xAD, 0x89, 0x80, 0x80, 0x80, 0x64, 0x64, 0x69, 0x69, 0x89, 0x89, 0x89, 0x89, 0x8D, 0x8D, 0x89, 0xB1,
-0xD5, 0xD5, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x8D, 0xAD, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x6D,
-0xB1, 0xB1, 0xD5, 0xD1, 0xAD, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x8D, 0xAD, 0xAD, 0x8D, 0x69, 0x69, 0x89, 0x89, 0x89,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x89, 0xB1, 0xD5, 0xD5, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x8D,
-0xAD, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x6D, 0xB1, 0xB1, 0xD5, 0xD1, 0xAD, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x6D, 0x91, 0x91, 0x8D, 0x6D, 0x69, 0x8D, 0x8D,
-0x6D, 0x8D, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB2, 0xB2,
-0xB6, 0xB6, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x8D, 0xAD, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x6D,
-0xB1, 0xB1, 0xD5, 0xD1, 0xAD, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5,
-0xB5, 0xB5, 0x6D, 0x91, 0x91, 0x91, 0x6D, 0x8D, 0x8D, 0xAD, 0x6D, 0x8D, 0xAD, 0xAD, 0x8D, 0x92, 0x92, 0x92, 0x92, 0x92,
-0x92, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1, 0xB1, 0x8D,
-0xAD, 0xB5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x6D, 0xB1, 0xB1, 0xD5, 0xD1, 0xAD, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0x6D, 0x91, 0x91, 0x91, 0x6D, 0x92, 0xB2, 0xB2,
-0x6D, 0x92, 0xAD, 0xAD, 0x8E, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
-0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB2, 0xB2, 0xB6, 0xB6, 0xB6, 0xB6, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6D,
-0xB1, 0xB1, 0xD5, 0xD1, 0x8D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xD5, 0xB5, 0xB5, 0xB6,
-0xB6, 0xB6, 0x6E, 0x92, 0x92, 0x92, 0x6D, 0x92, 0x92, 0x92, 0x6E, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
-0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB2, 0x92, 0x8D, 0x6D, 0x6D, 0x8D, 0x8E, 0x92, 0x92, 0xB2, 0xB6, 0xB6, 0xB6, 0xB6,
-0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x92, 0x92, 0x92, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1, 0xAD, 0x8D, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD6, 0xD2, 0xB6, 0xB6, 0xB6, 0x92, 0xB6, 0xB6, 0xB6,
-0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x92, 0x92, 0x8D, 0x6D, 0x69, 0x45, 0x29, 0x26, 0x25,
-0x26, 0x26, 0x26, 0x26, 0x49, 0x49, 0x49, 0x69, 0x6D, 0x8E, 0x8E, 0xB2, 0xB6, 0xB6, 0xB2, 0xB2, 0xB1, 0xAD, 0xAD, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x8D, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1,
-0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD6, 0xD6, 0xD6, 0xB6, 0xB6, 0xB6, 0xB2, 0x92, 0x8D, 0x8D, 0x69,
-0x49, 0x48, 0x29, 0x26, 0x26, 0x26, 0x22, 0x21, 0x22, 0x25, 0x26, 0x26, 0x26, 0x45, 0x49, 0x89, 0x68, 0xAD, 0x8D, 0xAD,
-0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6D, 0x6D, 0x4D, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x4D, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1,
-0xD1, 0xD1, 0xD2, 0xD2, 0xD6, 0xB6, 0xB2, 0xB2, 0x8E, 0x8D, 0x8D, 0x69, 0x69, 0x68, 0x45, 0x49, 0x45, 0x29, 0x49, 0x69,
-0x89, 0x89, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6E, 0x6D, 0x6D,
-0x4D, 0x4D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x48, 0x49, 0x4D,
-0x4D, 0x6D, 0x6D, 0x6E, 0x72, 0x92, 0x92, 0x92, 0x92, 0xB2, 0xB2, 0xB2, 0xB2, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
-0xB6, 0xB6, 0xB6, 0xB6, 0xB2, 0xB2, 0xAD, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
-0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x4D, 0x49, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x4D, 0x4D, 0x4D, 0x6D,
-0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0x92, 0x92, 0x72, 0x8D, 0xAD, 0xAD, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6E, 0x6D, 0x6D, 0x4D, 0x4D, 0x49, 0x48, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x4D, 0x72, 0x92, 0xB6, 0xB6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x8E, 0x8D, 0x8D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x4D, 0x49, 0x48, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x4D, 0x92, 0x92, 0xB6,
-0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x4D, 0x4D,
-0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x72, 0x92, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0x92,
-0x72, 0x6D, 0x4D, 0x4D, 0x48, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x49, 0x49, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x48, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x8, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28 };
-
-const UG_BMP homePictureInside =
-{
-	(void*)homePictureInsideTable,
-	70,
-	66,
-	BMP_BPP_8,
-	BMP_RGB332
-};
-
-const uint8_t wifiPictureTable[4620] = { 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
-0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x32, 0x32, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x33, 0x2E, 0x25, 0x25,
-0x25, 0x29, 0x32, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x17, 0x52, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x53, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0xE, 0x0, 0x25, 0x25, 0x25, 0x25, 0x29, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x53, 0x89, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x4E,
-0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x5, 0x0, 0x25, 0x25,
-0x25, 0x25, 0x25, 0x32, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x17, 0x57, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x32, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x33, 0x0, 0x0, 0x0, 0x25, 0x25, 0x25, 0x25, 0x2E, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x5, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x2E, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x37, 0x37, 0x37, 0x37, 0x17, 0x37, 0x52,
-0x72, 0x72, 0x72, 0x72, 0x72, 0x52, 0x37, 0x17, 0x37, 0x17, 0x37, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0xE, 0x0, 0x0,
-0x0, 0x5, 0x12, 0x37, 0x37, 0x17, 0x17, 0x52, 0x6D, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x89, 0x8E, 0x8E, 0x72,
-0x37, 0x17, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x29, 0x12, 0x29, 0x29, 0x37, 0x37, 0x17, 0x37, 0x72, 0x85, 0x85, 0xA5,
-0x84, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0xA5, 0xA5, 0xA5, 0x8E, 0x57, 0x6D, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2E, 0x29, 0x32,
-0x2D, 0x25, 0x32, 0x37, 0x52, 0x89, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0xA5, 0xA5, 0x85,
-0xA5, 0x89, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x33, 0x25, 0x25, 0x25, 0x25, 0x25, 0x29, 0x6E, 0x84, 0x85, 0xA5, 0xA5, 0xA5, 0x85,
-0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x25, 0x32, 0x37,
-0x32, 0x25, 0x25, 0x85, 0x84, 0x85, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5,
-0xA5, 0xA5, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x64, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x29, 0x25, 0x32, 0x52, 0x69, 0x45, 0x25, 0x65, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84,
-0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0x85, 0x84, 0x64, 0x57,
-0x17, 0x37, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
-0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3B, 0x32, 0x25, 0x25, 0x69, 0x84,
-0x85, 0x45, 0x25, 0x25, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5,
-0x85, 0x85, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0x85, 0x89, 0x8E, 0x8E, 0x77, 0x37, 0x1B, 0x37, 0x37, 0x37, 0x37, 0x3B,
-0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
-0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x2E, 0x25, 0x25, 0x25, 0x45, 0x45, 0x25, 0x25, 0x25, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0x84,
-0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0x85, 0x85,
-0x85, 0x85, 0x85, 0x72, 0x37, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
-0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x2E, 0x25, 0x25, 0x44, 0x25,
-0x25, 0x25, 0x25, 0x25, 0x85, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x85, 0xA5, 0xA5, 0xA5, 0xA5,
-0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x72, 0x57, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
-0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
-0x3B, 0x3B, 0x1B, 0x3B, 0x72, 0x25, 0x25, 0x44, 0x84, 0x85, 0x85, 0x65, 0x25, 0x5, 0x65, 0xA5, 0xA5, 0xA5, 0x85, 0x84,
-0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85,
-0x89, 0x72, 0x3B, 0x1B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x37, 0x37, 0x37, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
-0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x1B, 0x37, 0x72, 0x85, 0x25, 0x0, 0x64, 0x85, 0xA5,
-0xA5, 0x85, 0x25, 0x25, 0x44, 0x85, 0xA5, 0xA5, 0x84, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84,
-0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0xA5, 0xA5, 0xA5, 0x85, 0x8D, 0x3B, 0x1B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x49,
-0x49, 0x4D, 0x2E, 0x2E, 0x4D, 0x2E, 0x2D, 0x2E, 0x32, 0x2E, 0x32, 0x32, 0x32, 0x32, 0x32, 0x36, 0x32, 0x32, 0x32, 0x32,
-0x36, 0x56, 0x8E, 0xA5, 0x65, 0x25, 0x44, 0x84, 0xA5, 0xA5, 0xA5, 0x85, 0x45, 0x25, 0x0, 0x85, 0xA5, 0xA5, 0x84, 0xA5,
-0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0x85, 0x89,
-0x8D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x68, 0x49, 0x25, 0x25, 0x45, 0x65, 0x65,
-0x65, 0x65, 0x45, 0x45, 0x25, 0x69, 0xAD, 0xAD, 0x89, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0x89, 0xA9, 0xA9, 0xA9, 0xA9, 0x89,
-0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0x85, 0xA5, 0xA9, 0x89, 0x49, 0x8D, 0x56, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3B, 0x48,
-0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x28, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x69, 0xAD, 0xAD, 0xAD, 0xAD,
-0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x4A,
-0x8D, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4D, 0x4D, 0x4D, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x25, 0x25, 0x25, 0x45, 0x45, 0x25,
-0x25, 0x25, 0x25, 0x44, 0x25, 0x68, 0x8D, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x89, 0x8D, 0x8D, 0x8D,
-0x8D, 0x8D, 0x8D, 0x8D, 0xAD, 0xAD, 0x69, 0x89, 0x8D, 0x4A, 0x8D, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x28, 0x25, 0x0, 0x69, 0xAD, 0xAD, 0xB1, 0x8D, 0x4A, 0x4A, 0x25, 0x25, 0x25, 0x4A, 0x69, 0xAD, 0xAD,
-0xAD, 0xB1, 0xD1, 0xB1, 0xAD, 0x68, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x6A, 0x89, 0x8D, 0x4A,
-0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x25, 0x0, 0x89, 0xB1, 0xD1, 0xD1,
-0xAD, 0x4A, 0x4A, 0x44, 0x2A, 0x25, 0x4F, 0x6A, 0xAD, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x68, 0x0, 0x44, 0x44, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x8D, 0xB1, 0x6A, 0x89, 0x8D, 0x4A, 0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48,
-0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x28, 0x25, 0x0, 0xAD, 0xD1, 0xD1, 0xD1, 0xAD, 0x4E, 0x4F, 0x25, 0x4A, 0x25, 0x4F, 0x8E, 0xD1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x6A, 0x89, 0x8D, 0x4A,
-0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x25, 0x25, 0x44, 0xAD, 0xB1, 0xB1, 0xB1,
-0xAD, 0x6E, 0x4F, 0x25, 0x4A, 0x25, 0x2A, 0x8E, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x44, 0x44, 0x44,
-0x44, 0x44, 0x44, 0x0, 0x8D, 0xAD, 0x6A, 0x89, 0x8D, 0x69, 0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48,
-0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x48,
-0x28, 0x28, 0x28, 0x25, 0x25, 0x25, 0x45, 0x45, 0x45, 0x45, 0x44, 0x25, 0x29, 0x25, 0x25, 0x25, 0x2A, 0x8E, 0xD1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x8D, 0xAD, 0x6A, 0x89, 0x8D, 0x8D,
-0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x25, 0x25, 0x49, 0x69, 0x69, 0x69,
-0x69, 0x25, 0x2A, 0x25, 0x25, 0x25, 0x2A, 0x8E, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x44, 0x44, 0x44,
-0x44, 0x44, 0x44, 0x0, 0x8D, 0xAD, 0x69, 0x89, 0x8D, 0x8D, 0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x25, 0x25, 0x0, 0x45, 0x45, 0x25, 0x25, 0x25, 0x25, 0x25, 0x5, 0x25, 0x44, 0x25, 0x8D, 0xD1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x8D, 0xAD, 0x69, 0x8D, 0x8D, 0x8D,
-0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x25, 0x49, 0xB1, 0xB1, 0xAD, 0xAD,
-0xAD, 0xAD, 0xAD, 0x69, 0x45, 0x69, 0x25, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x25, 0x0, 0x49, 0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x8D, 0x25, 0x8D, 0x0, 0xAD, 0xD1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D,
-0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x0, 0x69, 0xD1, 0xD1, 0xD1, 0xD1,
-0xD1, 0xD1, 0xD1, 0x8D, 0x25, 0x8D, 0x0, 0x8D, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x25, 0x25, 0x25, 0x49, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xAD, 0xAD, 0x8D, 0x25, 0x69, 0x25, 0x8D, 0xD1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D,
-0x4D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x25, 0x25, 0x25, 0x5, 0x0, 0x0, 0x0,
-0x0, 0x25, 0x25, 0x25, 0x25, 0x49, 0x25, 0x69, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x68, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x8D, 0x8D, 0x6D, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x69, 0xD1, 0xD1,
-0xD1, 0xD1, 0xD1, 0xD1, 0xB2, 0xB2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xAD, 0x8D, 0x6D, 0x4D, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x0, 0x69, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-0x92, 0x92, 0x92, 0xB6, 0x92, 0x8D, 0x6D, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x25, 0x25, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x25, 0x25, 0x4D, 0x4D,
-0x4D, 0x4D, 0x4D, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6D, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x25, 0x25, 0x28, 0x28, 0x28, 0x28, 0x48, 0x92, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
-0xB6, 0xB6, 0xB6, 0x92, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x25, 0x25, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x25, 0x25, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x49, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x4D, 0x4D, 0x4D, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x25, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48,
-0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x48, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28 };
-
-const UG_BMP wifiPicture =
-{
-	(void*)wifiPictureTable,
-	70,
-	66,
-	BMP_BPP_8,
-	BMP_RGB332
-};
-
-//Generated by Gimp
-const uint8_t furnacePictureTable[9241] __attribute__ ((aligned (16))) = {
-"\256s\256s\256s\256s\256s\256s\256s\256s\256s\256s\317{\317{\317{\317{\317"
-"{\317{\317{\317{\317{\317{\317{E)\0\0\0\0\40\0A\10a\10\202\20\242\20\4!\4"
-"!\242\20\202\20\0\0iJ\20\204\357{\357{\357{\357{\357{\357{\357{\357{\357"
-"{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\317{\317{\317{\317{\317"
-"{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\216s\216s\256s\256s\256"
-"s\256s\256s\256s\256s\256s\256s\256s\317{\317{\317{\317{\317{\317{\317{\317"
-"{\256s$!\0\0\0\0\40\0A\10a\10\202\20\242\20\343\30\343\30\242\20\202\20\0"
-"\0iJ\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357"
-"{\357{\357{\357{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317"
-"{\317{\317{\317{\317{\256s\256s\216s\216s\216s\256s\256s\256s\256s\256s\256"
-"s\256s\256s\256s\256s\256s\317{\317{\317{\317{\317{\317{\256se)\0\0\0\0\40"
-"\0A\10a\10\202\20\242\20\343\30\343\30\242\20\202\20\0\0iJ\357{\357{\357"
-"{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\317{\317{\317{\317{\317"
-"{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\256s\256"
-"s\256s\256s\216s\216s\216s\216s\216s\256s\256s\256s\256s\256s\256s\256s\256"
-"s\256s\256s\256s\317{\317{\317{\317{\317{iJ\202\20\0\0\0\0A\10a\10\202\20"
-"\202\20\303\30\303\30\242\20\202\20\0\0iJ\357{\357{\357{\357{\357{\357{\357"
-"{\357{\357{\357{\357{\357{\357{\317{\317{\317{\317{\317{\317{\317{\317{\317"
-"{\317{\317{\317{\317{\317{\317{\256s\256s\256s\256s\256s\256s\256s\216s\216"
-"s\216s\216s\216s\216s\216s\256s\256s\256s\256s\256s\216s\216s\256s\256s\216"
-"s\216s\216s\216smk\212R\303\30A\10\202\20\242\20\242\20\303\30\303\30\343"
-"\30\4!\343\30\343\30\242\20\10BMkMk,c\14c\14c\14c\14c\14c\14c\14c\313Z\313"
-"Z\14c\216s\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\256"
-"s\256s\256s\256s\256s\256s\256s\256s\256s\216s\216s\216s\216s\216s\216s\216"
-"s\216s\256s\256s\256s,c\3479\3079\3079\3079\2461\2061\2061\2061\2061e)$!"
-"E)E)E)E)E)E)E)E)E)E)E)E)E)E)$!$!$!$!$!$!$!E)$!$!$!\2061iJMk\256s\317{\317"
-"{\317{\317{\317{\317{\256s\256s\256s\256s\256s\256s\256s\256s\256s\256s\256"
-"s\256s\216s\216s\216s\216s\216s\216s\216s\216s\216s\256s,c\3079E)E)E)E)E"
-")E)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)E)e)\347"
-"9\313Zmk\256s\317{\317{\256s\256s\256s\256s\256s\256s\256s\256s\256s\256"
-"s\256s\256s\256s\216s\216s\216s\216s\216s\216s\216s\216s\256s,c\3079E)e)"
-"e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)\2061\2061\2061\2061\206"
-"1\2061\2061\2061\2061\2061\2061\2061\2061\2061e)e)\2461IJ\14c\216s\256s\256"
-"s\256s\256s\256s\256s\256s\256s\256s\256s\256s\216s\216smkmk\216s\216s\216"
-"s\216s\216s\216s,c\3079E)e)e)e)e)e)e)e)e)e)e)e)\2061\2061\2061\2061\2061"
-"\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\206"
-"1\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\347"
-"9iJ,c\216s\256s\256s\256s\256s\256s\256s\216s\216s\216s\216smkmkmkmk\216"
-"s\216s\216s,c\3079e)e)\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061"
-"\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\206"
-"1\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\246"
-"1\2461\2461\2461\2461\2461\2061\2061\2461(B\313ZMk\256s\256s\256s\216s\216"
-"s\216s\216s\216smkmkmkmkmk\216s\14c\3079e)\2061\2061\2061\2061\2061\2061"
-"\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\206"
-"1\2061\2061\2061\2061\2061\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
-"1\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
-"1\2061\3079iJ\14cmk\216s\216s\216s\216s\216smkmkmkmk\216s\14c\3479e)\206"
-"1\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\206"
-"1\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
-"1\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
-"1\2461\2461\2461\2461\2461\2461\2461\2461\2461\2061\10B\212R,c\216s\216s"
-"\216smkmkmkmk\14c\3479\2061\2061\2061\2061\2061\2061\2061\2061\2461\2461"
-"\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
-"1\2461\2461\2461\2461\2461\2461\2461\2061\2061\2461\2461\2461\2061\2061\206"
-"1\2061\2061\2061\2061\2061\2061e)\2061e)\2061e)\2461\2061\2061\2061e)\10"
-"Be)e)E)\212R\216s\216s\216smkmkmk\14c\3079\2061\2061\2061\2061\2061\2061"
-"\2061\2061e)e)\2061\2061\2061e)e)e)\2061\2061e)e)e)\2061e)e)\2061e)e)e)e"
-")\10Be)e)e)\2461(Be)e)e)\3479IJe)e)\2061\212R\3079e)e)\10B,c\2461e)e)\14"
-"ciJe)e)\10B\216s\3079\2061E)\252R\216smkmkmkmkmk\313ZE)e)e)E)\10B\3079E)"
-"e)e)\3479\212Re)e)e)\3479\313Z\2061e)e)\3479\14c\3079e)e)\3079\14c\3479e"
-")e)\10B\216s\3079e)e)(B,c\3079e)e)iJ\252Re)e)\2061\252R\10Be)e)\2461IJe)"
-"\2061e)IJ\10Be)\2061\2461(Be)e)e)\14c\216smkmkMkMkmk\14ce)e)e)e)\14c\252"
-"RE)e)E)IJ\353Ze)e)e)\3079\212R\2061e)e)\2061\252R\2461e)e)\2061\3479e)e)"
-"e)e)\3079e)e)e)e)\2061E)e)e)e)e)E)e)E)e)E)$!$!$!$!\4!\4!\4!\343\30\343\30"
-"\343\30\343\30\303\30\303\30\303\30\242\20\252RmkmkmkmkMkMkMk,c\2461E)e)"
-"E)\2061\2061e)e)e)E)e)E)e)E)E)$!E)E)E)$!$!$!$!\4!\4!\4!\343\30\343\30\343"
-"\30\343\30\303\30\303\30\343\30\343\30\343\30\343\30\303\30\303\30\343\30"
-"\343\30\343\30\343\30\4!\4!\343\30\4!\4!\4!E)E)E)E)E)E)E)E)E)E)E)e)\3079"
-"MkmkmkmkmkMkMkMkMk\252R$!\303\30\303\30\303\30\303\30\343\30\343\30\343\30"
-"\343\30\303\30\303\30\343\30\343\30\303\30\303\30\343\30\343\30\343\30\4"
-"!\4!\4!E)E)E)E)E)E)E)E)E)E)E)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e"
-")e)e)e)e)e)\3479MkmkmkmkmkMkMkMkMkMk\3479$!$!E)E)E)E)E)E)E)E)E)E)E)E)E)e"
-")e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e"
-")e)e)e)e)e)e)iJmkmkmkMkMkMkMkMkMkMkIJE)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e"
-")e)e)e)e)e)e)e)e)\2061\2061\2461\3079\3479\3479\3479\3079\3079\2461e)e)e"
-")e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)E)\212RmkMkMkMkMkMkMkMkMkMk\252RE)e"
-")e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)\2461\3079\3479(BIJIJIJiJiJiJ"
-"iJiJiJIJ(B\10B\2461\2061e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)\353ZmkMkMkMkM"
-"k,c,cMkMkMk\353ZE)E)E)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)\2461\10B(BIJI"
-"J(B(B\10B\10B\3479\3479\3479\3479\3479\3479\10B(BIJIJ(B\3079e)e)e)e)e)e)"
-"e)e)e)e)e)e)e)e)e)e)\14cMkMkMkMkMk,c,c,c,cMk\353ZE)E)E)E)E)E)e)e)e)e)e)e"
-")e)e)e)e)e)e)e)\2461\3479\10B(B\10B\3479\3079\3079\3079\3079\3079\3079\307"
-"9\3079\3079\3079\3079\3079\3079\3079\3479\10B(B\10B\2461e)e)e)e)e)e)e)e)"
-"e)e)e)e)e)\3079,cMkMkMkMkMk,c,c,c,c,c\14c\2061E)E)E)E)E)E)E)E)e)e)e)e)e)"
-"e)e)e)e)\3079\10B\10B\3479\3079\3079\3079\3079\2461e)e)$!\4!\343\30\343\30"
-"\343\30\4!$!E)\2061\3079\3079\3079\3079\10B(B\3479e)e)e)e)e)e)e)e)e)e)e)"
-"E)\10BMkMkMkMk,c,c,c,c,c,c,c,c\3479E)E)E)E)E)E)E)E)E)E)E)E)e)e)E)e)\3079"
-"\3479\3479\3079\3079\3079\2461e)\4!\202\20\202\20\343\30\4!$!$!$!$!\4!\303"
-"\30A\10A\10\303\30$!\2061\3079\3079\3079\10B\3479e)e)e)e)e)e)e)e)e)e)E)I"
-"JMkMk,c,c,c,c,c,c,c,c,c,c\3479E)E)E)E)E)E)E)E)E)E)E)E)E)E)e)\3079\3479\307"
-"9\3079\3079\2061$!\343\30\4!\2061\2461\2461\2461\2461\2461\3079\3079\307"
-"9\2461\2461\2461\2461$!A\10A\10\4!\2461\3079\3079\3479\3479e)e)e)e)e)e)e"
-")e)e)E)\252RMk,c,c,c,c,c,c,c,c,c,c\353Ze)E)E)E)E)E)E)E)E)E)E)E)E)E)e)\246"
-"1\3079\3079\3079\2461E)\4!\2061\2461\2461\3079\3079\3079\3079\3079\3079\307"
-"9\3079\3079\3079\3079\3079\3079\3079\2461E)a\10a\10e)\3079\3079\3479\206"
-"1e)e)e)e)e)e)e)e)E)\313Z,c,c,c,c,c,c\14c\14c,c,c\14ciJ\4!E)E)E)E)E)E)E)E"
-")E)E)E)E)E)\2061\3079\3079\3079\2061\4!E)\2461\3079\3079\3079\3079\3079\307"
-"9\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\2461\343"
-"\30A\10e)\3079\3079\3079e)e)e)e)e)e)e)e)\2061\14c,c,c,c,c,c,c\14c\14c\14"
-"c\14c\14cE)A\10E)E)E)E)E)E)E)E)E)E)E)E)E)\2461\2461\3079\2061\4!\2061\246"
-"1\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\307"
-"9\3079\3079\3079\3079\3079\3079\2461\343\30\202\20\2461\3079\3079\2061e)"
-"e)e)e)e)e)E)\2461\14c,c,c,c,c\14c\14c\14c\14c\14c\14c\313Z\343\30\0\0$!E"
-")E)E)E)E)E)E)E)E)E)$!e)\2461\2461\2461\2461\2461\2461\2461\2461\2461\307"
-"9\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\307"
-"9\3079\3079\3079\3079\2461\303\30$!\3079\3079\2061E)e)e)e)e)e)E)(B,c,c\14"
-"c\14c\14c\14c\14c\14c\14c\14c\353Ze)\40\0\0\0\4!E)E)E)E)E)$!$!$!$!E)$!\206"
-"1\2461\2461e)\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
-"1\2461\2461\2461\2461\2461\3079\3079\3079\3079\3079\3079\3079\3079\3079\307"
-"9e)\242\20\2461\3079\2461E)E)E)E)E)E)E)IJ\14c\14c\14c\14c\313Z\252Z\252Z"
-"\14c\14c\14c\313Z\343\30\0\0\0\0\343\30E)\4!\202\20a\10A\10A\10A\10\4!\303"
-"\30E)$!\2461\2461\2461\2461\2461\2461\2461\2461\2461\3079\3079\3079\3079"
-"\3479\3479\3479\3479\10B\10B\10B\10B\10B\10B\3479\3479\3479\3479\3079\307"
-"9\3079\3079\2461\343\30\2461\3079\2061E)E)E)E)E)E)E)eA\205Q$I#I\306Q\306"
-"I`@\200H\14c\14c\353ZIJ\303\30\0\0\0\0\303\30E)\303\30$!\303\30\0\0\40\0"
-"a\10e)\242\20\4!$!\2461\2461\2461\2461\2461\2461\2461\2461\2461\3479\347"
-"9\3079\3079\2461\2461\2061\2061e)E)E)e)E)\343\30\242\20\242\20A\10E)\246"
-"1\2461\2461\2461\3079E)\2461\3079\2061E)E)E)E)E)E)E)\302@`H\200H\200H\200"
-"H\246I\246I\3I\353Z\353Z\353Z$!\40\0\0\0\0\0\202\20E)\303\30\0\0\0\0\0\0"
-"\40\0\0\0A\10a\10\242\20E)\2461\2461\2461\2461\2461\2461\2461\2461E)$!\343"
-"\30$!$!$!$!$!$!$!$!E)e)E)\242\20a\10\40\0\0\0E)\2461\2461\2461\2461\2461"
-"\4!\2461\2461\2061E)E)E)E)E)E)E)\240H\200H\200H\200H\200H`H#I\7R\353Z\353"
-"Z\252R\343\30\0\0\0\0\0\0\40\0$!\343\30\303\30\343\30\0\0\0\0\0\0E)\4!\242"
-"\20$!\2461\2461\2461\2461\2461\2461\2461\2461E)\4!\4!$)$)$!$)$!$!$)$)e1e"
-"1E)\242\20A\10\40\0\0\0e)\2461\2461\2461\2461\2461\4!\2461\2461e)E)E)E)E"
-")E)E)D1\240H\200H\200H\200H\200H\200H`H#Q\306I\246IE9A\20\0\0\0\0\0\0\0\0"
-"\4!\4!A\10A\10\0\0\0\0E)(B(B\3079$!\2461\2461\2461\2461\2461\2461\2461\246"
-"1E)$!\4!e9dIDA\204I$A\245Q\204Q\244Y&j\306Qe)\303\30A\10A\10\40\0\2061\246"
-"1\2461\2461\2461\2461\4!\2461\2461e)E)E)E)E)E)E)\4""9\200H\200H\200H\200"
-"H\200H\200H\200H`H@@@8\0\20\0\0\0\0\0\0\0\0\0\0\343\30$!\343\30\303\30\0"
-"\0\303\30$!\343\30\242\20a\10\343\30\2461\2461\2461\2461\2461\2461\2461\246"
-"1E)$!dQf\212F\212\306\232'\243\346\232\311\263\351\303\351\303\213\314\211"
-"\263eA\343\30A\10\40\0\0\0e)\2461\2461\2461\2461\2461$!\2461\2461E)E)E)E"
-")E)E)E!\3""9\200P\240H\240H\240H\240H\240H\240H\240H\200@@0\0\10\0\0\0\0"
-"\0\0\0\0\0\0\303\30E)$!$!A\10$!e)\242\20\303\30a\10\303\30\2461\2461\246"
-"1\2461\2461\2461\2461\2461E)D1\347\222M\355\216\355p\376p\376\221\376\22"
-"\377s\377s\377s\377\22\377(\213\343\40A\0\40\0\40\0\2061\2461\2461\2461\246"
-"1\2061$!\2461\2461E)E)\303\30$!E)E)E)\342@\200P\200P\200P`P`H`H\200H\240"
-"P`@\0\30\0\0\0\0\0\0\0\0\0\0\0\0a\10E)E)E)\4!\4!\2061$!$!\242\20\242\20\246"
-"1\2461\2461\2461\2461\2461\2461\2461%!fb\216\345\265\377\365\377\365\377"
-"\366\377\371\377\371\377\371\377\373\377\373\377\372\377o\355$AA\10\0\0A"
-"\10\2061\2461\2461\2461\2461E)$!e)E)\343\30\303\30\0\0\40\0\303\30$!E)eI"
-"\205Q#QdQ\205Q\306Y\306Y\347Y\347Y@8\0\20\0\0\0\0\0\0\0\0\0\0\0\0A\10$!E"
-")E)$!\303\30\2061E)$!\303\30a\10\2061\2461\2061\2461\2461\2461\2461\2461"
-"\4\21+\254\367\377\376\377\377\377\375\377\377\377\377\377\377\377\377\377"
-"\377\377\377\377\377\377\374\377\312\243A\10\0\0a\10\2061\2461\2461\2061"
-"\303\20A\30\0\10\0\0\0\0\0\0\0\0\0\0e)\10B\343\30E1\306Y\306Y#Q#Q\3Q#Q\341"
-"P\300P\240P\0\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\40\0$!$!$!$!\303\30\2061E)$"
-"!\343\30A\10\2061\2461\2061\2461\2461\2461\2461\2461#\0\360\274\375\377\377"
-"\377\377\377\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377"
-"\377\377\377p\345\3428\0\0\202\20\2061\2461\2061\4!\0\10\0""8\0""8\4!E)\0"
-"\0\40\0\0\0a\10$!\343\30\4""1`P\200P\240P\240P\240P\240P\240P\240P\240P\0"
-"\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4!$!$!$!\343\30\2061E)$!\4!\40\0e)\246"
-"1\2061\2061\2461\2461\2461\2461\2\0\322\325\377\377\377\377\377\377\377\377"
-"\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\370\377"
-"\246r\0\0\242\20\2061\2461E)\0\0\0\0\0(\0@\3430\206)\0\0\0\0\40\0\303\30"
-"\4!$!\246A\3Q\240P\240P\240P\240P\240P\240P\240P\240P\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\343\30$!$!$!\303\30e)e)$!$!\40\0e)\2461\2061\2061\2061\206"
-"1\2061\2461\1\0q\305\370\377\221\345s\325\375\377\26\336\377\377W\377\377"
-"\377\324\376\260\244Lko\244\373\377\213\213\0\0\303\30\2461\2461E)\0\0\0"
-"\0\0\20\0(a\40\343\40\0\0\0\0a\10$!E)$!\347I\7R`P\240P\240P\240P\240P\240"
-"P\240P\240P\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\242\20$!$!$!\303\30E)e)$"
-"!$!\0\0$!\2061\2061\2061\2061\2061\2061\2461\204\0,\234o\315\263\376\375"
-"\377T\255\234\3772\305r\376\376\377\24\377W\377*{\306\222\23\377({\0\0\303"
-"\30\2461\2461\2061a\10\40\0\40\20\0""0\2428\343(\0\0\40\0\242\20$!E)E!\342"
-"H\252bHb`P\240P\240P\240P\240P\240P\240P\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0a\10$!$!$!\343\30$!\2061$!$!\40\0$!\2061\2061\2061\2061\2061\2061\206"
-"1%\31\212\2135\377\224\377u\377(\213\357\314i\253*\304\17\325\7\203J{\204"
-"I\341P\347r\2)A\10\343\30\2461\2461e)\40\0\303\30\303\30\40\40E1$!\242\20"
-"\4!$!$!$!$)\240PDY\353j(Z`P\240P\240P\240P\240P\240P\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\40\0$!$!$!\4!\4!\2061$!$!\40\0\343\30\2061\2061\2061\206"
-"1\2061\2061\2061e)\203\30\10{\7{\10{#1\244IcA\305I\6Re9e)\2061\3069\3079"
-"\3479\3079E)\2461\2061E)\0\0\303\30\242\20a\10\2061E)$!$!$!$!$!$)\300P`P"
-"DY\212bDQ`P\240P\240P\240P\240P\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4"
-"!$!$!$!\343\30\2061$!$!\202\20\343\30\2061\2061\2061\2061\2061\2061\2061"
-"e)e)\3069\3079\347A\3479\3479\10B\10B\10B\3479\3479\3479\3479\3079\2461\206"
-"1e)\2061\2061\343\30\0\0\4!\242\20\242\20e)$!$!$!$!$!$!\3""9\240X\240X`P"
-"Hb\13kDY\200X\240X\240X\240Xa\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\343"
-"\30$!$!$!\242\20\2061$!$!\303\30\242\20\2061\2061\2061\2061\2061\2061\206"
-"1e)e)\3079\3079\2461\2061e)e)E)E)E)E)$!$!E)E)E)e)\2061e)A\10\0\0$!$!\206"
-"1e)$!$!$!$!$!$!\3A\240X\240X\240X`Xib\353j\300P\240X\240X\240X\3079\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\303\30$!$!$!\303\30e)E)$!\303\30\202\20\206"
-"1\2061\2061\2061\2061\2061\2061e)$!$!\4!$!E)E)e)e)e)\2061\2061\2061\2061"
-"\2461\3079\3079\3079\3079\2461\303\30\343\30\2461\2061\2061e)$!$!$!$!$!$"
-"!\342H\240X\240X\240X\240X`X\212bIZ`P\240X\240X\211R\0\20\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\242\20$!$!$!\303\30E)E)\4!\4!A\10e)\2061\2061\2061\2061"
-"\2061\2061\2061\2061\2061\2061\2461\2461\3079\3079\3079\3079\3479\3479\347"
-"9\3079\3079\3079\3079\2461\2461\2461\2061\2061\2061\2061\2061E)$!$!$!$!$"
-"!$!\342H\240X\300X\300X\300X\200XDY\14kIb\0X`XeQ@@\0\20\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0a\10$!$!$!\343\30E)\10B(BIJ$!E)\2061\2061\3079\3079\3079\3479\347"
-"9\3079\3079\3079\3079\3079\2461\2461\2461\2061\2061\2061\2061\2061\2061\206"
-"1\2061\2061\2061\2061\2061e)e)E)e)E)$!$!$!$!$!\4)`P\200X\300X\2YDY\205Y\246"
-"Y\211b\256s\353j\252j\200P\240H@0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\40\0\4!\4!"
-"\242\20a\10\343\30e)$!\4!a\10E)\2061\2061\2461\2461\2061\2061\2061\2061\206"
-"1\2061\2061\2061\2061\2061\2061\2061e)e)e)E)E)$!$!$!E)E)\2061\2461\3079\347"
-"9(B\3079$!$!$!$!$!\2461\212b\353j\353j\212b\211b\252j\211jib\312jms\347Y"
-"`P\240P\200H\40\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\343\30\343\30\242\20\303\30"
-"\0\0\0\0\0\0\0\0\0\0$!\2061\2061\2061\2061\2061\2061e)e)E)E)$!$!$!$!$!E)"
-"\2061\3079\3479\10BIJiJ\212R\252R\252R\252R\252R\252R\212R\212RIJe)$!$!$"
-"!$!$!DA\245a\205a#Y\200X\200X\200X`X`X@Xij\14s\240P\240P\240P\200@\0\20\0"
-"\0\0\0\0\0\0\0\0\0\0\0\303\30\343\30A\10\202\20\0\0\0\0\202\20\4!\0\0\343"
-"\30E)$!$!$!\4!$!E)\2461\3079\10B(BIJ\212R\252R\313Z\313Z\313Z\353Z\353Z\313"
-"Z\252R\212RiJIJ(B\10B\3079\2061e)E)$!\4!$!$!$!$!$!\343@\300X\300X\300X\300"
-"X\300X\300X\300X\300X\240X`X\212j\240P\240P\240P\240P@0\0\10\0\0\0\0\0\0"
-"\0\0\0\0\242\20\4!\242\20\4!\0\0\0\0a\10\343\30\242\20\2061\3479\10B(BIJ"
-"iJ\212R\252R\252R\252R\252R\252R\252RiJIJ(B\10B\3479\3079\2061E)$!\4!\343"
-"\30\343\30\343\30\343\30\343\30\343\30\4!\4!$!$!$!$!$!$!$!\342P\300X\300"
-"X\300X\300X\300X\300X\300X\300X\300X\240XCa\240P\240P\240P\240P\240P@(\0"
-"\0\0\0\0\0\0\0\0\0a\10\4!\242\20a\10\0\0\202\20\343\30\4!A\10$!\10BIJIJ("
-"B(B\3479\3079\2461\2061e)E)\4!\343\30\343\30\343\30\343\30\343\30\343\30"
-"\4!\4!\4!\4!\4!$!$!$!$!$!\4!$!\4!$!$!$!$!$!$!\301P\300X\300X\300X\300X\300"
-"X\300X\300X\300X\300X\300X\200X\40P@P`P\240P\341P$A\202\30\0\0\0\0\0\0\0"
-"\0\40\0\4!\4!\343\30\202\20\343\30\4!\4!A\10\242\20\343\30$!\4!\343\30\303"
-"\30\303\30\343\30\343\30\343\30\4!\4!\4!\4!\4!$!$!$!$!$!\4!\4!e)$!\4!$!$"
-"!$!$!\4!\4!\4!\4!$!$!$!$!\4)\300X\300X\300X\300X\300X\300X\300X\300X\300"
-"X\300X\300X\300X\212b\252b\313b\353b\353j\252beA\0\10\0\0\0\0\0\0\0\0\4!"
-"\4!\4!\4!\4!\4!\4!\202\20\242\20\343\30$!$!\4!\4!\4!$!$!$!\4!e)$!\4!\4!\4"
-"!\343\30\303\30\303\30\303\30\343\30$!\3079\3479\2061$!$!E)e)\4!\4!\4!\4"
-"!\4!\4!\4!\4!\4""1\300X\300X\300X\300X\300X\300X\300X\300X\300X\300X\300"
-"X\300X\347Y\245YdY#Y\301P\240P`P@0\0\0\0\0\0\0\0\0\343\30\4!\4!\4!\4!\4!"
-"\4!\242\20\202\20\303\30\4!$!\4!\4!\4!\4!\4!\4!\343\30E)e)\2061\3479(B\212"
-"R\353Z,cMk,cMkmkMkiJ\2061\2061\2061e)$!\4!\4!\4!\4!$!$!$!$1\300X\300X\300"
-"X\300X\300X\300X\300X\300X\300X\300X\300X\300X\240P\240P\240P\240P\240P\240"
-"P\240X\240P\40\40\0\0\0\0\0\0\303\30\4!\4!\4!\4!\4!\4!\303\30\202\20\303"
-"\30\4!$!\4!\4!\4!$!$!E)\313Z\14cMkMkMk,c\313Z\212R(B\3479E)\303\30\40\0\40"
-"\0\202\20\303\30\242\20\202\20a\10A\10\202\20$!E)E)e)E)$!$!\341X\300X\300"
-"X\300X\300X\300X\300X\300X\300X\300X\300X\300X\240P\240P\240P\240P\240X\240"
-"X\240X\240X\200H\0\20\0\0\0\0\242\20\4!\4!\4!\4!\4!\4!\303\30a\10\303\30"
-"\4!$!e)\2061\2061\2461e)\343\30\2461E)\303\30\40\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\40\0\202\20E)\242\20\343\30\3479E)\4!\3079e)\4"
-"!\4)\300X\300`\300X\300`\300`\300`\300`\300`\300`\300`\300`\300`\240P\240"
-"P\240X\240X\240X\240X\240X\240X\240P@0\0\0\0\0a\10\4!\4!\4!\4!\4!\4!\343"
-"\30a\10\303\30\4!\4!$!\4!\4!\343\30\202\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\40\0\343\30\343\30\3079\2461\4!E)\3479$!\4!\2461$!\343"
-"\20\343\20\242\20\3020\341P\300`\300`\300`\300`\300`\300`\300`\300`\300`"
-"\300`\300`\300`\240X\240X\240X\240X\240X\240X\240X\240X\300X\240P\40\40\0"
-"\0\40\0\4!\4!\4!\4!\4!\4!\4!\40\0A\10a\10A\10\0\0\40\0\0\0\0\0\0\0\0\0\0"
-"\0\0\0\0\0\0\0\0\0\0\0\0\0\40\0\40\0A\10\202\20\343\30\4!\343\40E)\4!\303"
-"\40\242\30@\30\343\40$1\0""0`8\200@\240H\240P\240X\300`\300`\300`\300`\300"
-"`\300`\300`\300`\300`\300`\300`\300`\300`\240X\240X\240X\240X\240X\240X\240"
-"X\240X\300X\300X\200H\0\30\40\0\4!$!$!$!$!$!$!\303\30a\10\202\20e)$!\303"
-"\30\303\30\4!\40\0\40\0a\10\202\20\202\20\202\20\242\30\303\30\242\30\242"
-"\20\302\40\202\30\202\30\201(`0`8`8\200H\240X\240X\200X\212j\216s#Y\300`"
-"\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300"
-"`\300`\300`\240X\240X\240X\240X\240X\240X\300X\300X\300X\300X\240X`@a\20"
-"$!$!E)\3479\4!\4!\2061\10B\4!\4!\3079\2061\4!\343\40$)\303\30\242\30\242"
-"\30\202\30a\30`(`0`8`@\200H\240P\240X\240X\300X\300X\300X\300X\300X\300`"
-"\300`\240`\245a\357{ib\200`\300`\300`\300`\300`\300`\300`\300`\300`\300`"
-"\300`\300`\300`\300`\300`\300`\300`\300`\240X\240X\240X\240X\300X\300X\300"
-"X\300X\300X\300X\300X\240Pa\30\4!\4!$!\3479\343\30\343\30\4!$!\343\30$!A"
-"\30\201(\2010`0`8`@\200H\240P\240X\240X\300X\300X\300X\300X\300X\300`\300"
-"`\300`\300`\300`\300`\300`\300`\300`\300`\300`\200`Ms\215s\300X\300`\300"
-"`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300"
-"`"
-};
-
-const UG_BMP furnacePicture =
-{
-	(void*)furnacePictureTable,
-	70,
-	66,
-	BMP_BPP_16,
-	BMP_RGB565
-};
-
-const UG_COLOR colorMenuTable[2] = { C_BLACK, C_WHITE_SMOKE };
-const uint8_t optionsPictureTable[30] = { 0xE1, 0xFF, 0x2D, 0xC0, 0x2D, 0xC0, 0xE1, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x2D, 0xC0, 0x2D, 0xC0, 0xE1, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x2D, 0xC0, 0x2D, 0xC0, 0xE1, 0xFF, 0xFF, 0xFF };
-
-const UG_BMP optionsPicture =
-{
-	(void*)optionsPictureTable,
-	16,
-	15,
-	BMP_BPP_1,
-	BMP_MONO,
-	(void*)colorMenuTable
-};
-
-const uint8_t closePictureTable[57] = { 0xFF, 0xFF, 0x1F, 0xE3, 0xFF, 0x18, 0xC3, 0x7F, 0x18, 0x83, 0x3F, 0x18, 0x7, 0x1F, 0x1C, 0xF, 0xE, 0x1E, 0x1F, 0x4, 0x1F, 0x3F, 0x80, 0x1F, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x1F, 0x7F, 0xC0, 0x1F, 0x3F, 0x80, 0x1F, 0x1F, 0x4, 0x1F, 0xF, 0xE, 0x1E, 0x7, 0x1F, 0x1C, 0x83, 0x3F, 0x18, 0xC3, 0x7F, 0x18, 0xE3, 0xFF, 0x18, 0xFF, 0xFF, 0x1F};
-
-const UG_BMP closePicture =
-{
-	(void*)closePictureTable,
-	21,
-	19,
-	BMP_BPP_1,
-	BMP_MONO,
-	(void*)colorMenuTable
-};
-
-const uint8_t incrementMinuteHourPictureTable[90] = { 0xFF, 0xFF, 0xFD, 0xFF, 0x7, 0xFF, 0xFF, 0xF8, 0xFF, 0x7, 0xFF, 0x7F, 0xF0, 0xFF, 0x7, 0xFF, 0x3F, 0xE0, 0xFF, 0x7, 0xFF, 0x1F, 0xC0, 0xFF, 0x7, 0xFF, 0xF, 0x80, 0xFF, 0x7, 0xFF, 0x7, 0x0, 0xFF, 0x7, 0xFF, 0x3, 0x0, 0xFE, 0x7, 0xFF, 0x1, 0x0, 0xFC, 0x7, 0xFF, 0x0, 0x0, 0xF8, 0x7, 0x7F, 0x0, 0x0, 0xF0, 0x7, 0x3F, 0x0, 0x0, 0xE0, 0x7, 0x1F, 0x0, 0x0, 0xC0, 0x7, 0xF, 0x0, 0x0, 0x80, 0x7, 0x7, 0x0, 0x0, 0x0, 0x7, 0x3, 0x0, 0x0, 0x0, 0x6, 0x1, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0};
-
-const UG_BMP incrementMinuteHourPicture =
-{
-	(void*)incrementMinuteHourPictureTable,
-	35,
-	18,
-	BMP_BPP_1,
-	BMP_MONO,
-	(void*)colorMenuTable
-};
-
-const uint8_t decrementMinuteHourPictureTable[90] = { 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x4, 0x3, 0x0, 0x0, 0x0, 0x6, 0x7, 0x0, 0x0, 0x0, 0x7, 0xF, 0x0, 0x0, 0x80, 0x7, 0x1F, 0x0, 0x0, 0xC0, 0x7, 0x3F, 0x0, 0x0, 0xE0, 0x7, 0x7F, 0x0, 0x0, 0xF0, 0x7, 0xFF, 0x0, 0x0, 0xF8, 0x7, 0xFF, 0x1, 0x0, 0xFC, 0x7, 0xFF, 0x3, 0x0, 0xFE, 0x7, 0xFF, 0x7, 0x0, 0xFF, 0x7, 0xFF, 0xF, 0x80, 0xFF, 0x7, 0xFF, 0x1F, 0xC0, 0xFF, 0x7, 0xFF, 0x3F, 0xE0, 0xFF, 0x7, 0xFF, 0x7F, 0xF0, 0xFF, 0x7, 0xFF, 0xFF, 0xF8, 0xFF, 0x7, 0xFF, 0xFF, 0xFD, 0xFF, 0x7 };
-
-const UG_BMP decrementMinuteHourPicture =
-{
-	(void*)decrementMinuteHourPictureTable,
-	35,
-	18,
-	BMP_BPP_1,
-	BMP_MONO,
-	(void*)colorMenuTable
-};
-
-const uint8_t smallIncrementPictureTable[14] = { 0xBF, 0x1F, 0x1F, 0x1F, 0xF, 0x1E, 0x7, 0x1C, 0x3, 0x18, 0x1, 0x10, 0x0, 0x0 };
-
-const UG_BMP smallIncrementPicture =
-{
-	(void*)smallIncrementPictureTable,
-	13,
-	7,
-	BMP_BPP_1,
-	BMP_MONO,
-	(void*)colorMenuTable
-};
-
-const uint8_t smallDecrementPictureTable[14] = { 0x0, 0x0, 0x1, 0x10, 0x3, 0x18, 0x7, 0x1C, 0xF, 0x1E, 0x1F, 0x1F, 0xBF, 0x1F };
-
-const UG_BMP smallDecrementPicture =
-{
-	(void*)smallDecrementPictureTable,
-	13,
-	7,
-	BMP_BPP_1,
-	BMP_MONO,
-	(void*)colorMenuTable
-};
-
-const uint8_t moveHistoryGraphLeftPictureTable[105] = { 0xFF, 0xFF, 0x1, 0xFF, 0xFF, 0x0, 0xFF, 0x7F, 0x0, 0xFF, 0x3F, 0x0, 0xFF, 0x1F, 0x0, 0xFF, 0xF, 0x0, 0xFF, 0x7, 0x0, 0xFF, 0x3, 0x0, 0xFF, 0x1, 0x0, 0xFF, 0x0, 0x0, 0x7F, 0x0, 0x0, 0x3F, 0x0, 0x0, 0x1F, 0x0, 0x0, 0xF, 0x0, 0x0, 0x7, 0x0, 0x0, 0x3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x3, 0x0, 0x0, 0x7, 0x0, 0x0, 0xF, 0x0, 0x0, 0x1F, 0x0, 0x0, 0x3F, 0x0, 0x0, 0x7F, 0x0, 0x0, 0xFF, 0x0, 0x0, 0xFF, 0x1, 0x0, 0xFF, 0x3, 0x0, 0xFF, 0x7, 0x0, 0xFF, 0xF, 0x0, 0xFF, 0x1F, 0x0, 0xFF, 0x3F, 0x0, 0xFF, 0x7F, 0x0, 0xFF, 0xFF, 0x0, 0xFF, 0xFF, 0x1 };
-
-const UG_BMP moveHistoryGraphLeftPicture =
-{
-	(void*)moveHistoryGraphLeftPictureTable,
-	18,
-	35,
-	BMP_BPP_1,
-	BMP_MONO,
-	(void*)colorMenuTable
-};
-
-const uint8_t moveHistoryGraphRightPictureTable[105] = { 0xFE, 0xFF, 0x3, 0xFC, 0xFF, 0x3, 0xF8, 0xFF, 0x3, 0xF0, 0xFF, 0x3, 0xE0, 0xFF, 0x3, 0xC0, 0xFF, 0x3, 0x80, 0xFF, 0x3, 0x0, 0xFF, 0x3, 0x0, 0xFE, 0x3, 0x0, 0xFC, 0x3, 0x0, 0xF8, 0x3, 0x0, 0xF0, 0x3, 0x0, 0xE0, 0x3, 0x0, 0xC0, 0x3, 0x0, 0x80, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x3, 0x0, 0x80, 0x3, 0x0, 0xC0, 0x3, 0x0, 0xE0, 0x3, 0x0, 0xF0, 0x3, 0x0, 0xF8, 0x3, 0x0, 0xFC, 0x3, 0x0, 0xFE, 0x3, 0x0, 0xFF, 0x3, 0x80, 0xFF, 0x3, 0xC0, 0xFF, 0x3, 0xE0, 0xFF, 0x3, 0xF0, 0xFF, 0x3, 0xF8, 0xFF, 0x3, 0xFC, 0xFF, 0x3, 0xFE, 0xFF, 0x3 };
-
-const UG_BMP moveHistoryGraphRightPicture =
-{
-	(void*)moveHistoryGraphRightPictureTable,
-	18,
-	35,
-	BMP_BPP_1,
-	BMP_MONO,
-	(void*)colorMenuTable
-};
-
-const uint8_t upWifiNetworkTable[30] = { 0xDF, 0x7, 0xDF, 0x7, 0x8F, 0x7, 0x8F, 0x7, 0x8F, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x3, 0x6, 0x3, 0x6, 0x1, 0x4, 0x1, 0x4, 0x1, 0x4, 0x0, 0x0, 0x0, 0x0 };
-
-const UG_BMP upWifiNetwork =
-{
-	(void*)upWifiNetworkTable,
-	11,
-	15,
-	BMP_BPP_1,
-	BMP_MONO,
-	(void*)colorMenuTable
-};
-
-const uint8_t downWifiNetworkTable[30] = { 0x0, 0x0, 0x0, 0x0, 0x1, 0x4, 0x1, 0x4, 0x1, 0x4, 0x3, 0x6, 0x3, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8F, 0x7, 0x8F, 0x7, 0x8F, 0x7, 0xDF, 0x7, 0xDF, 0x7 };
-
-const UG_BMP downWifiNetwork =
-{
-	(void*)downWifiNetworkTable,
-	11,
-	15,
-	BMP_BPP_1,
-	BMP_MONO,
-	(void*)colorMenuTable
-};
+/*
+ * Copyright (c) 2018, Adrian Chemicz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDER BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "image.h"
+
+const uint8_t homePictureOutsideTable[4620] = { 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x13, 0x13, 0x13, 0x13, 0x33, 0x33, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13,
+0x33, 0x33, 0x52, 0x52, 0x6E, 0x4A, 0x69, 0x69, 0x6E, 0x6E, 0x6E, 0x52, 0x52, 0x33, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x17, 0x6E, 0x85, 0x84, 0x84, 0x64, 0x64, 0x84, 0x84, 0x84, 0x64,
+0x64, 0x64, 0x64, 0x52, 0x17, 0x33, 0x33, 0x33, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17,
+0x6E, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x32, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x33, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x49, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17,
+0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x37, 0x52, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x53, 0x37,
+0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x49, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x53, 0x8D,
+0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x8E, 0x52, 0x37, 0x17, 0x37, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x17, 0x17, 0x17, 0x53, 0x8E, 0x72, 0x8E, 0x89, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0xA5, 0xA5, 0x85, 0x84,
+0x84, 0x89, 0x8E, 0x8E, 0x72, 0x57, 0x17, 0x17, 0x37, 0x37, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x49, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x72, 0x8E, 0x89, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x89, 0x72, 0x37, 0x17, 0x37,
+0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x4D, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17,
+0x37, 0x72, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0x85, 0xA5, 0xA5,
+0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x6E, 0x57, 0x17, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x4D, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x53, 0x8D, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x89, 0x52,
+0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x4D, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x37, 0x72, 0x89,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x85,
+0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x85, 0x6E, 0x89, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x4D, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x17, 0x17, 0x37, 0x72, 0x77, 0x72, 0x8E, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85,
+0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x4E, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x57, 0x72, 0x8E, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84,
+0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x4E, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17,
+0x57, 0x89, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5,
+0xA5, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x4E, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x37, 0x72, 0x89, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x85, 0xA5, 0xA9,
+0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x84, 0x64, 0x64, 0x64,
+0x64, 0x64, 0x4E, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x57, 0x8E, 0x85,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x84, 0x85, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x84, 0x84,
+0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x64, 0x85, 0x85, 0x84, 0x64, 0x6D, 0x37, 0x37, 0x37, 0x17, 0x37, 0x37, 0x37,
+0x37, 0x17, 0x17, 0x57, 0x57, 0x57, 0x8E, 0x89, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x84, 0x85,
+0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5,
+0x85, 0x84, 0x84, 0x8D, 0x8E, 0x8E, 0x72, 0x37, 0x17, 0x36, 0x32, 0x52, 0x8E, 0x89, 0xA9, 0x85, 0xA5, 0x85, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85,
+0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x8D, 0x72, 0x48,
+0x88, 0x85, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84,
+0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x84, 0x84,
+0x85, 0xA5, 0x85, 0x84, 0x89, 0x72, 0x92, 0x72, 0x72, 0x48, 0x68, 0x89, 0x89, 0x69, 0x89, 0xA9, 0x85, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0xA5,
+0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x89, 0x89, 0x89, 0x89, 0x89, 0x72, 0x17, 0x1B, 0x1B, 0x1B, 0x48,
+0x28, 0x28, 0x28, 0x28, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xA9, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0xA5, 0xA9,
+0x85, 0x84, 0x84, 0x85, 0xA5, 0xA5, 0x85, 0x84, 0x84, 0x84, 0x85, 0xA5, 0x85, 0x84, 0x89, 0x89, 0x8D, 0x89, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0xAD, 0x6D, 0x2D, 0x2D, 0x32, 0x32, 0x48, 0x48, 0x48, 0x48, 0x28, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x85, 0xA5, 0xA9, 0x85, 0x84, 0x84, 0x84, 0xA5, 0xA5, 0x85, 0x84, 0x89,
+0x89, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x28, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0x84,
+0xA5, 0xA9, 0x85, 0x85, 0x89, 0x8D, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xB1, 0xAD, 0xAD, 0xAD, 0xB1,
+0xAD, 0x8D, 0x8D, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xA9, 0xA5, 0xA5, 0x85, 0x85, 0x89, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x89, 0x68, 0x69, 0x49, 0x45, 0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xAD, 0xB1, 0xAD, 0xAD, 0xAD, 0xD1, 0xAD, 0x45, 0x4A, 0x4A, 0x69, 0x69, 0x69, 0x89, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4A, 0x4A, 0x4E, 0x4E, 0x49,
+0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xB1, 0xAD, 0xAD, 0xB1, 0xD1,
+0xAD, 0x69, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4A, 0x8D, 0xAD, 0xAD, 0xAD, 0xB1, 0xB1, 0xAD, 0xAD, 0x64, 0x64, 0x68, 0x68,
+0x89, 0x8D, 0x8D, 0x8D, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x89, 0x68, 0x89, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49, 0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x69, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0x8D, 0xAD,
+0xAD, 0xD1, 0xD1, 0xD1, 0xB1, 0xAD, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x68, 0xAD, 0x8D, 0x8D, 0x8D,
+0x8D, 0x69, 0x49, 0x4A, 0x4A, 0x4A, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49,
+0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xAD, 0x6A, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xAD, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x44, 0x0, 0x44, 0x44,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x89, 0x4A, 0x4E, 0x4E, 0x4F, 0x4A, 0x68, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49, 0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x6A, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x64, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0xAD, 0x8D, 0x8D,
+0x89, 0x4A, 0x4E, 0x4E, 0x4E, 0x4A, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49,
+0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xAD, 0x6A, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44,
+0x44, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0xAD, 0x8D, 0x8D, 0x89, 0x4A, 0x4E, 0x4E, 0x4E, 0x4A, 0x68, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49, 0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x6A, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0xAD, 0x8D, 0x8D,
+0x89, 0x4A, 0x4E, 0x4E, 0x4E, 0x4A, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x49,
+0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xAD, 0x6A, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0xAD, 0x8D, 0x8D, 0x89, 0x4A, 0x4E, 0x4E, 0x4E, 0x4A, 0x68, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4E, 0x4E, 0x4E, 0x4E, 0x45, 0x89, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x69, 0x6F, 0x6F, 0x4F, 0x4F, 0x4F, 0x6E, 0xAD, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0xAD, 0x8D, 0x8D,
+0x89, 0x4A, 0x4E, 0x4E, 0x4E, 0x4A, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x69, 0x4A, 0x49, 0x45, 0x65, 0x68,
+0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xB1, 0x8D, 0x89, 0x89, 0x69, 0x69, 0x6A, 0x69, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x89, 0x4A, 0x4E, 0x4E, 0x4F, 0x4A, 0x68, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x89, 0x69, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0xAD, 0xD1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0xB1, 0xB1, 0xAD, 0xAD, 0xB1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D,
+0x89, 0x4A, 0x4A, 0x4A, 0x4A, 0x45, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAD, 0xD1, 0xB1, 0xB1, 0xB1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x89, 0x65, 0x69, 0x68, 0x68, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0xAD, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xAD, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0xAD, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xAD, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x8D, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x64, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6D, 0x6D, 0x4D, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x4D, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xB2, 0xB2, 0xB6, 0x92, 0x92, 0x6D, 0x49, 0x49, 0x44, 0x0, 0x0, 0x0, 0x64, 0xB1, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6E, 0x6D, 0x6D,
+0x49, 0x49, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x48, 0x49, 0x4D,
+0x4D, 0x6D, 0x6D, 0x6E, 0x72, 0x92, 0x92, 0x92, 0x92, 0xB2, 0xB2, 0xB2, 0xB2, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB6, 0xB6, 0xB2, 0x92, 0x6D, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x4D, 0x4D, 0x4D, 0x6D,
+0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0x92, 0x92, 0x6E, 0x8D, 0xAD, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6E, 0x6D, 0x6D, 0x4D, 0x49, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x4D, 0x72, 0x92, 0xB6, 0xB6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x8E, 0x8D, 0x8D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x4D, 0x49, 0x48, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x4D, 0x92, 0x92, 0xB6,
+0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x4D, 0x4D,
+0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x72, 0x92, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0x92,
+0x72, 0x6D, 0x4D, 0x4D, 0x48, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x49, 0x49, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x48, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x8, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28 };
+
+const UG_BMP homePictureOutside =
+{
+	(void*)homePictureOutsideTable,
+	70,
+	66,
+	BMP_BPP_8,
+	BMP_RGB332
+};
+
+//uint32_t pictureHeigh = 66;
+//uint32_t pictureWeigh = 70;
+const uint8_t homePictureInsideTable[4620] = { 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17,
+0x57, 0x57, 0x77, 0x57, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x32, 0x2E, 0x2E,
+0x2D, 0x32, 0x12, 0x32, 0x52, 0x77, 0x77, 0x97, 0x96, 0xB6, 0xB5, 0xB5, 0xD5, 0xD5, 0xB6, 0xB6, 0xB6, 0xB6, 0x96, 0x77,
+0x77, 0x57, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x36, 0x32, 0x32, 0x2E, 0x2D, 0x28, 0x28, 0x28, 0x48, 0x49, 0x6D, 0x8D, 0x91, 0xB1, 0xB1, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB6, 0xB6, 0xB6, 0x96, 0x97, 0x77, 0x57, 0x37,
+0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x32, 0x4D, 0x29, 0x28, 0x28, 0x48, 0x49, 0x6D, 0x6D, 0x8D, 0xB1, 0xB1, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xB6, 0xB6, 0xB6, 0x96, 0x77, 0x77, 0x57, 0x37, 0x17, 0x17,
+0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x32, 0x32, 0x32, 0x2D, 0x29, 0x28, 0x28, 0x48, 0x49, 0x6D,
+0x8D, 0x91, 0xB1, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0x8D, 0x8D, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB6, 0xB6, 0x92, 0x96, 0x97, 0x77, 0x57, 0x37, 0x17, 0x37, 0x37, 0x37, 0x48,
+0x48, 0x48, 0x48, 0x28, 0x6D, 0x8D, 0xB1, 0xB1, 0xB5, 0xB5, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D,
+0x61, 0x61, 0x62, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0xB1, 0xB1,
+0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49,
+0xB5, 0xD5, 0xD5, 0xD6, 0xB6, 0x1B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D, 0x82, 0x82, 0x62, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4A, 0x4A, 0x6A, 0x6A, 0x69, 0x8D, 0x8D, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49, 0xB5, 0xD5, 0xD5, 0xD5, 0xB6, 0x17, 0x3B, 0x3B, 0x3B, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D,
+0x82, 0x82, 0x62, 0x91, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x53,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4A, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49,
+0xB5, 0xD5, 0xD5, 0xD5, 0xB1, 0x2D, 0x2D, 0x32, 0x32, 0x48, 0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D, 0x62, 0x61, 0x62, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x53, 0x4F, 0x4F, 0x4F, 0x53, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49, 0xB5, 0xD5, 0xD5, 0xD5, 0xAD, 0x28, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D,
+0x62, 0x61, 0x62, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x53, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49,
+0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D, 0x82, 0x61, 0x61, 0x91, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1,
+0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x53, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49, 0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D,
+0x62, 0x82, 0x82, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x53, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x49,
+0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x8D, 0x65, 0x65, 0x89, 0x91, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1,
+0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x53, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x49, 0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1,
+0xB1, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x4F, 0x4F,
+0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x49,
+0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xD1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0x8C, 0x6A, 0x6F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x91, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x49, 0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xB1, 0xD5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0x8D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0xB1, 0xB1,
+0x8D, 0x8D, 0x8D, 0x6E, 0x6A, 0xB1, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x49,
+0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB1, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB1, 0xAD, 0xAD, 0xB1, 0xB1, 0xB1, 0xB1, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0xB5, 0xB5, 0xD5, 0xD5, 0xD5, 0xD5,
+0xD5, 0xD5, 0xD5, 0xD5, 0xB1, 0x91, 0x91, 0x91, 0x6D, 0x49, 0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB1, 0xB5, 0xB5,
+0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xB5, 0xB5, 0xB5, 0xB1, 0xAD, 0xAD, 0xAD, 0x8D, 0xAD, 0xAD, 0xAD, 0xB1,
+0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xB5, 0x49, 0x25, 0x49, 0x29, 0x25, 0x49,
+0xB5, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB1, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0xB1, 0xB1, 0xB1,
+0xB1, 0xB6, 0xB6, 0xB6, 0xDB, 0xB6, 0xB2, 0xB6, 0xB2, 0xB1, 0xD5, 0xD5, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1,
+0xB1, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x44, 0xB1, 0xD5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48,
+0x48, 0x48, 0x48, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB1, 0xB5, 0xB5,
+0xB5, 0xB1, 0xB1, 0xB1, 0x8D, 0x8D, 0x88, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x85, 0x8D, 0x8D, 0xB2, 0xB6, 0xDB, 0xB6,
+0xD5, 0xD5, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x8D, 0xAD, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x69,
+0xB1, 0xB5, 0xD5, 0xD1, 0xAD, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0xB1, 0xB1, 0xB1, 0xAD, 0x89, 0x89, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+0x80, 0x80, 0x80, 0x80, 0x64, 0x64, 0x64, 0x8D, 0x92, 0xB1, 0xD5, 0xD5, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x8D,
+0xAD, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x6D, 0xB1, 0xB1, 0xD5, 0xD1, 0xAD, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x8D, 0x8D, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0x89, 0x80, 0x80, 0x80, 0x64, 0x64, 0x69, 0x69, 0x89, 0x89, 0x89, 0x89, 0x8D, 0x8D, 0x89, 0xB1,
+0xD5, 0xD5, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x8D, 0xAD, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x6D,
+0xB1, 0xB1, 0xD5, 0xD1, 0xAD, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x8D, 0xAD, 0xAD, 0x8D, 0x69, 0x69, 0x89, 0x89, 0x89,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x89, 0xB1, 0xD5, 0xD5, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x8D,
+0xAD, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x6D, 0xB1, 0xB1, 0xD5, 0xD1, 0xAD, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x6D, 0x91, 0x91, 0x8D, 0x6D, 0x69, 0x8D, 0x8D,
+0x6D, 0x8D, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB2, 0xB2,
+0xB6, 0xB6, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x8D, 0xAD, 0xD5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x6D,
+0xB1, 0xB1, 0xD5, 0xD1, 0xAD, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5,
+0xB5, 0xB5, 0x6D, 0x91, 0x91, 0x91, 0x6D, 0x8D, 0x8D, 0xAD, 0x6D, 0x8D, 0xAD, 0xAD, 0x8D, 0x92, 0x92, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1, 0xB1, 0x8D,
+0xAD, 0xB5, 0xD5, 0xB5, 0x49, 0x49, 0x49, 0x49, 0x25, 0x6D, 0xB1, 0xB1, 0xD5, 0xD1, 0xAD, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB1, 0x6D, 0x91, 0x91, 0x91, 0x6D, 0x92, 0xB2, 0xB2,
+0x6D, 0x92, 0xAD, 0xAD, 0x8E, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB2, 0xB2, 0xB6, 0xB6, 0xB6, 0xB6, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6D,
+0xB1, 0xB1, 0xD5, 0xD1, 0x8D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xB1, 0xD1, 0xD5, 0xB5, 0xB5, 0xB6,
+0xB6, 0xB6, 0x6E, 0x92, 0x92, 0x92, 0x6D, 0x92, 0x92, 0x92, 0x6E, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB2, 0x92, 0x8D, 0x6D, 0x6D, 0x8D, 0x8E, 0x92, 0x92, 0xB2, 0xB6, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x92, 0x92, 0x92, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1, 0xAD, 0x8D, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD6, 0xD2, 0xB6, 0xB6, 0xB6, 0x92, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x92, 0x92, 0x8D, 0x6D, 0x69, 0x45, 0x29, 0x26, 0x25,
+0x26, 0x26, 0x26, 0x26, 0x49, 0x49, 0x49, 0x69, 0x6D, 0x8E, 0x8E, 0xB2, 0xB6, 0xB6, 0xB2, 0xB2, 0xB1, 0xAD, 0xAD, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x6D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x8D, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1,
+0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD6, 0xD6, 0xD6, 0xB6, 0xB6, 0xB6, 0xB2, 0x92, 0x8D, 0x8D, 0x69,
+0x49, 0x48, 0x29, 0x26, 0x26, 0x26, 0x22, 0x21, 0x22, 0x25, 0x26, 0x26, 0x26, 0x45, 0x49, 0x89, 0x68, 0xAD, 0x8D, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6D, 0x6D, 0x4D, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x4D, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB2, 0xB2, 0xB2, 0xB1, 0xB1, 0xB1, 0xB1, 0xD1,
+0xD1, 0xD1, 0xD2, 0xD2, 0xD6, 0xB6, 0xB2, 0xB2, 0x8E, 0x8D, 0x8D, 0x69, 0x69, 0x68, 0x45, 0x49, 0x45, 0x29, 0x49, 0x69,
+0x89, 0x89, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6E, 0x6D, 0x6D,
+0x4D, 0x4D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x48, 0x49, 0x4D,
+0x4D, 0x6D, 0x6D, 0x6E, 0x72, 0x92, 0x92, 0x92, 0x92, 0xB2, 0xB2, 0xB2, 0xB2, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB6, 0xB6, 0xB6, 0xB2, 0xB2, 0xAD, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x4D, 0x49, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x4D, 0x4D, 0x4D, 0x6D,
+0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0x92, 0x92, 0x72, 0x8D, 0xAD, 0xAD, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x6E, 0x6E, 0x6D, 0x6D, 0x4D, 0x4D, 0x49, 0x48, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x4D, 0x72, 0x92, 0xB6, 0xB6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x8E, 0x8D, 0x8D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x4D, 0x49, 0x48, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x4D, 0x92, 0x92, 0xB6,
+0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x4D, 0x4D,
+0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x72, 0x92, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0x92,
+0x72, 0x6D, 0x4D, 0x4D, 0x48, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x49, 0x49, 0x49, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x48, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x8, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28 };
+
+const UG_BMP homePictureInside =
+{
+	(void*)homePictureInsideTable,
+	70,
+	66,
+	BMP_BPP_8,
+	BMP_RGB332
+};
+
+const uint8_t wifiPictureTable[4620] = { 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x32, 0x32, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x33, 0x2E, 0x25, 0x25,
+0x25, 0x29, 0x32, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x17, 0x52, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x53, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0xE, 0x0, 0x25, 0x25, 0x25, 0x25, 0x29, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x17, 0x53, 0x89, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x4E,
+0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x5, 0x0, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x32, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x17, 0x57, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x32, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x33, 0x0, 0x0, 0x0, 0x25, 0x25, 0x25, 0x25, 0x2E, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x5, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x2E, 0x37, 0x37, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x37, 0x37, 0x37, 0x37, 0x17, 0x37, 0x52,
+0x72, 0x72, 0x72, 0x72, 0x72, 0x52, 0x37, 0x17, 0x37, 0x17, 0x37, 0x37, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0xE, 0x0, 0x0,
+0x0, 0x5, 0x12, 0x37, 0x37, 0x17, 0x17, 0x52, 0x6D, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x89, 0x8E, 0x8E, 0x72,
+0x37, 0x17, 0x69, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x29, 0x12, 0x29, 0x29, 0x37, 0x37, 0x17, 0x37, 0x72, 0x85, 0x85, 0xA5,
+0x84, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0xA5, 0xA5, 0xA5, 0x8E, 0x57, 0x6D, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x2E, 0x29, 0x32,
+0x2D, 0x25, 0x32, 0x37, 0x52, 0x89, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0xA5, 0xA5, 0x85,
+0xA5, 0x89, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x33, 0x25, 0x25, 0x25, 0x25, 0x25, 0x29, 0x6E, 0x84, 0x85, 0xA5, 0xA5, 0xA5, 0x85,
+0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x64, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x25, 0x32, 0x37,
+0x32, 0x25, 0x25, 0x85, 0x84, 0x85, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5,
+0xA5, 0xA5, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x64, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x29, 0x25, 0x32, 0x52, 0x69, 0x45, 0x25, 0x65, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84,
+0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0x85, 0x84, 0x64, 0x57,
+0x17, 0x37, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3B, 0x32, 0x25, 0x25, 0x69, 0x84,
+0x85, 0x45, 0x25, 0x25, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5,
+0x85, 0x85, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0x85, 0x89, 0x8E, 0x8E, 0x77, 0x37, 0x1B, 0x37, 0x37, 0x37, 0x37, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x2E, 0x25, 0x25, 0x25, 0x45, 0x45, 0x25, 0x25, 0x25, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0x84,
+0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0x85, 0x85,
+0x85, 0x85, 0x85, 0x72, 0x37, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x2E, 0x25, 0x25, 0x44, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x85, 0xA5, 0xA5, 0xA5, 0x85, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x85, 0xA5, 0xA5, 0xA5, 0xA5,
+0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x72, 0x57, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x1B, 0x3B, 0x72, 0x25, 0x25, 0x44, 0x84, 0x85, 0x85, 0x65, 0x25, 0x5, 0x65, 0xA5, 0xA5, 0xA5, 0x85, 0x84,
+0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0x85, 0x85,
+0x89, 0x72, 0x3B, 0x1B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x37, 0x37, 0x37, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x1B, 0x37, 0x72, 0x85, 0x25, 0x0, 0x64, 0x85, 0xA5,
+0xA5, 0x85, 0x25, 0x25, 0x44, 0x85, 0xA5, 0xA5, 0x84, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84,
+0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0x85, 0xA5, 0xA5, 0xA5, 0x85, 0x8D, 0x3B, 0x1B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x49,
+0x49, 0x4D, 0x2E, 0x2E, 0x4D, 0x2E, 0x2D, 0x2E, 0x32, 0x2E, 0x32, 0x32, 0x32, 0x32, 0x32, 0x36, 0x32, 0x32, 0x32, 0x32,
+0x36, 0x56, 0x8E, 0xA5, 0x65, 0x25, 0x44, 0x84, 0xA5, 0xA5, 0xA5, 0x85, 0x45, 0x25, 0x0, 0x85, 0xA5, 0xA5, 0x84, 0xA5,
+0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0x84, 0xA5, 0xA5, 0x85, 0x89,
+0x8D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x68, 0x68, 0x49, 0x25, 0x25, 0x45, 0x65, 0x65,
+0x65, 0x65, 0x45, 0x45, 0x25, 0x69, 0xAD, 0xAD, 0x89, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0x89, 0xA9, 0xA9, 0xA9, 0xA9, 0x89,
+0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0x85, 0xA5, 0xA9, 0x89, 0x49, 0x8D, 0x56, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x3B, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x28, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x69, 0xAD, 0xAD, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x8D, 0x8D, 0x4A,
+0x8D, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4D, 0x4D, 0x4D, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x25, 0x25, 0x25, 0x45, 0x45, 0x25,
+0x25, 0x25, 0x25, 0x44, 0x25, 0x68, 0x8D, 0x8D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0x8D, 0x89, 0x8D, 0x8D, 0x8D,
+0x8D, 0x8D, 0x8D, 0x8D, 0xAD, 0xAD, 0x69, 0x89, 0x8D, 0x4A, 0x8D, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x28, 0x25, 0x0, 0x69, 0xAD, 0xAD, 0xB1, 0x8D, 0x4A, 0x4A, 0x25, 0x25, 0x25, 0x4A, 0x69, 0xAD, 0xAD,
+0xAD, 0xB1, 0xD1, 0xB1, 0xAD, 0x68, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x6A, 0x89, 0x8D, 0x4A,
+0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x25, 0x0, 0x89, 0xB1, 0xD1, 0xD1,
+0xAD, 0x4A, 0x4A, 0x44, 0x2A, 0x25, 0x4F, 0x6A, 0xAD, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xAD, 0x68, 0x0, 0x44, 0x44, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x8D, 0xB1, 0x6A, 0x89, 0x8D, 0x4A, 0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x28, 0x25, 0x0, 0xAD, 0xD1, 0xD1, 0xD1, 0xAD, 0x4E, 0x4F, 0x25, 0x4A, 0x25, 0x4F, 0x8E, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x6A, 0x89, 0x8D, 0x4A,
+0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x25, 0x25, 0x44, 0xAD, 0xB1, 0xB1, 0xB1,
+0xAD, 0x6E, 0x4F, 0x25, 0x4A, 0x25, 0x2A, 0x8E, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x0, 0x8D, 0xAD, 0x6A, 0x89, 0x8D, 0x69, 0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x48,
+0x28, 0x28, 0x28, 0x25, 0x25, 0x25, 0x45, 0x45, 0x45, 0x45, 0x44, 0x25, 0x29, 0x25, 0x25, 0x25, 0x2A, 0x8E, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x8D, 0xAD, 0x6A, 0x89, 0x8D, 0x8D,
+0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x25, 0x25, 0x49, 0x69, 0x69, 0x69,
+0x69, 0x25, 0x2A, 0x25, 0x25, 0x25, 0x2A, 0x8E, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x0, 0x8D, 0xAD, 0x69, 0x89, 0x8D, 0x8D, 0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x25, 0x25, 0x0, 0x45, 0x45, 0x25, 0x25, 0x25, 0x25, 0x25, 0x5, 0x25, 0x44, 0x25, 0x8D, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x8D, 0xAD, 0x69, 0x8D, 0x8D, 0x8D,
+0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x25, 0x49, 0xB1, 0xB1, 0xAD, 0xAD,
+0xAD, 0xAD, 0xAD, 0x69, 0x45, 0x69, 0x25, 0xAD, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x25, 0x0, 0x49, 0xB1, 0xB1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x8D, 0x25, 0x8D, 0x0, 0xAD, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D,
+0x8D, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x0, 0x69, 0xD1, 0xD1, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0x8D, 0x25, 0x8D, 0x0, 0x8D, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x25, 0x25, 0x25, 0x49, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0xAD, 0xAD, 0x8D, 0x25, 0x69, 0x25, 0x8D, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x69, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x8D, 0x8D, 0x8D, 0x8D,
+0x4D, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x25, 0x25, 0x25, 0x5, 0x0, 0x0, 0x0,
+0x0, 0x25, 0x25, 0x25, 0x25, 0x49, 0x25, 0x69, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xB1, 0x68, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x8D, 0xAD, 0x8D, 0x8D, 0x6D, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x69, 0xD1, 0xD1,
+0xD1, 0xD1, 0xD1, 0xD1, 0xB2, 0xB2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xAD, 0x8D, 0x6D, 0x4D, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x0, 0x69, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+0x92, 0x92, 0x92, 0xB6, 0x92, 0x8D, 0x6D, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x25, 0x25, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x25, 0x25, 0x4D, 0x4D,
+0x4D, 0x4D, 0x4D, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6D, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x25, 0x25, 0x28, 0x28, 0x28, 0x28, 0x48, 0x92, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+0xB6, 0xB6, 0xB6, 0x92, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x25, 0x25, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x25, 0x25, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x49, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x4D, 0x4D, 0x4D, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x25, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x25, 0x25, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x48, 0x48, 0x28, 0x48, 0x48, 0x48, 0x48,
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x28, 0x48, 0x28, 0x28, 0x48, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28 };
+
+const UG_BMP wifiPicture =
+{
+	(void*)wifiPictureTable,
+	70,
+	66,
+	BMP_BPP_8,
+	BMP_RGB332
+};
+
+//Generated by Gimp
+const uint8_t furnacePictureTable[9241] __attribute__ ((aligned (16))) = {
+"\256s\256s\256s\256s\256s\256s\256s\256s\256s\256s\317{\317{\317{\317{\317"
+"{\317{\317{\317{\317{\317{\317{E)\0\0\0\0\40\0A\10a\10\202\20\242\20\4!\4"
+"!\242\20\202\20\0\0iJ\20\204\357{\357{\357{\357{\357{\357{\357{\357{\357"
+"{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\317{\317{\317{\317{\317"
+"{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\216s\216s\256s\256s\256"
+"s\256s\256s\256s\256s\256s\256s\256s\317{\317{\317{\317{\317{\317{\317{\317"
+"{\256s$!\0\0\0\0\40\0A\10a\10\202\20\242\20\343\30\343\30\242\20\202\20\0"
+"\0iJ\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357"
+"{\357{\357{\357{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317"
+"{\317{\317{\317{\317{\256s\256s\216s\216s\216s\256s\256s\256s\256s\256s\256"
+"s\256s\256s\256s\256s\256s\317{\317{\317{\317{\317{\317{\256se)\0\0\0\0\40"
+"\0A\10a\10\202\20\242\20\343\30\343\30\242\20\202\20\0\0iJ\357{\357{\357"
+"{\357{\357{\357{\357{\357{\357{\357{\357{\357{\357{\317{\317{\317{\317{\317"
+"{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\256s\256"
+"s\256s\256s\216s\216s\216s\216s\216s\256s\256s\256s\256s\256s\256s\256s\256"
+"s\256s\256s\256s\317{\317{\317{\317{\317{iJ\202\20\0\0\0\0A\10a\10\202\20"
+"\202\20\303\30\303\30\242\20\202\20\0\0iJ\357{\357{\357{\357{\357{\357{\357"
+"{\357{\357{\357{\357{\357{\357{\317{\317{\317{\317{\317{\317{\317{\317{\317"
+"{\317{\317{\317{\317{\317{\317{\256s\256s\256s\256s\256s\256s\256s\216s\216"
+"s\216s\216s\216s\216s\216s\256s\256s\256s\256s\256s\216s\216s\256s\256s\216"
+"s\216s\216s\216smk\212R\303\30A\10\202\20\242\20\242\20\303\30\303\30\343"
+"\30\4!\343\30\343\30\242\20\10BMkMk,c\14c\14c\14c\14c\14c\14c\14c\313Z\313"
+"Z\14c\216s\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\256"
+"s\256s\256s\256s\256s\256s\256s\256s\256s\216s\216s\216s\216s\216s\216s\216"
+"s\216s\256s\256s\256s,c\3479\3079\3079\3079\2461\2061\2061\2061\2061e)$!"
+"E)E)E)E)E)E)E)E)E)E)E)E)E)E)$!$!$!$!$!$!$!E)$!$!$!\2061iJMk\256s\317{\317"
+"{\317{\317{\317{\317{\256s\256s\256s\256s\256s\256s\256s\256s\256s\256s\256"
+"s\256s\216s\216s\216s\216s\216s\216s\216s\216s\216s\256s,c\3079E)E)E)E)E"
+")E)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)E)e)\347"
+"9\313Zmk\256s\317{\317{\256s\256s\256s\256s\256s\256s\256s\256s\256s\256"
+"s\256s\256s\256s\216s\216s\216s\216s\216s\216s\216s\216s\256s,c\3079E)e)"
+"e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)\2061\2061\2061\2061\206"
+"1\2061\2061\2061\2061\2061\2061\2061\2061\2061e)e)\2461IJ\14c\216s\256s\256"
+"s\256s\256s\256s\256s\256s\256s\256s\256s\256s\216s\216smkmk\216s\216s\216"
+"s\216s\216s\216s,c\3079E)e)e)e)e)e)e)e)e)e)e)e)\2061\2061\2061\2061\2061"
+"\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\206"
+"1\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\347"
+"9iJ,c\216s\256s\256s\256s\256s\256s\256s\216s\216s\216s\216smkmkmkmk\216"
+"s\216s\216s,c\3079e)e)\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061"
+"\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\206"
+"1\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\246"
+"1\2461\2461\2461\2461\2461\2061\2061\2461(B\313ZMk\256s\256s\256s\216s\216"
+"s\216s\216s\216smkmkmkmkmk\216s\14c\3079e)\2061\2061\2061\2061\2061\2061"
+"\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\206"
+"1\2061\2061\2061\2061\2061\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
+"1\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
+"1\2061\3079iJ\14cmk\216s\216s\216s\216s\216smkmkmkmk\216s\14c\3479e)\206"
+"1\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\2061\206"
+"1\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
+"1\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
+"1\2461\2461\2461\2461\2461\2461\2461\2461\2461\2061\10B\212R,c\216s\216s"
+"\216smkmkmkmk\14c\3479\2061\2061\2061\2061\2061\2061\2061\2061\2461\2461"
+"\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
+"1\2461\2461\2461\2461\2461\2461\2461\2061\2061\2461\2461\2461\2061\2061\206"
+"1\2061\2061\2061\2061\2061\2061e)\2061e)\2061e)\2461\2061\2061\2061e)\10"
+"Be)e)E)\212R\216s\216s\216smkmkmk\14c\3079\2061\2061\2061\2061\2061\2061"
+"\2061\2061e)e)\2061\2061\2061e)e)e)\2061\2061e)e)e)\2061e)e)\2061e)e)e)e"
+")\10Be)e)e)\2461(Be)e)e)\3479IJe)e)\2061\212R\3079e)e)\10B,c\2461e)e)\14"
+"ciJe)e)\10B\216s\3079\2061E)\252R\216smkmkmkmkmk\313ZE)e)e)E)\10B\3079E)"
+"e)e)\3479\212Re)e)e)\3479\313Z\2061e)e)\3479\14c\3079e)e)\3079\14c\3479e"
+")e)\10B\216s\3079e)e)(B,c\3079e)e)iJ\252Re)e)\2061\252R\10Be)e)\2461IJe)"
+"\2061e)IJ\10Be)\2061\2461(Be)e)e)\14c\216smkmkMkMkmk\14ce)e)e)e)\14c\252"
+"RE)e)E)IJ\353Ze)e)e)\3079\212R\2061e)e)\2061\252R\2461e)e)\2061\3479e)e)"
+"e)e)\3079e)e)e)e)\2061E)e)e)e)e)E)e)E)e)E)$!$!$!$!\4!\4!\4!\343\30\343\30"
+"\343\30\343\30\303\30\303\30\303\30\242\20\252RmkmkmkmkMkMkMk,c\2461E)e)"
+"E)\2061\2061e)e)e)E)e)E)e)E)E)$!E)E)E)$!$!$!$!\4!\4!\4!\343\30\343\30\343"
+"\30\343\30\303\30\303\30\343\30\343\30\343\30\343\30\303\30\303\30\343\30"
+"\343\30\343\30\343\30\4!\4!\343\30\4!\4!\4!E)E)E)E)E)E)E)E)E)E)E)e)\3079"
+"MkmkmkmkmkMkMkMkMk\252R$!\303\30\303\30\303\30\303\30\343\30\343\30\343\30"
+"\343\30\303\30\303\30\343\30\343\30\303\30\303\30\343\30\343\30\343\30\4"
+"!\4!\4!E)E)E)E)E)E)E)E)E)E)E)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e"
+")e)e)e)e)e)\3479MkmkmkmkmkMkMkMkMkMk\3479$!$!E)E)E)E)E)E)E)E)E)E)E)E)E)e"
+")e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e"
+")e)e)e)e)e)e)iJmkmkmkMkMkMkMkMkMkMkIJE)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e"
+")e)e)e)e)e)e)e)e)\2061\2061\2461\3079\3479\3479\3479\3079\3079\2461e)e)e"
+")e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)E)\212RmkMkMkMkMkMkMkMkMkMk\252RE)e"
+")e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)\2461\3079\3479(BIJIJIJiJiJiJ"
+"iJiJiJIJ(B\10B\2461\2061e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)\353ZmkMkMkMkM"
+"k,c,cMkMkMk\353ZE)E)E)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)e)\2461\10B(BIJI"
+"J(B(B\10B\10B\3479\3479\3479\3479\3479\3479\10B(BIJIJ(B\3079e)e)e)e)e)e)"
+"e)e)e)e)e)e)e)e)e)e)\14cMkMkMkMkMk,c,c,c,cMk\353ZE)E)E)E)E)E)e)e)e)e)e)e"
+")e)e)e)e)e)e)e)\2461\3479\10B(B\10B\3479\3079\3079\3079\3079\3079\3079\307"
+"9\3079\3079\3079\3079\3079\3079\3079\3479\10B(B\10B\2461e)e)e)e)e)e)e)e)"
+"e)e)e)e)e)\3079,cMkMkMkMkMk,c,c,c,c,c\14c\2061E)E)E)E)E)E)E)E)e)e)e)e)e)"
+"e)e)e)e)\3079\10B\10B\3479\3079\3079\3079\3079\2461e)e)$!\4!\343\30\343\30"
+"\343\30\4!$!E)\2061\3079\3079\3079\3079\10B(B\3479e)e)e)e)e)e)e)e)e)e)e)"
+"E)\10BMkMkMkMk,c,c,c,c,c,c,c,c\3479E)E)E)E)E)E)E)E)E)E)E)E)e)e)E)e)\3079"
+"\3479\3479\3079\3079\3079\2461e)\4!\202\20\202\20\343\30\4!$!$!$!$!\4!\303"
+"\30A\10A\10\303\30$!\2061\3079\3079\3079\10B\3479e)e)e)e)e)e)e)e)e)e)E)I"
+"JMkMk,c,c,c,c,c,c,c,c,c,c\3479E)E)E)E)E)E)E)E)E)E)E)E)E)E)e)\3079\3479\307"
+"9\3079\3079\2061$!\343\30\4!\2061\2461\2461\2461\2461\2461\3079\3079\307"
+"9\2461\2461\2461\2461$!A\10A\10\4!\2461\3079\3079\3479\3479e)e)e)e)e)e)e"
+")e)e)E)\252RMk,c,c,c,c,c,c,c,c,c,c\353Ze)E)E)E)E)E)E)E)E)E)E)E)E)E)e)\246"
+"1\3079\3079\3079\2461E)\4!\2061\2461\2461\3079\3079\3079\3079\3079\3079\307"
+"9\3079\3079\3079\3079\3079\3079\3079\2461E)a\10a\10e)\3079\3079\3479\206"
+"1e)e)e)e)e)e)e)e)E)\313Z,c,c,c,c,c,c\14c\14c,c,c\14ciJ\4!E)E)E)E)E)E)E)E"
+")E)E)E)E)E)\2061\3079\3079\3079\2061\4!E)\2461\3079\3079\3079\3079\3079\307"
+"9\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\2461\343"
+"\30A\10e)\3079\3079\3079e)e)e)e)e)e)e)e)\2061\14c,c,c,c,c,c,c\14c\14c\14"
+"c\14c\14cE)A\10E)E)E)E)E)E)E)E)E)E)E)E)E)\2461\2461\3079\2061\4!\2061\246"
+"1\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\307"
+"9\3079\3079\3079\3079\3079\3079\2461\343\30\202\20\2461\3079\3079\2061e)"
+"e)e)e)e)e)E)\2461\14c,c,c,c,c\14c\14c\14c\14c\14c\14c\313Z\343\30\0\0$!E"
+")E)E)E)E)E)E)E)E)E)$!e)\2461\2461\2461\2461\2461\2461\2461\2461\2461\307"
+"9\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\3079\307"
+"9\3079\3079\3079\3079\2461\303\30$!\3079\3079\2061E)e)e)e)e)e)E)(B,c,c\14"
+"c\14c\14c\14c\14c\14c\14c\14c\353Ze)\40\0\0\0\4!E)E)E)E)E)$!$!$!$!E)$!\206"
+"1\2461\2461e)\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\2461\246"
+"1\2461\2461\2461\2461\2461\3079\3079\3079\3079\3079\3079\3079\3079\3079\307"
+"9e)\242\20\2461\3079\2461E)E)E)E)E)E)E)IJ\14c\14c\14c\14c\313Z\252Z\252Z"
+"\14c\14c\14c\313Z\343\30\0\0\0\0\343\30E)\4!\202\20a\10A\10A\10A\10\4!\303"
+"\30E)$!\2461\2461\2461\2461\2461\2461\2461\2461\2461\3079\3079\3079\3079"
+"\3479\3479\3479\3479\10B\10B\10B\10B\10B\10B\3479\3479\3479\3479\3079\307"
+"9\3079\3079\2461\343\30\2461\3079\2061E)E)E)E)E)E)E)eA\205Q$I#I\306Q\306"
+"I`@\200H\14c\14c\353ZIJ\303\30\0\0\0\0\303\30E)\303\30$!\303\30\0\0\40\0"
+"a\10e)\242\20\4!$!\2461\2461\2461\2461\2461\2461\2461\2461\2461\3479\347"
+"9\3079\3079\2461\2461\2061\2061e)E)E)e)E)\343\30\242\20\242\20A\10E)\246"
+"1\2461\2461\2461\3079E)\2461\3079\2061E)E)E)E)E)E)E)\302@`H\200H\200H\200"
+"H\246I\246I\3I\353Z\353Z\353Z$!\40\0\0\0\0\0\202\20E)\303\30\0\0\0\0\0\0"
+"\40\0\0\0A\10a\10\242\20E)\2461\2461\2461\2461\2461\2461\2461\2461E)$!\343"
+"\30$!$!$!$!$!$!$!$!E)e)E)\242\20a\10\40\0\0\0E)\2461\2461\2461\2461\2461"
+"\4!\2461\2461\2061E)E)E)E)E)E)E)\240H\200H\200H\200H\200H`H#I\7R\353Z\353"
+"Z\252R\343\30\0\0\0\0\0\0\40\0$!\343\30\303\30\343\30\0\0\0\0\0\0E)\4!\242"
+"\20$!\2461\2461\2461\2461\2461\2461\2461\2461E)\4!\4!$)$)$!$)$!$!$)$)e1e"
+"1E)\242\20A\10\40\0\0\0e)\2461\2461\2461\2461\2461\4!\2461\2461e)E)E)E)E"
+")E)E)D1\240H\200H\200H\200H\200H\200H`H#Q\306I\246IE9A\20\0\0\0\0\0\0\0\0"
+"\4!\4!A\10A\10\0\0\0\0E)(B(B\3079$!\2461\2461\2461\2461\2461\2461\2461\246"
+"1E)$!\4!e9dIDA\204I$A\245Q\204Q\244Y&j\306Qe)\303\30A\10A\10\40\0\2061\246"
+"1\2461\2461\2461\2461\4!\2461\2461e)E)E)E)E)E)E)\4""9\200H\200H\200H\200"
+"H\200H\200H\200H`H@@@8\0\20\0\0\0\0\0\0\0\0\0\0\343\30$!\343\30\303\30\0"
+"\0\303\30$!\343\30\242\20a\10\343\30\2461\2461\2461\2461\2461\2461\2461\246"
+"1E)$!dQf\212F\212\306\232'\243\346\232\311\263\351\303\351\303\213\314\211"
+"\263eA\343\30A\10\40\0\0\0e)\2461\2461\2461\2461\2461$!\2461\2461E)E)E)E"
+")E)E)E!\3""9\200P\240H\240H\240H\240H\240H\240H\240H\200@@0\0\10\0\0\0\0"
+"\0\0\0\0\0\0\303\30E)$!$!A\10$!e)\242\20\303\30a\10\303\30\2461\2461\246"
+"1\2461\2461\2461\2461\2461E)D1\347\222M\355\216\355p\376p\376\221\376\22"
+"\377s\377s\377s\377\22\377(\213\343\40A\0\40\0\40\0\2061\2461\2461\2461\246"
+"1\2061$!\2461\2461E)E)\303\30$!E)E)E)\342@\200P\200P\200P`P`H`H\200H\240"
+"P`@\0\30\0\0\0\0\0\0\0\0\0\0\0\0a\10E)E)E)\4!\4!\2061$!$!\242\20\242\20\246"
+"1\2461\2461\2461\2461\2461\2461\2461%!fb\216\345\265\377\365\377\365\377"
+"\366\377\371\377\371\377\371\377\373\377\373\377\372\377o\355$AA\10\0\0A"
+"\10\2061\2461\2461\2461\2461E)$!e)E)\343\30\303\30\0\0\40\0\303\30$!E)eI"
+"\205Q#QdQ\205Q\306Y\306Y\347Y\347Y@8\0\20\0\0\0\0\0\0\0\0\0\0\0\0A\10$!E"
+")E)$!\303\30\2061E)$!\303\30a\10\2061\2461\2061\2461\2461\2461\2461\2461"
+"\4\21+\254\367\377\376\377\377\377\375\377\377\377\377\377\377\377\377\377"
+"\377\377\377\377\377\377\374\377\312\243A\10\0\0a\10\2061\2461\2461\2061"
+"\303\20A\30\0\10\0\0\0\0\0\0\0\0\0\0e)\10B\343\30E1\306Y\306Y#Q#Q\3Q#Q\341"
+"P\300P\240P\0\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\40\0$!$!$!$!\303\30\2061E)$"
+"!\343\30A\10\2061\2461\2061\2461\2461\2461\2461\2461#\0\360\274\375\377\377"
+"\377\377\377\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377"
+"\377\377\377p\345\3428\0\0\202\20\2061\2461\2061\4!\0\10\0""8\0""8\4!E)\0"
+"\0\40\0\0\0a\10$!\343\30\4""1`P\200P\240P\240P\240P\240P\240P\240P\240P\0"
+"\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4!$!$!$!\343\30\2061E)$!\4!\40\0e)\246"
+"1\2061\2061\2461\2461\2461\2461\2\0\322\325\377\377\377\377\377\377\377\377"
+"\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\370\377"
+"\246r\0\0\242\20\2061\2461E)\0\0\0\0\0(\0@\3430\206)\0\0\0\0\40\0\303\30"
+"\4!$!\246A\3Q\240P\240P\240P\240P\240P\240P\240P\240P\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\343\30$!$!$!\303\30e)e)$!$!\40\0e)\2461\2061\2061\2061\206"
+"1\2061\2461\1\0q\305\370\377\221\345s\325\375\377\26\336\377\377W\377\377"
+"\377\324\376\260\244Lko\244\373\377\213\213\0\0\303\30\2461\2461E)\0\0\0"
+"\0\0\20\0(a\40\343\40\0\0\0\0a\10$!E)$!\347I\7R`P\240P\240P\240P\240P\240"
+"P\240P\240P\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\242\20$!$!$!\303\30E)e)$"
+"!$!\0\0$!\2061\2061\2061\2061\2061\2061\2461\204\0,\234o\315\263\376\375"
+"\377T\255\234\3772\305r\376\376\377\24\377W\377*{\306\222\23\377({\0\0\303"
+"\30\2461\2461\2061a\10\40\0\40\20\0""0\2428\343(\0\0\40\0\242\20$!E)E!\342"
+"H\252bHb`P\240P\240P\240P\240P\240P\240P\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0a\10$!$!$!\343\30$!\2061$!$!\40\0$!\2061\2061\2061\2061\2061\2061\206"
+"1%\31\212\2135\377\224\377u\377(\213\357\314i\253*\304\17\325\7\203J{\204"
+"I\341P\347r\2)A\10\343\30\2461\2461e)\40\0\303\30\303\30\40\40E1$!\242\20"
+"\4!$!$!$!$)\240PDY\353j(Z`P\240P\240P\240P\240P\240P\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\40\0$!$!$!\4!\4!\2061$!$!\40\0\343\30\2061\2061\2061\206"
+"1\2061\2061\2061e)\203\30\10{\7{\10{#1\244IcA\305I\6Re9e)\2061\3069\3079"
+"\3479\3079E)\2461\2061E)\0\0\303\30\242\20a\10\2061E)$!$!$!$!$!$)\300P`P"
+"DY\212bDQ`P\240P\240P\240P\240P\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4"
+"!$!$!$!\343\30\2061$!$!\202\20\343\30\2061\2061\2061\2061\2061\2061\2061"
+"e)e)\3069\3079\347A\3479\3479\10B\10B\10B\3479\3479\3479\3479\3079\2461\206"
+"1e)\2061\2061\343\30\0\0\4!\242\20\242\20e)$!$!$!$!$!$!\3""9\240X\240X`P"
+"Hb\13kDY\200X\240X\240X\240Xa\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\343"
+"\30$!$!$!\242\20\2061$!$!\303\30\242\20\2061\2061\2061\2061\2061\2061\206"
+"1e)e)\3079\3079\2461\2061e)e)E)E)E)E)$!$!E)E)E)e)\2061e)A\10\0\0$!$!\206"
+"1e)$!$!$!$!$!$!\3A\240X\240X\240X`Xib\353j\300P\240X\240X\240X\3079\0\0\0"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\303\30$!$!$!\303\30e)E)$!\303\30\202\20\206"
+"1\2061\2061\2061\2061\2061\2061e)$!$!\4!$!E)E)e)e)e)\2061\2061\2061\2061"
+"\2461\3079\3079\3079\3079\2461\303\30\343\30\2461\2061\2061e)$!$!$!$!$!$"
+"!\342H\240X\240X\240X\240X`X\212bIZ`P\240X\240X\211R\0\20\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\242\20$!$!$!\303\30E)E)\4!\4!A\10e)\2061\2061\2061\2061"
+"\2061\2061\2061\2061\2061\2061\2461\2461\3079\3079\3079\3079\3479\3479\347"
+"9\3079\3079\3079\3079\2461\2461\2461\2061\2061\2061\2061\2061E)$!$!$!$!$"
+"!$!\342H\240X\300X\300X\300X\200XDY\14kIb\0X`XeQ@@\0\20\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0a\10$!$!$!\343\30E)\10B(BIJ$!E)\2061\2061\3079\3079\3079\3479\347"
+"9\3079\3079\3079\3079\3079\2461\2461\2461\2061\2061\2061\2061\2061\2061\206"
+"1\2061\2061\2061\2061\2061e)e)E)e)E)$!$!$!$!$!\4)`P\200X\300X\2YDY\205Y\246"
+"Y\211b\256s\353j\252j\200P\240H@0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\40\0\4!\4!"
+"\242\20a\10\343\30e)$!\4!a\10E)\2061\2061\2461\2461\2061\2061\2061\2061\206"
+"1\2061\2061\2061\2061\2061\2061\2061e)e)e)E)E)$!$!$!E)E)\2061\2461\3079\347"
+"9(B\3079$!$!$!$!$!\2461\212b\353j\353j\212b\211b\252j\211jib\312jms\347Y"
+"`P\240P\200H\40\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\343\30\343\30\242\20\303\30"
+"\0\0\0\0\0\0\0\0\0\0$!\2061\2061\2061\2061\2061\2061e)e)E)E)$!$!$!$!$!E)"
+"\2061\3079\3479\10BIJiJ\212R\252R\252R\252R\252R\252R\212R\212RIJe)$!$!$"
+"!$!$!DA\245a\205a#Y\200X\200X\200X`X`X@Xij\14s\240P\240P\240P\200@\0\20\0"
+"\0\0\0\0\0\0\0\0\0\0\0\303\30\343\30A\10\202\20\0\0\0\0\202\20\4!\0\0\343"
+"\30E)$!$!$!\4!$!E)\2461\3079\10B(BIJ\212R\252R\313Z\313Z\313Z\353Z\353Z\313"
+"Z\252R\212RiJIJ(B\10B\3079\2061e)E)$!\4!$!$!$!$!$!\343@\300X\300X\300X\300"
+"X\300X\300X\300X\300X\240X`X\212j\240P\240P\240P\240P@0\0\10\0\0\0\0\0\0"
+"\0\0\0\0\242\20\4!\242\20\4!\0\0\0\0a\10\343\30\242\20\2061\3479\10B(BIJ"
+"iJ\212R\252R\252R\252R\252R\252R\252RiJIJ(B\10B\3479\3079\2061E)$!\4!\343"
+"\30\343\30\343\30\343\30\343\30\343\30\4!\4!$!$!$!$!$!$!$!\342P\300X\300"
+"X\300X\300X\300X\300X\300X\300X\300X\240XCa\240P\240P\240P\240P\240P@(\0"
+"\0\0\0\0\0\0\0\0\0a\10\4!\242\20a\10\0\0\202\20\343\30\4!A\10$!\10BIJIJ("
+"B(B\3479\3079\2461\2061e)E)\4!\343\30\343\30\343\30\343\30\343\30\343\30"
+"\4!\4!\4!\4!\4!$!$!$!$!$!\4!$!\4!$!$!$!$!$!$!\301P\300X\300X\300X\300X\300"
+"X\300X\300X\300X\300X\300X\200X\40P@P`P\240P\341P$A\202\30\0\0\0\0\0\0\0"
+"\0\40\0\4!\4!\343\30\202\20\343\30\4!\4!A\10\242\20\343\30$!\4!\343\30\303"
+"\30\303\30\343\30\343\30\343\30\4!\4!\4!\4!\4!$!$!$!$!$!\4!\4!e)$!\4!$!$"
+"!$!$!\4!\4!\4!\4!$!$!$!$!\4)\300X\300X\300X\300X\300X\300X\300X\300X\300"
+"X\300X\300X\300X\212b\252b\313b\353b\353j\252beA\0\10\0\0\0\0\0\0\0\0\4!"
+"\4!\4!\4!\4!\4!\4!\202\20\242\20\343\30$!$!\4!\4!\4!$!$!$!\4!e)$!\4!\4!\4"
+"!\343\30\303\30\303\30\303\30\343\30$!\3079\3479\2061$!$!E)e)\4!\4!\4!\4"
+"!\4!\4!\4!\4!\4""1\300X\300X\300X\300X\300X\300X\300X\300X\300X\300X\300"
+"X\300X\347Y\245YdY#Y\301P\240P`P@0\0\0\0\0\0\0\0\0\343\30\4!\4!\4!\4!\4!"
+"\4!\242\20\202\20\303\30\4!$!\4!\4!\4!\4!\4!\4!\343\30E)e)\2061\3479(B\212"
+"R\353Z,cMk,cMkmkMkiJ\2061\2061\2061e)$!\4!\4!\4!\4!$!$!$!$1\300X\300X\300"
+"X\300X\300X\300X\300X\300X\300X\300X\300X\300X\240P\240P\240P\240P\240P\240"
+"P\240X\240P\40\40\0\0\0\0\0\0\303\30\4!\4!\4!\4!\4!\4!\303\30\202\20\303"
+"\30\4!$!\4!\4!\4!$!$!E)\313Z\14cMkMkMk,c\313Z\212R(B\3479E)\303\30\40\0\40"
+"\0\202\20\303\30\242\20\202\20a\10A\10\202\20$!E)E)e)E)$!$!\341X\300X\300"
+"X\300X\300X\300X\300X\300X\300X\300X\300X\300X\240P\240P\240P\240P\240X\240"
+"X\240X\240X\200H\0\20\0\0\0\0\242\20\4!\4!\4!\4!\4!\4!\303\30a\10\303\30"
+"\4!$!e)\2061\2061\2461e)\343\30\2461E)\303\30\40\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\40\0\202\20E)\242\20\343\30\3479E)\4!\3079e)\4"
+"!\4)\300X\300`\300X\300`\300`\300`\300`\300`\300`\300`\300`\300`\240P\240"
+"P\240X\240X\240X\240X\240X\240X\240P@0\0\0\0\0a\10\4!\4!\4!\4!\4!\4!\343"
+"\30a\10\303\30\4!\4!$!\4!\4!\343\30\202\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\40\0\343\30\343\30\3079\2461\4!E)\3479$!\4!\2461$!\343"
+"\20\343\20\242\20\3020\341P\300`\300`\300`\300`\300`\300`\300`\300`\300`"
+"\300`\300`\300`\240X\240X\240X\240X\240X\240X\240X\240X\300X\240P\40\40\0"
+"\0\40\0\4!\4!\4!\4!\4!\4!\4!\40\0A\10a\10A\10\0\0\40\0\0\0\0\0\0\0\0\0\0"
+"\0\0\0\0\0\0\0\0\0\0\0\0\0\40\0\40\0A\10\202\20\343\30\4!\343\40E)\4!\303"
+"\40\242\30@\30\343\40$1\0""0`8\200@\240H\240P\240X\300`\300`\300`\300`\300"
+"`\300`\300`\300`\300`\300`\300`\300`\300`\240X\240X\240X\240X\240X\240X\240"
+"X\240X\300X\300X\200H\0\30\40\0\4!$!$!$!$!$!$!\303\30a\10\202\20e)$!\303"
+"\30\303\30\4!\40\0\40\0a\10\202\20\202\20\202\20\242\30\303\30\242\30\242"
+"\20\302\40\202\30\202\30\201(`0`8`8\200H\240X\240X\200X\212j\216s#Y\300`"
+"\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300"
+"`\300`\300`\240X\240X\240X\240X\240X\240X\300X\300X\300X\300X\240X`@a\20"
+"$!$!E)\3479\4!\4!\2061\10B\4!\4!\3079\2061\4!\343\40$)\303\30\242\30\242"
+"\30\202\30a\30`(`0`8`@\200H\240P\240X\240X\300X\300X\300X\300X\300X\300`"
+"\300`\240`\245a\357{ib\200`\300`\300`\300`\300`\300`\300`\300`\300`\300`"
+"\300`\300`\300`\300`\300`\300`\300`\300`\240X\240X\240X\240X\300X\300X\300"
+"X\300X\300X\300X\300X\240Pa\30\4!\4!$!\3479\343\30\343\30\4!$!\343\30$!A"
+"\30\201(\2010`0`8`@\200H\240P\240X\240X\300X\300X\300X\300X\300X\300`\300"
+"`\300`\300`\300`\300`\300`\300`\300`\300`\300`\200`Ms\215s\300X\300`\300"
+"`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300`\300"
+"`"
+};
+
+const UG_BMP furnacePicture =
+{
+	(void*)furnacePictureTable,
+	70,
+	66,
+	BMP_BPP_16,
+	BMP_RGB565
+};
+
+const UG_COLOR colorMenuTable[2] = { C_BLACK, C_WHITE_SMOKE };
+const uint8_t optionsPictureTable[30] = { 0xE1, 0xFF, 0x2D, 0xC0, 0x2D, 0xC0, 0xE1, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x2D, 0xC0, 0x2D, 0xC0, 0xE1, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x2D, 0xC0, 0x2D, 0xC0, 0xE1, 0xFF, 0xFF, 0xFF };
+
+const UG_BMP optionsPicture =
+{
+	(void*)optionsPictureTable,
+	16,
+	15,
+	BMP_BPP_1,
+	BMP_MONO,
+	(void*)colorMenuTable
+};
+
+const uint8_t closePictureTable[57] = { 0xFF, 0xFF, 0x1F, 0xE3, 0xFF, 0x18, 0xC3, 0x7F, 0x18, 0x83, 0x3F, 0x18, 0x7, 0x1F, 0x1C, 0xF, 0xE, 0x1E, 0x1F, 0x4, 0x1F, 0x3F, 0x80, 0x1F, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x1F, 0x7F, 0xC0, 0x1F, 0x3F, 0x80, 0x1F, 0x1F, 0x4, 0x1F, 0xF, 0xE, 0x1E, 0x7, 0x1F, 0x1C, 0x83, 0x3F, 0x18, 0xC3, 0x7F, 0x18, 0xE3, 0xFF, 0x18, 0xFF, 0xFF, 0x1F};
+
+const UG_BMP closePicture =
+{
+	(void*)closePictureTable,
+	21,
+	19,
+	BMP_BPP_1,
+	BMP_MONO,
+	(void*)colorMenuTable
+};
+
+const uint8_t incrementMinuteHourPictureTable[90] = { 0xFF, 0xFF, 0xFD, 0xFF, 0x7, 0xFF, 0xFF, 0xF8, 0xFF, 0x7, 0xFF, 0x7F, 0xF0, 0xFF, 0x7, 0xFF, 0x3F, 0xE0, 0xFF, 0x7, 0xFF, 0x1F, 0xC0, 0xFF, 0x7, 0xFF, 0xF, 0x80, 0xFF, 0x7, 0xFF, 0x7, 0x0, 0xFF, 0x7, 0xFF, 0x3, 0x0, 0xFE, 0x7, 0xFF, 0x1, 0x0, 0xFC, 0x7, 0xFF, 0x0, 0x0, 0xF8, 0x7, 0x7F, 0x0, 0x0, 0xF0, 0x7, 0x3F, 0x0, 0x0, 0xE0, 0x7, 0x1F, 0x0, 0x0, 0xC0, 0x7, 0xF, 0x0, 0x0, 0x80, 0x7, 0x7, 0x0, 0x0, 0x0, 0x7, 0x3, 0x0, 0x0, 0x0, 0x6, 0x1, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0};
+
+const UG_BMP incrementMinuteHourPicture =
+{
+	(void*)incrementMinuteHourPictureTable,
+	35,
+	18,
+	BMP_BPP_1,
+	BMP_MONO,
+	(void*)colorMenuTable
+};
+
+const uint8_t decrementMinuteHourPictureTable[90] = { 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x4, 0x3, 0x0, 0x0, 0x0, 0x6, 0x7, 0x0, 0x0, 0x0, 0x7, 0xF, 0x0, 0x0, 0x80, 0x7, 0x1F, 0x0, 0x0, 0xC0, 0x7, 0x3F, 0x0, 0x0, 0xE0, 0x7, 0x7F, 0x0, 0x0, 0xF0, 0x7, 0xFF, 0x0, 0x0, 0xF8, 0x7, 0xFF, 0x1, 0x0, 0xFC, 0x7, 0xFF, 0x3, 0x0, 0xFE, 0x7, 0xFF, 0x7, 0x0, 0xFF, 0x7, 0xFF, 0xF, 0x80, 0xFF, 0x7, 0xFF, 0x1F, 0xC0, 0xFF, 0x7, 0xFF, 0x3F, 0xE0, 0xFF, 0x7, 0xFF, 0x7F, 0xF0, 0xFF, 0x7, 0xFF, 0xFF, 0xF8, 0xFF, 0x7, 0xFF, 0xFF, 0xFD, 0xFF, 0x7 };
+
+const UG_BMP decrementMinuteHourPicture =
+{
+	(void*)decrementMinuteHourPictureTable,
+	35,
+	18,
+	BMP_BPP_1,
+	BMP_MONO,
+	(void*)colorMenuTable
+};
+
+const uint8_t smallIncrementPictureTable[14] = { 0xBF, 0x1F, 0x1F, 0x1F, 0xF, 0x1E, 0x7, 0x1C, 0x3, 0x18, 0x1, 0x10, 0x0, 0x0 };
+
+const UG_BMP smallIncrementPicture =
+{
+	(void*)smallIncrementPictureTable,
+	13,
+	7,
+	BMP_BPP_1,
+	BMP_MONO,
+	(void*)colorMenuTable
+};
+
+const uint8_t smallDecrementPictureTable[14] = { 0x0, 0x0, 0x1, 0x10, 0x3, 0x18, 0x7, 0x1C, 0xF, 0x1E, 0x1F, 0x1F, 0xBF, 0x1F };
+
+const UG_BMP smallDecrementPicture =
+{
+	(void*)smallDecrementPictureTable,
+	13,
+	7,
+	BMP_BPP_1,
+	BMP_MONO,
+	(void*)colorMenuTable
+};
+
+const uint8_t moveHistoryGraphLeftPictureTable[105] = { 0xFF, 0xFF, 0x1, 0xFF, 0xFF, 0x0, 0xFF, 0x7F, 0x0, 0xFF, 0x3F, 0x0, 0xFF, 0x1F, 0x0, 0xFF, 0xF, 0x0, 0xFF, 0x7, 0x0, 0xFF, 0x3, 0x0, 0xFF, 0x1, 0x0, 0xFF, 0x0, 0x0, 0x7F, 0x0, 0x0, 0x3F, 0x0, 0x0, 0x1F, 0x0, 0x0, 0xF, 0x0, 0x0, 0x7, 0x0, 0x0, 0x3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x3, 0x0, 0x0, 0x7, 0x0, 0x0, 0xF, 0x0, 0x0, 0x1F, 0x0, 0x0, 0x3F, 0x0, 0x0, 0x7F, 0x0, 0x0, 0xFF, 0x0, 0x0, 0xFF, 0x1, 0x0, 0xFF, 0x3, 0x0, 0xFF, 0x7, 0x0, 0xFF, 0xF, 0x0, 0xFF, 0x1F, 0x0, 0xFF, 0x3F, 0x0, 0xFF, 0x7F, 0x0, 0xFF, 0xFF, 0x0, 0xFF, 0xFF, 0x1 };
+
+const UG_BMP moveHistoryGraphLeftPicture =
+{
+	(void*)moveHistoryGraphLeftPictureTable,
+	18,
+	35,
+	BMP_BPP_1,
+	BMP_MONO,
+	(void*)colorMenuTable
+};
+
+const uint8_t moveHistoryGraphRightPictureTable[105] = { 0xFE, 0xFF, 0x3, 0xFC, 0xFF, 0x3, 0xF8, 0xFF, 0x3, 0xF0, 0xFF, 0x3, 0xE0, 0xFF, 0x3, 0xC0, 0xFF, 0x3, 0x80, 0xFF, 0x3, 0x0, 0xFF, 0x3, 0x0, 0xFE, 0x3, 0x0, 0xFC, 0x3, 0x0, 0xF8, 0x3, 0x0, 0xF0, 0x3, 0x0, 0xE0, 0x3, 0x0, 0xC0, 0x3, 0x0, 0x80, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x3, 0x0, 0x80, 0x3, 0x0, 0xC0, 0x3, 0x0, 0xE0, 0x3, 0x0, 0xF0, 0x3, 0x0, 0xF8, 0x3, 0x0, 0xFC, 0x3, 0x0, 0xFE, 0x3, 0x0, 0xFF, 0x3, 0x80, 0xFF, 0x3, 0xC0, 0xFF, 0x3, 0xE0, 0xFF, 0x3, 0xF0, 0xFF, 0x3, 0xF8, 0xFF, 0x3, 0xFC, 0xFF, 0x3, 0xFE, 0xFF, 0x3 };
+
+const UG_BMP moveHistoryGraphRightPicture =
+{
+	(void*)moveHistoryGraphRightPictureTable,
+	18,
+	35,
+	BMP_BPP_1,
+	BMP_MONO,
+	(void*)colorMenuTable
+};
+
+const uint8_t upWifiNetworkTable[30] = { 0xDF, 0x7, 0xDF, 0x7, 0x8F, 0x7, 0x8F, 0x7, 0x8F, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x3, 0x6, 0x3, 0x6, 0x1, 0x4, 0x1, 0x4, 0x1, 0x4, 0x0, 0x0, 0x0, 0x0 };
+
+const UG_BMP upWifiNetwork =
+{
+	(void*)upWifiNetworkTable,
+	11,
+	15,
+	BMP_BPP_1,
+	BMP_MONO,
+	(void*)colorMenuTable
+};
+
+const uint8_t downWifiNetworkTable[30] = { 0x0, 0x0, 0x0, 0x0, 0x1, 0x4, 0x1, 0x4, 0x1, 0x4, 0x3, 0x6, 0x3, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8F, 0x7, 0x8F, 0x7, 0x8F, 0x7, 0xDF, 0x7, 0xDF, 0x7 };
+
+const UG_BMP downWifiNetwork =
+{
+	(void*)downWifiNetworkTable,
+	11,
+	15,
+	BMP_BPP_1,
+	BMP_MONO,
+	(void*)colorMenuTable
+};
@@ -5473,6 +5473,123 @@ void _UG_PutText(UG_TEXT* txt)
    }
 }
 
+#ifdef USE_OBJECT_INDEX
+UG_U8 _UG_ObjectIndexGetCell( UG_S16 x, UG_S16 y )
+{
+   if ( x < 0 ) x = 0;
+   if ( y < 0 ) y = 0;
+   x /= UG_OBJECT_INDEX_CELL_WIDTH;
+   y /= UG_OBJECT_INDEX_CELL_HEIGHT;
+   if ( x >= UG_OBJECT_INDEX_COLUMNS ) x = UG_OBJECT_INDEX_COLUMNS-1;
+   if ( y >= UG_OBJECT_INDEX_ROWS ) y = UG_OBJECT_INDEX_ROWS-1;
+
+   return (UG_U8)(y*UG_OBJECT_INDEX_COLUMNS + x);
+}
+
+void _UG_ObjectIndexClear( UG_OBJECT_INDEX* index )
+{
+   UG_U8 c,w;
+
+   for(w=0; w<UG_OBJECT_MASK_WORDS; w++)
+   {
+      for(c=0; c<UG_OBJECT_INDEX_CELLS; c++) index->touch_grid[c][w] = 0;
+      index->touch_objects[w] = 0;
+      index->active_objects[w] = 0;
+   }
+   for(c=0; c<UG_OBJECT_INDEX_TYPES; c++)
+   {
+      for(w=0; w<=UG_OBJECT_INDEX_MAX_ID; w++) index->object_slot[c][w] = 0;
+   }
+   index->touch_pressed = 0;
+}
+
+UG_U8 _UG_ObjectIndexHasSlot( UG_U8 type, UG_U8 id )
+{
+   return ( (type != OBJ_TYPE_NONE) && (type <= UG_OBJECT_INDEX_TYPES) && (id <= UG_OBJECT_INDEX_MAX_ID) );
+}
+
+void _UG_ObjectIndexInsert( UG_WINDOW* wnd, UG_OBJECT* obj )
+{
+   UG_U8 i,cs,ce,col,row;
+   UG_OBJECT_INDEX* index = wnd->index;
+
+   if ( index == NULL ) return;
+   i = (UG_U8)(obj - wnd->objlst);
+
+   /* First object created with given type and ID is found by _UG_SearchObject */
+   if ( _UG_ObjectIndexHasSlot( obj->type, obj->id ) && (index->object_slot[obj->type-1][obj->id] == 0) )
+   {
+      index->object_slot[obj->type-1][obj->id] = i+1;
+   }
+
+   /* Only touch enabled objects are placed in the grid */
+   if ( !(obj->state & OBJ_STATE_TOUCH_ENABLE) ) return;
+
+   cs = _UG_ObjectIndexGetCell( obj->a_rel.xs, obj->a_rel.ys );
+   ce = _UG_ObjectIndexGetCell( obj->a_rel.xe, obj->a_rel.ye );
+
+   for(row=cs/UG_OBJECT_INDEX_COLUMNS; row<=ce/UG_OBJECT_INDEX_COLUMNS; row++)
+   {
+      for(col=cs%UG_OBJECT_INDEX_COLUMNS; col<=ce%UG_OBJECT_INDEX_COLUMNS; col++)
+      {
+         index->touch_grid[row*UG_OBJECT_INDEX_COLUMNS + col][i>>5] |= UG_OBJECT_MASK_BIT(i);
+      }
+   }
+}
+
+void _UG_ObjectIndexRemove( UG_WINDOW* wnd, UG_OBJECT* obj )
+{
+   UG_U8 i,c;
+   UG_OBJECT* other;
+   UG_OBJECT_INDEX* index = wnd->index;
+
+   if ( index == NULL ) return;
+   i = (UG_U8)(obj - wnd->objlst);
+   for(c=0; c<UG_OBJECT_INDEX_CELLS; c++) index->touch_grid[c][i>>5] &= ~UG_OBJECT_MASK_BIT(i);
+   index->touch_objects[i>>5] &= ~UG_OBJECT_MASK_BIT(i);
+   index->active_objects[i>>5] &= ~UG_OBJECT_MASK_BIT(i);
+
+   if ( _UG_ObjectIndexHasSlot( obj->type, obj->id ) && (index->object_slot[obj->type-1][obj->id] == i+1) )
+   {
+      /* Another object can use the same type and ID */
+      index->object_slot[obj->type-1][obj->id] = 0;
+      for(c=0; c<wnd->objcnt; c++)
+      {
+         other = (UG_OBJECT*)&wnd->objlst[c];
+         if ( (other != obj) && !(other->state & OBJ_STATE_FREE) && (other->state & OBJ_STATE_VALID)
+              && (other->type == obj->type) && (other->id == obj->id) )
+         {
+            index->object_slot[obj->type-1][obj->id] = c+1;
+            break;
+         }
+      }
+   }
+}
+
+void _UG_ObjectIndexSetActive( UG_WINDOW* wnd, UG_OBJECT* obj )
+{
+   UG_U8 i = (UG_U8)(obj - wnd->objlst);
+
+   if ( wnd->index != NULL ) wnd->index->active_objects[i>>5] |= UG_OBJECT_MASK_BIT(i);
+}
+
+void _UG_ObjectIndexRefreshActive( UG_WINDOW* wnd, UG_OBJECT* obj )
+{
+   UG_U8 i = (UG_U8)(obj - wnd->objlst);
+
+   /* Object stays in the list as long as update or event is pending */
+   if ( !(obj->state & OBJ_STATE_FREE) && (obj->state & OBJ_STATE_VALID)
+        && ( (obj->state & OBJ_STATE_UPDATE) || (obj->touch_state & (OBJ_TOUCH_STATE_CHANGED | OBJ_TOUCH_STATE_IS_PRESSED)) || (obj->event != OBJ_EVENT_NONE) ) )
+   {
+      wnd->index->active_objects[i>>5] |= UG_OBJECT_MASK_BIT(i);
+   }
+   else
+   {
+      wnd->index->active_objects[i>>5] &= ~UG_OBJECT_MASK_BIT(i);
+   }
+}
+#endif
+
 UG_OBJECT* _UG_GetFreeObject( UG_WINDOW* wnd )
 {
    UG_U8 i;
@@ -5495,6 +5612,18 @@ UG_OBJECT* _UG_SearchObject( UG_WINDOW* wnd, UG_U8 type, UG_U8 id )
    UG_U8 i;
    UG_OBJECT* obj=(UG_OBJECT*)wnd->objlst;
 
+#ifdef USE_OBJECT_INDEX
+   /* Direct lookup, IDs out of the table are searched below */
+   if ( (wnd->index != NULL) && _UG_ObjectIndexHasSlot( type, id ) )
+   {
+      i = wnd->index->object_slot[type-1][id];
+      if ( i == 0 ) return NULL;
+      obj = (UG_OBJECT*)(&wnd->objlst[i-1]);
+      _UG_ObjectIndexSetActive( wnd, obj );
+      return obj;
+   }
+#endif
+
    for(i=0;i<wnd->objcnt;i++)
    {
       obj = (UG_OBJECT*)(&wnd->objlst[i]);
@@ -5503,6 +5632,10 @@ UG_OBJECT* _UG_SearchObject( UG_WINDOW* wnd, UG_U8 type, UG_U8 id )
          if ( (obj->type == type) && (obj->id == id) )
          {
             /* Requested object found! */
+#ifdef USE_OBJECT_INDEX
+            /* All object functions find object here, so it will be checked in next update */
+            _UG_ObjectIndexSetActive( wnd, obj );
+#endif
             return obj;
          }
       }
@@ -5521,6 +5654,9 @@ UG_RESULT _UG_DeleteObject( UG_WINDOW* wnd, UG_U8 type, UG_U8 id )
    {
       /* We dont't want to delete a visible or busy object! */
       if ( (obj->state & OBJ_STATE_VISIBLE) || (obj->state & OBJ_STATE_UPDATE) ) return UG_RESULT_FAIL;
+#ifdef USE_OBJECT_INDEX
+      _UG_ObjectIndexRemove( wnd, obj );
+#endif
       obj->state = OBJ_STATE_INIT;
       obj->data = NULL;
       obj->event = 0;
@@ -5533,115 +5669,209 @@ UG_RESULT _UG_DeleteObject( UG_WINDOW* wnd, UG_U8 type, UG_U8 id )
    return UG_RESULT_FAIL;
 }
 
-void _UG_ProcessTouchData( UG_WINDOW* wnd )
+void _UG_ProcessObjectTouch( UG_OBJECT* obj, UG_S16 xp, UG_S16 yp, UG_U8 tchstate, UG_U8 pressed_before )
 {
-   UG_S16 xp,yp;
-   UG_U16 i,objcnt;
-   UG_OBJECT* obj;
    UG_U8 objstate;
    UG_U8 objtouch;
-   UG_U8 tchstate;
 
-   xp = gui->touch.xp;
-   yp = gui->touch.yp;
-   tchstate = gui->touch.state;
-
-   objcnt = wnd->objcnt;
-   for(i=0; i<objcnt; i++)
+   objstate = obj->state;
+   objtouch = obj->touch_state;
+   if ( !(objstate & OBJ_STATE_FREE) && (objstate & OBJ_STATE_VALID) && (objstate & OBJ_STATE_VISIBLE) && !(objstate & OBJ_STATE_REDRAW))
    {
-      obj = (UG_OBJECT*)&wnd->objlst[i];
-      objstate = obj->state;
-      objtouch = obj->touch_state;
-      if ( !(objstate & OBJ_STATE_FREE) && (objstate & OBJ_STATE_VALID) && (objstate & OBJ_STATE_VISIBLE) && !(objstate & OBJ_STATE_REDRAW))
+      /* Object wasn't checked when touch started - it was pressed outside */
+      if ( pressed_before && (tchstate) && xp != -1 && !(objtouch & OBJ_TOUCH_STATE_IS_PRESSED) )
       {
-         /* Process touch data */
-         if ( (tchstate) && xp != -1 )
+         objtouch |= OBJ_TOUCH_STATE_IS_PRESSED | OBJ_TOUCH_STATE_PRESSED_OUTSIDE_OBJECT;
+      }
+      /* Process touch data */
+      if ( (tchstate) && xp != -1 )
+      {
+         if ( !(objtouch & OBJ_TOUCH_STATE_IS_PRESSED) )
          {
-            if ( !(objtouch & OBJ_TOUCH_STATE_IS_PRESSED) )
-            {
-               objtouch |= OBJ_TOUCH_STATE_PRESSED_OUTSIDE_OBJECT | OBJ_TOUCH_STATE_CHANGED;
-               objtouch &= ~(OBJ_TOUCH_STATE_RELEASED_ON_OBJECT | OBJ_TOUCH_STATE_RELEASED_OUTSIDE_OBJECT | OBJ_TOUCH_STATE_CLICK_ON_OBJECT);
-            }
-            objtouch &= ~OBJ_TOUCH_STATE_IS_PRESSED_ON_OBJECT;
-            if ( xp >= obj->a_abs.xs )
+            objtouch |= OBJ_TOUCH_STATE_PRESSED_OUTSIDE_OBJECT | OBJ_TOUCH_STATE_CHANGED;
+            objtouch &= ~(OBJ_TOUCH_STATE_RELEASED_ON_OBJECT | OBJ_TOUCH_STATE_RELEASED_OUTSIDE_OBJECT | OBJ_TOUCH_STATE_CLICK_ON_OBJECT);
+         }
+         objtouch &= ~OBJ_TOUCH_STATE_IS_PRESSED_ON_OBJECT;
+         if ( xp >= obj->a_abs.xs )
+         {
+            if ( xp <= obj->a_abs.xe )
             {
-               if ( xp <= obj->a_abs.xe )
+               if ( yp >= obj->a_abs.ys )
                {
-                  if ( yp >= obj->a_abs.ys )
+                  if ( yp <= obj->a_abs.ye )
                   {
-                     if ( yp <= obj->a_abs.ye )
+                     objtouch |= OBJ_TOUCH_STATE_IS_PRESSED_ON_OBJECT;
+                     if ( !(objtouch & OBJ_TOUCH_STATE_IS_PRESSED) )
                      {
-                        objtouch |= OBJ_TOUCH_STATE_IS_PRESSED_ON_OBJECT;
-                        if ( !(objtouch & OBJ_TOUCH_STATE_IS_PRESSED) )
-                        {
-                           objtouch &= ~OBJ_TOUCH_STATE_PRESSED_OUTSIDE_OBJECT;
-                           objtouch |= OBJ_TOUCH_STATE_PRESSED_ON_OBJECT;
-                        }
+                        objtouch &= ~OBJ_TOUCH_STATE_PRESSED_OUTSIDE_OBJECT;
+                        objtouch |= OBJ_TOUCH_STATE_PRESSED_ON_OBJECT;
                      }
                   }
                }
             }
-            objtouch |= OBJ_TOUCH_STATE_IS_PRESSED;
          }
-         else if ( objtouch & OBJ_TOUCH_STATE_IS_PRESSED )
+         objtouch |= OBJ_TOUCH_STATE_IS_PRESSED;
+      }
+      else if ( objtouch & OBJ_TOUCH_STATE_IS_PRESSED )
+      {
+         if ( objtouch & OBJ_TOUCH_STATE_IS_PRESSED_ON_OBJECT )
          {
-            if ( objtouch & OBJ_TOUCH_STATE_IS_PRESSED_ON_OBJECT )
-            {
-               if ( objtouch & OBJ_TOUCH_STATE_PRESSED_ON_OBJECT ) objtouch |= OBJ_TOUCH_STATE_CLICK_ON_OBJECT;
-               objtouch |= OBJ_TOUCH_STATE_RELEASED_ON_OBJECT;
-            }
-            else
-            {
-               objtouch |= OBJ_TOUCH_STATE_RELEASED_OUTSIDE_OBJECT;
-            }
-            if ( objtouch & OBJ_TOUCH_STATE_IS_PRESSED )
-            {
-               objtouch |= OBJ_TOUCH_STATE_CHANGED;
-            }
-            objtouch &= ~(OBJ_TOUCH_STATE_PRESSED_OUTSIDE_OBJECT | OBJ_TOUCH_STATE_PRESSED_ON_OBJECT | OBJ_TOUCH_STATE_IS_PRESSED);
+            if ( objtouch & OBJ_TOUCH_STATE_PRESSED_ON_OBJECT ) objtouch |= OBJ_TOUCH_STATE_CLICK_ON_OBJECT;
+            objtouch |= OBJ_TOUCH_STATE_RELEASED_ON_OBJECT;
+         }
+         else
+         {
+            objtouch |= OBJ_TOUCH_STATE_RELEASED_OUTSIDE_OBJECT;
+         }
+         if ( objtouch & OBJ_TOUCH_STATE_IS_PRESSED )
+         {
+            objtouch |= OBJ_TOUCH_STATE_CHANGED;
          }
+         objtouch &= ~(OBJ_TOUCH_STATE_PRESSED_OUTSIDE_OBJECT | OBJ_TOUCH_STATE_PRESSED_ON_OBJECT | OBJ_TOUCH_STATE_IS_PRESSED);
       }
-      obj->touch_state = objtouch;
    }
+   obj->touch_state = objtouch;
 }
 
-void _UG_UpdateObjects( UG_WINDOW* wnd )
+void _UG_ProcessTouchData( UG_WINDOW* wnd )
 {
-   UG_U16 i,objcnt;
+   UG_S16 xp,yp;
+   UG_U16 i;
+   UG_U8 tchstate;
+#ifdef USE_OBJECT_INDEX
+   UG_OBJECT_INDEX* index = wnd->index;
    UG_OBJECT* obj;
+   UG_AREA a;
+   UG_U32 candidates[UG_OBJECT_MASK_WORDS];
+   UG_U32 mask;
+   UG_U8 w,cell,pressed;
+#endif
+
+   xp = gui->touch.xp;
+   yp = gui->touch.yp;
+   tchstate = gui->touch.state;
+
+#ifdef USE_OBJECT_INDEX
+   if ( index != NULL )
+   {
+      pressed = ( (tchstate) && xp != -1 );
+
+      /* Only objects from touched cell and already pressed objects can change the state */
+      for(w=0; w<UG_OBJECT_MASK_WORDS; w++) candidates[w] = index->touch_objects[w];
+      if ( pressed )
+      {
+         UG_WindowGetArea(wnd,&a);
+         cell = _UG_ObjectIndexGetCell( xp-a.xs, yp-a.ys );
+         for(w=0; w<UG_OBJECT_MASK_WORDS; w++) candidates[w] |= index->touch_grid[cell][w];
+      }
+
+      for(w=0; w<UG_OBJECT_MASK_WORDS; w++)
+      {
+         for(i=w*32, mask=candidates[w]; mask!=0; i++, mask>>=1)
+         {
+            if ( !(mask & 1) ) continue;
+            obj = (UG_OBJECT*)&wnd->objlst[i];
+            _UG_ProcessObjectTouch( obj, xp, yp, tchstate, index->touch_pressed );
+
+            if ( obj->touch_state & OBJ_TOUCH_STATE_IS_PRESSED ) index->touch_objects[w] |= UG_OBJECT_MASK_BIT(i);
+            else index->touch_objects[w] &= ~UG_OBJECT_MASK_BIT(i);
+            if ( obj->touch_state & (OBJ_TOUCH_STATE_CHANGED | OBJ_TOUCH_STATE_IS_PRESSED) ) _UG_ObjectIndexSetActive( wnd, obj );
+         }
+      }
+      index->touch_pressed = pressed;
+      return;
+   }
+#endif
+   for(i=0; i<wnd->objcnt; i++)
+   {
+      _UG_ProcessObjectTouch( (UG_OBJECT*)&wnd->objlst[i], xp, yp, tchstate, 0 );
+   }
+}
+
+void _UG_UpdateObject( UG_WINDOW* wnd, UG_OBJECT* obj )
+{
    UG_U8 objstate;
    UG_U8 objtouch;
 
-   /* Check each object, if it needs to be updated? */
-   objcnt = wnd->objcnt;
-   for(i=0; i<objcnt; i++)
+   objstate = obj->state;
+   objtouch = obj->touch_state;
+   if ( !(objstate & OBJ_STATE_FREE) && (objstate & OBJ_STATE_VALID) )
    {
-      obj = (UG_OBJECT*)&wnd->objlst[i];
-      objstate = obj->state;
-      objtouch = obj->touch_state;
-      if ( !(objstate & OBJ_STATE_FREE) && (objstate & OBJ_STATE_VALID) )
+      if ( objstate & OBJ_STATE_UPDATE )
+      {
+         obj->update(wnd,obj);
+      }
+      if ( (objstate & OBJ_STATE_VISIBLE) && (objstate & OBJ_STATE_TOUCH_ENABLE) )
       {
-         if ( objstate & OBJ_STATE_UPDATE )
+         if ( (objtouch & (OBJ_TOUCH_STATE_CHANGED | OBJ_TOUCH_STATE_IS_PRESSED)) )
          {
             obj->update(wnd,obj);
          }
-         if ( (objstate & OBJ_STATE_VISIBLE) && (objstate & OBJ_STATE_TOUCH_ENABLE) )
+      }
+   }
+}
+
+void _UG_UpdateObjects( UG_WINDOW* wnd )
+{
+   UG_U16 i;
+#ifdef USE_OBJECT_INDEX
+   UG_OBJECT* obj;
+   UG_U32 mask;
+   UG_U8 w;
+
+   /* Check only objects which wait for update */
+   if ( wnd->index != NULL )
+   {
+      for(w=0; w<UG_OBJECT_MASK_WORDS; w++)
+      {
+         for(i=w*32, mask=wnd->index->active_objects[w]; mask!=0; i++, mask>>=1)
          {
-            if ( (objtouch & (OBJ_TOUCH_STATE_CHANGED | OBJ_TOUCH_STATE_IS_PRESSED)) )
-            {
-               obj->update(wnd,obj);
-            }
+            if ( !(mask & 1) ) continue;
+            obj = (UG_OBJECT*)&wnd->objlst[i];
+            _UG_UpdateObject( wnd, obj );
+            _UG_ObjectIndexRefreshActive( wnd, obj );
          }
       }
+      return;
+   }
+#endif
+   /* Check each object, if it needs to be updated? */
+   for(i=0; i<wnd->objcnt; i++)
+   {
+      _UG_UpdateObject( wnd, (UG_OBJECT*)&wnd->objlst[i] );
    }
 }
 
-void _UG_HandleEvents( UG_WINDOW* wnd )
+void _UG_HandleObjectEvent( UG_WINDOW* wnd, UG_OBJECT* obj, UG_MESSAGE* msg )
 {
-   UG_U16 i,objcnt;
-   UG_OBJECT* obj;
    UG_U8 objstate;
+
+   objstate = obj->state;
+   if ( !(objstate & OBJ_STATE_FREE) && (objstate & OBJ_STATE_VALID) )
+   {
+      if ( obj->event != OBJ_EVENT_NONE )
+      {
+         msg->src = &obj;
+         msg->id = obj->type;
+         msg->sub_id = obj->id;
+         msg->event = obj->event;
+
+         wnd->cb( msg );
+
+         obj->event = OBJ_EVENT_NONE;
+      }
+   }
+}
+
+void _UG_HandleEvents( UG_WINDOW* wnd )
+{
+   UG_U16 i;
    static UG_MESSAGE msg;
+#ifdef USE_OBJECT_INDEX
+   UG_OBJECT* obj;
+   UG_U32 mask;
+   UG_U8 w;
+#endif
    msg.src = NULL;
 
    /* Handle window-related events */
@@ -5650,25 +5880,25 @@ void _UG_HandleEvents( UG_WINDOW* wnd )
 
    /* Handle object-related events */
    msg.type = MSG_TYPE_OBJECT;
-   objcnt = wnd->objcnt;
-   for(i=0; i<objcnt; i++)
+#ifdef USE_OBJECT_INDEX
+   if ( wnd->index != NULL )
    {
-      obj = (UG_OBJECT*)&wnd->objlst[i];
-      objstate = obj->state;
-      if ( !(objstate & OBJ_STATE_FREE) && (objstate & OBJ_STATE_VALID) )
+      for(w=0; w<UG_OBJECT_MASK_WORDS; w++)
       {
-         if ( obj->event != OBJ_EVENT_NONE )
+         for(i=w*32, mask=wnd->index->active_objects[w]; mask!=0; i++, mask>>=1)
          {
-            msg.src = &obj;
-            msg.id = obj->type;
-            msg.sub_id = obj->id;
-            msg.event = obj->event;
-
-            wnd->cb( &msg );
-
-            obj->event = OBJ_EVENT_NONE;
+            if ( !(mask & 1) ) continue;
+            obj = (UG_OBJECT*)&wnd->objlst[i];
+            _UG_HandleObjectEvent( wnd, obj, &msg );
+            _UG_ObjectIndexRefreshActive( wnd, obj );
          }
       }
+      return;
+   }
+#endif
+   for(i=0; i<wnd->objcnt; i++)
+   {
+      _UG_HandleObjectEvent( wnd, (UG_OBJECT*)&wnd->objlst[i], &msg );
    }
 }
 
@@ -5977,6 +6207,9 @@ UG_RESULT UG_WindowCreate( UG_WINDOW* wnd, UG_OBJECT* objlst, UG_U8 objcnt, void
    wnd->objcnt = objcnt;
    wnd->objlst = objlst;
    wnd->state = WND_STATE_VALID;
+#ifdef USE_OBJECT_INDEX
+   wnd->index = NULL;
+#endif
    #ifdef USE_COLOR_RGB888
    wnd->fc = 0x000000;
    wnd->bc = 0xF0F0F0;
@@ -6216,6 +6449,38 @@ UG_RESULT UG_WindowSetTitleTextFont( UG_WINDOW* wnd, const UG_FONT* font )
    return UG_RESULT_FAIL;
 }
 
+#ifdef USE_OBJECT_INDEX
+UG_RESULT UG_WindowSetObjectIndex( UG_WINDOW* wnd, UG_OBJECT_INDEX* index )
+{
+   UG_U8 i;
+   UG_OBJECT* obj;
+
+   if ( (wnd != NULL) && (wnd->state & WND_STATE_VALID) )
+   {
+      if ( (index != NULL) && (wnd->objcnt > UG_OBJECT_INDEX_MAX_OBJECTS) ) return UG_RESULT_FAIL;
+
+      /* NULL index returns window to linear search */
+      wnd->index = index;
+      if ( index == NULL ) return UG_RESULT_OK;
+
+      /* Objects created before are indexed now */
+      _UG_ObjectIndexClear( index );
+      for(i=0; i<wnd->objcnt; i++)
+      {
+         obj = (UG_OBJECT*)&wnd->objlst[i];
+         if ( !(obj->state & OBJ_STATE_FREE) && (obj->state & OBJ_STATE_VALID) )
+         {
+            _UG_ObjectIndexInsert( wnd, obj );
+            if ( obj->touch_state & OBJ_TOUCH_STATE_IS_PRESSED ) index->touch_objects[i>>5] |= UG_OBJECT_MASK_BIT(i);
+            _UG_ObjectIndexRefreshActive( wnd, obj );
+         }
+      }
+      return UG_RESULT_OK;
+   }
+   return UG_RESULT_FAIL;
+}
+#endif
+
 UG_RESULT UG_WindowSetTitleTextHSpace( UG_WINDOW* wnd, UG_S8 hs )
 {
    if ( (wnd != NULL) && (wnd->state & WND_STATE_VALID) )
@@ -6682,7 +6947,13 @@ void _UG_WindowUpdate( UG_WINDOW* wnd )
       for(i=0; i<objcnt; i++)
       {
          obj = (UG_OBJECT*)&wnd->objlst[i];
-         if ( !(obj->state & OBJ_STATE_FREE) && (obj->state & OBJ_STATE_VALID) && (obj->state & OBJ_STATE_VISIBLE) ) obj->state |= (OBJ_STATE_UPDATE | OBJ_STATE_REDRAW);
+         if ( !(obj->state & OBJ_STATE_FREE) && (obj->state & OBJ_STATE_VALID) && (obj->state & OBJ_STATE_VISIBLE) )
+         {
+            obj->state |= (OBJ_STATE_UPDATE | OBJ_STATE_REDRAW);
+#ifdef USE_OBJECT_INDEX
+            _UG_ObjectIndexSetActive( wnd, obj );
+#endif
+         }
       }
    }
    else
@@ -6756,6 +7027,9 @@ UG_RESULT UG_ButtonCreate( UG_WINDOW* wnd, UG_BUTTON* btn, UG_U8 id, UG_S16 xs,
 
    /* Update function: Do your thing! */
    obj->state &= ~OBJ_STATE_FREE;
+#ifdef USE_OBJECT_INDEX
+   _UG_ObjectIndexInsert( wnd, obj );
+#endif
 
    return UG_RESULT_OK;
 }
@@ -7295,6 +7569,9 @@ UG_RESULT UG_CheckboxCreate( UG_WINDOW* wnd, UG_CHECKBOX* chb, UG_U8 id, UG_S16
 
    /* Update function: Do your thing! */
    obj->state &= ~OBJ_STATE_FREE;
+#ifdef USE_OBJECT_INDEX
+   _UG_ObjectIndexInsert( wnd, obj );
+#endif
 
    return UG_RESULT_OK;
 }
@@ -7894,6 +8171,9 @@ UG_RESULT UG_TextboxCreate( UG_WINDOW* wnd, UG_TEXTBOX* txb, UG_U8 id, UG_S16 xs
 
    /* Update function: Do your thing! */
    obj->state &= ~OBJ_STATE_FREE;
+#ifdef USE_OBJECT_INDEX
+   _UG_ObjectIndexInsert( wnd, obj );
+#endif
 
    return UG_RESULT_OK;
 }
@@ -8238,6 +8518,9 @@ UG_RESULT UG_ImageCreate( UG_WINDOW* wnd, UG_IMAGE* img, UG_U8 id, UG_S16 xs, UG
 
    /* Update function: Do your thing! */
    obj->state &= ~OBJ_STATE_FREE;
+#ifdef USE_OBJECT_INDEX
+   _UG_ObjectIndexInsert( wnd, obj );
+#endif
 
    return UG_RESULT_OK;
 }
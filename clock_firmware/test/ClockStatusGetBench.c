@@ -0,0 +1,133 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Benchmark of processing of SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET request with cached
+ * response and with cache invalidated by WIFI_ClockStatusChanged() before each request,
+ * which is the same work as coding of response before cache was added. Each request is
+ * written to socket buffer, validated, its descriptor is found in MethodDescriptorTable and
+ * it is processed by WIFI_ProcessRequest which code response in the same buffer. ESP layer
+ * and UART aren't part of measurement, they send the same response in both cases. Static
+ * functions of WIFI_InteractionLayer.c are used, so the file is included here and isn't
+ * linked second time. Host time doesn't say how long processing takes on LPC11E68, but it
+ * show the part of request path removed by the cache.
+ */
+
+#include "../src/WIFI_InteractionLayer.c"
+#include "TestAssert.h"
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_NUMBER_OF_REQUESTS	2000000U
+#define BENCH_SOCKET_ID				0U
+
+static WifiStateType BenchState;
+static uint8_t Request[MAX_SIZE_OF_SOCKET_BUFFER];
+static uint16_t RequestSize;
+static SocketMessage RxMessage;
+static volatile uint32_t Sink;
+
+/*****************************************************************************************
+* ProcessGetRequest() - validate and process request like WIFI_ReceiveRequests and
+* WIFI_DispatchRequest do it.
+*
+* Return: size of response.
+*****************************************************************************************/
+static uint16_t ProcessGetRequest(bool invalidateCache)
+{
+	uint16_t responseSize;
+
+	if(invalidateCache)
+		WIFI_ClockStatusChanged();
+
+	//response overwrite request so request is written to buffer each time like by framer of ESP layer
+	memcpy(RxMessage.payload, Request, RequestSize);
+
+	if(SOMEIP_ValidateRxMessage(RxMessage.payload, RxMessage.payloadSize) == false)
+		return 0;
+
+	WIFI_ProcessRequest(&BenchState, &RxMessage, WIFI_FindMethodDescriptor(SOMEIP_GetServiceId(RxMessage.payload),
+		SOMEIP_GetMethodId(RxMessage.payload)));
+
+	//release buffer like after send of response
+	responseSize = RxMessage.payloadSize;
+	RxMessage.payloadSize = RequestSize;
+	RxMessage.transmitFlag = false;
+	RxMessage.lockFlag = false;
+
+	return responseSize;
+}
+
+/*****************************************************************************************
+* Measure() - process requests and print time of one request.
+*
+* Return: nanoseconds per request.
+*****************************************************************************************/
+static double Measure(const char* name, bool invalidateCache)
+{
+	struct timespec start, end;
+	double nanoseconds;
+	uint32_t responseBytes = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for(uint32_t i = 0; i < BENCH_NUMBER_OF_REQUESTS; i++)
+		responseBytes += ProcessGetRequest(invalidateCache);
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	TEST_ASSERT_EQUAL(BENCH_NUMBER_OF_REQUESTS*(uint32_t)(SOME_IP_MINIMAL_MESSAGE_SIZE + SOME_IP_CRC_SIZE
+		+ SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET_PAYLOAD_SIZE), responseBytes);
+	Sink += responseBytes;
+
+	nanoseconds = ((end.tv_sec - start.tv_sec)*1e9 + (end.tv_nsec - start.tv_nsec))/BENCH_NUMBER_OF_REQUESTS;
+	printf("%-12s %6.1f ns per CLOCK_STATUS GET request\n", name, nanoseconds);
+
+	return nanoseconds;
+}
+
+int main(void)
+{
+	uint8_t cachedResponse[MAX_SIZE_OF_SOCKET_BUFFER];
+	uint16_t responseSize;
+	double cachedTime, invalidatedTime;
+
+	ClockState.currentTimeMinute = 30;
+	ClockState.currentTimeHour = 12;
+	ClockState.day = 15;
+	ClockState.month = 6;
+	ClockState.year = 24;
+
+	RequestSize = SOMEIP_CodeTxMessage(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET,
+		SOME_IP_REQUEST_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE, Request, NULL, 0);
+	RxMessage.payloadSize = RequestSize;
+	RxMessage.socketId = BENCH_SOCKET_ID;
+
+	//cached response must be the same as coded one
+	responseSize = ProcessGetRequest(true);
+	TEST_ASSERT(responseSize != 0);
+	memcpy(cachedResponse, RxMessage.payload, responseSize);
+	TEST_ASSERT_EQUAL(responseSize, ProcessGetRequest(false));
+	TEST_ASSERT(memcmp(cachedResponse, RxMessage.payload, responseSize) == 0);
+
+	cachedTime = Measure("cached", false);
+	invalidatedTime = Measure("invalidated", true);
+	printf("invalidated / cached: %.2f\n", invalidatedTime/cachedTime);
+
+	return TEST_RESULT("ClockStatusGetBench");
+}
@@ -0,0 +1,201 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Test of CobsFraming: coded bytes of examples from module description, round trip of
+ * messages of different length with and without 0x00 including blocks of 254 bytes,
+ * delimiters between messages and synchronization on next delimiter after lost byte.
+ */
+
+#include "CobsFraming.h"
+#include "TestAssert.h"
+#include <stdint.h>
+#include <string.h>
+
+#define TEST_MAX_MESSAGE_SIZE	600U
+#define TEST_MAX_STREAM_SIZE	(2U*COBS_FRAMING_MAX_ENCODED_SIZE(TEST_MAX_MESSAGE_SIZE))
+
+typedef struct
+{
+	uint8_t data[TEST_MAX_MESSAGE_SIZE];
+	uint16_t size;
+}TestMessage;
+
+static void CheckCodedBytes(const uint8_t* data, uint16_t size, const uint8_t* expectedBytes, uint16_t expectedSize)
+{
+	uint8_t buffer[COBS_FRAMING_MAX_ENCODED_SIZE(TEST_MAX_MESSAGE_SIZE)];
+
+	TEST_ASSERT_EQUAL(expectedSize, CobsFraming_Encode(data, size, buffer, sizeof(buffer)));
+	TEST_ASSERT(memcmp(buffer, expectedBytes, expectedSize) == 0);
+}
+
+/*****************************************************************************************
+* DecodeStream() - decode stream byte after byte like receiver of serial link.
+*
+* Return: number of correct messages stored in messageTable, frame errors are counted in
+*  numberOfErrors.
+*****************************************************************************************/
+static uint8_t DecodeStream(const uint8_t* stream, uint16_t streamSize, TestMessage* messageTable,
+	uint8_t maxNumberOfMessages, uint8_t* numberOfErrors)
+{
+	CobsDecoder decoder;
+	uint8_t numberOfMessages = 0;
+
+	CobsFraming_InitDecoder(&decoder);
+	messageTable[0].size = 0;
+	*numberOfErrors = 0;
+
+	for(uint16_t i = 0; (i < streamSize) && (numberOfMessages < maxNumberOfMessages); i++)
+	{
+		TestMessage* message = &messageTable[numberOfMessages];
+		uint8_t decodedByte = 0xAA;
+
+		switch(CobsFraming_DecodeByte(&decoder, stream[i], &decodedByte))
+		{
+		case COBS_DECODE_DATA:
+			TEST_ASSERT(message->size < TEST_MAX_MESSAGE_SIZE);
+
+			if(message->size < TEST_MAX_MESSAGE_SIZE)
+				message->data[message->size++] = decodedByte;
+			break;
+		case COBS_DECODE_FRAME_END:
+			numberOfMessages++;
+
+			if(numberOfMessages < maxNumberOfMessages)
+				messageTable[numberOfMessages].size = 0;
+			break;
+		case COBS_DECODE_FRAME_ERROR:
+			(*numberOfErrors)++;
+			message->size = 0;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return numberOfMessages;
+}
+
+static void CheckRoundTrip(const uint8_t* data, uint16_t size)
+{
+	uint8_t stream[COBS_FRAMING_MAX_ENCODED_SIZE(TEST_MAX_MESSAGE_SIZE)];
+	static TestMessage messageTable[1];
+	uint16_t streamSize = CobsFraming_Encode(data, size, stream, sizeof(stream));
+	uint8_t numberOfErrors;
+
+	TEST_ASSERT(streamSize != 0);
+	TEST_ASSERT(streamSize <= COBS_FRAMING_MAX_ENCODED_SIZE(size));
+	TEST_ASSERT_EQUAL(COBS_FRAMING_DELIMITER, stream[streamSize - 1]);
+	TEST_ASSERT(memchr(stream, COBS_FRAMING_DELIMITER, streamSize - 1) == NULL);
+
+	TEST_ASSERT_EQUAL(1, DecodeStream(stream, streamSize, messageTable, 1, &numberOfErrors));
+	TEST_ASSERT_EQUAL(0, numberOfErrors);
+	TEST_ASSERT_EQUAL(size, messageTable[0].size);
+	TEST_ASSERT(memcmp(messageTable[0].data, data, size) == 0);
+}
+
+static void TestCodedBytes(void)
+{
+	const uint8_t message[] = {0x11, 0x22, 0x00, 0x33};
+	const uint8_t messageBytes[] = {0x03, 0x11, 0x22, 0x02, 0x33, 0x00};
+	const uint8_t zero[] = {0x00};
+	const uint8_t zeroBytes[] = {0x01, 0x01, 0x00};
+	const uint8_t emptyBytes[] = {0x01, 0x00};
+	uint8_t longBlock[254];
+	uint8_t longBlockBytes[sizeof(longBlock) + 3];
+	uint8_t buffer[COBS_FRAMING_MAX_ENCODED_SIZE(sizeof(longBlock))];
+
+	CheckCodedBytes(message, sizeof(message), messageBytes, sizeof(messageBytes));
+	CheckCodedBytes(zero, sizeof(zero), zeroBytes, sizeof(zeroBytes));
+	CheckCodedBytes(NULL, 0, emptyBytes, sizeof(emptyBytes));
+
+	//254 bytes without 0x00 fill block with code 0xFF, next block is empty
+	memset(longBlock, 0x5A, sizeof(longBlock));
+	longBlockBytes[0] = COBS_FRAMING_MAX_BLOCK_CODE;
+	memset(&longBlockBytes[1], 0x5A, sizeof(longBlock));
+	longBlockBytes[sizeof(longBlock) + 1] = 0x01;
+	longBlockBytes[sizeof(longBlock) + 2] = COBS_FRAMING_DELIMITER;
+	CheckCodedBytes(longBlock, sizeof(longBlock), longBlockBytes, sizeof(longBlockBytes));
+
+	//buffer must have place for the worst case
+	TEST_ASSERT_EQUAL(0, CobsFraming_Encode(longBlock, sizeof(longBlock), buffer, sizeof(buffer) - 1));
+}
+
+static void TestRoundTrip(void)
+{
+	static uint8_t data[TEST_MAX_MESSAGE_SIZE];
+	uint32_t seed = 1;
+
+	for(uint16_t size = 0; size <= TEST_MAX_MESSAGE_SIZE; size++)
+	{
+		//without 0x00, only 0x00 and random bytes with about 1/8 of 0x00
+		memset(data, 0xA5, size);
+		CheckRoundTrip(data, size);
+		memset(data, 0x00, size);
+		CheckRoundTrip(data, size);
+
+		for(uint16_t i = 0; i < size; i++)
+		{
+			seed = seed*1103515245U + 12345U;
+			data[i] = ((seed >> 16) & 7U) ? (uint8_t)(seed >> 24) | 1U : 0x00;
+		}
+
+		CheckRoundTrip(data, size);
+	}
+}
+
+static void TestStream(void)
+{
+	const uint8_t first[] = {0x01, 0x00, 0x02};
+	const uint8_t second[] = {0x00, 0x00, 0x03, 0x04, 0x00};
+	static uint8_t stream[TEST_MAX_STREAM_SIZE];
+	static TestMessage messageTable[3];
+	uint16_t size = 0;
+	uint8_t numberOfErrors;
+
+	//delimiters before and between messages are ignored
+	stream[size++] = COBS_FRAMING_DELIMITER;
+	size += CobsFraming_Encode(first, sizeof(first), &stream[size], sizeof(stream) - size);
+	stream[size++] = COBS_FRAMING_DELIMITER;
+	size += CobsFraming_Encode(second, sizeof(second), &stream[size], sizeof(stream) - size);
+
+	TEST_ASSERT_EQUAL(2, DecodeStream(stream, size, messageTable, 3, &numberOfErrors));
+	TEST_ASSERT_EQUAL(0, numberOfErrors);
+	TEST_ASSERT_EQUAL(sizeof(first), messageTable[0].size);
+	TEST_ASSERT(memcmp(messageTable[0].data, first, sizeof(first)) == 0);
+	TEST_ASSERT_EQUAL(sizeof(second), messageTable[1].size);
+	TEST_ASSERT(memcmp(messageTable[1].data, second, sizeof(second)) == 0);
+
+	//lost code byte of second block of first message, second message is received after next delimiter
+	memmove(&stream[3], &stream[4], size - 4);
+	size--;
+
+	TEST_ASSERT_EQUAL(1, DecodeStream(stream, size, messageTable, 3, &numberOfErrors));
+	TEST_ASSERT_EQUAL(1, numberOfErrors);
+	TEST_ASSERT_EQUAL(sizeof(second), messageTable[0].size);
+	TEST_ASSERT(memcmp(messageTable[0].data, second, sizeof(second)) == 0);
+}
+
+int main(void)
+{
+	TestCodedBytes();
+	TestRoundTrip();
+	TestStream();
+
+	return TEST_RESULT("CobsFramingTest");
+}
@@ -0,0 +1,600 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Transcript test of RX parser of ESP layer. Each transcript is list of steps, step send AT
+ * request(or nothing if module send only events), pass response and events of ESP8266 to
+ * UART model and process response by appropriate function. Result of each step(sent bytes,
+ * state of request, result of process function, parsed data and received messages) is
+ * written to log. Transcript is fed as one block, byte after byte and in random chunks and
+ * all logs must be equal to golden log.
+ * Golden logs were recorded by the same steps executed with parser of ESP layer before RX
+ * ring and byte parser were introduced(strstr search in RX buffer), so new parser must give
+ * the same result like old one for data which old parser handled correctly. Transcripts
+ * of golden tests avoid known issues of old parser: link state after n,CONNECT(socket was
+ * never marked as open), result codes or NUL inside payload of +IPD and messages divided
+ * into few +IPD payloads or coalesced in one payload(old parser returned payload of +IPD as
+ * one message). Behavior of new parser in those cases is checked by separate tests.
+ * Run test with parameter --print to print logs of golden transcripts.
+ */
+
+#include "ESP_Layer.h"
+#include "HostUart.h"
+#include "TestAssert.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_LOG_SIZE 				8192U
+#define TEST_REQUEST_SEND_CALLS		30U //ESP_Process calls after request, longest request is send in few calls
+#define TEST_DEFAULT_IDLE_CALLS		5U //ESP_Process calls after last chunk of step
+#define TEST_RANDOM_FEED_RUNS		50U
+#define TEST_MAX_CHUNK_SIZE			32U
+#define TEST_MESSAGE_MARKER			'#' //place of SOME/IP message inside rxData
+
+typedef enum
+{
+	TEST_RESPONSE_NONE = 0,//only events, nothing to process
+	TEST_RESPONSE_GENERAL,
+	TEST_RESPONSE_APN_LIST,
+	TEST_RESPONSE_IP,
+	TEST_RESPONSE_CONNECTION_STATUS,
+}TEST_RESPONSE_TYPE;
+
+typedef enum
+{
+	TEST_FEED_WHOLE = 0,
+	TEST_FEED_BYTE,
+	TEST_FEED_RANDOM,
+}TEST_FEED_MODE;
+
+typedef struct
+{
+	bool (*requestFunction)(void);//NULL if module send only events
+	TEST_RESPONSE_TYPE responseType;
+	const char* rxData;//each TEST_MESSAGE_MARKER is replaced by message with size from messageSizeTable
+	uint16_t messageSizeTable[2];
+	uint16_t idleCalls;//additional ESP_Process calls, used to reach request timeout
+}TranscriptStep;
+
+typedef struct
+{
+	const char* name;
+	const TranscriptStep* stepTable;
+	uint8_t numberOfSteps;
+	const char* goldenLog;
+}Transcript;
+
+static char TestLog[TEST_LOG_SIZE];
+static uint32_t TestLogSize;
+static uint32_t RandomState;
+static uint8_t TxCapture[TX_RX_BUFFER_SIZE];
+static uint32_t TxCaptureSize;
+static uint8_t WriteData[24];
+
+/*****************************************************************************************
+* Requests with parameters used by transcripts.
+*****************************************************************************************/
+static bool RequestWifiMode(void)
+{
+	return ESP_SendWifiModeRequest(AT_STATION_MODE);
+}
+
+static bool RequestConnectToApn(void)
+{
+	return ESP_SendConnectToApnRequest("HomeNet", "secret12");
+}
+
+static bool RequestServer(void)
+{
+	return ESP_SendServerCommandRequest(true, 3000U);
+}
+
+static bool RequestWriteSocket0(void)
+{
+	return ESP_SendWriteDataRequest(0U, sizeof(WriteData));
+}
+
+static bool RequestWrite(void)
+{
+	for(uint8_t i = 0; i < sizeof(WriteData); i++)
+		WriteData[i] = (uint8_t)(0x80U + i*3U);
+
+	return ESP_Write(WriteData, sizeof(WriteData));
+}
+
+/*****************************************************************************************
+* Golden transcripts.
+*****************************************************************************************/
+static const TranscriptStep StartupSteps[] =
+{
+	{ESP_SendDetectDeviceRequest, TEST_RESPONSE_GENERAL, "AT\r\r\n\r\nOK\r\n", {0}, 0},
+	{ESP_SendResetRequest, TEST_RESPONSE_GENERAL, "AT+RST\r\r\n\r\nOK\r\n", {0}, 0},
+	{NULL, TEST_RESPONSE_NONE, "\r\n ets Jan  8 2013,rst cause:2, boot mode:(3,6)\r\n\r\nload 0x40100000, len 1856, room 16 \r\n"
+		"tail 0\r\nchksum 0x63\r\n\r\nready\r\n", {0}, 0},
+	{RequestWifiMode, TEST_RESPONSE_GENERAL, "AT+CWMODE_CUR=1\r\r\n\r\nOK\r\n", {0}, 0},
+	{ESP_SendApnListRequest, TEST_RESPONSE_APN_LIST, "AT+CWLAP\r\r\n"
+		"+CWLAP:(3,\"HomeNet\",-67,\"aa:bb:cc:dd:ee:ff\",1,-12,0)\r\n"
+		"+CWLAP:(4,\"Office 2\",-80,\"11:22:33:44:55:66\",6,-5,0)\r\n"
+		"+CWLAP:(0,\"Guest\",-91,\"12:34:56:78:9a:bc\",11,3,0)\r\n\r\nOK\r\n", {0}, 0},
+	{RequestConnectToApn, TEST_RESPONSE_GENERAL, "AT+CWJAP_CUR=\"HomeNet\",\"secret12\"\r\r\n"
+		"WIFI CONNECTED\r\nWIFI GOT IP\r\n\r\nOK\r\n", {0}, 0},
+	{ESP_GetAssignedIpAddress, TEST_RESPONSE_IP, "AT+CIFSR\r\r\n+CIFSR:STAIP,\"192.168.1.50\"\r\n"
+		"+CIFSR:STAMAC,\"18:fe:34:00:00:01\"\r\n\r\nOK\r\n", {0}, 0},
+	{ESP_SendAcceptMultipleConnectionRequest, TEST_RESPONSE_GENERAL, "AT+CIPMUX=1\r\r\n\r\nOK\r\n", {0}, 0},
+	{RequestServer, TEST_RESPONSE_GENERAL, "AT+CIPSERVER=1,3000\r\r\n\r\nOK\r\n", {0}, 0},
+};
+
+static const TranscriptStep ServerSteps[] =
+{
+	{NULL, TEST_RESPONSE_NONE, "0,CONNECT\r\n", {0}, 0},
+	{ESP_GetConnectionStatus, TEST_RESPONSE_CONNECTION_STATUS, "AT+CIPSTATUS\r\r\nSTATUS:3\r\n"
+		"+CIPSTATUS:0,\"TCP\",\"192.168.1.3\",51171,3000,1\r\n\r\nOK\r\n", {0}, 0},
+	{NULL, TEST_RESPONSE_NONE, "\r\n+IPD,0,24:#", {24}, 0},
+	{RequestWriteSocket0, TEST_RESPONSE_GENERAL, "AT+CIPSEND=0,24\r\r\n\r\nOK\r\n> ", {0}, 0},
+	{RequestWrite, TEST_RESPONSE_GENERAL, "\r\nRecv 24 bytes\r\n\r\nSEND OK\r\n", {0}, 0},
+	{NULL, TEST_RESPONSE_NONE, "1,CONNECT\r\n\r\n+IPD,1,64:#", {64}, 0},
+	{NULL, TEST_RESPONSE_NONE, "\r\n+IPD,0,16:#\r\n+IPD,1,190:#", {16, 190}, 0},
+	{ESP_GetConnectionStatus, TEST_RESPONSE_CONNECTION_STATUS, "AT+CIPSTATUS\r\r\nSTATUS:3\r\n"
+		"+CIPSTATUS:0,\"TCP\",\"192.168.1.3\",51171,3000,1\r\n"
+		"+CIPSTATUS:1,\"TCP\",\"192.168.1.27\",40000,3000,1\r\n\r\nOK\r\n", {0}, 0},
+	{NULL, TEST_RESPONSE_NONE, "0,CLOSED\r\n", {0}, 0},
+	{ESP_GetConnectionStatus, TEST_RESPONSE_CONNECTION_STATUS, "AT+CIPSTATUS\r\r\nSTATUS:3\r\n"
+		"+CIPSTATUS:0,\"TCP\",\"192.168.1.27\",40000,3000,1\r\n\r\nOK\r\n", {0}, 0},
+	{ESP_GetConnectionStatus, TEST_RESPONSE_CONNECTION_STATUS, "AT+CIPSTATUS\r\r\nSTATUS:2\r\n\r\nOK\r\n", {0}, 0},
+};
+
+static const TranscriptStep ErrorSteps[] =
+{
+	{ESP_SendAcceptMultipleConnectionRequest, TEST_RESPONSE_GENERAL, "AT+CIPMUX=1\r\r\nlink is builded\r\n\r\nERROR\r\n", {0}, 0},
+	{ESP_GetAssignedIpAddress, TEST_RESPONSE_IP, "AT+CIFSR\r\r\n\r\nERROR\r\n", {0}, 0},
+	{ESP_SendDetectDeviceRequest, TEST_RESPONSE_GENERAL, "", {0}, 420},
+	{ESP_SendDetectDeviceRequest, TEST_RESPONSE_GENERAL, "AT\r\r\n\r\nOK\r\n", {0}, 0},
+	{ESP_GetConnectionStatus, TEST_RESPONSE_CONNECTION_STATUS, "\r\n+IPD,2,40:#AT+CIPSTATUS\r\r\nSTATUS:3\r\n"
+		"+CIPSTATUS:0,\"UDP\",\"10.0.0.1\",1234,3001,0\r\n\r\nOK\r\n", {40}, 0},
+	{ESP_SendDetectDeviceRequest, TEST_RESPONSE_GENERAL, "AT\r\r\n\r\n+IPD,4,32:#\r\n\r\nOK\r\n", {32}, 0},
+};
+
+static const char StartupGolden[] =
+#include "EspParserTestStartup.golden"
+;
+
+static const char ServerGolden[] =
+#include "EspParserTestServer.golden"
+;
+
+static const char ErrorGolden[] =
+#include "EspParserTestError.golden"
+;
+
+static const Transcript TranscriptTable[] =
+{
+	{"startup", StartupSteps, sizeof(StartupSteps)/sizeof(TranscriptStep), StartupGolden},
+	{"server", ServerSteps, sizeof(ServerSteps)/sizeof(TranscriptStep), ServerGolden},
+	{"error", ErrorSteps, sizeof(ErrorSteps)/sizeof(TranscriptStep), ErrorGolden},
+};
+
+static void LogPrint(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+static void LogPrint(const char* format, ...)
+{
+	va_list arguments;
+
+	va_start(arguments, format);
+	int printedSize = vsnprintf(&TestLog[TestLogSize], TEST_LOG_SIZE - TestLogSize, format, arguments);
+	va_end(arguments);
+
+	if(printedSize > 0)
+		TestLogSize += printedSize;
+
+	if(TestLogSize >= TEST_LOG_SIZE)
+		TestLogSize = TEST_LOG_SIZE - 1U;
+}
+
+static uint32_t Random(void)
+{
+	RandomState = RandomState*1103515245U + 12345U;
+
+	return RandomState >> 16;
+}
+
+static uint32_t Hash(const uint8_t* data, uint32_t size)
+{
+	uint32_t hash = 2166136261U;
+
+	for(uint32_t i = 0; i < size; i++)
+	{
+		hash ^= data[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+/*****************************************************************************************
+* BuildMessage() - fill buffer with message which has SOME/IP header. Bytes of payload
+* are above 0x7F so they can't be taken as AT result code.
+*
+* Parameters:
+* @buffer: pointer to buffer where message is created.
+* @size: size of message with header.
+* @seed: value which make content of message unique.
+*****************************************************************************************/
+static void BuildMessage(uint8_t* buffer, uint16_t size, uint8_t seed)
+{
+	uint32_t length = size - 8U;
+	const uint8_t header[] = {0x00, 0x01, 0x00, seed, length>>24, length>>16, length>>8, length,
+		0x00, 0x01, 0x00, seed, 0x01, 0x01, 0x00, 0x00};
+
+	memcpy(buffer, header, (size < sizeof(header)) ? size : sizeof(header));
+
+	for(uint16_t i = sizeof(header); i < size; i++)
+		buffer[i] = (uint8_t)(0x80U + ((i*7U + seed) % 0x7FU));
+}
+
+static uint32_t BuildRxData(const TranscriptStep* step, uint8_t stepNumber, uint8_t* buffer)
+{
+	uint32_t size = 0;
+	uint8_t messageNumber = 0;
+
+	for(const char* character = step->rxData; *character != '\0'; character++)
+	{
+		if(*character == TEST_MESSAGE_MARKER)
+		{
+			uint16_t messageSize = step->messageSizeTable[messageNumber];
+
+			BuildMessage(&buffer[size], messageSize, (uint8_t)(stepNumber*2U + messageNumber));
+			size += messageSize;
+			messageNumber++;
+		}
+		else
+		{
+			buffer[size++] = (uint8_t)*character;
+		}
+	}
+
+	return size;
+}
+
+static void ProcessCall(void)
+{
+	ESP_Process();
+	TxCaptureSize += HostUart_Transmit(&TxCapture[TxCaptureSize], sizeof(TxCapture) - TxCaptureSize);
+}
+
+/*****************************************************************************************
+* FeedData() - pass data to ESP layer like UART interrupt. ESP_Process is called after
+* each chunk.
+*
+* Parameters:
+* @data: pointer to data send by module.
+* @size: number of bytes.
+* @feedMode: size of chunks(all data, one byte or random number of bytes).
+*****************************************************************************************/
+static void FeedData(const uint8_t* data, uint32_t size, TEST_FEED_MODE feedMode)
+{
+	for(uint32_t position = 0; position < size;)
+	{
+		uint32_t chunkSize = size - position;
+
+		if(feedMode == TEST_FEED_BYTE)
+			chunkSize = 1U;
+		else if((feedMode == TEST_FEED_RANDOM) && (chunkSize > 1U))
+			chunkSize = 1U + (Random() % ((chunkSize < TEST_MAX_CHUNK_SIZE) ? chunkSize : TEST_MAX_CHUNK_SIZE));
+
+		HostUart_Receive(&data[position], chunkSize);
+		HostUart_Deliver(chunkSize);
+		ProcessCall();
+
+		position += chunkSize;
+	}
+}
+
+static void LogLinks(void)
+{
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET; i++)
+	{
+		SocketState link = ESP_ReturnLinkInformation(i);
+
+		LogPrint(" link%u=%u", i, link.socketIsOpen);
+
+		if(link.additionalSocketDataIsAvailable)
+		{
+			LogPrint("(%u,%u.%u.%u.%u,%u,%u,%u)", link.connectionType, link.remoteIpAddress[0],
+				link.remoteIpAddress[1], link.remoteIpAddress[2], link.remoteIpAddress[3],
+				link.remotePort, link.localPort, link.tcpConnectionRunAsServer);
+		}
+	}
+}
+
+static void ProcessResponse(TEST_RESPONSE_TYPE responseType)
+{
+	bool result = false;
+
+	switch(responseType)
+	{
+	case TEST_RESPONSE_GENERAL:
+		result = ESP_ProcessGaneralFormatResponse();
+		LogPrint(" result=%u", result);
+		break;
+	case TEST_RESPONSE_APN_LIST:
+		result = ESP_ProcessApnListResponse();
+		LogPrint(" result=%u apn=%u", result, ApnStructure.NumberOfApn);
+
+		for(uint8_t i = 0; i < ApnStructure.NumberOfApn; i++)
+		{
+			ApnInformation* apn = &ApnStructure.AppInformationTable[i];
+
+			LogPrint(" (%u,%s,%d,%s)", apn->securityLevel, apn->ssid, apn->signalPower, apn->bssid);
+		}
+		break;
+	case TEST_RESPONSE_IP:
+	{
+		uint8_t ipAddress[IP_ADDRESS_BYTE_LENGTH] = {0};
+
+		result = ESP_ProcessGetAssignedIpResponse(ipAddress);
+		LogPrint(" result=%u ip=%u.%u.%u.%u", result, ipAddress[0], ipAddress[1], ipAddress[2], ipAddress[3]);
+		break;
+	}
+	case TEST_RESPONSE_CONNECTION_STATUS:
+	{
+		bool connectedToApn = false;
+
+		result = ESP_ProcessConnectionStatus(&connectedToApn);
+		LogPrint(" result=%u apn=%u", result, connectedToApn);
+		LogLinks();
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+/*****************************************************************************************
+* LogMessages() - write received messages to log and release their buffers. Buffers are
+* reserved from the lowest index so order of index is order of receive.
+*****************************************************************************************/
+static void LogMessages(void)
+{
+	for(uint8_t i = 0; i < MAX_NUMBER_OF_SOCKET_BUFFER; i++)
+	{
+		if(SocketBufferTable[i].lockFlag)
+		{
+			LogPrint("\n  message socket=%u size=%u hash=%08x", SocketBufferTable[i].socketId,
+				SocketBufferTable[i].payloadSize, Hash(SocketBufferTable[i].payload, SocketBufferTable[i].payloadSize));
+			SocketBufferTable[i].lockFlag = false;
+		}
+	}
+}
+
+static void RunStep(const TranscriptStep* step, uint8_t stepNumber, TEST_FEED_MODE feedMode)
+{
+	static uint8_t rxData[1024];
+	uint32_t rxSize = BuildRxData(step, stepNumber, rxData);
+
+	TxCaptureSize = 0;
+	LogPrint("step %u:", stepNumber);
+
+	if(step->requestFunction != NULL)
+	{
+		LogPrint(" request=%u", step->requestFunction());
+
+		for(uint32_t i = 0; i < TEST_REQUEST_SEND_CALLS; i++)
+			ProcessCall();
+	}
+
+	FeedData(rxData, rxSize, feedMode);
+
+	for(uint32_t i = 0; i < (TEST_DEFAULT_IDLE_CALLS + step->idleCalls); i++)
+		ProcessCall();
+
+	LogPrint(" tx=%u/%08x state=%u", TxCaptureSize, Hash(TxCapture, TxCaptureSize), ESP_GetRequestState());
+	ProcessResponse(step->responseType);
+	LogMessages();
+	LogPrint("\n");
+}
+
+/*****************************************************************************************
+* ResetLayer() - initialize ESP layer like main function and clear link states which are
+* kept by ESP layer between initializations.
+*****************************************************************************************/
+static void ResetLayer(void)
+{
+	static const TranscriptStep clearLinksStep =
+		{ESP_GetConnectionStatus, TEST_RESPONSE_CONNECTION_STATUS, "AT+CIPSTATUS\r\r\nSTATUS:5\r\n\r\nOK\r\n", {0}, 0};
+
+	HostUart_Reset();
+	ESP_Init(0, 115200, 400, 3, 0);
+	memset(SocketBufferTable, 0, sizeof(SocketBufferTable));
+	memset(&ApnStructure, 0, sizeof(ApnStructure));
+
+	RunStep(&clearLinksStep, 0, TEST_FEED_WHOLE);
+	TestLogSize = 0;
+	TestLog[0] = '\0';
+}
+
+static void RunTranscript(const Transcript* transcript, TEST_FEED_MODE feedMode)
+{
+	ResetLayer();
+
+	for(uint8_t i = 0; i < transcript->numberOfSteps; i++)
+		RunStep(&transcript->stepTable[i], i + 1U, feedMode);
+}
+
+static void CheckLog(const Transcript* transcript, const char* feedName)
+{
+	if(strcmp(TestLog, transcript->goldenLog) != 0)
+	{
+		printf("transcript %s fed %s differ from golden log:\n%s", transcript->name, feedName, TestLog);
+		TestAssertFailures++;
+	}
+}
+
+static void PrintGoldenLog(const Transcript* transcript)
+{
+	printf("/* %s */\n\"", transcript->name);
+
+	for(const char* character = TestLog; *character != '\0'; character++)
+	{
+		if(*character == '\n')
+			printf("\\n\"\n%s", (character[1] != '\0') ? "\"" : "");
+		else if((*character == '"') || (*character == '\\'))
+			printf("\\%c", *character);
+		else
+			putchar(*character);
+	}
+}
+
+/*****************************************************************************************
+* Tests of cases handled differently than by old parser.
+*****************************************************************************************/
+static void FeedString(const char* data, TEST_FEED_MODE feedMode)
+{
+	FeedData((const uint8_t*)data, strlen(data), feedMode);
+}
+
+static void TestLinkEvents(TEST_FEED_MODE feedMode)
+{
+	ResetLayer();
+
+	FeedString("0,CONNECT\r\n", feedMode);
+	TEST_ASSERT(ESP_ReturnLinkInformation(0).socketIsOpen);
+
+	FeedString("2,CONNECT\r\n1,CONNECT\r\n7,CONNECT\r\n", feedMode);
+	TEST_ASSERT(ESP_ReturnLinkInformation(1).socketIsOpen);
+	TEST_ASSERT(ESP_ReturnLinkInformation(2).socketIsOpen);
+	TEST_ASSERT(!ESP_ReturnLinkInformation(3).socketIsOpen);
+
+	FeedString("0,CLOSED\r\n2,CLOSED\r\n", feedMode);
+	TEST_ASSERT(!ESP_ReturnLinkInformation(0).socketIsOpen);
+	TEST_ASSERT(ESP_ReturnLinkInformation(1).socketIsOpen);
+	TEST_ASSERT(!ESP_ReturnLinkInformation(2).socketIsOpen);
+	TEST_ASSERT_EQUAL(READY, ESP_GetRequestState());
+}
+
+static void TestResultCodeInsidePayload(TEST_FEED_MODE feedMode)
+{
+	uint8_t message[32];
+
+	ResetLayer();
+	BuildMessage(message, sizeof(message), 1);
+	memcpy(&message[16], "\r\nOK\r\n\0ERROR\r\n", 14);
+
+	TEST_ASSERT(ESP_SendDetectDeviceRequest());
+
+	for(uint32_t i = 0; i < TEST_REQUEST_SEND_CALLS; i++)
+		ProcessCall();
+
+	FeedString("AT\r\r\n\r\n+IPD,0,32:", feedMode);
+	FeedData(message, sizeof(message), feedMode);
+	TEST_ASSERT_EQUAL(BUSY, ESP_GetRequestState());
+	TEST_ASSERT(SocketBufferTable[0].lockFlag);
+	TEST_ASSERT_EQUAL(sizeof(message), SocketBufferTable[0].payloadSize);
+	TEST_ASSERT(memcmp(SocketBufferTable[0].payload, message, sizeof(message)) == 0);
+
+	FeedString("\r\nOK\r\n", feedMode);
+	TEST_ASSERT_EQUAL(RESPONSE_RECEIVED, ESP_GetRequestState());
+	TEST_ASSERT(ESP_ProcessGaneralFormatResponse());
+}
+
+static void TestMessageFraming(TEST_FEED_MODE feedMode)
+{
+	uint8_t firstMessage[16];
+	uint8_t secondMessage[24];
+	uint8_t longMessage[64];
+
+	ResetLayer();
+	BuildMessage(firstMessage, sizeof(firstMessage), 1);
+	BuildMessage(secondMessage, sizeof(secondMessage), 2);
+	BuildMessage(longMessage, sizeof(longMessage), 3);
+
+	//two messages coalesced in one +IPD payload
+	FeedString("\r\n+IPD,0,40:", feedMode);
+	FeedData(firstMessage, sizeof(firstMessage), feedMode);
+	FeedData(secondMessage, sizeof(secondMessage), feedMode);
+	TEST_ASSERT(SocketBufferTable[0].lockFlag && SocketBufferTable[1].lockFlag);
+	TEST_ASSERT_EQUAL(sizeof(firstMessage), SocketBufferTable[0].payloadSize);
+	TEST_ASSERT(memcmp(SocketBufferTable[0].payload, firstMessage, sizeof(firstMessage)) == 0);
+	TEST_ASSERT_EQUAL(sizeof(secondMessage), SocketBufferTable[1].payloadSize);
+	TEST_ASSERT(memcmp(SocketBufferTable[1].payload, secondMessage, sizeof(secondMessage)) == 0);
+	SocketBufferTable[0].lockFlag = false;
+	SocketBufferTable[1].lockFlag = false;
+
+	/* message of socket 1 divided into two payloads with message of socket 0 between them.
+	Data of socket 0 is fed at once, byte after byte it would take more than ESP_FRAME_TIMEOUT
+	calls and partial message of socket 1 would be dropped */
+	FeedString("\r\n+IPD,1,10:", feedMode);
+	FeedData(longMessage, 10, feedMode);
+	FeedString("\r\n+IPD,0,16:", TEST_FEED_WHOLE);
+	FeedData(firstMessage, sizeof(firstMessage), TEST_FEED_WHOLE);
+	FeedString("\r\n+IPD,1,54:", feedMode);
+	FeedData(&longMessage[10], sizeof(longMessage) - 10U, feedMode);
+
+	TEST_ASSERT(SocketBufferTable[1].lockFlag);
+	TEST_ASSERT_EQUAL(0, SocketBufferTable[1].socketId);
+	TEST_ASSERT_EQUAL(sizeof(firstMessage), SocketBufferTable[1].payloadSize);
+	TEST_ASSERT(SocketBufferTable[0].lockFlag);
+	TEST_ASSERT_EQUAL(1, SocketBufferTable[0].socketId);
+	TEST_ASSERT_EQUAL(sizeof(longMessage), SocketBufferTable[0].payloadSize);
+	TEST_ASSERT(memcmp(SocketBufferTable[0].payload, longMessage, sizeof(longMessage)) == 0);
+	TEST_ASSERT(!SocketBufferTable[2].lockFlag);
+}
+
+int main(int argc, char** argv)
+{
+	bool printLog = (argc > 1) && (strcmp(argv[1], "--print") == 0);
+	const TEST_FEED_MODE feedModeTable[] = {TEST_FEED_WHOLE, TEST_FEED_BYTE, TEST_FEED_RANDOM};
+
+	for(uint8_t i = 0; i < sizeof(TranscriptTable)/sizeof(Transcript); i++)
+	{
+		const Transcript* transcript = &TranscriptTable[i];
+
+		RunTranscript(transcript, TEST_FEED_WHOLE);
+
+		if(printLog)
+		{
+			PrintGoldenLog(transcript);
+			continue;
+		}
+
+		CheckLog(transcript, "whole");
+
+		RunTranscript(transcript, TEST_FEED_BYTE);
+		CheckLog(transcript, "byte after byte");
+
+		for(uint32_t run = 0; run < TEST_RANDOM_FEED_RUNS; run++)
+		{
+			RandomState = run + 1U;
+			RunTranscript(transcript, TEST_FEED_RANDOM);
+			CheckLog(transcript, "in random chunks");
+		}
+	}
+
+	if(printLog)
+		return 0;
+
+	for(uint8_t i = 0; i < sizeof(feedModeTable)/sizeof(TEST_FEED_MODE); i++)
+	{
+		RandomState = i + 1U;
+		TestLinkEvents(feedModeTable[i]);
+		TestResultCodeInsidePayload(feedModeTable[i]);
+		TestMessageFraming(feedModeTable[i]);
+	}
+
+	return TEST_RESULT("EspParserTest");
+}
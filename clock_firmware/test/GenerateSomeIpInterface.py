@@ -0,0 +1,998 @@
+#!/usr/bin/env python3
+#
+# clock_firmware
+# Copyright (C) 2019 Adrian Chemicz
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+"""Generate code of SOME/IP interface from its description.
+
+Usage: GenerateSomeIpInterface.py SomeIpInterface.json header|source|client|test output
+
+- header, source: SomeIpInterface.h and SomeIpInterface.c of firmware. They contain
+  MethodDescriptorTable used by WIFI_InteractionLayer.c to dispatch requests, decoders of
+  request payloads and encoders of response payloads used by handlers. Generated files are
+  stored in inc and src directories so firmware is built from them without python.
+  Order of table is checked by _Static_assert, so wrong order is found by compiler also
+  when identifiers are macros.
+- client: SomeIpClient.h with static functions of host client which code requests and
+  decode responses.
+- test: SomeIpInterfaceTest.c which check that:
+  - size of each described payload structure and offset of each field are the same as in
+    the description, and that fields are listed without padding,
+  - firmware answer request of each method with wrong payload size by
+    SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE,
+  - each method coded by client header with example values is answered by
+    SOME_IP_RETURN_CODE_E_OK_VALUE and described response payload is decoded by client,
+  - request of method with waitForSearch is answered only after end of FRAM search
+    requested by other client, request of other method is answered during search,
+  - methods of round trips return in response the values written by request.
+"""
+
+import json
+import sys
+import textwrap
+
+TYPE_SIZE = {"uint8": 1, "uint16": 2, "uint32": 4}
+C_TYPE = {"uint8": "uint8_t", "uint16": "uint16_t", "uint32": "uint32_t"}
+
+GPL_HEADER = """/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+"""
+
+
+def camel_case(name):
+    return "".join(word.capitalize() for word in name.split("_"))
+
+
+def all_methods(interface):
+    """Return list of (service, method) in order of MethodDescriptorTable."""
+    return [(service, method) for service in interface["services"] for method in service["methods"]]
+
+
+def guarded(items):
+    """Return lines of (condition, lines) items, consecutive items with the same condition
+    share one #if block."""
+    lines = []
+    condition = None
+
+    for item_condition, item_lines in items:
+        if item_condition != condition:
+            if condition:
+                lines.append("#endif")
+
+            if item_condition:
+                lines.append("#if %s" % item_condition)
+
+            condition = item_condition
+
+        lines.extend(item_lines)
+
+    if condition:
+        lines.append("#endif")
+
+    return lines
+
+
+def doc_comment(text, parameters):
+    """Return lines of doc comment of function in style of firmware sources."""
+    lines = ["/*****************************************************************************************"]
+    lines.extend("* " + line for line in textwrap.wrap(text, 88))
+    lines.append("*")
+    lines.append("* Parameters:")
+    lines.extend("* " + parameter for parameter in parameters)
+    lines.append("*")
+    lines.append("*****************************************************************************************/")
+
+    return lines
+
+
+def offset_expression(offset, symbolic_offset, index=0):
+    return " + ".join([str(offset + index)] + symbolic_offset)
+
+
+def payload_layout(payload):
+    """Return list of (field, offset expression, size expression) of payload fields."""
+    layout = []
+    offset = 0
+    symbolic_offset = []
+
+    for field in payload.get("fields", []):
+        size = TYPE_SIZE[field["type"]]
+
+        if not symbolic_offset and offset % size != 0:
+            raise ValueError("field %s isn't aligned, describe padding as reserved field" % field["name"])
+
+        field_offset = (offset, list(symbolic_offset))
+        count = field.get("count", 1)
+
+        if isinstance(count, int):
+            offset += size * count
+            size_expression = str(size * count)
+        else:
+            size_expression = count if size == 1 else "%d*(%s)" % (size, count)
+            symbolic_offset.append(size_expression)
+
+        layout.append((field, field_offset, size_expression))
+
+    return layout, offset_expression(offset, symbolic_offset)
+
+
+def find_method(service, name):
+    for method in service["methods"]:
+        if method["name"] == name:
+            return method
+
+    raise ValueError("method %s of service %s isn't described" % (name, service["name"]))
+
+
+def structure_name(payload):
+    return payload.get("type", payload.get("structure"))
+
+
+def codecs(interface, direction):
+    """Return dictionary (service name, method name) -> (codec name, fields, condition) of
+    payloads of requests or responses which are decoded to structure. Payload described
+    only by type use codec of first method which list fields of the same type."""
+    prefix = "Decode" if direction == "request" else "Encode"
+    by_type = {}
+    result = {}
+
+    for service, method in all_methods(interface):
+        payload = method.get(direction)
+
+        if payload is None or "fields" not in payload:
+            continue
+
+        name = "%s%s%s%s" % (prefix, camel_case(service["name"]), camel_case(method["name"]), direction.capitalize())
+        codec = (name, payload["fields"], service.get("condition"))
+        result[(service["name"], method["name"])] = codec
+
+        if "type" in payload:
+            by_type.setdefault(payload["type"], codec)
+
+    for service, method in all_methods(interface):
+        payload = method.get(direction)
+
+        if payload is None or "fields" in payload or "type" not in payload:
+            continue
+
+        if payload["type"] not in by_type:
+            raise ValueError("fields of %s aren't described" % payload["type"])
+
+        result[(service["name"], method["name"])] = by_type[payload["type"]]
+
+    return result
+
+
+def validate(interface):
+    for service, method in all_methods(interface):
+        name = "%s %s" % (service["name"], method["name"])
+
+        if not isinstance(method.get("waitForSearch"), bool):
+            raise ValueError("method %s must have waitForSearch true or false" % name)
+
+        if "handler" not in method or "request" not in method:
+            raise ValueError("method %s must have handler and request" % name)
+
+    for key, (_, fields, _) in codecs(interface, "request").items():
+        for field in fields:
+            if "example" not in field:
+                raise ValueError("field %s of request %s %s hasn't example value" % ((field["name"],) + key))
+
+
+def byte_index(field_offset, index):
+    offset, symbolic_offset = field_offset
+
+    return offset_expression(offset, symbolic_offset, index)
+
+
+def decode_lines(fields, payload, structure, indent="\t"):
+    """Return C lines which read little-endian fields from payload to structure."""
+    lines = []
+    layout, _ = payload_layout({"fields": fields})
+
+    for field, field_offset, size_expression in layout:
+        size = TYPE_SIZE[field["type"]]
+        target = "%s->%s" % (structure, field["name"])
+
+        if "count" in field:
+            if size != 1:
+                raise ValueError("only array of uint8 is supported, field %s" % field["name"])
+
+            lines.append("%smemcpy(%s, &%s[%s], %s);" % (indent, target, payload, byte_index(field_offset, 0),
+                                                        size_expression))
+        elif size == 1:
+            lines.append("%s%s = %s[%s];" % (indent, target, payload, byte_index(field_offset, 0)))
+        else:
+            parts = ["((%s)%s[%s] << %d)" % (C_TYPE[field["type"]], payload, byte_index(field_offset, i), 8 * i)
+                     for i in range(1, size)]
+            lines.append("%s%s = (%s)%s[%s] | %s;" % (indent, target, C_TYPE[field["type"]], payload,
+                                                     byte_index(field_offset, 0), " | ".join(parts)))
+
+    return lines
+
+
+def encode_lines(fields, payload, structure, indent="\t"):
+    """Return C lines which write fields of structure to payload as little-endian."""
+    lines = []
+    layout, _ = payload_layout({"fields": fields})
+
+    for field, field_offset, size_expression in layout:
+        size = TYPE_SIZE[field["type"]]
+        source = "%s->%s" % (structure, field["name"])
+
+        if "count" in field:
+            if size != 1:
+                raise ValueError("only array of uint8 is supported, field %s" % field["name"])
+
+            lines.append("%smemcpy(&%s[%s], %s, %s);" % (indent, payload, byte_index(field_offset, 0), source,
+                                                        size_expression))
+        elif size == 1:
+            lines.append("%s%s[%s] = %s;" % (indent, payload, byte_index(field_offset, 0), source))
+        else:
+            for i in range(size):
+                shifted = source if i == 0 else "(%s >> %d)" % (source, 8 * i)
+                lines.append("%s%s[%s] = (uint8_t)%s;" % (indent, payload, byte_index(field_offset, i), shifted))
+
+    return lines
+
+
+def codec_payload_type(interface, codec_name, direction):
+    for service, method in all_methods(interface):
+        payload = method.get(direction)
+
+        if payload is not None and "fields" in payload:
+            name = "%s%s%s%s" % ("Decode" if direction == "request" else "Encode", camel_case(service["name"]),
+                                 camel_case(method["name"]), direction.capitalize())
+
+            if name == codec_name:
+                return structure_name(payload), service, method
+
+    raise ValueError("codec %s isn't described" % codec_name)
+
+
+def unique_codecs(interface, direction):
+    """Return codecs in order of description without codecs shared by type."""
+    seen = []
+
+    for codec in codecs(interface, direction).values():
+        if codec not in seen:
+            seen.append(codec)
+
+    order = [name for service, method in all_methods(interface)
+             for name in ["%s%s%s%s" % ("Decode" if direction == "request" else "Encode", camel_case(service["name"]),
+                                       camel_case(method["name"]), direction.capitalize())]]
+
+    return sorted(seen, key=lambda codec: order.index(codec[0]))
+
+
+def firmware_codec_prototypes(interface):
+    items = []
+
+    for direction in ("request", "response"):
+        for name, _, condition in unique_codecs(interface, direction):
+            payload_type, _, _ = codec_payload_type(interface, name, direction)
+
+            if direction == "request":
+                items.append((condition, ["void SomeIpInterface_%s(const uint8_t* payload, %s* structure);"
+                                          % (name, payload_type)]))
+            else:
+                items.append((condition, ["void SomeIpInterface_%s(uint8_t* payload, const %s* structure);"
+                                          % (name, payload_type)]))
+
+    return guarded(items)
+
+
+def generate_header(interface, source_name):
+    lines = [GPL_HEADER]
+    lines.append("/* Generated by GenerateSomeIpInterface.py from %s, don't edit. */" % source_name)
+    lines.append("")
+    lines.append("#ifndef _SOME_IP_INTERFACE_H_")
+    lines.append("#define _SOME_IP_INTERFACE_H_")
+    lines.append("")
+    lines.append("""/*
+ * Module contain MethodDescriptorTable of methods supported by WIFI_InteractionLayer,
+ * decoders of request payloads and encoders of response payloads. Payload fields are
+ * little-endian and are read and written byte after byte, so payload in buffer doesn't need
+ * to be aligned and structures can have padding. Handlers of methods are implemented by
+ * WIFI_InteractionLayer.c. Decoder is called after check of payload size by
+ * WIFI_ProcessRequest. Request which hasn't all fields of structure(unsubscribe) clear
+ * other fields.
+ */""")
+    lines.append("")
+    lines.append("#include \"WIFI_InteractionLayer.h\"")
+    lines.append("")
+
+    unconditional = 0
+    conditional = {}
+
+    for service, method in all_methods(interface):
+        if service.get("condition"):
+            conditional.setdefault(service["condition"], 0)
+            conditional[service["condition"]] += 1
+        else:
+            unconditional += 1
+
+    if len(conditional) > 1:
+        raise ValueError("only one condition of service is supported")
+
+    for condition, number in conditional.items():
+        lines.append("#if %s" % condition)
+        lines.append("#define NUMBER_OF_METHOD_DESCRIPTORS\t%d" % (unconditional + number))
+        lines.append("#else")
+        lines.append("#define NUMBER_OF_METHOD_DESCRIPTORS\t%d" % unconditional)
+        lines.append("#endif")
+
+    if not conditional:
+        lines.append("#define NUMBER_OF_METHOD_DESCRIPTORS\t%d" % unconditional)
+
+    lines.append("")
+    lines.append("extern const WifiMethodDescriptorType MethodDescriptorTable[NUMBER_OF_METHOD_DESCRIPTORS];")
+    lines.append("")
+
+    handlers = []
+
+    for service, method in all_methods(interface):
+        if (method["handler"], service.get("condition")) not in handlers:
+            handlers.append((method["handler"], service.get("condition")))
+
+    lines.extend(guarded([(condition, ["uint8_t %s(WifiStateType* wifiStateStructure, SocketMessage* request,"
+                                       % handler, "\t\tSomeIpWriter* responseWriter);"])
+                          for handler, condition in handlers]))
+    lines.append("")
+    lines.extend(firmware_codec_prototypes(interface))
+    lines.append("")
+    lines.append("#endif  /* _SOME_IP_INTERFACE_H_ */")
+
+    return "\n".join(lines) + "\n"
+
+
+def generate_source(interface, source_name):
+    lines = [GPL_HEADER]
+    lines.append("/* Generated by GenerateSomeIpInterface.py from %s, don't edit. */" % source_name)
+    lines.append("")
+    lines.append("#include \"SomeIpInterface.h\"")
+    lines.append("#include <string.h>")
+    lines.append("")
+    lines.append("#define METHOD_KEY(serviceId, methodId)\t((((uint32_t)(serviceId)) << 16) | (methodId))")
+    lines.append("")
+    lines.append("/*")
+    lines.append(" * Supported methods sorted by service ID and first method ID, WIFI_FindMethodDescriptor")
+    lines.append(" * use binary search. One entry can describe range of methods with the same payload.")
+    lines.append(" */")
+    lines.append("const WifiMethodDescriptorType MethodDescriptorTable[NUMBER_OF_METHOD_DESCRIPTORS] = {")
+
+    condition = None
+
+    for service, method in all_methods(interface):
+        if service.get("condition") != condition:
+            if condition:
+                lines.append("#endif")
+
+            condition = service.get("condition")
+
+            if condition:
+                lines.append("#if %s" % condition)
+
+        lines.append("\t{%s, %s, %s," % (service["serviceId"], method["firstMethodId"], method["lastMethodId"]))
+        lines.append("\t\t%s, %s, %s}," % (method["request"]["size"], "true" if method["waitForSearch"] else "false",
+                                          method["handler"]))
+
+    if condition:
+        lines.append("#endif")
+
+    lines.append("};")
+    lines.append("")
+
+    methods = all_methods(interface)
+    lines.append("//range of each method and order of table, identifiers don't depend on conditions of services")
+
+    for index, (service, method) in enumerate(methods):
+        if method["firstMethodId"] != method["lastMethodId"]:
+            lines.append("_Static_assert(METHOD_KEY(%s, %s)" % (service["serviceId"], method["firstMethodId"]))
+            lines.append("\t<= METHOD_KEY(%s, %s), \"%s %s has empty range\");"
+                         % (service["serviceId"], method["lastMethodId"], service["name"], method["name"]))
+
+        if index + 1 < len(methods):
+            next_service, next_method = methods[index + 1]
+            lines.append("_Static_assert(METHOD_KEY(%s, %s)" % (service["serviceId"], method["lastMethodId"]))
+            lines.append("\t< METHOD_KEY(%s, %s), \"%s %s must be after %s %s\");"
+                         % (next_service["serviceId"], next_method["firstMethodId"], next_service["name"],
+                            next_method["name"], service["name"], method["name"]))
+
+    lines.append("")
+
+    for direction in ("request", "response"):
+        for name, fields, condition in unique_codecs(interface, direction):
+            payload_type, service, method = codec_payload_type(interface, name, direction)
+            full_structure = "type" in method[direction]
+
+            if condition:
+                lines.append("#if %s" % condition)
+
+            if direction == "request":
+                lines.extend(doc_comment("SomeIpInterface_%s() - read request payload of %s %s."
+                                         % (name, service["name"], method["name"]),
+                                         ["@payload: pointer to payload with checked size.",
+                                          "@structure: pointer to structure filled by fields of payload."]))
+                lines.append("void SomeIpInterface_%s(const uint8_t* payload, %s* structure)" % (name, payload_type))
+                lines.append("{")
+
+                if not full_structure:
+                    lines.append("\tmemset(structure, 0, sizeof(%s));" % payload_type)
+                    lines.append("")
+
+                lines.extend(decode_lines(fields, "payload", "structure"))
+            else:
+                lines.extend(doc_comment("SomeIpInterface_%s() - write response payload of %s %s."
+                                         % (name, service["name"], method["name"]),
+                                         ["@payload: pointer to payload with size %s." % method[direction]["size"],
+                                          "@structure: pointer to structure with values of fields."]))
+                lines.append("void SomeIpInterface_%s(uint8_t* payload, const %s* structure)" % (name, payload_type))
+                lines.append("{")
+                lines.extend(encode_lines(fields, "payload", "structure"))
+
+            lines.append("}")
+
+            if condition:
+                lines.append("#endif")
+
+            lines.append("")
+
+    return "\n".join(lines)
+
+
+def client_function_suffix(service, method):
+    return "%s%s" % (camel_case(service["name"]), camel_case(method["name"]))
+
+
+def generate_client(interface, source_name):
+    request_codecs = codecs(interface, "request")
+    response_codecs = codecs(interface, "response")
+    lines = ["/* Generated by GenerateSomeIpInterface.py from %s, don't edit. */" % source_name, ""]
+
+    lines.append("#ifndef _SOME_IP_CLIENT_H_")
+    lines.append("#define _SOME_IP_CLIENT_H_")
+    lines.append("")
+    lines.append("""/*
+ * Functions of host client which code request of each method and decode described response
+ * payloads. Fields are read and written as little-endian byte after byte like by firmware,
+ * so client don't depend on layout of structures. Request of method which describe range
+ * of methods get method ID as parameter. Response must be checked by
+ * SOMEIP_ValidateRxMessage before decode.
+ */""")
+    lines.append("")
+    lines.append("#include \"SOMEIP_Layer.h\"")
+    lines.append("#include \"WIFI_InteractionLayer.h\"")
+    lines.append("#include <string.h>")
+    lines.append("")
+
+    for service, method in all_methods(interface):
+        suffix = client_function_suffix(service, method)
+        request = method["request"]
+        range_of_methods = method["firstMethodId"] != method["lastMethodId"]
+        method_id = "methodId" if range_of_methods else method["firstMethodId"]
+        parameters = ["uint8_t* message"]
+
+        if range_of_methods:
+            parameters.append("uint16_t methodId")
+
+        if (service["name"], method["name"]) in request_codecs:
+            _, fields, _ = request_codecs[(service["name"], method["name"])]
+            parameters.append("const %s* request" % structure_name(request))
+            lines.append("static inline uint16_t SomeIpClient_Code%sRequest(%s)" % (suffix, ", ".join(parameters)))
+            lines.append("{")
+            lines.append("\tuint8_t payload[%s];" % request["size"])
+            lines.append("")
+            lines.extend(encode_lines(fields, "payload", "request"))
+            lines.append("")
+            lines.append("\treturn SOMEIP_CodeTxMessage(%s, %s, SOME_IP_REQUEST_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE,"
+                         % (service["serviceId"], method_id))
+            lines.append("\t\tmessage, payload, %s);" % request["size"])
+        else:
+            lines.append("static inline uint16_t SomeIpClient_Code%sRequest(%s)" % (suffix, ", ".join(parameters)))
+            lines.append("{")
+            lines.append("\treturn SOMEIP_CodeTxMessage(%s, %s, SOME_IP_REQUEST_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE,"
+                         % (service["serviceId"], method_id))
+            lines.append("\t\tmessage, NULL, 0);")
+
+        lines.append("}")
+        lines.append("")
+
+        if (service["name"], method["name"]) not in response_codecs:
+            continue
+
+        response = method["response"]
+        _, fields, _ = response_codecs[(service["name"], method["name"])]
+
+        lines.append("//return false if message isn't response with described payload")
+        lines.append("static inline bool SomeIpClient_Decode%sResponse(uint8_t* message, %s* response)"
+                     % (suffix, structure_name(response)))
+        lines.append("{")
+        lines.append("\tconst uint8_t* payload = SOMEIP_GetPayload(message);")
+        lines.append("")
+        lines.append("\tif((SOMEIP_GetMessageType(message) != SOME_IP_RESPONSE_CODE)")
+        lines.append("\t\t|| (message[SOME_IP_RETURN_CODE_FIELD_BEGIN] != SOME_IP_RETURN_CODE_E_OK_VALUE)")
+        lines.append("\t\t|| (SOMEIP_GetServiceId(message) != %s)" % service["serviceId"])
+        lines.append("\t\t|| (SOMEIP_GetPayloadSize(message) != %s))" % response["size"])
+        lines.append("\t{")
+        lines.append("\t\treturn false;")
+        lines.append("\t}")
+        lines.append("")
+        lines.extend(decode_lines(fields, "payload", "response"))
+        lines.append("")
+        lines.append("\treturn true;")
+        lines.append("}")
+        lines.append("")
+
+    lines.append("#endif  /* _SOME_IP_CLIENT_H_ */")
+
+    return "\n".join(lines) + "\n"
+
+
+def generate_layout_checks(interface, lines):
+    checked_types = set()
+
+    lines.append("static void TestPayloadLayout(void)")
+    lines.append("{")
+
+    for service in interface["services"]:
+        for method in service["methods"]:
+            for direction in ("request", "response"):
+                payload = method.get(direction)
+
+                if payload is None or "fields" not in payload:
+                    continue
+
+                layout, total = payload_layout(payload)
+                lines.append("\t//%s %s %s" % (service["name"], method["name"], direction))
+                lines.append("\tTEST_ASSERT_EQUAL(%s, %s);" % (total, payload["size"]))
+
+                if "type" not in payload or payload["type"] in checked_types:
+                    continue
+
+                checked_types.add(payload["type"])
+                lines.append("\tTEST_ASSERT_EQUAL(%s, sizeof(%s));" % (payload["size"], payload["type"]))
+
+                for field, field_offset, _ in layout:
+                    lines.append("\tTEST_ASSERT_EQUAL(%s, offsetof(%s, %s));" % (byte_index(field_offset, 0),
+                                                                                 payload["type"], field["name"]))
+
+    lines.append("}")
+    lines.append("")
+
+
+def generate_size_checks(interface, lines):
+    lines.append("static void TestRequestPayloadSize(void)")
+    lines.append("{")
+
+    for service in interface["services"]:
+        condition = service.get("condition")
+
+        if condition:
+            lines.append("#if %s" % condition)
+
+        for method in service["methods"]:
+            for method_id in sorted({method["firstMethodId"], method["lastMethodId"]}):
+                lines.append("\tCheckMalformedRequest(%s, %s, %s);" % (service["serviceId"], method_id,
+                                                                       method["request"]["size"]))
+
+        if condition:
+            lines.append("#else")
+            lines.append("\tCheckUnknownService(%s, %s);" % (service["serviceId"], service["methods"][0]["firstMethodId"]))
+            lines.append("#endif")
+
+    lines.append("}")
+    lines.append("")
+
+
+def example_lines(fields, structure):
+    lines = []
+
+    for field in fields:
+        if "count" in field:
+            lines.append("\tmemset(%s.%s, %d, sizeof(%s.%s));" % (structure, field["name"], field["example"],
+                                                                 structure, field["name"]))
+        else:
+            lines.append("\t%s.%s = %d;" % (structure, field["name"], field["example"]))
+
+    return lines
+
+
+def code_request_lines(service, method, request_codecs):
+    """Return C lines which code example request of method to TestRequest."""
+    suffix = client_function_suffix(service, method)
+    arguments = ["TestRequest"]
+    lines = []
+
+    if method["firstMethodId"] != method["lastMethodId"]:
+        arguments.append(method["firstMethodId"])
+
+    if (service["name"], method["name"]) in request_codecs:
+        _, fields, _ = request_codecs[(service["name"], method["name"])]
+        lines.extend(example_lines(fields, "request"))
+        arguments.append("&request")
+
+    lines.append("\tuint16_t requestSize = SomeIpClient_Code%sRequest(%s);" % (suffix, ", ".join(arguments)))
+
+    return lines
+
+
+def generate_method_checks(interface, lines):
+    request_codecs = codecs(interface, "request")
+    response_codecs = codecs(interface, "response")
+
+    for service, method in all_methods(interface):
+        suffix = client_function_suffix(service, method)
+        condition = service.get("condition")
+        response = method.get("response")
+
+        if condition:
+            lines.append("#if %s" % condition)
+
+        lines.append("static void TestMethod%s(void)" % suffix)
+        lines.append("{")
+
+        if (service["name"], method["name"]) in request_codecs:
+            lines.append("\t%s request;" % structure_name(method["request"]))
+            lines.append("")
+
+        request_lines = code_request_lines(service, method, request_codecs)
+        lines.extend(request_lines[:-1])
+
+        if len(request_lines) > 1:
+            lines.append("")
+
+        lines.append(request_lines[-1])
+        lines.append("\tuint16_t responseSize = ExchangeDuringSearch(TestRequest, requestSize, %s);"
+                     % ("true" if method["waitForSearch"] else "false"))
+        lines.append("")
+
+        if response is None:
+            lines.append("\t(void)responseSize; //size isn't described")
+        elif (service["name"], method["name"]) in response_codecs:
+            lines.append("\t%s response;" % structure_name(response))
+            lines.append("")
+
+            if response.get("optional"):
+                lines.append("\tif(responseSize != 0)")
+                lines.append("\t\tTEST_ASSERT(SomeIpClient_Decode%sResponse(TestResponse, &response));" % suffix)
+            else:
+                lines.append("\tTEST_ASSERT(SomeIpClient_Decode%sResponse(TestResponse, &response));" % suffix)
+        else:
+            lines.append("\tTEST_ASSERT_EQUAL(%s, responseSize);" % response["size"])
+
+        lines.append("}")
+
+        if condition:
+            lines.append("#endif")
+
+        lines.append("")
+
+
+def generate_round_trip(interface, round_trip, lines):
+    service = next(service for service in interface["services"] if service["name"] == round_trip["service"])
+    request_method = find_method(service, round_trip["request"])
+    response_method = find_method(service, round_trip["response"])
+    request_codecs = codecs(interface, "request")
+    response_codecs = codecs(interface, "response")
+    _, request_fields, _ = request_codecs[(service["name"], request_method["name"])]
+    _, response_fields, _ = response_codecs[(service["name"], response_method["name"])]
+    response_names = {field["name"] for field in response_fields}
+
+    lines.append("static void TestRoundTrip%s(void)" % round_trip["name"])
+    lines.append("{")
+    lines.append("\t%s request;" % structure_name(request_method["request"]))
+    lines.append("\t%s response;" % structure_name(response_method["response"]))
+    lines.append("")
+    lines.extend(example_lines(request_fields, "request"))
+    lines.append("")
+    lines.append("\tExchange(TestRequest, SomeIpClient_Code%sRequest(TestRequest, &request));"
+                 % client_function_suffix(service, request_method))
+    lines.append("\tTEST_ASSERT_EQUAL(SOME_IP_RETURN_CODE_E_OK_VALUE, TestResponse[SOME_IP_RETURN_CODE_FIELD_BEGIN]);")
+    lines.append("\tExchange(TestRequest, SomeIpClient_Code%sRequest(TestRequest));"
+                 % client_function_suffix(service, response_method))
+    lines.append("\tTEST_ASSERT(SomeIpClient_Decode%sResponse(TestResponse, &response));"
+                 % client_function_suffix(service, response_method))
+
+    for field in request_fields:
+        if field["name"] in response_names:
+            lines.append("\tTEST_ASSERT_EQUAL(%d, response.%s);" % (field["example"], field["name"]))
+
+    lines.append("}")
+    lines.append("")
+
+
+def generate_test(interface, source_name):
+    lines = ["/* Generated by GenerateSomeIpInterface.py from %s, don't edit. */" % source_name, ""]
+
+    lines.append(TEST_PREAMBLE)
+    generate_layout_checks(interface, lines)
+    generate_size_checks(interface, lines)
+    generate_method_checks(interface, lines)
+
+    for round_trip in interface.get("roundTrips", []):
+        generate_round_trip(interface, round_trip, lines)
+
+    lines.append("int main(void)")
+    lines.append("{")
+    lines.append("\tTestStartClock();")
+    lines.append("")
+    lines.append("\tTestPayloadLayout();")
+    lines.append("\tTestRequestPayloadSize();")
+
+    lines.extend(guarded((service.get("condition"), ["\tTestMethod%s();" % client_function_suffix(service, method)])
+        for service, method in all_methods(interface)))
+
+    for round_trip in interface.get("roundTrips", []):
+        lines.append("\tTestRoundTrip%s();" % round_trip["name"])
+
+    lines.append("")
+    lines.append("\treturn TEST_RESULT(\"SomeIpInterfaceTest\");")
+    lines.append("}")
+
+    return "\n".join(lines) + "\n"
+
+
+TEST_PREAMBLE = r"""#include "HostClock.h"
+#include "HostEsp.h"
+#include "HostUart.h"
+#include "SOMEIP_Layer.h"
+#include "WIFI_InteractionLayer.h"
+#include "SomeIpClient.h"
+#include "TestAssert.h"
+#include <stddef.h>
+#include <string.h>
+
+#define TEST_LINK_ID				0U
+#define TEST_SEARCH_LINK_ID			1U //client which keep FRAM search active
+#define TEST_STARTUP_TICKS			(60U*50U) //ESP startup sequence and connection to access point
+#define TEST_RESPONSE_TICKS			(5U*50U)
+#define TEST_SEARCH_TICKS			(60U*50U)
+#define TEST_QUIET_TICKS			(2U*50U) //end of response stream
+#define TEST_SEARCH_ATTEMPTS		10U
+#define TEST_REJECT_TICKS			20U //rejection of search is send after notification
+#define TEST_MAX_MESSAGE_SIZE		600U
+
+static uint8_t TestRequest[TEST_MAX_MESSAGE_SIZE];
+static uint8_t TestResponse[TEST_MAX_MESSAGE_SIZE];
+
+static void TestStartClock(void)
+{
+	HostUart_Reset();
+	HostEsp_Init();
+	HostClock_Init();
+	HostClock_SetTime(12, 30, 15, 6, 24);
+
+	HostEsp_RunTicks(TEST_STARTUP_TICKS);
+	TEST_ASSERT(HostEsp_ServerIsRunning());
+	TEST_ASSERT(HostEsp_ConnectClient(TEST_LINK_ID));
+	TEST_ASSERT(HostEsp_ConnectClient(TEST_SEARCH_LINK_ID));
+	HostEsp_RunTicks(3);
+}
+
+/*****************************************************************************************
+* ReceiveResponse() - take next message of link which isn't notification.
+*
+* Return: true if response was received.
+*****************************************************************************************/
+static bool ReceiveResponse(uint8_t linkId, uint8_t* response)
+{
+	uint16_t responseSize = 0;
+
+	do
+	{
+		responseSize = HostEsp_ReceiveMessage(linkId, response, TEST_MAX_MESSAGE_SIZE);
+
+		//SOMEIP_ValidateRxMessage don't accept error message type and TP segment
+		if((responseSize != 0) && (SOMEIP_GetMessageType(response) != SOME_IP_ERROR_CODE)
+			&& ((SOMEIP_GetMessageType(response) & SOME_IP_TP_FLAG) == 0))
+		{
+			TEST_ASSERT(SOMEIP_ValidateRxMessage(response, responseSize));
+		}
+	}
+	while((responseSize != 0) && (SOMEIP_GetMessageType(response) == SOME_IP_NOTIFICATION_CODE));
+
+	return (responseSize != 0);
+}
+
+static void CheckResponse(const uint8_t* request, uint8_t* response)
+{
+	TEST_ASSERT(SOMEIP_GetMessageType(response) != SOME_IP_NOTIFICATION_CODE);
+	TEST_ASSERT_EQUAL(SOMEIP_GetServiceId(request), SOMEIP_GetServiceId(response));
+	TEST_ASSERT_EQUAL(SOMEIP_GetMethodId(request), SOMEIP_GetMethodId(response));
+}
+
+/*****************************************************************************************
+* Exchange() - send coded request and wait for response of the same method.
+*
+* Return: size of response payload in TestResponse.
+*****************************************************************************************/
+static uint16_t Exchange(uint8_t* request, uint16_t requestSize)
+{
+	HostEsp_SendToDevice(TEST_LINK_ID, request, requestSize);
+
+	for(uint32_t tick = 0; tick < TEST_RESPONSE_TICKS; tick++)
+	{
+		if(ReceiveResponse(TEST_LINK_ID, TestResponse))
+		{
+			CheckResponse(request, TestResponse);
+
+			return SOMEIP_GetPayloadSize(TestResponse);
+		}
+
+		HostEsp_RunTicks(1);
+	}
+
+	TEST_ASSERT(false);
+	memset(TestResponse, 0xFF, TEST_MAX_MESSAGE_SIZE);
+
+	return 0;
+}
+
+/*****************************************************************************************
+* WaitUntilQuiet() - drop messages of both links until end of response streams.
+*****************************************************************************************/
+static void WaitUntilQuiet(void)
+{
+	uint8_t message[TEST_MAX_MESSAGE_SIZE];
+	uint32_t quietTicks = 0;
+
+	for(uint32_t tick = 0; (tick < TEST_SEARCH_TICKS) && (quietTicks < TEST_QUIET_TICKS); tick++)
+	{
+		quietTicks++;
+
+		while((HostEsp_ReceiveMessage(TEST_LINK_ID, message, TEST_MAX_MESSAGE_SIZE) != 0)
+			|| (HostEsp_ReceiveMessage(TEST_SEARCH_LINK_ID, message, TEST_MAX_MESSAGE_SIZE) != 0))
+		{
+			quietTicks = 0;
+		}
+
+		HostEsp_RunTicks(1);
+	}
+
+	TEST_ASSERT(quietTicks >= TEST_QUIET_TICKS);
+}
+
+/*****************************************************************************************
+* ExchangeDuringSearch() - send request when other client wait for summary of day which
+* isn't stored in FRAM, so search check all day measurements. Request of method with
+* searchInFram must wait in queue until end of search, request of other method is
+* answered before response of search. Response must have SOME_IP_RETURN_CODE_E_OK_VALUE.
+*
+* Return: size of response payload in TestResponse.
+*****************************************************************************************/
+static uint16_t ExchangeDuringSearch(uint8_t* request, uint16_t requestSize, bool waitForSearch)
+{
+	static const uint8_t searchPayload[SOME_IP_SERVICE_DAY_MEASUREMENT_REQ_PAYLOAD_SIZE] = {0, 1, 1, 24};
+	uint8_t searchRequest[TEST_MAX_MESSAGE_SIZE];
+	uint8_t searchResponse[TEST_MAX_MESSAGE_SIZE];
+	bool searchFinished = false;
+	bool responseReceived = false;
+	bool searchRejected = false;
+	uint8_t attempt = 0;
+
+	//search is started before request is send, it is rejected by E_NOT_READY when
+	//notification use TX buffer so it is send again
+	do
+	{
+		HostEsp_SendToDevice(TEST_SEARCH_LINK_ID, searchRequest, SOMEIP_CodeTxMessage(SOME_IP_SERVICE_DAY_SUMMARY,
+			SOME_IP_SERVICE_DAY_SUMMARY_METHOD_GET, SOME_IP_REQUEST_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE, searchRequest,
+			(uint8_t*)searchPayload, sizeof(searchPayload)));
+		HostEsp_RunTicks(TEST_REJECT_TICKS);
+
+		searchRejected = ReceiveResponse(TEST_SEARCH_LINK_ID, searchResponse);
+
+		if(searchRejected)
+			TEST_ASSERT_EQUAL(SOME_IP_RETURN_CODE_E_NOT_READY, searchResponse[SOME_IP_RETURN_CODE_FIELD_BEGIN]);
+	}
+	while(searchRejected && (++attempt < TEST_SEARCH_ATTEMPTS));
+
+	TEST_ASSERT(searchRejected == false);
+
+	HostEsp_SendToDevice(TEST_LINK_ID, request, requestSize);
+
+	//next search can start only after response of this one
+	for(uint32_t tick = 0; (tick < TEST_SEARCH_TICKS) && ((searchFinished == false) || (responseReceived == false)); tick++)
+	{
+		HostEsp_RunTicks(1);
+
+		if(ReceiveResponse(TEST_SEARCH_LINK_ID, searchResponse))
+		{
+			TEST_ASSERT_EQUAL(SOME_IP_SERVICE_DAY_SUMMARY, SOMEIP_GetServiceId(searchResponse));
+			searchFinished = true;
+		}
+
+		//next segments of response stay in link until WaitUntilQuiet
+		if((responseReceived == false) && ReceiveResponse(TEST_LINK_ID, TestResponse))
+		{
+			CheckResponse(request, TestResponse);
+			TEST_ASSERT_EQUAL(SOME_IP_RETURN_CODE_E_OK_VALUE, TestResponse[SOME_IP_RETURN_CODE_FIELD_BEGIN]);
+			TEST_ASSERT_EQUAL(waitForSearch, searchFinished);
+			responseReceived = true;
+		}
+	}
+
+	TEST_ASSERT(searchFinished);
+	WaitUntilQuiet();
+
+	if(responseReceived)
+		return SOMEIP_GetPayloadSize(TestResponse);
+
+	TEST_ASSERT(false);
+	memset(TestResponse, 0xFF, TEST_MAX_MESSAGE_SIZE);
+
+	return 0;
+}
+
+/*****************************************************************************************
+* CheckMalformedRequest() - send request with payload shorter than described, or one byte
+* when method has no payload, and check that it is rejected.
+*****************************************************************************************/
+static void CheckMalformedRequest(uint16_t serviceId, uint16_t methodId, uint16_t payloadSize)
+{
+	static uint8_t payload[TEST_MAX_MESSAGE_SIZE];
+
+	TEST_ASSERT_EQUAL(0, Exchange(TestRequest, SOMEIP_CodeTxMessage(serviceId, methodId, SOME_IP_REQUEST_CODE,
+		SOME_IP_RETURN_CODE_E_OK_VALUE, TestRequest, payload, (payloadSize == 0) ? 1 : (payloadSize - 1))));
+	TEST_ASSERT_EQUAL(SOME_IP_RETURN_CODE_E_MALFORMED_MESSAGE, TestResponse[SOME_IP_RETURN_CODE_FIELD_BEGIN]);
+}
+
+static void CheckUnknownService(uint16_t serviceId, uint16_t methodId)
+{
+	TEST_ASSERT_EQUAL(0, Exchange(TestRequest, SOMEIP_CodeTxMessage(serviceId, methodId, SOME_IP_REQUEST_CODE,
+		SOME_IP_RETURN_CODE_E_OK_VALUE, TestRequest, NULL, 0)));
+	TEST_ASSERT_EQUAL(SOME_IP_RETURN_CODE_E_UNKNOWN_SERVICE, TestResponse[SOME_IP_RETURN_CODE_FIELD_BEGIN]);
+}
+"""
+
+
+GENERATORS = {"header": generate_header, "source": generate_source, "client": generate_client, "test": generate_test}
+
+
+def main():
+    if len(sys.argv) != 4 or sys.argv[2] not in GENERATORS:
+        sys.exit("usage: %s interface.json header|source|client|test output" % sys.argv[0])
+
+    with open(sys.argv[1]) as interface_file:
+        interface = json.load(interface_file)
+
+    validate(interface)
+    source = GENERATORS[sys.argv[2]](interface, sys.argv[1])
+
+    #files of firmware have the same line ends as other sources of project
+    newline = "\r\n" if sys.argv[2] in ("header", "source") else "\n"
+
+    with open(sys.argv[3], "w", newline=newline) as output_file:
+        output_file.write(source)
+
+
+if __name__ == "__main__":
+    main()
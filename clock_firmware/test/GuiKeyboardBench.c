@@ -0,0 +1,104 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Benchmark of relabel of WiFi keyboard. Each relabel is started like release of shift key
+ * so setKeyboardButtons() change text, font and style of all 39 keys, which is 117 searches
+ * of button by ID in window with 47 objects. Time is measured with object index attached to
+ * keyboard window and with linear search after index is detached. Host time doesn't say
+ * how long relabel takes on LPC11E68 but ratio show cost of search against rest of setters.
+ */
+
+#include "HostClock.h"
+#include "GUI_Clock.h"
+#include "ugui.h"
+#include "TestAssert.h"
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_NUMBER_OF_RELABELS	20000U
+#define BENCH_SEARCHES_PER_RELABEL	(3U*NUMBER_OF_KEY_ON_KEYBOARD)
+
+void wifiKeyboardWindowHandler(UG_MESSAGE *msg);
+
+static UG_OBJECT_INDEX BenchObjectIndex;
+
+static void RelabelKeyboard(void)
+{
+	UG_MESSAGE msg = {0};
+
+	msg.type = MSG_TYPE_OBJECT;
+	msg.id = OBJ_TYPE_BUTTON;
+	msg.sub_id = BUTTON_WIFI_KEYBOARD_BEGIN + SHIFT_KEY_OFFSET_WKW;
+	msg.event = OBJ_EVENT_RELEASED;
+
+	wifiKeyboardWindowHandler(&msg);
+}
+
+/*****************************************************************************************
+* MeasureRelabel() - run relabels and print time of one relabel.
+*
+* Return: nanoseconds per relabel.
+*****************************************************************************************/
+static double MeasureRelabel(const char* name)
+{
+	struct timespec start, end;
+	double nanoseconds;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for(uint32_t i = 0; i < BENCH_NUMBER_OF_RELABELS; i++)
+		RelabelKeyboard();
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	nanoseconds = ((end.tv_sec - start.tv_sec)*1e9 + (end.tv_nsec - start.tv_nsec))/BENCH_NUMBER_OF_RELABELS;
+	printf("%-14s %8.0f ns per relabel, %6.1f ns per setter call\n", name, nanoseconds,
+		nanoseconds/BENCH_SEARCHES_PER_RELABEL);
+
+	return nanoseconds;
+}
+
+int main(void)
+{
+	char* firstText;
+	char* secondText;
+	double indexTime, linearTime;
+
+	HostClock_Init();
+
+	//shift key switch small and big letters so text of key is changed by each relabel
+	RelabelKeyboard();
+	firstText = UG_ButtonGetText(&wifiKeyboardWindow, BUTTON_WIFI_KEYBOARD_BEGIN);
+	RelabelKeyboard();
+	secondText = UG_ButtonGetText(&wifiKeyboardWindow, BUTTON_WIFI_KEYBOARD_BEGIN);
+	TEST_ASSERT(firstText != secondText);
+
+	TEST_ASSERT_EQUAL(UG_RESULT_OK, UG_WindowSetObjectIndex(&wifiKeyboardWindow, &BenchObjectIndex));
+	indexTime = MeasureRelabel("object index");
+
+	TEST_ASSERT_EQUAL(UG_RESULT_OK, UG_WindowSetObjectIndex(&wifiKeyboardWindow, NULL));
+	linearTime = MeasureRelabel("linear search");
+	//even number of relabels in each measurement
+	TEST_ASSERT(secondText == UG_ButtonGetText(&wifiKeyboardWindow, BUTTON_WIFI_KEYBOARD_BEGIN));
+
+	TEST_ASSERT_EQUAL(UG_RESULT_OK, UG_WindowSetObjectIndex(&wifiKeyboardWindow, &BenchObjectIndex));
+	printf("linear search / object index: %.2f\n", linearTime/indexTime);
+
+	return TEST_RESULT("GuiKeyboardBench");
+}
@@ -0,0 +1,121 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Implementation of chip library functions declared in host_include/chip.h. CRC engine is
+ * replaced by software CRC16(polynomial 0x8005, seed 0x0000, reflected). Messages of both
+ * sides of link are coded on host by the same function so exact match with CRC engine of
+ * microcontroller isn't required.
+ */
+
+#include "chip.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+static LPC_SYSCON_T HostSyscon;
+static LPC_TIMER_T HostTimer16_0;
+static LPC_IOCON_T HostIocon;
+static LPC_USART0_T HostUsart0;
+
+LPC_SYSCON_T *LPC_SYSCON = &HostSyscon;
+LPC_TIMER_T *LPC_TIMER16_0 = &HostTimer16_0;
+LPC_IOCON_T *LPC_IOCON = &HostIocon;
+LPC_USART0_T *LPC_USART0 = &HostUsart0;
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+}
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority)
+{
+}
+
+void NVIC_SystemReset(void)
+{
+	fprintf(stderr, "NVIC_SystemReset called\n");
+	exit(1);
+}
+
+void Chip_CRC_Init(void)
+{
+}
+
+uint16_t Chip_CRC_CRC16(const uint16_t *data, uint32_t hwords)
+{
+	static uint16_t crcTable[256];
+	static bool crcTableReady = false;
+	const uint8_t *bytePointer = (const uint8_t*)data;
+	uint16_t crcValue = 0;
+
+	//table is used so CRC on host don't take most of time of benchmarks like bitwise loop
+	if(crcTableReady == false)
+	{
+		for(uint16_t i = 0; i < 256; i++)
+		{
+			uint16_t value = i;
+
+			for(uint8_t bit = 0; bit < 8; bit++)
+				value = (value & 1) ? ((value >> 1) ^ 0xA001) : (value >> 1);
+
+			crcTable[i] = value;
+		}
+
+		crcTableReady = true;
+	}
+
+	//halfwords are read from memory in little endian order like by Cortex-M0+
+	for(uint32_t i = 0; i < (2*hwords); i++)
+		crcValue = (crcValue >> 8) ^ crcTable[(crcValue ^ bytePointer[i]) & 0xFF];
+
+	return crcValue;
+}
+
+uint32_t Chip_Clock_GetMainClockRate(void)
+{
+	return 48000000;
+}
+
+char* itoa(int value, char* string, int radix)
+{
+	char digits[34];
+	uint8_t position = 0;
+	uint8_t length = 0;
+	unsigned int absoluteValue = (value < 0) && (radix == 10) ? -(unsigned int)value : (unsigned int)value;
+
+	do
+	{
+		uint8_t digit = absoluteValue % radix;
+
+		digits[position++] = (digit < 10) ? ('0' + digit) : ('a' + digit - 10);
+		absoluteValue /= radix;
+	}while(absoluteValue != 0);
+
+	if((value < 0) && (radix == 10))
+		string[length++] = '-';
+
+	while(position > 0)
+		string[length++] = digits[--position];
+
+	string[length] = '\0';
+
+	return string;
+}
@@ -0,0 +1,104 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "HostClock.h"
+#include "HostUart.h"
+#include "GUI_Clock.h"
+#include "Thread.h"
+#include "ESP_Layer.h"
+#include "WIFI_InteractionLayer.h"
+#include <string.h>
+
+void TIMER16_0_IRQHandler(void);
+
+static uint32_t NumberOfTicks;
+
+/*****************************************************************************************
+* HostClock_Init() - initialize clock like main function after power on with empty FRAM.
+* Device has assigned access point so WIFI layer connect to it after startup sequence.
+*****************************************************************************************/
+void HostClock_Init(void)
+{
+	NumberOfTicks = 0;
+
+	ESP_Init(0, 115200, 400, 3, 0);
+
+	memset(&ClockState, 0, sizeof(ClockState));
+	ClockState.brightness = 80;
+	ClockState.day = INVALID_CALENDAR_DATE;
+	ClockState.month = INVALID_CALENDAR_DATE;
+	ClockState.year = INVALID_CALENDAR_DATE;
+
+	for(uint8_t i = 0; i < NUM_OF_TEMPERATURE_SOURCE; i++)
+	{
+		ClockState.TemperatureSensorTable[i].temperatureFramIndex = NOT_INITIALIZED_FRAM_INDEX_VALUE;
+		ClockState.TemperatureSensorTable[i].temperatureValue = INVALID_READ_SENSOR_VALUE;
+		ClockState.TemperatureSensorTable[i].temperatureValid = false;
+	}
+
+	strcpy((char*)ClockState.ssidOfAssignedApn, "HomeNet");
+	strcpy((char*)ClockState.passwordToAssignedApn, "secret12");
+
+	//ring of buffers used by temperature graph
+	for(uint8_t i = 0; i < READ_TEMP_FRAM_BUFFER_SIZE; i++)
+	{
+		ReadFramTempBufferTable[i].availabilityFlag = false;
+		ReadFramTempBufferTable[i].framIndex = 0;
+		ReadFramTempBufferTable[i].notExistFlag = false;
+		ReadFramTempBufferTable[i].singleRecord = &TemperatureSingleDay[0];
+		ReadFramTempBufferTable[i].pointerToNextElement = &ReadFramTempBufferTable[(i + 1) % READ_TEMP_FRAM_BUFFER_SIZE];
+		ReadFramTempBufferTable[i].pointerToPreviousElement =
+			&ReadFramTempBufferTable[(i + READ_TEMP_FRAM_BUFFER_SIZE - 1) % READ_TEMP_FRAM_BUFFER_SIZE];
+	}
+
+	GUI_ClockInit();
+
+	Thread_Init();
+}
+
+void HostClock_SetTime(uint8_t hour, uint8_t minute, uint8_t day, uint8_t month, uint8_t year)
+{
+	ClockState.currentTimeHour = hour;
+	ClockState.currentTimeMinute = minute;
+	ClockState.currentTimeSecond = 0;
+	ClockState.day = day;
+	ClockState.month = month;
+	ClockState.year = year;
+
+	WIFI_ClockStatusChanged();
+}
+
+/*****************************************************************************************
+* HostClock_Tick() - simulate one period of Thread_Call(20ms).
+*****************************************************************************************/
+void HostClock_Tick(void)
+{
+	HostUart_Deliver(HostUart_GetBytesPerTick());
+
+	TIMER16_0_IRQHandler();
+
+	NumberOfTicks++;
+
+	if((NumberOfTicks % ONE_SECONDS) == 0)
+		GUI_IncrementSecond();
+}
+
+uint32_t HostClock_GetTicks(void)
+{
+	return NumberOfTicks;
+}
@@ -0,0 +1,39 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _HOST_CLOCK_H_
+#define _HOST_CLOCK_H_
+
+/*
+ * Host fixture of whole clock firmware. HostClock_Init initialize ClockState and modules like
+ * main function when FRAM doesn't contain valid ClockState. HostClock_Tick simulate 20ms:
+ * bytes received by UART during tick are delivered by RX interrupt, Thread_Call is executed
+ * by timer interrupt and every ONE_SECONDS ticks second is counted like by RTC interrupt.
+ * Main loop of firmware(touch panel and refresh of LCD) isn't executed. Other side of UART
+ * (ESP8266 simulator or serial link client) must take bytes send by firmware before each tick.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void HostClock_Init(void);
+void HostClock_SetTime(uint8_t hour, uint8_t minute, uint8_t day, uint8_t month, uint8_t year);
+void HostClock_Tick(void);
+uint32_t HostClock_GetTicks(void);
+
+#endif /* _HOST_CLOCK_H_ */
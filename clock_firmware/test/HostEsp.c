@@ -0,0 +1,536 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "HostEsp.h"
+#include "HostUart.h"
+#include "HostClock.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+	bool isOpen;
+	char remote[HOST_ESP_REMOTE_SIZE];//"UDP","ip",port of link opened by AT+CIPSTART=n, otherwise empty
+	uint8_t buffer[HOST_ESP_LINK_BUFFER_SIZE];//data send by firmware to client
+	uint32_t head;
+	uint32_t tail;
+}HostEspLink;
+
+static HostEspLink LinkTable[HOST_ESP_NUMBER_OF_LINKS];
+static char CommandBuffer[HOST_ESP_COMMAND_BUFFER_SIZE];
+static uint16_t CommandSize;
+static uint8_t SendLinkId;//link of data after AT+CIPSEND
+static uint16_t SendRemaining;//bytes of data after AT+CIPSEND which wasn't received yet
+static uint16_t SendSize;
+static bool AccessPointAvailable;
+static bool StationConnected;
+static bool ServerRunning;
+static bool EventsEnabled;
+static bool MultipleConnections;//AT+CIPMUX=1
+static bool PassthroughMode;//AT+CIPMODE=1
+static bool PassthroughActive;//data of link 0 is send without AT+CIPSEND handshake
+static uint32_t TxIdleTicks;//ticks without data from firmware, "+++" must be separated by them
+static uint32_t StartFailures;//number of next AT+CIPSTART=n requests which fail
+static HostEspStatistics Statistics;
+
+static void HostEsp_Write(const char* text)
+{
+	HostUart_Receive((const uint8_t*)text, strlen(text));
+}
+
+/*****************************************************************************************
+* HostEsp_WriteEvent() - send event which module send without request(n,CONNECT, n,CLOSED,
+* WIFI DISCONNECT). Events can be disabled to simulate lost data.
+*****************************************************************************************/
+static void HostEsp_WriteEvent(const char* text)
+{
+	if(EventsEnabled)
+		HostEsp_Write(text);
+}
+
+static void HostEsp_CloseAllLinks(void)
+{
+	for(uint8_t i = 0; i < HOST_ESP_NUMBER_OF_LINKS; i++)
+	{
+		if(LinkTable[i].isOpen)
+			HostEsp_CloseClient(i);
+	}
+}
+
+void HostEsp_Init(void)
+{
+	memset(LinkTable, 0, sizeof(LinkTable));
+	CommandSize = 0;
+	SendRemaining = 0;
+	AccessPointAvailable = true;
+	StationConnected = false;
+	ServerRunning = false;
+	EventsEnabled = true;
+	MultipleConnections = false;
+	PassthroughMode = false;
+	PassthroughActive = false;
+	TxIdleTicks = 0;
+	StartFailures = 0;
+	HostEsp_ClearStatistics();
+}
+
+/*****************************************************************************************
+* HostEsp_ExecuteCommand() - answer AT request stored in CommandBuffer(without <CR><LF>).
+*****************************************************************************************/
+static void HostEsp_ExecuteCommand(void)
+{
+	char response[HOST_ESP_COMMAND_BUFFER_SIZE + 300];
+	const char* command = CommandBuffer;
+
+	Statistics.numberOfRequests++;
+
+	//echo of request
+	snprintf(response, sizeof(response), "%s\r\r\n", command);
+	HostEsp_Write(response);
+
+	if((strcmp(command, "AT") == 0) || (strncmp(command, "AT+CWMODE_CUR=", 14) == 0)
+		|| (strncmp(command, "AT+UART_CUR=", 12) == 0))
+	{
+		HostEsp_Write("\r\nOK\r\n");
+	}
+	else if((strcmp(command, "AT+CIPMUX=0") == 0) || (strcmp(command, "AT+CIPMUX=1") == 0))
+	{
+		MultipleConnections = (command[10] == '1');
+		HostEsp_Write("\r\nOK\r\n");
+	}
+	else if((strcmp(command, "AT+CIPMODE=0") == 0) || (strcmp(command, "AT+CIPMODE=1") == 0))
+	{
+		PassthroughMode = (command[11] == '1');
+		HostEsp_Write("\r\nOK\r\n");
+	}
+	else if(strcmp(command, "AT+RST") == 0)
+	{
+		HostEsp_CloseAllLinks();
+		StationConnected = false;
+		ServerRunning = false;
+		MultipleConnections = false;
+		PassthroughMode = false;
+		HostEsp_Write("\r\nOK\r\n\r\n ets Jan  8 2013,rst cause:2, boot mode:(3,6)\r\n\r\nready\r\n");
+	}
+	else if(strncmp(command, "AT+CWJAP_CUR=", 13) == 0)
+	{
+		Statistics.numberOfConnectRequests++;
+
+		if(AccessPointAvailable)
+		{
+			StationConnected = true;
+			HostEsp_Write("WIFI CONNECTED\r\nWIFI GOT IP\r\n\r\nOK\r\n");
+		}
+		else
+		{
+			HostEsp_Write("+CWJAP:3\r\n\r\nFAIL\r\n");
+		}
+	}
+	else if(strcmp(command, "AT+CWQAP") == 0)
+	{
+		HostEsp_CloseAllLinks();
+		StationConnected = false;
+		HostEsp_Write("\r\nOK\r\n");
+		HostEsp_WriteEvent("WIFI DISCONNECT\r\n");
+	}
+	else if(strcmp(command, "AT+CWLAP") == 0)
+	{
+		HostEsp_Write("+CWLAP:(3,\"HomeNet\",-67,\"aa:bb:cc:dd:ee:ff\",1,-12,0)\r\n"
+			"+CWLAP:(4,\"Office\",-80,\"11:22:33:44:55:66\",6,-5,0)\r\n\r\nOK\r\n");
+	}
+	else if(strcmp(command, "AT+CIFSR") == 0)
+	{
+		HostEsp_Write(StationConnected ? "+CIFSR:STAIP,\"192.168.1.50\"\r\n" : "+CIFSR:STAIP,\"0.0.0.0\"\r\n");
+		HostEsp_Write("+CIFSR:STAMAC,\"18:fe:34:00:00:01\"\r\n\r\nOK\r\n");
+	}
+	else if(strncmp(command, "AT+CIPSERVER=1,", 15) == 0)
+	{
+		ServerRunning = true;
+		HostEsp_Write("\r\nOK\r\n");
+	}
+	else if(strcmp(command, "AT+CIPSTATUS") == 0)
+	{
+		bool linkIsOpen = false;
+
+		Statistics.numberOfStatusRequests++;
+
+		for(uint8_t i = 0; i < HOST_ESP_NUMBER_OF_LINKS; i++)
+			linkIsOpen |= LinkTable[i].isOpen;
+
+		snprintf(response, sizeof(response), "STATUS:%u\r\n", StationConnected ? (linkIsOpen ? 3U : 2U) : 5U);
+		HostEsp_Write(response);
+
+		for(uint8_t i = 0; i < HOST_ESP_NUMBER_OF_LINKS; i++)
+		{
+			if(LinkTable[i].isOpen && (LinkTable[i].remote[0] != '\0'))
+			{
+				snprintf(response, sizeof(response), "+CIPSTATUS:%u,%s,%u,0\r\n", i, LinkTable[i].remote, 4000U + i);
+				HostEsp_Write(response);
+			}
+			else if(LinkTable[i].isOpen)
+			{
+				snprintf(response, sizeof(response), "+CIPSTATUS:%u,\"TCP\",\"192.168.1.%u\",%u,3000,1\r\n",
+					i, 100U + i, 50000U + i);
+				HostEsp_Write(response);
+			}
+		}
+
+		HostEsp_Write("\r\nOK\r\n");
+	}
+	else if(strncmp(command, "AT+CIPSTART=\"TCP\",", 18) == 0)
+	{
+		//single connection to remote server always use link 0
+		if((MultipleConnections == false) && StationConnected && (LinkTable[0].isOpen == false))
+		{
+			LinkTable[0].isOpen = true;
+			LinkTable[0].head = 0;
+			LinkTable[0].tail = 0;
+			HostEsp_Write("CONNECT\r\n\r\nOK\r\n");
+		}
+		else
+		{
+			HostEsp_Write("\r\nERROR\r\n");
+		}
+	}
+	else if(strncmp(command, "AT+CIPSTART=", 12) == 0)
+	{
+		//link to remote device selected by firmware in multiple connection mode
+		uint8_t linkId = atoi(&command[12]);
+		const char* remote = strchr(&command[12], ',');
+
+		Statistics.numberOfStartRequests++;
+
+		if((remote == NULL) || (strncmp(remote + 1, "\"UDP\",", 6) != 0) || (MultipleConnections == false)
+			|| (StationConnected == false) || (linkId >= HOST_ESP_NUMBER_OF_LINKS))
+		{
+			HostEsp_Write("\r\nERROR\r\n");
+		}
+		else if(LinkTable[linkId].isOpen)
+		{
+			HostEsp_Write("ALREADY CONNECTED\r\n\r\nERROR\r\n");
+		}
+		else if(StartFailures > 0)
+		{
+			StartFailures--;
+			HostEsp_Write("\r\nERROR\r\n");
+		}
+		else
+		{
+			LinkTable[linkId].isOpen = true;
+			LinkTable[linkId].head = 0;
+			LinkTable[linkId].tail = 0;
+			snprintf(LinkTable[linkId].remote, sizeof(LinkTable[linkId].remote), "%s", remote + 1);
+			snprintf(response, sizeof(response), "%u,CONNECT\r\n\r\nOK\r\n", linkId);
+			HostEsp_Write(response);
+		}
+	}
+	else if(strcmp(command, "AT+CIPSEND") == 0)
+	{
+		Statistics.numberOfSendRequests++;
+
+		if(PassthroughMode && (MultipleConnections == false) && LinkTable[0].isOpen)
+		{
+			PassthroughActive = true;
+			HostEsp_Write("\r\nOK\r\n\r\n>");
+		}
+		else
+		{
+			HostEsp_Write("\r\nERROR\r\n");
+		}
+	}
+	else if(strncmp(command, "AT+CIPSEND=", 11) == 0)
+	{
+		uint8_t linkId = atoi(&command[11]);
+		const char* sizePointer = strchr(&command[11], ',');
+
+		Statistics.numberOfSendRequests++;
+
+		if((sizePointer != NULL) && (linkId < HOST_ESP_NUMBER_OF_LINKS) && LinkTable[linkId].isOpen)
+		{
+			SendLinkId = linkId;
+			SendSize = atoi(sizePointer + 1);
+			SendRemaining = SendSize;
+			HostEsp_Write("\r\nOK\r\n> ");
+		}
+		else
+		{
+			HostEsp_Write("link is not valid\r\n\r\nERROR\r\n");
+		}
+	}
+	else
+	{
+		HostEsp_Write("\r\nERROR\r\n");
+	}
+}
+
+/*****************************************************************************************
+* HostEsp_ReceiveByte() - process byte send by firmware. Bytes are collected into AT request
+* or after AT+CIPSEND are stored in buffer of link.
+*****************************************************************************************/
+static void HostEsp_ReceiveByte(uint8_t txByte)
+{
+	if(PassthroughActive)
+	{
+		HostEspLink* link = &LinkTable[0];
+
+		link->buffer[link->head] = txByte;
+		link->head = (link->head + 1) & (HOST_ESP_LINK_BUFFER_SIZE - 1);
+		Statistics.sentBytes++;
+
+		return;
+	}
+
+	if(SendRemaining > 0)
+	{
+		HostEspLink* link = &LinkTable[SendLinkId];
+
+		link->buffer[link->head] = txByte;
+		link->head = (link->head + 1) & (HOST_ESP_LINK_BUFFER_SIZE - 1);
+		Statistics.sentBytes++;
+		SendRemaining--;
+
+		if(SendRemaining == 0)
+		{
+			char response[40];
+
+			snprintf(response, sizeof(response), "\r\nRecv %u bytes\r\n\r\nSEND OK\r\n", SendSize);
+			HostEsp_Write(response);
+		}
+
+		return;
+	}
+
+	if(txByte == '\n')
+	{
+		if((CommandSize > 0) && (CommandBuffer[CommandSize - 1] == '\r'))
+			CommandSize--;
+
+		CommandBuffer[CommandSize] = '\0';
+
+		if(CommandSize > 0)
+			HostEsp_ExecuteCommand();
+
+		CommandSize = 0;
+	}
+	else if(CommandSize < (HOST_ESP_COMMAND_BUFFER_SIZE - 1))
+	{
+		CommandBuffer[CommandSize++] = (char)txByte;
+	}
+}
+
+/*****************************************************************************************
+* HostEsp_Process() - take bytes send by firmware during one tick and answer them. In
+* passthrough mode "+++" send alone after at least one tick without data return module to
+* command mode, like guard time of module.
+*****************************************************************************************/
+void HostEsp_Process(void)
+{
+	uint8_t txData[0x1000];
+	uint32_t bytesPerTick = HostUart_GetBytesPerTick();
+	uint32_t txSize = HostUart_Transmit(txData, (bytesPerTick < sizeof(txData)) ? bytesPerTick : sizeof(txData));
+
+	if(PassthroughActive && (txSize == 3U) && (memcmp(txData, "+++", 3) == 0) && (TxIdleTicks > 0))
+	{
+		PassthroughActive = false;
+		txSize = 0;
+	}
+
+	TxIdleTicks = (txSize == 0) ? (TxIdleTicks + 1) : 0;
+
+	for(uint32_t i = 0; i < txSize; i++)
+		HostEsp_ReceiveByte(txData[i]);
+}
+
+void HostEsp_RunTicks(uint32_t numberOfTicks)
+{
+	for(uint32_t i = 0; i < numberOfTicks; i++)
+	{
+		HostEsp_Process();
+		HostClock_Tick();
+	}
+}
+
+bool HostEsp_ServerIsRunning(void)
+{
+	return ServerRunning && StationConnected;
+}
+
+bool HostEsp_StationIsConnected(void)
+{
+	return StationConnected;
+}
+
+bool HostEsp_PassthroughIsActive(void)
+{
+	return PassthroughActive;
+}
+
+bool HostEsp_LinkIsOpen(uint8_t linkId)
+{
+	return LinkTable[linkId].isOpen;
+}
+
+/*****************************************************************************************
+* HostEsp_GetLinkRemote() - return remote part of AT+CIPSTART request which opened link, for
+* example "UDP","192.168.1.100",3001. Links of TCP server clients return empty string.
+*****************************************************************************************/
+const char* HostEsp_GetLinkRemote(uint8_t linkId)
+{
+	return LinkTable[linkId].remote;
+}
+
+/*****************************************************************************************
+* HostEsp_SetStartFailures() - next numberOfFailures AT+CIPSTART requests of multiple
+* connection mode fail with ERROR like when station lost IP address or remote network.
+*****************************************************************************************/
+void HostEsp_SetStartFailures(uint32_t numberOfFailures)
+{
+	StartFailures = numberOfFailures;
+}
+
+/*****************************************************************************************
+* HostEsp_SetAccessPointAvailable() - switch on or off access point. When access point is
+* switched off connected station is disconnected(WIFI DISCONNECT) and AT+CWJAP_CUR fail.
+* TCP server stay created like in module and accept clients after next connection.
+*****************************************************************************************/
+void HostEsp_SetAccessPointAvailable(bool available)
+{
+	AccessPointAvailable = available;
+
+	if((available == false) && StationConnected)
+	{
+		HostEsp_CloseAllLinks();
+		StationConnected = false;
+		HostEsp_WriteEvent("WIFI DISCONNECT\r\n");
+	}
+}
+
+void HostEsp_SetEventsEnabled(bool enabled)
+{
+	EventsEnabled = enabled;
+}
+
+bool HostEsp_ConnectClient(uint8_t linkId)
+{
+	char event[16];
+
+	if((HostEsp_ServerIsRunning() == false) || LinkTable[linkId].isOpen)
+		return false;
+
+	LinkTable[linkId].isOpen = true;
+	LinkTable[linkId].head = 0;
+	LinkTable[linkId].tail = 0;
+
+	snprintf(event, sizeof(event), "%u,CONNECT\r\n", linkId);
+	HostEsp_WriteEvent(event);
+
+	return true;
+}
+
+void HostEsp_CloseClient(uint8_t linkId)
+{
+	char event[16];
+
+	LinkTable[linkId].isOpen = false;
+	LinkTable[linkId].remote[0] = '\0';
+	PassthroughActive = false;
+
+	if(MultipleConnections)
+		snprintf(event, sizeof(event), "%u,CLOSED\r\n", linkId);
+	else
+		snprintf(event, sizeof(event), "CLOSED\r\n");
+
+	HostEsp_WriteEvent(event);
+}
+
+/*****************************************************************************************
+* HostEsp_SendToDevice() - send data of client to firmware as one +IPD message or as raw
+* data in passthrough mode.
+*
+* Parameters:
+* @linkId: link of client.
+* @data: pointer to data, it can contain few messages or part of message.
+* @size: number of bytes.
+*****************************************************************************************/
+void HostEsp_SendToDevice(uint8_t linkId, const uint8_t* data, uint16_t size)
+{
+	char header[24];
+
+	if(PassthroughActive)
+	{
+		HostUart_Receive(data, size);
+		return;
+	}
+
+	snprintf(header, sizeof(header), "\r\n+IPD,%u,%u:", linkId, size);
+	HostEsp_Write(header);
+	HostUart_Receive(data, size);
+}
+
+void HostEsp_SendRaw(const char* text)
+{
+	HostEsp_Write(text);
+}
+
+/*****************************************************************************************
+* HostEsp_ReceiveMessage() - take next complete SOME/IP message send by firmware to client.
+* Messages are divided by length field of header.
+*
+* Parameters:
+* @linkId: link of client.
+* @buffer: pointer to buffer where message is copied.
+* @bufferSize: size of buffer.
+*
+* Return: size of message or 0 if complete message wasn't received.
+*****************************************************************************************/
+uint16_t HostEsp_ReceiveMessage(uint8_t linkId, uint8_t* buffer, uint16_t bufferSize)
+{
+	HostEspLink* link = &LinkTable[linkId];
+	uint32_t storedBytes = (link->head - link->tail) & (HOST_ESP_LINK_BUFFER_SIZE - 1);
+	uint32_t messageSize;
+
+	if(storedBytes < 8U)
+		return 0;
+
+	messageSize = 8U;
+
+	for(uint32_t i = 4; i < 8U; i++)
+		messageSize += (uint32_t)link->buffer[(link->tail + i) & (HOST_ESP_LINK_BUFFER_SIZE - 1)] << (8U*(7U - i));
+
+	if((storedBytes < messageSize) || (messageSize > bufferSize))
+		return 0;
+
+	for(uint32_t i = 0; i < messageSize; i++)
+	{
+		buffer[i] = link->buffer[link->tail];
+		link->tail = (link->tail + 1) & (HOST_ESP_LINK_BUFFER_SIZE - 1);
+	}
+
+	return (uint16_t)messageSize;
+}
+
+HostEspStatistics HostEsp_GetStatistics(void)
+{
+	return Statistics;
+}
+
+void HostEsp_ClearStatistics(void)
+{
+	memset(&Statistics, 0, sizeof(Statistics));
+}
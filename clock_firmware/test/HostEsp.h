@@ -0,0 +1,75 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _HOST_ESP_H_
+#define _HOST_ESP_H_
+
+/*
+ * Simulator of ESP8266 module used by host tests. Simulator take AT requests send by firmware
+ * from UART model, answer them like AT firmware of module(with echo of request) and keep
+ * state of station, TCP server and links. Clients of TCP server are simulated by test:
+ * HostEsp_ConnectClient open link(n,CONNECT), HostEsp_SendToDevice send data of client as
+ * +IPD message and data send by firmware via AT+CIPSEND is stored in buffer of link and can
+ * be read by HostEsp_ReceiveMessage as SOME/IP messages. Simulator answer immediately, time
+ * of transmission is simulated by UART model. HostEsp_RunTicks execute simulator and
+ * HostClock_Tick in loop. Single connection(AT+CIPMUX=0) to remote server opened by
+ * AT+CIPSTART use link 0, after AT+CIPMODE=1 and AT+CIPSEND data of link 0 is exchanged
+ * without +IPD headers and AT+CIPSEND handshake until "+++". In multiple connection mode
+ * AT+CIPSTART=n,"UDP",... open link n to remote device, data send to it is stored like data
+ * of clients and each AT+CIPSEND is one datagram. HostEsp_SetStartFailures make next
+ * AT+CIPSTART requests fail.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HOST_ESP_NUMBER_OF_LINKS		5U
+#define HOST_ESP_LINK_BUFFER_SIZE		0x4000U //bytes send by firmware to one link, must be power of two
+#define HOST_ESP_COMMAND_BUFFER_SIZE	512U
+#define HOST_ESP_REMOTE_SIZE			48U
+
+typedef struct
+{
+	uint32_t numberOfRequests;//all AT requests
+	uint32_t numberOfSendRequests;//AT+CIPSEND requests
+	uint32_t numberOfConnectRequests;//AT+CWJAP_CUR requests
+	uint32_t numberOfStatusRequests;//AT+CIPSTATUS requests
+	uint32_t numberOfStartRequests;//AT+CIPSTART=n requests of multiple connection mode
+	uint32_t sentBytes;//data bytes received from firmware for links
+}HostEspStatistics;
+
+void HostEsp_Init(void);
+void HostEsp_Process(void);
+void HostEsp_RunTicks(uint32_t numberOfTicks);
+bool HostEsp_ServerIsRunning(void);
+bool HostEsp_StationIsConnected(void);
+bool HostEsp_PassthroughIsActive(void);
+bool HostEsp_LinkIsOpen(uint8_t linkId);
+const char* HostEsp_GetLinkRemote(uint8_t linkId);
+void HostEsp_SetStartFailures(uint32_t numberOfFailures);
+void HostEsp_SetAccessPointAvailable(bool available);
+void HostEsp_SetEventsEnabled(bool enabled);
+bool HostEsp_ConnectClient(uint8_t linkId);
+void HostEsp_CloseClient(uint8_t linkId);
+void HostEsp_SendToDevice(uint8_t linkId, const uint8_t* data, uint16_t size);
+void HostEsp_SendRaw(const char* text);
+uint16_t HostEsp_ReceiveMessage(uint8_t linkId, uint8_t* buffer, uint16_t bufferSize);
+HostEspStatistics HostEsp_GetStatistics(void);
+void HostEsp_ClearStatistics(void);
+
+#endif /* _HOST_ESP_H_ */
@@ -0,0 +1,192 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "HostPeripherals.h"
+#include "FRAM_Driver.h"
+#include "TemperatureSensor.h"
+#include "GPIO_Driver.h"
+#include "BacklightControl.h"
+#include "BuzzerControl.h"
+#include "TouchPanel.h"
+#include "ClockControl.h"
+#include "LCD.h"
+#include <string.h>
+
+#define HOST_NUMBER_OF_SENSORS	3U
+
+static uint8_t FramMemory[FRAM_MEMORY_SIZE];
+static HostFramStatistics FramStatistics;
+static uint16_t SensorRawValueTable[HOST_NUMBER_OF_SENSORS] = {0x6000, 0x5000, 0x7000};
+static uint8_t ActiveSensor = CN6_TEMP_INSIDE;
+static TempStatus SensorStatus = I2C_WAITING_FOR_REQUEST;
+
+/*****************************************************************************************
+* HostPeripherals_SetTemperature() - set raw value returned by sensor. Value is converted by
+* TemperatureSensor_ReturnTemperature like value read from SHT21.
+*
+* Parameters:
+* @sensorNumber: CN6_TEMP_INSIDE, CN5_TEMP_OUTSIDE or CN4_TEMP_FURNACE.
+* @rawValue: raw value of sensor, 0xFFFF mean damaged sensor.
+*****************************************************************************************/
+void HostPeripherals_SetTemperature(uint8_t sensorNumber, uint16_t rawValue)
+{
+	SensorRawValueTable[sensorNumber - 1] = rawValue;
+}
+
+HostFramStatistics HostPeripherals_GetFramStatistics(void)
+{
+	return FramStatistics;
+}
+
+void HostPeripherals_ClearFramStatistics(void)
+{
+	memset(&FramStatistics, 0, sizeof(FramStatistics));
+}
+
+uint8_t* HostPeripherals_GetFramMemory(void)
+{
+	return FramMemory;
+}
+
+/*****************************************************************************************
+* FRAM_Driver
+*****************************************************************************************/
+void FRAM_Init(uint8_t port)
+{
+}
+
+void FRAM_Write(uint16_t dataAddress, uint16_t numOfBytes, uint8_t* writeBufferPointer)
+{
+	if(((uint32_t)dataAddress + numOfBytes) <= FRAM_MEMORY_SIZE)
+		memcpy(&FramMemory[dataAddress], writeBufferPointer, numOfBytes);
+
+	FramStatistics.numberOfWrites++;
+	FramStatistics.writtenBytes += numOfBytes;
+}
+
+void FRAM_Read(uint16_t dataAddress, uint16_t numOfBytes, uint8_t* readBufferPointer)
+{
+	if(((uint32_t)dataAddress + numOfBytes) <= FRAM_MEMORY_SIZE)
+		memcpy(readBufferPointer, &FramMemory[dataAddress], numOfBytes);
+
+	FramStatistics.numberOfReads++;
+	FramStatistics.readBytes += numOfBytes;
+}
+
+bool FRAM_Process(void)
+{
+	return true;
+}
+
+/*****************************************************************************************
+* TemperatureSensor
+*****************************************************************************************/
+void TemperatureSensor_Init(void)
+{
+}
+
+void TemperatureSensor_ChoseSensor(uint8_t sensorNumber)
+{
+	ActiveSensor = sensorNumber;
+}
+
+void TemperatureSensor_StartMeasurement(void)
+{
+	SensorStatus = I2C_REQUEST_EXECUTING;
+}
+
+void TemperatureSensor_Process(void)
+{
+	if(SensorStatus == I2C_REQUEST_EXECUTING)
+		SensorStatus = I2C_DATA_IS_READY;
+}
+
+TempStatus TemperatureSensor_CheckMeasurementStatus(void)
+{
+	return SensorStatus;
+}
+
+uint16_t TemperatureSensor_ReturnTemperature(void)
+{
+	uint32_t rawValue = SensorRawValueTable[ActiveSensor - 1];
+
+	SensorStatus = I2C_WAITING_FOR_REQUEST;
+
+	//the same conversion like in TemperatureSensor module
+	if(rawValue == 0xFFFF)
+		return (uint16_t)rawValue;
+
+	return (uint16_t)((1757 * (rawValue*10)) / 655360);
+}
+
+/*****************************************************************************************
+* GPIO, backlight, buzzer, touch panel, clock control and LCD
+*****************************************************************************************/
+bool GPIO_GetState(uint8_t port, uint8_t pin)
+{
+	//buttons aren't pressed
+	return true;
+}
+
+void Backlight_SetBrightness(uint8_t value)
+{
+}
+
+void Buzzer_SetOctave(uint8_t octaveNumber)
+{
+}
+
+void Buzzer_TurnOn(void)
+{
+}
+
+void Buzzer_TurnOff(void)
+{
+}
+
+void TouchPanel_SetCalibrationParameter(uint16_t rawX1, uint16_t rawX2, uint16_t rawY1, uint16_t rawY2)
+{
+}
+
+void ClockSleep(uint32_t time)
+{
+}
+
+void ClockInitTouchScreen(void)
+{
+}
+
+void LCD_SetPixel_uGui(uint16_t xPos, uint16_t yPos, uint32_t color)
+{
+}
+
+void LCD_FillFrame_uGui(uint16_t xPos1, uint16_t yPos1, uint16_t xPos2, uint16_t yPos2, uint32_t color)
+{
+}
+
+void LCD_StartFillArea_uGui(uint16_t xPos1, uint16_t yPos1, uint16_t xPos2, uint16_t yPos2)
+{
+}
+
+void LCD_PixelFillArea_uGui(uint32_t color)
+{
+}
+
+void LCD_StopFillArea_uGui(void)
+{
+}
@@ -0,0 +1,45 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _HOST_PERIPHERALS_H_
+#define _HOST_PERIPHERALS_H_
+
+/*
+ * Models of peripherals used by Thread and GUI modules in host tests. FRAM is array of
+ * FRAM_MEMORY_SIZE bytes, read and write are executed immediately and FRAM_Process return
+ * true. Temperature sensors return values set by HostPeripherals_SetTemperature after one
+ * call of TemperatureSensor_Process. LCD, backlight, buzzer and touch panel do nothing.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct
+{
+	uint32_t numberOfReads;
+	uint32_t numberOfWrites;
+	uint32_t readBytes;
+	uint32_t writtenBytes;
+}HostFramStatistics;
+
+void HostPeripherals_SetTemperature(uint8_t sensorNumber, uint16_t rawValue);
+HostFramStatistics HostPeripherals_GetFramStatistics(void);
+void HostPeripherals_ClearFramStatistics(void);
+uint8_t* HostPeripherals_GetFramMemory(void);
+
+#endif /* _HOST_PERIPHERALS_H_ */
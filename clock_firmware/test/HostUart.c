@@ -0,0 +1,253 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "HostUart.h"
+#include "UART_Driver.h"
+#include <string.h>
+
+void USART0_IRQHandler(void);
+
+static uint8_t RxBuffer[HOST_UART_RX_BUFFER_SIZE];
+static uint32_t RxHead;
+static uint32_t RxTail;
+static uint32_t RxAllowance;//bytes which can be read by current RX interrupt
+static uint8_t TxRing[UART_TX_RING_SIZE];
+static uint16_t TxRingHead;
+static uint16_t TxRingTail;
+static uint32_t Baudrate;
+static bool BaudrateSupported = true;
+static uint32_t NumberOfRxBytes;
+static uint32_t NumberOfTxBytes;
+
+/*****************************************************************************************
+* HostUart_Reset() - clear data of both directions and counters. Baudrate stay unchanged.
+*****************************************************************************************/
+void HostUart_Reset(void)
+{
+	RxHead = 0;
+	RxTail = 0;
+	RxAllowance = 0;
+	TxRingHead = 0;
+	TxRingTail = 0;
+	NumberOfRxBytes = 0;
+	NumberOfTxBytes = 0;
+}
+
+/*****************************************************************************************
+* HostUart_Receive() - place bytes send by other side of link on wire. Bytes are passed to
+* firmware by HostUart_Deliver.
+*
+* Parameters:
+* @data: pointer to received bytes.
+* @size: number of bytes.
+*
+* Return: number of stored bytes, lower than size if buffer is full.
+*****************************************************************************************/
+uint32_t HostUart_Receive(const uint8_t* data, uint32_t size)
+{
+	uint32_t storedBytes = 0;
+
+	for(; storedBytes < size; storedBytes++)
+	{
+		uint32_t nextHead = (RxHead + 1) & (HOST_UART_RX_BUFFER_SIZE - 1);
+
+		if(nextHead == RxTail)
+			break;
+
+		RxBuffer[RxHead] = data[storedBytes];
+		RxHead = nextHead;
+	}
+
+	return storedBytes;
+}
+
+/*****************************************************************************************
+* HostUart_Deliver() - pass waiting bytes to firmware by call of RX interrupt.
+*
+* Parameters:
+* @maxBytes: max number of bytes read by interrupt.
+*
+* Return: number of delivered bytes.
+*****************************************************************************************/
+uint32_t HostUart_Deliver(uint32_t maxBytes)
+{
+	uint32_t pendingBytes = HostUart_GetPendingRxSize();
+
+	RxAllowance = (pendingBytes < maxBytes) ? pendingBytes : maxBytes;
+
+	if(RxAllowance == 0)
+		return 0;
+
+	pendingBytes = RxAllowance;
+	USART0_IRQHandler();
+
+	return pendingBytes - RxAllowance;
+}
+
+uint32_t HostUart_GetPendingRxSize(void)
+{
+	return (RxHead - RxTail) & (HOST_UART_RX_BUFFER_SIZE - 1);
+}
+
+/*****************************************************************************************
+* HostUart_Transmit() - take bytes send by firmware from TX ring.
+*
+* Parameters:
+* @buffer: pointer to buffer where bytes are copied, can be NULL if bytes are ignored.
+* @maxBytes: max number of bytes send on wire.
+*
+* Return: number of bytes taken from TX ring.
+*****************************************************************************************/
+uint32_t HostUart_Transmit(uint8_t* buffer, uint32_t maxBytes)
+{
+	uint32_t sendBytes = 0;
+
+	for(; (sendBytes < maxBytes) && (TxRingTail != TxRingHead); sendBytes++)
+	{
+		if(buffer != NULL)
+			buffer[sendBytes] = TxRing[TxRingTail];
+
+		TxRingTail = (TxRingTail + 1) & (UART_TX_RING_SIZE - 1);
+	}
+
+	NumberOfTxBytes += sendBytes;
+
+	return sendBytes;
+}
+
+uint32_t HostUart_GetTxRingUsage(void)
+{
+	return (TxRingHead - TxRingTail) & (UART_TX_RING_SIZE - 1);
+}
+
+uint32_t HostUart_GetBaudrate(void)
+{
+	return Baudrate;
+}
+
+/*****************************************************************************************
+* HostUart_GetBytesPerTick() - return number of bytes which can be send in one direction
+* during one tick with present baudrate. 8N1 frame has 10 bits.
+*****************************************************************************************/
+uint32_t HostUart_GetBytesPerTick(void)
+{
+	return ((Baudrate/10U)*HOST_UART_TICK_PERIOD_MS)/1000U;
+}
+
+void HostUart_SetBaudrateSupported(bool supported)
+{
+	BaudrateSupported = supported;
+}
+
+uint32_t HostUart_GetNumberOfRxBytes(void)
+{
+	return NumberOfRxBytes;
+}
+
+uint32_t HostUart_GetNumberOfTxBytes(void)
+{
+	return NumberOfTxBytes;
+}
+
+/*****************************************************************************************
+* Functions of UART_Driver used by ESP layer. Only port 0 is modeled.
+*****************************************************************************************/
+bool UART_DriverInit(uint8_t portNumber, uint32_t baudrate, WORD_LENGTH length, STOP_BITS stopBits, PARITY parity)
+{
+	Baudrate = baudrate;
+
+	return true;
+}
+
+bool UART_ChangeBaudrate(uint8_t portNumber, uint32_t baudrate)
+{
+	if(BaudrateSupported == false)
+		return false;
+
+	Baudrate = baudrate;
+
+	return true;
+}
+
+bool UART_IsBaudrateSupported(uint32_t baudrate)
+{
+	return BaudrateSupported;
+}
+
+uint8_t UART_ReadByteFromTrasmitter(uint8_t portNumber)
+{
+	uint8_t rxByte = 0;
+
+	if((RxAllowance > 0) && (RxTail != RxHead))
+	{
+		rxByte = RxBuffer[RxTail];
+		RxTail = (RxTail + 1) & (HOST_UART_RX_BUFFER_SIZE - 1);
+		RxAllowance--;
+		NumberOfRxBytes++;
+	}
+
+	return rxByte;
+}
+
+UART_Status UART_ReturnStatusRegister(uint8_t portNumber)
+{
+	UART_Status status;
+
+	memset(&status, 0, sizeof(status));
+	status.RDR = (RxAllowance > 0) && (RxTail != RxHead);
+	status.THRE = (TxRingTail == TxRingHead);
+	status.TEMT = status.THRE;
+
+	return status;
+}
+
+uint16_t UART_Write(uint8_t portNumber, const uint8_t* data, uint16_t size)
+{
+	uint16_t queuedBytes = 0;
+
+	for(; queuedBytes < size; queuedBytes++)
+	{
+		uint16_t nextHead = (TxRingHead + 1) & (UART_TX_RING_SIZE - 1);
+
+		if(nextHead == TxRingTail)
+			break;
+
+		TxRing[TxRingHead] = data[queuedBytes];
+		TxRingHead = nextHead;
+	}
+
+	return queuedBytes;
+}
+
+bool UART_IsTransmitFinished(uint8_t portNumber)
+{
+	return (TxRingTail == TxRingHead);
+}
+
+void UART_ProcessTransmitInterrupt(uint8_t portNumber)
+{
+	//bytes are taken from TX ring by HostUart_Transmit
+}
+
+void UART_EnableInterrupts(uint8_t portNumber)
+{
+}
+
+void UART_DisableInterrupts(uint8_t portNumber)
+{
+}
@@ -0,0 +1,50 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _HOST_UART_H_
+#define _HOST_UART_H_
+
+/*
+ * Model of UART port 0 used by host tests instead of UART_Driver. Test place bytes send by
+ * other side of link(ESP8266 simulator or serial link client) by HostUart_Receive and
+ * pass them to firmware by HostUart_Deliver which call USART0_IRQHandler like RX interrupt.
+ * Bytes queued by UART_Write are stored in TX ring of the same size like in UART_Driver
+ * and are taken from it by HostUart_Transmit. Test call both functions once per tick with
+ * number of bytes which can be send in tick with used baudrate(HostUart_GetBytesPerTick)
+ * so time of transmission on wire is simulated.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HOST_UART_RX_BUFFER_SIZE	0x10000U //bytes waiting for delivery, must be power of two
+#define HOST_UART_TICK_PERIOD_MS	20U //period of Thread_Call
+
+void HostUart_Reset(void);
+uint32_t HostUart_Receive(const uint8_t* data, uint32_t size);
+uint32_t HostUart_Deliver(uint32_t maxBytes);
+uint32_t HostUart_GetPendingRxSize(void);
+uint32_t HostUart_Transmit(uint8_t* buffer, uint32_t maxBytes);
+uint32_t HostUart_GetTxRingUsage(void);
+uint32_t HostUart_GetBaudrate(void);
+uint32_t HostUart_GetBytesPerTick(void);
+void HostUart_SetBaudrateSupported(bool supported);
+uint32_t HostUart_GetNumberOfRxBytes(void);
+uint32_t HostUart_GetNumberOfTxBytes(void);
+
+#endif /* _HOST_UART_H_ */
@@ -0,0 +1,185 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "HostUsart.h"
+#include "chip.h"
+#include "UART_Driver.h"
+
+#define HOST_USART_LSR_THRE		(1U << 5)
+#define HOST_USART_LSR_TEMT		(1U << 6)
+#define HOST_USART_LCR_TWO_STOP_BITS	(1U << 2)
+#define HOST_USART_LCR_PARITY_ENABLE	(1U << 3)
+
+void USART0_IRQHandler(void);
+
+static uint32_t FifoWrites;
+static uint32_t FifoReads;
+static uint32_t FifoOverruns;
+static bool Shifting;
+static uint8_t ShiftRegister;
+static uint64_t ShiftEndNs;
+static uint64_t TimeNs;
+static uint32_t NumberOfInterrupts;
+static uint8_t WireData[HOST_USART_WIRE_BUFFER_SIZE];
+static uint32_t WireSize;
+
+void HostUsart_Reset(void)
+{
+	memset((void*)LPC_USART0, 0, sizeof(LPC_USART0_T));
+	LPC_USART0->FDR = 0x10; //MULVAL = 1, DIVADDVAL = 0 after reset
+	LPC_SYSCON->USART0CLKDIV = 1;
+
+	FifoWrites = 0;
+	FifoReads = 0;
+	FifoOverruns = 0;
+	Shifting = false;
+	TimeNs = 0;
+	NumberOfInterrupts = 0;
+	WireSize = 0;
+}
+
+/*****************************************************************************************
+* HostUsart_PushTxFifo() - called by write of THR.
+*
+* Return: index of TX_FIFO entry where written byte is stored.
+*****************************************************************************************/
+uint32_t HostUsart_PushTxFifo(void)
+{
+	//byte written to full FIFO is lost like in hardware, it is counted as error of driver
+	if(HostUsart_GetFifoLevel() == HOST_USART_FIFO_SIZE)
+	{
+		FifoOverruns++;
+		return FifoReads & (HOST_USART_FIFO_SIZE - 1);
+	}
+
+	return (FifoWrites++) & (HOST_USART_FIFO_SIZE - 1);
+}
+
+/*****************************************************************************************
+* HostUsart_UpdateLineStatus() - called by read of LSR.
+*
+* Return: index of LSR_VALUE entry, it is always 0.
+*****************************************************************************************/
+uint32_t HostUsart_UpdateLineStatus(void)
+{
+	uint32_t status = 0;
+
+	if(HostUsart_GetFifoLevel() == 0)
+	{
+		status |= HOST_USART_LSR_THRE;
+
+		if(Shifting == false)
+			status |= HOST_USART_LSR_TEMT;
+	}
+
+	LPC_USART0->LSR_VALUE[0] = status;
+
+	return 0;
+}
+
+void HostUsart_Run(uint32_t microseconds)
+{
+	uint64_t endTimeNs = TimeNs + (uint64_t)microseconds*1000U;
+
+	while(true)
+	{
+		if((Shifting == false) && (HostUsart_GetFifoLevel() > 0))
+		{
+			ShiftRegister = LPC_USART0->TX_FIFO[(FifoReads++) & (HOST_USART_FIFO_SIZE - 1)];
+			Shifting = true;
+			ShiftEndNs = TimeNs + HostUsart_GetFrameTimeNs();
+
+			//THRE interrupt is generated when FIFO become empty
+			if((HostUsart_GetFifoLevel() == 0) && (LPC_USART0->IER & THRE_INTERRUPT_ENABLE))
+			{
+				NumberOfInterrupts++;
+				USART0_IRQHandler();
+			}
+			continue;
+		}
+
+		if(Shifting && (ShiftEndNs <= endTimeNs))
+		{
+			TimeNs = ShiftEndNs;
+			Shifting = false;
+
+			if(WireSize < HOST_USART_WIRE_BUFFER_SIZE)
+				WireData[WireSize++] = ShiftRegister;
+			continue;
+		}
+
+		break;
+	}
+
+	TimeNs = endTimeNs;
+}
+
+uint32_t HostUsart_GetBaudrate(void)
+{
+	uint32_t divisorLatch = (LPC_USART0->DLM << 8) | LPC_USART0->DLL;
+	uint32_t mulVal = LPC_USART0->FDR >> 4;
+	uint32_t divAddVal = LPC_USART0->FDR & 0xF;
+	uint64_t peripheralClock = Chip_Clock_GetMainClockRate()/LPC_SYSCON->USART0CLKDIV;
+
+	if((divisorLatch == 0) || (mulVal == 0))
+		return 0;
+
+	return (uint32_t)((peripheralClock*mulVal)/(16U*divisorLatch*(mulVal + divAddVal)));
+}
+
+uint32_t HostUsart_GetFrameTimeNs(void)
+{
+	//start bit, data bits, optional parity and stop bits
+	uint32_t bits = 1 + 5 + (LPC_USART0->LCR & 0x3) + 1;
+	uint32_t baudrate = HostUsart_GetBaudrate();
+
+	if(LPC_USART0->LCR & HOST_USART_LCR_PARITY_ENABLE)
+		bits++;
+
+	if(LPC_USART0->LCR & HOST_USART_LCR_TWO_STOP_BITS)
+		bits++;
+
+	return (baudrate == 0) ? UINT32_MAX : (uint32_t)((bits*1000000000ULL)/baudrate);
+}
+
+uint64_t HostUsart_GetTimeNs(void)
+{
+	return TimeNs;
+}
+
+uint32_t HostUsart_GetFifoLevel(void)
+{
+	return FifoWrites - FifoReads;
+}
+
+uint32_t HostUsart_GetFifoOverruns(void)
+{
+	return FifoOverruns;
+}
+
+uint32_t HostUsart_GetNumberOfInterrupts(void)
+{
+	return NumberOfInterrupts;
+}
+
+const uint8_t* HostUsart_GetWireData(uint32_t* size)
+{
+	*size = WireSize;
+
+	return WireData;
+}
@@ -0,0 +1,46 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _HOST_USART_H_
+#define _HOST_USART_H_
+
+/*
+ * Model of USART0 registers used to test UART_Driver on host. Bytes written to THR are
+ * stored in 16 byte TX FIFO and moved to shift register, each byte leave shift register
+ * after time of frame calculated from divisors, LCR and main clock. Time is simulated by
+ * HostUsart_Run. When last byte is taken from FIFO and THRE interrupt is enabled then
+ * USART0_IRQHandler is called like by NVIC, it must be defined by test. Bytes send on wire
+ * are stored so test can compare them with written data.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HOST_USART_WIRE_BUFFER_SIZE	4096U //bytes send on wire
+
+void HostUsart_Reset(void);
+void HostUsart_Run(uint32_t microseconds);
+uint32_t HostUsart_GetBaudrate(void);
+uint32_t HostUsart_GetFrameTimeNs(void);
+uint64_t HostUsart_GetTimeNs(void);
+uint32_t HostUsart_GetFifoLevel(void);
+uint32_t HostUsart_GetFifoOverruns(void);
+uint32_t HostUsart_GetNumberOfInterrupts(void);
+const uint8_t* HostUsart_GetWireData(uint32_t* size);
+
+#endif /* _HOST_USART_H_ */
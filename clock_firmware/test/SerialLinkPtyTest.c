@@ -0,0 +1,577 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Test of serial link mode over pseudo terminal. Firmware is built with WIFI_SERIAL_LINK_MODE
+ * and UART model of firmware is connected to slave side of pty pair configured as raw port
+ * with 1000000 baud. Client use master side, send SOME/IP requests coded by COBS and decode
+ * responses. All services are called once and then throughput is measured for pipelined
+ * CLOCK_STATUS GET requests, FRAM image export(device to client) and FRAM image import
+ * (client to device). Pty doesn't limit speed so time of transmission is simulated by UART
+ * model(bytes per 20ms tick at 1000000 baud) and throughput is reported per simulated second
+ * together with usage of link capacity. Client decode frames by CobsFraming module of
+ * firmware, coding of module is checked separately.
+ */
+
+#include "HostClock.h"
+#include "HostUart.h"
+#include "HostPeripherals.h"
+#include "ESP_Layer.h"
+#include "FRAM_Driver.h"
+#include "SOMEIP_Layer.h"
+#include "WIFI_InteractionLayer.h"
+#include "CobsFraming.h"
+#include "TestAssert.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#if (WIFI_SERIAL_LINK_MODE == 0) || (WIFI_FRAM_IMAGE_SERVICE == 0)
+#error "test must be built with WIFI_SERIAL_LINK_MODE and WIFI_FRAM_IMAGE_SERVICE"
+#endif
+
+#define TEST_TICKS_PER_SECOND		50U
+#define TEST_STARTUP_TICKS			(5U*TEST_TICKS_PER_SECOND)
+#define TEST_RESPONSE_TIMEOUT		(20U*TEST_TICKS_PER_SECOND) //search of FRAM takes about 8s
+#define TEST_MAX_MESSAGE_SIZE		300U
+#define TEST_FRAME_QUEUE_SIZE		64U
+#define TEST_CLIENT_TX_BUFFER_SIZE	0x8000U
+#define TEST_PTY_CHUNK_SIZE			4096U
+#define TEST_WINDOW					WIFI_REQUEST_QUEUE_SIZE //requests in flight
+#define TEST_NUMBER_OF_GET_REQUESTS	2000U
+#define TEST_LINK_CAPACITY			(WIFI_SERIAL_LINK_BAUDRATE/10U) //bytes per second, 8N1 frame has 10 bits
+#define TEST_NUMBER_OF_BLOCKS		WIFI_FRAM_IMAGE_NUMBER_OF_BLOCKS
+//minimal messages per second, firmware process requests in 20ms thread so link isn't limit
+#define TEST_MIN_GET_RATE			45U
+#define TEST_MIN_EXPORT_RATE		20U
+#define TEST_MIN_IMPORT_RATE		15U
+
+typedef struct
+{
+	uint16_t size;
+	uint8_t data[TEST_MAX_MESSAGE_SIZE];
+}TestFrame;
+
+typedef struct
+{
+	const char* name;
+	uint32_t ticks;
+	uint32_t messages;
+	uint32_t clientTxBytes;//bytes on wire from client to device
+	uint32_t clientRxBytes;//bytes on wire from device to client
+	double wallSeconds;
+}TestThroughput;
+
+static int MasterFd = -1;//client side
+static int SlaveFd = -1;//device side
+//bytes taken from TX ring of UART model which wasn't written to pty yet
+static uint8_t DeviceTxBuffer[TEST_PTY_CHUNK_SIZE];
+static uint32_t DeviceTxSize;
+static uint32_t DeviceTxOffset;
+//COBS coded requests which wasn't written to pty yet
+static uint8_t ClientTxBuffer[TEST_CLIENT_TX_BUFFER_SIZE];
+static uint32_t ClientTxSize;
+static uint32_t ClientTxOffset;
+static CobsDecoder ClientDecoder;
+static TestFrame ReceivedFrame;
+static bool ReceivedFrameDropped;
+static TestFrame FrameQueue[TEST_FRAME_QUEUE_SIZE];
+static uint32_t FrameQueueHead;
+static uint32_t FrameQueueSize;
+static uint32_t NumberOfNotifications;
+static uint32_t ClientTxBytes;
+static uint32_t ClientRxBytes;
+static uint8_t FramImage[FRAM_MEMORY_SIZE];
+
+/*****************************************************************************************
+* OpenPty() - open pty pair, slave is configured like serial port of device.
+*
+* Return: true if pty is ready.
+*****************************************************************************************/
+static bool OpenPty(void)
+{
+	struct termios settings;
+
+	MasterFd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+	if((MasterFd < 0) || (grantpt(MasterFd) != 0) || (unlockpt(MasterFd) != 0))
+		return false;
+
+	SlaveFd = open(ptsname(MasterFd), O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+	if((SlaveFd < 0) || (tcgetattr(SlaveFd, &settings) != 0))
+		return false;
+
+	cfmakeraw(&settings);
+	cfsetispeed(&settings, B1000000);
+	cfsetospeed(&settings, B1000000);
+
+	return tcsetattr(SlaveFd, TCSANOW, &settings) == 0;
+}
+
+static void ClientDecodeByte(uint8_t codedByte)
+{
+	uint8_t decodedByte = 0;
+
+	switch(CobsFraming_DecodeByte(&ClientDecoder, codedByte, &decodedByte))
+	{
+	case COBS_DECODE_NO_DATA:
+		break;
+
+	case COBS_DECODE_DATA:
+		if(ReceivedFrame.size < TEST_MAX_MESSAGE_SIZE)
+			ReceivedFrame.data[ReceivedFrame.size++] = decodedByte;
+		else
+			ReceivedFrameDropped = true;
+		break;
+
+	case COBS_DECODE_FRAME_END:
+		TEST_ASSERT(ReceivedFrameDropped == false);
+		TEST_ASSERT(FrameQueueSize < TEST_FRAME_QUEUE_SIZE);
+
+		if((ReceivedFrame.size > 0) && (ReceivedFrameDropped == false) && (FrameQueueSize < TEST_FRAME_QUEUE_SIZE))
+		{
+			FrameQueue[(FrameQueueHead + FrameQueueSize) % TEST_FRAME_QUEUE_SIZE] = ReceivedFrame;
+			FrameQueueSize++;
+		}
+
+		ReceivedFrame.size = 0;
+		ReceivedFrameDropped = false;
+		CobsFraming_InitDecoder(&ClientDecoder);
+		break;
+
+	case COBS_DECODE_FRAME_ERROR:
+		TEST_ASSERT(false);
+		ReceivedFrame.size = 0;
+		ReceivedFrameDropped = false;
+		CobsFraming_InitDecoder(&ClientDecoder);
+		break;
+	}
+}
+
+/*****************************************************************************************
+* RunTick() - exchange data over pty and execute one tick of firmware.
+*****************************************************************************************/
+static void RunTick(void)
+{
+	uint8_t buffer[TEST_PTY_CHUNK_SIZE];
+	ssize_t size;
+
+	//client write requests
+	if(ClientTxOffset < ClientTxSize)
+	{
+		size = write(MasterFd, &ClientTxBuffer[ClientTxOffset], ClientTxSize - ClientTxOffset);
+
+		if(size > 0)
+			ClientTxOffset += size;
+
+		if(ClientTxOffset == ClientTxSize)
+		{
+			ClientTxOffset = 0;
+			ClientTxSize = 0;
+		}
+	}
+
+	//device side read pty, UART model deliver bytes with speed of link
+	while((size = read(SlaveFd, buffer, sizeof(buffer))) > 0)
+		TEST_ASSERT_EQUAL(size, HostUart_Receive(buffer, size));
+
+	HostClock_Tick();
+
+	//bytes send by UART in tick are written to pty
+	if(DeviceTxOffset == DeviceTxSize)
+	{
+		DeviceTxOffset = 0;
+		DeviceTxSize = HostUart_Transmit(DeviceTxBuffer, HostUart_GetBytesPerTick());
+	}
+
+	if(DeviceTxOffset < DeviceTxSize)
+	{
+		size = write(SlaveFd, &DeviceTxBuffer[DeviceTxOffset], DeviceTxSize - DeviceTxOffset);
+
+		if(size > 0)
+			DeviceTxOffset += size;
+	}
+
+	//client read responses
+	while((size = read(MasterFd, buffer, sizeof(buffer))) > 0)
+	{
+		ClientRxBytes += size;
+
+		for(ssize_t i = 0; i < size; i++)
+			ClientDecodeByte(buffer[i]);
+	}
+}
+
+static void ClientSend(uint16_t serviceId, uint16_t methodId, const void* payload, uint16_t payloadSize)
+{
+	uint8_t message[TEST_MAX_MESSAGE_SIZE];
+	uint16_t messageSize = SOMEIP_CodeTxMessage(serviceId, methodId, SOME_IP_REQUEST_CODE,
+		SOME_IP_RETURN_CODE_E_OK_VALUE, message, (uint8_t*)payload, payloadSize);
+	uint16_t codedSize = CobsFraming_Encode(message, messageSize, &ClientTxBuffer[ClientTxSize],
+		TEST_CLIENT_TX_BUFFER_SIZE - ClientTxSize);
+
+	TEST_ASSERT(codedSize > 0);
+	ClientTxSize += codedSize;
+	ClientTxBytes += codedSize;
+}
+
+/*****************************************************************************************
+* ClientReceive() - wait for next message which isn't notification.
+*
+* Return: pointer to message or NULL after timeout.
+*****************************************************************************************/
+static TestFrame* ClientReceive(void)
+{
+	static TestFrame frame;
+
+	for(uint32_t tick = 0; tick < TEST_RESPONSE_TIMEOUT; )
+	{
+		if(FrameQueueSize == 0)
+		{
+			RunTick();
+			tick++;
+			continue;
+		}
+
+		frame = FrameQueue[FrameQueueHead];
+		FrameQueueHead = (FrameQueueHead + 1) % TEST_FRAME_QUEUE_SIZE;
+		FrameQueueSize--;
+
+		if(SOMEIP_GetMessageType(frame.data) == SOME_IP_NOTIFICATION_CODE)
+		{
+			NumberOfNotifications++;
+			continue;
+		}
+
+		return &frame;
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************************
+* ExpectResponse() - receive response, check header and CRC.
+*
+* Return: pointer to response or NULL if response wasn't received or is wrong.
+*****************************************************************************************/
+static TestFrame* ExpectResponse(uint16_t serviceId, uint16_t methodId, uint8_t messageType)
+{
+	TestFrame* frame = ClientReceive();
+
+	TEST_ASSERT(frame != NULL);
+
+	if(frame == NULL)
+		return NULL;
+
+	TEST_ASSERT_EQUAL(serviceId, SOMEIP_GetServiceId(frame->data));
+	TEST_ASSERT_EQUAL(methodId, SOMEIP_GetMethodId(frame->data));
+	TEST_ASSERT_EQUAL(messageType, SOMEIP_GetMessageType(frame->data));
+
+	//validation of TP segment isn't supported by SOMEIP_ValidateRxMessage
+	if((messageType & SOME_IP_TP_FLAG) == 0)
+		TEST_ASSERT(SOMEIP_ValidateRxMessage(frame->data, frame->size));
+
+	if((serviceId != SOMEIP_GetServiceId(frame->data)) || (methodId != SOMEIP_GetMethodId(frame->data)))
+		return NULL;
+
+	return frame;
+}
+
+static void StartMeasurement(TestThroughput* throughput, const char* name, struct timespec* start)
+{
+	memset(throughput, 0, sizeof(TestThroughput));
+	throughput->name = name;
+	throughput->ticks = HostClock_GetTicks();
+	throughput->clientTxBytes = ClientTxBytes;
+	throughput->clientRxBytes = ClientRxBytes;
+	clock_gettime(CLOCK_MONOTONIC, start);
+}
+
+/*****************************************************************************************
+* FinishMeasurement() - print throughput in simulated time and wall time of measurement.
+*
+* Return: messages per simulated second.
+*****************************************************************************************/
+static double FinishMeasurement(TestThroughput* throughput, uint32_t messages, const struct timespec* start)
+{
+	struct timespec end;
+	double seconds;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	throughput->ticks = HostClock_GetTicks() - throughput->ticks;
+	throughput->messages = messages;
+	throughput->clientTxBytes = ClientTxBytes - throughput->clientTxBytes;
+	throughput->clientRxBytes = ClientRxBytes - throughput->clientRxBytes;
+	throughput->wallSeconds = (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec)/1e9;
+
+	seconds = (double)throughput->ticks/TEST_TICKS_PER_SECOND;
+	printf("%-22s %5u messages in %6.2f s: %7.1f msg/s, to device %6.0f B/s (%4.1f%%), "
+		"to client %6.0f B/s (%4.1f%%), wall time %.2f s\n", throughput->name, messages, seconds,
+		messages/seconds, throughput->clientTxBytes/seconds, 100.0*throughput->clientTxBytes/seconds/TEST_LINK_CAPACITY,
+		throughput->clientRxBytes/seconds, 100.0*throughput->clientRxBytes/seconds/TEST_LINK_CAPACITY,
+		throughput->wallSeconds);
+
+	return messages/seconds;
+}
+
+/*****************************************************************************************
+* TestServiceSuite() - call each method of each service once.
+*****************************************************************************************/
+static void TestServiceSuite(void)
+{
+	SomeIpClockStatusSetRequestMethodPayload setRequest = {0};
+	SomeIpClockStatusSubscribeRequestMethodPayload subscribeRequest = {1U << WIFI_EVENTGROUP_TIME, 0, 0};
+	SomeIpDayMeasurmentRequestPayload dayRequest = {INSIDE_TEMPERATURE, 15, 6, 24};
+	SomeIpDayMeasurmentSegmentedRequestPayload segmentedRequest = {INSIDE_TEMPERATURE, 15, 6, 24,
+		(1U << SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENTS_PER_DAY) - 1U};
+	SomeIpRangeQueryRequestPayload rangeRequest = {1U << INSIDE_TEMPERATURE, 9, 6, 24, 0, 15, 6, 24};
+	SomeIpClockStatusGetResponseMethodPayload getResponse;
+	TestFrame* frame;
+	uint32_t segments = 0;
+
+	setRequest.hour = 13;
+	setRequest.minute = 45;
+	setRequest.day = 15;
+	setRequest.month = 6;
+	setRequest.year = 24;
+	ClientSend(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET, &setRequest,
+		SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET_PAYLOAD_SIZE);
+	frame = ExpectResponse(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET, SOME_IP_RESPONSE_CODE);
+	TEST_ASSERT((frame != NULL) && (frame->data[SOME_IP_RETURN_CODE_FIELD_BEGIN] == SOME_IP_RETURN_CODE_E_OK_VALUE));
+
+	ClientSend(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET, NULL, 0);
+	frame = ExpectResponse(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET, SOME_IP_RESPONSE_CODE);
+
+	if(frame != NULL)
+	{
+		TEST_ASSERT_EQUAL(SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET_PAYLOAD_SIZE, SOMEIP_GetPayloadSize(frame->data));
+		memcpy(&getResponse, SOMEIP_GetPayload(frame->data), sizeof(getResponse));
+		TEST_ASSERT_EQUAL(13, getResponse.hour);
+		TEST_ASSERT_EQUAL(45, getResponse.minute);
+	}
+
+	//initial notification is send after response
+	ClientSend(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE, &subscribeRequest,
+		SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE_PAYLOAD_SIZE);
+	ExpectResponse(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE, SOME_IP_RESPONSE_CODE);
+	ClientSend(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE, &subscribeRequest,
+		SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE_PAYLOAD_SIZE);
+	ExpectResponse(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE, SOME_IP_RESPONSE_CODE);
+	TEST_ASSERT_EQUAL(1, NumberOfNotifications);
+
+	ClientSend(SOME_IP_SERVICE_DAY_MEASUREMENT, 0, &dayRequest, SOME_IP_SERVICE_DAY_MEASUREMENT_REQ_PAYLOAD_SIZE);
+	ExpectResponse(SOME_IP_SERVICE_DAY_MEASUREMENT, 0, SOME_IP_RESPONSE_CODE);
+
+	ClientSend(SOME_IP_SERVICE_DAY_SUMMARY, SOME_IP_SERVICE_DAY_SUMMARY_METHOD_GET, &dayRequest,
+		SOME_IP_SERVICE_DAY_MEASUREMENT_REQ_PAYLOAD_SIZE);
+	ExpectResponse(SOME_IP_SERVICE_DAY_SUMMARY, SOME_IP_SERVICE_DAY_SUMMARY_METHOD_GET, SOME_IP_RESPONSE_CODE);
+
+	//segments are send until more segments flag is cleared
+	ClientSend(SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_GET_SEGMENTED, &segmentedRequest,
+		SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENTED_REQ_PAYLOAD_SIZE);
+
+	do
+	{
+		frame = ExpectResponse(SOME_IP_SERVICE_DAY_MEASUREMENT, SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_GET_SEGMENTED,
+			SOME_IP_RESPONSE_CODE | SOME_IP_TP_FLAG);
+		segments++;
+	}while((frame != NULL) && (frame->data[SOME_IP_MINIMAL_MESSAGE_SIZE + SOME_IP_TP_HEADER_SIZE - 1] & SOME_IP_TP_MORE_SEGMENTS_FLAG));
+
+	TEST_ASSERT_EQUAL(SOME_IP_SERVICE_DAY_MEASUREMENT_SEGMENTS_PER_DAY, segments);
+
+	//response messages are send until moreMessages is cleared
+	for(uint16_t methodId = SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_RANGE_QUERY;
+		methodId <= SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST; methodId++)
+	{
+		SomeIpRangeQueryResponseHeader responseHeader = {0};
+
+		ClientSend(SOME_IP_SERVICE_DAY_MEASUREMENT, methodId, &rangeRequest,
+			SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_REQ_PAYLOAD_SIZE);
+
+		do
+		{
+			frame = ExpectResponse(SOME_IP_SERVICE_DAY_MEASUREMENT, methodId, SOME_IP_RESPONSE_CODE);
+
+			if(frame != NULL)
+				memcpy(&responseHeader, SOMEIP_GetPayload(frame->data), sizeof(responseHeader));
+		}while((frame != NULL) && responseHeader.moreMessages);
+	}
+}
+
+static void TestGetThroughput(void)
+{
+	TestThroughput throughput;
+	struct timespec start;
+	uint32_t sent = 0;
+	uint32_t received = 0;
+
+	StartMeasurement(&throughput, "CLOCK_STATUS GET", &start);
+
+	while(received < TEST_NUMBER_OF_GET_REQUESTS)
+	{
+		TestFrame* frame;
+
+		for(; (sent < TEST_NUMBER_OF_GET_REQUESTS) && ((sent - received) < TEST_WINDOW); sent++)
+			ClientSend(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET, NULL, 0);
+
+		frame = ExpectResponse(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET, SOME_IP_RESPONSE_CODE);
+
+		if(frame == NULL)
+			break;
+
+		received++;
+	}
+
+	TEST_ASSERT(FinishMeasurement(&throughput, received, &start) >= TEST_MIN_GET_RATE);
+	TEST_ASSERT_EQUAL(TEST_NUMBER_OF_GET_REQUESTS, received);
+}
+
+/*****************************************************************************************
+* TestFramImageExport() - export whole FRAM by one request and compare it with FRAM model.
+*****************************************************************************************/
+static void TestFramImageExport(void)
+{
+	SomeIpFramImageExportRequestPayload exportRequest = {0, 0};
+	SomeIpFramImageBlock block = {0};
+	TestThroughput throughput;
+	struct timespec start;
+	uint32_t blocks = 0;
+	uint8_t* framMemory = HostPeripherals_GetFramMemory();
+
+	//history area is filled by pattern so export and import move data which can be compared
+	srand(1);
+
+	for(uint32_t i = FRAM_MEASUREMENT_DATA_BEGIN; i < FRAM_MEMORY_SIZE; i++)
+		framMemory[i] = (uint8_t)rand();
+
+	memcpy(FramImage, framMemory, FRAM_MEMORY_SIZE);
+
+	StartMeasurement(&throughput, "FRAM_IMAGE EXPORT", &start);
+	ClientSend(SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_EXPORT, &exportRequest,
+		SOME_IP_SERVICE_FRAM_IMAGE_EXPORT_REQ_PAYLOAD_SIZE);
+
+	do
+	{
+		TestFrame* frame = ExpectResponse(SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_EXPORT,
+			SOME_IP_RESPONSE_CODE);
+		uint16_t blockSize;
+
+		if(frame == NULL)
+			break;
+
+		memcpy(&block, SOMEIP_GetPayload(frame->data), SOME_IP_SERVICE_FRAM_IMAGE_BLOCK_HEADER_SIZE);
+		blockSize = SOMEIP_GetPayloadSize(frame->data) - SOME_IP_SERVICE_FRAM_IMAGE_BLOCK_HEADER_SIZE;
+
+		TEST_ASSERT_EQUAL(blocks, block.blockIndex);
+		TEST_ASSERT_EQUAL(WIFI_GetFramImageBlockSize(block.blockIndex), blockSize);
+		TEST_ASSERT(memcmp(&SOMEIP_GetPayload(frame->data)[SOME_IP_SERVICE_FRAM_IMAGE_BLOCK_HEADER_SIZE],
+			&FramImage[FRAM_MEASUREMENT_DATA_BEGIN + block.blockIndex*WIFI_FRAM_IMAGE_BLOCK_SIZE], blockSize) == 0);
+		blocks++;
+	}while(block.moreMessages);
+
+	TEST_ASSERT(FinishMeasurement(&throughput, blocks, &start) >= TEST_MIN_EXPORT_RATE);
+	TEST_ASSERT_EQUAL(TEST_NUMBER_OF_BLOCKS, blocks);
+}
+
+/*****************************************************************************************
+* TestFramImageImport() - clear FRAM and import exported image block after block.
+*****************************************************************************************/
+static void TestFramImageImport(void)
+{
+	SomeIpFramImageImportRequestPayload importRequest;
+	TestThroughput throughput;
+	struct timespec start;
+	uint32_t sent = 0;
+	uint32_t received = 0;
+	TestFrame* frame;
+
+	memset(&HostPeripherals_GetFramMemory()[FRAM_MEASUREMENT_DATA_BEGIN], 0, FRAM_MEMORY_SIZE - FRAM_MEASUREMENT_DATA_BEGIN);
+
+	StartMeasurement(&throughput, "FRAM_IMAGE IMPORT", &start);
+
+	while(received < TEST_NUMBER_OF_BLOCKS)
+	{
+		for(; (sent < TEST_NUMBER_OF_BLOCKS) && ((sent - received) < TEST_WINDOW); sent++)
+		{
+			uint16_t blockSize = WIFI_GetFramImageBlockSize(sent);
+
+			memset(&importRequest, 0, sizeof(importRequest));
+			importRequest.blockIndex = sent;
+			memcpy(importRequest.data, &FramImage[FRAM_MEASUREMENT_DATA_BEGIN + sent*WIFI_FRAM_IMAGE_BLOCK_SIZE], blockSize);
+			importRequest.crc16Value = Chip_CRC_CRC16((uint16_t*)importRequest.data, blockSize/2);
+
+			ClientSend(SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_IMPORT, &importRequest,
+				SOME_IP_SERVICE_FRAM_IMAGE_IMPORT_REQ_PAYLOAD_SIZE);
+		}
+
+		frame = ExpectResponse(SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_IMPORT, SOME_IP_RESPONSE_CODE);
+
+		if(frame == NULL)
+			break;
+
+		TEST_ASSERT_EQUAL(SOME_IP_RETURN_CODE_E_OK_VALUE, frame->data[SOME_IP_RETURN_CODE_FIELD_BEGIN]);
+		received++;
+	}
+
+	TEST_ASSERT(FinishMeasurement(&throughput, received, &start) >= TEST_MIN_IMPORT_RATE);
+	TEST_ASSERT_EQUAL(TEST_NUMBER_OF_BLOCKS, received);
+
+	ClientSend(SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_VALIDATE, NULL, 0);
+	frame = ExpectResponse(SOME_IP_SERVICE_FRAM_IMAGE, SOME_IP_SERVICE_FRAM_IMAGE_METHOD_VALIDATE, SOME_IP_RESPONSE_CODE);
+	TEST_ASSERT((frame != NULL) && (SOMEIP_GetPayloadSize(frame->data) == SOME_IP_SERVICE_FRAM_IMAGE_VALIDATE_RESP_PAYLOAD_SIZE));
+
+	TEST_ASSERT(memcmp(&HostPeripherals_GetFramMemory()[FRAM_MEASUREMENT_DATA_BEGIN], &FramImage[FRAM_MEASUREMENT_DATA_BEGIN],
+		FRAM_MEMORY_SIZE - FRAM_MEASUREMENT_DATA_BEGIN) == 0);
+}
+
+int main(void)
+{
+	if(OpenPty() == false)
+	{
+		printf("SerialLinkPtyTest: pty isn't available(%s)\n", strerror(errno));
+		return 1;
+	}
+
+	CobsFraming_InitDecoder(&ClientDecoder);
+	HostUart_Reset();
+	HostClock_Init();
+	HostClock_SetTime(12, 30, 15, 6, 24);
+
+	for(uint32_t i = 0; i < TEST_STARTUP_TICKS; i++)
+		RunTick();
+
+	TEST_ASSERT(ESP_SerialLinkIsActive());
+	TEST_ASSERT_EQUAL(WIFI_SERIAL_LINK_BAUDRATE, HostUart_GetBaudrate());
+
+	TestServiceSuite();
+	TestGetThroughput();
+	TestFramImageExport();
+	TestFramImageImport();
+
+	close(SlaveFd);
+	close(MasterFd);
+
+	return TEST_RESULT("SerialLinkPtyTest");
+}
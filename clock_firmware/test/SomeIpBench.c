@@ -0,0 +1,167 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Benchmark of whole path of SOME/IP request through firmware in serial link mode. Request
+ * coded by COBS is delivered by UART model, ESP_Process decode it into SocketBufferTable,
+ * WIFI_Process validate and process it and send response by ESP_SerialLinkWrite, then
+ * bytes queued in UART TX ring are taken by HostUart_Transmit. Only public functions of
+ * ESP_Layer and WIFI_InteractionLayer are called, so the same file can be built with
+ * sources of previous firmware to compare both versions. Firmware is started by
+ * HostClock like in other tests, WIFI_Process is called with own WifiStateType structure
+ * so rest of Thread_Call isn't measured. Host time doesn't say how long processing takes
+ * on LPC11E68, but it show the difference between versions of message path.
+ */
+
+#include "HostClock.h"
+#include "HostUart.h"
+#include "ESP_Layer.h"
+#include "SOMEIP_Layer.h"
+#include "WIFI_InteractionLayer.h"
+#include "CobsFraming.h"
+#include "TestAssert.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if (WIFI_SERIAL_LINK_MODE == 0)
+#error "benchmark must be built with WIFI_SERIAL_LINK_MODE"
+#endif
+
+#define BENCH_NUMBER_OF_REQUESTS	1000000U
+#define BENCH_STARTUP_TICKS			(5U*50U)
+#define BENCH_MAX_CODED_SIZE		COBS_FRAMING_MAX_ENCODED_SIZE(MAX_SIZE_OF_SOCKET_BUFFER)
+
+static WifiStateType BenchState;
+static uint8_t CodedRequest[BENCH_MAX_CODED_SIZE];
+static uint16_t CodedRequestSize;
+static uint8_t CodedResponse[BENCH_MAX_CODED_SIZE];
+static volatile uint32_t Sink;
+
+/*****************************************************************************************
+* CodeRequest() - code SOME/IP request and COBS frame of it in CodedRequest.
+*****************************************************************************************/
+static void CodeRequest(uint16_t serviceId, uint16_t methodId, uint8_t* payload, uint16_t payloadSize)
+{
+	uint8_t request[MAX_SIZE_OF_SOCKET_BUFFER];
+	uint16_t requestSize = SOMEIP_CodeTxMessage(serviceId, methodId, SOME_IP_REQUEST_CODE,
+		SOME_IP_RETURN_CODE_E_OK_VALUE, request, payload, payloadSize);
+
+	CodedRequestSize = CobsFraming_Encode(request, requestSize, CodedRequest, sizeof(CodedRequest));
+	TEST_ASSERT(CodedRequestSize != 0);
+}
+
+/*****************************************************************************************
+* ProcessRequest() - pass request through firmware and take coded response from UART.
+*
+* Return: number of bytes send by UART.
+*****************************************************************************************/
+static uint32_t ProcessRequest(void)
+{
+	HostUart_Receive(CodedRequest, CodedRequestSize);
+	HostUart_Deliver(CodedRequestSize);
+
+	ESP_Process();
+	WIFI_Process(&BenchState);
+
+	return HostUart_Transmit(CodedResponse, sizeof(CodedResponse));
+}
+
+/*****************************************************************************************
+* CheckResponse() - process one request and check decoded response.
+*****************************************************************************************/
+static void CheckResponse(uint16_t serviceId, uint16_t methodId, uint16_t payloadSize)
+{
+	uint8_t response[MAX_SIZE_OF_SOCKET_BUFFER];
+	uint16_t responseSize = 0;
+	uint32_t codedSize = ProcessRequest();
+	CobsDecoder decoder;
+	uint8_t decodedByte;
+
+	CobsFraming_InitDecoder(&decoder);
+
+	for(uint32_t i = 0; i < codedSize; i++)
+	{
+		COBS_DECODE_RESULT result = CobsFraming_DecodeByte(&decoder, CodedResponse[i], &decodedByte);
+
+		TEST_ASSERT(result != COBS_DECODE_FRAME_ERROR);
+
+		if((result == COBS_DECODE_DATA) && (responseSize < sizeof(response)))
+			response[responseSize++] = decodedByte;
+	}
+
+	TEST_ASSERT(SOMEIP_ValidateRxMessage(response, responseSize));
+	TEST_ASSERT_EQUAL(serviceId, SOMEIP_GetServiceId(response));
+	TEST_ASSERT_EQUAL(methodId, SOMEIP_GetMethodId(response));
+	TEST_ASSERT_EQUAL(SOME_IP_RESPONSE_CODE, SOMEIP_GetMessageType(response));
+	TEST_ASSERT_EQUAL(SOME_IP_RETURN_CODE_E_OK_VALUE, response[SOME_IP_RETURN_CODE_FIELD_BEGIN]);
+	TEST_ASSERT_EQUAL(payloadSize, SOMEIP_GetPayloadSize(response));
+}
+
+/*****************************************************************************************
+* Measure() - pass requests through firmware and print time of one request.
+*****************************************************************************************/
+static void Measure(const char* name)
+{
+	struct timespec start, end;
+	uint32_t codedBytes = 0;
+	uint32_t firstSize = ProcessRequest();
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for(uint32_t i = 0; i < BENCH_NUMBER_OF_REQUESTS; i++)
+		codedBytes += ProcessRequest();
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	//each request must be answered in the same call
+	TEST_ASSERT_EQUAL(BENCH_NUMBER_OF_REQUESTS*firstSize, codedBytes);
+	Sink += codedBytes;
+
+	printf("%-18s %6.1f ns per request\n", name,
+		((end.tv_sec - start.tv_sec)*1e9 + (end.tv_nsec - start.tv_nsec))/BENCH_NUMBER_OF_REQUESTS);
+}
+
+int main(void)
+{
+	SomeIpClockStatusSetRequestMethodPayload setPayload = {45, 21, 29, 2, 24};
+
+	HostUart_Reset();
+	HostClock_Init();
+	HostClock_SetTime(12, 30, 15, 6, 24);
+
+	for(uint32_t i = 0; i < BENCH_STARTUP_TICKS; i++)
+	{
+		HostClock_Tick();
+		HostUart_Transmit(CodedResponse, sizeof(CodedResponse));
+	}
+
+	TEST_ASSERT(ESP_SerialLinkIsActive());
+
+	CodeRequest(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET, NULL, 0);
+	CheckResponse(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET,
+		SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET_PAYLOAD_SIZE);
+	Measure("CLOCK_STATUS GET");
+
+	CodeRequest(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET, (uint8_t*)&setPayload,
+		SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET_PAYLOAD_SIZE);
+	CheckResponse(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SET, 0);
+	Measure("CLOCK_STATUS SET");
+
+	return TEST_RESULT("SomeIpBench");
+}
@@ -0,0 +1,152 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Test of SOMEIP_Layer: big-endian header coded by SOMEIP_CodeTxMessage, validation of
+ * messages with even and odd payload size, rejection of damaged messages and payload built
+ * by SomeIpWriter which must give the same message as SOMEIP_CodeTxMessage.
+ */
+
+#include "SOMEIP_Layer.h"
+#include "TestAssert.h"
+#include <stdint.h>
+#include <string.h>
+
+#define TEST_SERVICE_ID			0x1234U
+#define TEST_METHOD_ID			0x5678U
+#define TEST_MAX_PAYLOAD_SIZE	40U
+#define TEST_BUFFER_SIZE		(SOME_IP_MINIMAL_MESSAGE_SIZE + TEST_MAX_PAYLOAD_SIZE + SOME_IP_CRC_SIZE + 1U)
+
+static uint8_t Message[TEST_BUFFER_SIZE] __attribute__((aligned(4)));
+static uint8_t Copy[TEST_BUFFER_SIZE] __attribute__((aligned(4)));
+
+static void FillPayload(uint8_t* payload, uint16_t size)
+{
+	for(uint16_t i = 0; i < size; i++)
+		payload[i] = (uint8_t)(0x30U + 7U*i);
+}
+
+static void TestHeader(void)
+{
+	uint8_t payload[3] = {0xA1, 0xA2, 0xA3};
+	const uint8_t expectedHeader[SOME_IP_MINIMAL_MESSAGE_SIZE] = {
+		0x12, 0x34, 0x56, 0x78, //service ID, method ID
+		0x00, 0x00, 0x00, 0x0D, //length: 8 bytes of header, payload and CRC
+		0x00, 0x00, 0x00, 0x00, //client ID, session ID
+		SOME_IP_SUPPORTED_PROTOCOL_VERSION, SOME_IP_SUPPORTED_INTERFACE_VERSION, SOME_IP_RESPONSE_CODE,
+		SOME_IP_RETURN_CODE_E_UNKNOWN_METHOD};
+
+	TEST_ASSERT_EQUAL(SOME_IP_MINIMAL_MESSAGE_SIZE + sizeof(payload) + SOME_IP_CRC_SIZE,
+		SOMEIP_CodeTxMessage(TEST_SERVICE_ID, TEST_METHOD_ID, SOME_IP_RESPONSE_CODE,
+		SOME_IP_RETURN_CODE_E_UNKNOWN_METHOD, Message, payload, sizeof(payload)));
+	TEST_ASSERT(memcmp(Message, expectedHeader, sizeof(expectedHeader)) == 0);
+	TEST_ASSERT(memcmp(&Message[SOME_IP_MINIMAL_MESSAGE_SIZE], payload, sizeof(payload)) == 0);
+
+	TEST_ASSERT_EQUAL(0x1234, SOMEIP_ReadUint16(Message));
+	TEST_ASSERT_EQUAL(0x12345678, SOMEIP_ReadUint32(Message));
+}
+
+static void TestValidation(void)
+{
+	for(uint16_t payloadSize = 0; payloadSize <= TEST_MAX_PAYLOAD_SIZE; payloadSize++)
+	{
+		uint8_t payload[TEST_MAX_PAYLOAD_SIZE];
+		uint16_t size;
+
+		FillPayload(payload, payloadSize);
+		size = SOMEIP_CodeTxMessage(TEST_SERVICE_ID, TEST_METHOD_ID, SOME_IP_REQUEST_CODE,
+			SOME_IP_RETURN_CODE_E_OK_VALUE, Message, payload, payloadSize);
+		TEST_ASSERT_EQUAL(SOME_IP_MINIMAL_MESSAGE_SIZE + payloadSize + SOME_IP_CRC_SIZE, size);
+		memcpy(Copy, Message, size);
+
+		//header fields are read from buffer after validation
+		TEST_ASSERT(SOMEIP_ValidateRxMessage(Message, size));
+		TEST_ASSERT_EQUAL(TEST_SERVICE_ID, SOMEIP_GetServiceId(Message));
+		TEST_ASSERT_EQUAL(TEST_METHOD_ID, SOMEIP_GetMethodId(Message));
+		TEST_ASSERT_EQUAL(SOME_IP_REQUEST_CODE, SOMEIP_GetMessageType(Message));
+		TEST_ASSERT_EQUAL(payloadSize, SOMEIP_GetPayloadSize(Message));
+		TEST_ASSERT(memcmp(SOMEIP_GetPayload(Message), payload, payloadSize) == 0);
+
+		//validation clear CRC so damaged message is written again from copy each time
+		for(uint16_t i = 0; i < size; i++)
+		{
+			memcpy(Message, Copy, size);
+			Message[i] ^= 0x10;
+			TEST_ASSERT(SOMEIP_ValidateRxMessage(Message, size) == false);
+		}
+
+		memcpy(Message, Copy, size);
+		TEST_ASSERT(SOMEIP_ValidateRxMessage(Message, size - 1) == false);
+	}
+
+	//error messages are send only by clock
+	SOMEIP_CodeTxMessage(TEST_SERVICE_ID, TEST_METHOD_ID, SOME_IP_ERROR_CODE, SOME_IP_RETURN_CODE_E_NOT_READY,
+		Message, NULL, 0);
+	TEST_ASSERT(SOMEIP_ValidateRxMessage(Message, SOME_IP_MINIMAL_MESSAGE_SIZE + SOME_IP_CRC_SIZE) == false);
+	TEST_ASSERT(SOMEIP_ValidateRxMessage(Message, SOME_IP_MINIMAL_MESSAGE_SIZE - 1) == false);
+}
+
+static void TestWriter(void)
+{
+	uint8_t payload[TEST_MAX_PAYLOAD_SIZE];
+	SomeIpWriter writer;
+	uint8_t* reserved;
+	uint16_t size;
+
+	//message built in place is the same as message coded from payload
+	FillPayload(payload, sizeof(payload));
+	size = SOMEIP_CodeTxMessage(TEST_SERVICE_ID, TEST_METHOD_ID, SOME_IP_RESPONSE_CODE,
+		SOME_IP_RETURN_CODE_E_OK_VALUE, Copy, payload, 25);
+
+	SOMEIP_InitWriter(&writer, Message, sizeof(Message));
+	reserved = SOMEIP_WriterReserve(&writer, 10);
+	TEST_ASSERT(reserved == &Message[SOME_IP_MINIMAL_MESSAGE_SIZE]);
+	memcpy(reserved, payload, 10);
+	TEST_ASSERT(SOMEIP_WriteBytes(&writer, &payload[10], 15));
+	TEST_ASSERT_EQUAL(size, SOMEIP_WriterFinish(&writer, TEST_SERVICE_ID, TEST_METHOD_ID, SOME_IP_RESPONSE_CODE,
+		SOME_IP_RETURN_CODE_E_OK_VALUE));
+	TEST_ASSERT(memcmp(Message, Copy, size) == 0);
+
+	//payload fill buffer with place for CRC and byte cleared after it
+	SOMEIP_InitWriter(&writer, Message, sizeof(Message));
+	TEST_ASSERT(SOMEIP_WriteBytes(&writer, payload, TEST_MAX_PAYLOAD_SIZE));
+	TEST_ASSERT(SOMEIP_WriterReserve(&writer, 0) != NULL);
+	TEST_ASSERT_EQUAL(SOME_IP_MINIMAL_MESSAGE_SIZE + TEST_MAX_PAYLOAD_SIZE + SOME_IP_CRC_SIZE,
+		SOMEIP_WriterFinish(&writer, TEST_SERVICE_ID, TEST_METHOD_ID, SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE));
+
+	//after overflow message can't be finished
+	SOMEIP_InitWriter(&writer, Message, sizeof(Message));
+	TEST_ASSERT(SOMEIP_WriteBytes(&writer, payload, TEST_MAX_PAYLOAD_SIZE - 1));
+	TEST_ASSERT(SOMEIP_WriterReserve(&writer, 2) == NULL);
+	TEST_ASSERT(SOMEIP_WriterReserve(&writer, 1) == NULL);
+	TEST_ASSERT_EQUAL(0, SOMEIP_WriterFinish(&writer, TEST_SERVICE_ID, TEST_METHOD_ID, SOME_IP_RESPONSE_CODE,
+		SOME_IP_RETURN_CODE_E_OK_VALUE));
+
+	//buffer without place for payload
+	SOMEIP_InitWriter(&writer, Message, SOME_IP_MINIMAL_MESSAGE_SIZE);
+	TEST_ASSERT(SOMEIP_WriterReserve(&writer, 1) == NULL);
+}
+
+int main(void)
+{
+	TestHeader();
+	TestValidation();
+	TestWriter();
+
+	return TEST_RESULT("SomeIpLayerTest");
+}
@@ -0,0 +1,141 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "TelemetryCollector.h"
+#include "SOMEIP_Layer.h"
+#include <string.h>
+
+static TelemetryCollectorClock ClockTable[TELEMETRY_COLLECTOR_MAX_CLOCKS];
+static uint8_t NumberOfClocks;
+static uint32_t RejectedDatagrams;
+
+void TelemetryCollector_Init(void)
+{
+	memset(ClockTable, 0, sizeof(ClockTable));
+	NumberOfClocks = 0;
+	RejectedDatagrams = 0;
+}
+
+static uint16_t TelemetryCollector_ReadUint16(const uint8_t* field)
+{
+	//payload fields are little-endian
+	return (uint16_t)(field[0] | (field[1] << 8));
+}
+
+/*****************************************************************************************
+* TelemetryCollector_FindClock() - return clock which send datagrams from address and port,
+* new clock is added when sender is unknown.
+*
+* Return: pointer to clock or NULL if table of clocks is full.
+*****************************************************************************************/
+static TelemetryCollectorClock* TelemetryCollector_FindClock(uint32_t address, uint16_t port)
+{
+	for(uint8_t i = 0; i < NumberOfClocks; i++)
+	{
+		if((ClockTable[i].address == address) && (ClockTable[i].port == port))
+			return &ClockTable[i];
+	}
+
+	if(NumberOfClocks == TELEMETRY_COLLECTOR_MAX_CLOCKS)
+		return NULL;
+
+	ClockTable[NumberOfClocks].address = address;
+	ClockTable[NumberOfClocks].port = port;
+
+	return &ClockTable[NumberOfClocks++];
+}
+
+/*****************************************************************************************
+* TelemetryCollector_Receive() - validate datagram and store telemetry of clock which send it.
+*
+* Parameters:
+* @address: IPv4 address of sender.
+* @port: port number of sender.
+* @datagram: pointer to received data, data isn't modified.
+* @size: number of bytes of datagram.
+*
+* Return: pointer to updated clock or NULL if datagram was rejected.
+*****************************************************************************************/
+const TelemetryCollectorClock* TelemetryCollector_Receive(uint32_t address, uint16_t port,
+	const uint8_t* datagram, uint16_t size)
+{
+	uint8_t message[TELEMETRY_COLLECTOR_MAX_DATAGRAM + 1];//validation clear one byte after message
+	SomeIpClockStatusTelemetryEventPayload payload;
+	TelemetryCollectorClock* clock = NULL;
+	const uint8_t* field = NULL;
+
+	if(size <= TELEMETRY_COLLECTOR_MAX_DATAGRAM)
+	{
+		memcpy(message, datagram, size);
+
+		if(SOMEIP_ValidateRxMessage(message, size)
+			&& (SOMEIP_GetServiceId(message) == SOME_IP_SERVICE_CLOCK_STATUS)
+			&& (SOMEIP_GetMethodId(message) == SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TELEMETRY)
+			&& (SOMEIP_GetMessageType(message) == SOME_IP_NOTIFICATION_CODE)
+			&& (SOMEIP_GetPayloadSize(message) == SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TELEMETRY_PAYLOAD_SIZE))
+		{
+			clock = TelemetryCollector_FindClock(address, port);
+		}
+	}
+
+	if(clock == NULL)
+	{
+		RejectedDatagrams++;
+		return NULL;
+	}
+
+	field = SOMEIP_GetPayload(message);
+	memset(&payload, 0, sizeof(payload));
+	payload.hour = field[0];
+	payload.minute = field[1];
+	field += 4;
+
+	for(uint8_t i = 0; i < NUM_OF_TEMPERATURE_SOURCE; i++)
+		payload.temperatureTable[i] = TelemetryCollector_ReadUint16(&field[2*i]);
+
+	field += 2*NUM_OF_TEMPERATURE_SOURCE;
+
+	for(uint8_t i = 0; i < NUM_OF_TEMPERATURE_SOURCE; i++)
+		payload.aggregateTable[i] = TelemetryCollector_ReadUint16(&field[2*i]);
+
+	if((clock->numberOfNotifications > 0)
+		&& (memcmp(payload.aggregateTable, clock->lastPayload.aggregateTable, sizeof(payload.aggregateTable)) != 0))
+	{
+		clock->numberOfAggregateChanges++;
+	}
+
+	clock->lastPayload = payload;
+	clock->numberOfNotifications++;
+
+	return clock;
+}
+
+uint8_t TelemetryCollector_GetNumberOfClocks(void)
+{
+	return NumberOfClocks;
+}
+
+const TelemetryCollectorClock* TelemetryCollector_GetClock(uint8_t index)
+{
+	return (index < NumberOfClocks) ? &ClockTable[index] : NULL;
+}
+
+uint32_t TelemetryCollector_GetRejectedDatagrams(void)
+{
+	return RejectedDatagrams;
+}
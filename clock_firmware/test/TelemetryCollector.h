@@ -0,0 +1,54 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _TELEMETRY_COLLECTOR_H_
+#define _TELEMETRY_COLLECTOR_H_
+
+/*
+ * Collector of SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TELEMETRY notifications send by clocks
+ * built with WIFI_TELEMETRY_MODE. Each datagram is validated(SOME/IP header and CRC, service,
+ * event, notification type and payload size) and assigned to clock by address and port of
+ * sender. Collector keep number of notifications and last payload of each clock, datagrams
+ * which aren't correct telemetry are only counted. Module is used by WifiTelemetryTest and
+ * by TelemetryCollectorTool which receive datagrams from UDP socket.
+ */
+
+#include "WIFI_InteractionLayer.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TELEMETRY_COLLECTOR_MAX_CLOCKS		32U
+#define TELEMETRY_COLLECTOR_MAX_DATAGRAM	64U
+
+typedef struct
+{
+	uint32_t address;//IPv4 address of sender
+	uint16_t port;
+	uint32_t numberOfNotifications;
+	uint32_t numberOfAggregateChanges;//notifications with other aggregateTable than previous one
+	SomeIpClockStatusTelemetryEventPayload lastPayload;
+}TelemetryCollectorClock;
+
+void TelemetryCollector_Init(void);
+const TelemetryCollectorClock* TelemetryCollector_Receive(uint32_t address, uint16_t port,
+	const uint8_t* datagram, uint16_t size);
+uint8_t TelemetryCollector_GetNumberOfClocks(void);
+const TelemetryCollectorClock* TelemetryCollector_GetClock(uint8_t index);
+uint32_t TelemetryCollector_GetRejectedDatagrams(void);
+
+#endif /* _TELEMETRY_COLLECTOR_H_ */
@@ -0,0 +1,108 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Collector of UDP telemetry of clocks built with WIFI_TELEMETRY_MODE. Program listen on
+ * WIFI_TELEMETRY_COLLECTOR_PORT_NUMBER or port given as argument and print one line per
+ * accepted notification:
+ *	address:port,count,hh:mm,present temperatures,last 15 minutes temperatures
+ * Temperatures are printed in Celsius degrees of each source in order of ClockState table
+ * (outside, inside, furnace), "-" mean invalid value. Rejected datagrams are reported on
+ * stderr. Computer which run program must have address WIFI_TELEMETRY_COLLECTOR_IP_ADDRESS.
+ *	build/TelemetryCollectorTool [port]
+ */
+
+#include "TelemetryCollector.h"
+#include "TemperatureSensor.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static void PrintTemperature(uint16_t temperatureValue)
+{
+	int16_t signedTemperature = (int16_t)temperatureValue - (int16_t)TEMPERATURE_OFFSET_FROM_ZERO;
+
+	if(temperatureValue == INVALID_READ_SENSOR_VALUE)
+		printf(",-");
+	else
+		printf(",%s%d.%d", (signedTemperature < 0) ? "-" : "", abs(signedTemperature)/10, abs(signedTemperature)%10);
+}
+
+int main(int argc, char* argv[])
+{
+	uint16_t port = (argc > 1) ? (uint16_t)atoi(argv[1]) : WIFI_TELEMETRY_COLLECTOR_PORT_NUMBER;
+	struct sockaddr_in collectorAddress = {0};
+	int udpSocket = socket(AF_INET, SOCK_DGRAM, 0);
+
+	collectorAddress.sin_family = AF_INET;
+	collectorAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+	collectorAddress.sin_port = htons(port);
+
+	if((udpSocket < 0) || (bind(udpSocket, (struct sockaddr*)&collectorAddress, sizeof(collectorAddress)) != 0))
+	{
+		perror("TelemetryCollectorTool");
+		return 1;
+	}
+
+	TelemetryCollector_Init();
+
+	while(1)
+	{
+		uint8_t datagram[TELEMETRY_COLLECTOR_MAX_DATAGRAM + 1];
+		struct sockaddr_in clockAddress;
+		socklen_t addressSize = sizeof(clockAddress);
+		ssize_t size = recvfrom(udpSocket, datagram, sizeof(datagram), 0, (struct sockaddr*)&clockAddress, &addressSize);
+		const TelemetryCollectorClock* clock = NULL;
+
+		if(size < 0)
+		{
+			perror("TelemetryCollectorTool");
+			break;
+		}
+
+		//datagram longer than buffer is rejected as too long
+		clock = TelemetryCollector_Receive(ntohl(clockAddress.sin_addr.s_addr), ntohs(clockAddress.sin_port),
+			datagram, (uint16_t)size);
+
+		if(clock == NULL)
+		{
+			fprintf(stderr, "rejected %d bytes from %s:%u\n", (int)size, inet_ntoa(clockAddress.sin_addr),
+				ntohs(clockAddress.sin_port));
+			continue;
+		}
+
+		printf("%s:%u,%u,%02u:%02u", inet_ntoa(clockAddress.sin_addr), clock->port, clock->numberOfNotifications,
+			clock->lastPayload.hour, clock->lastPayload.minute);
+
+		for(uint8_t i = 0; i < NUM_OF_TEMPERATURE_SOURCE; i++)
+			PrintTemperature(clock->lastPayload.temperatureTable[i]);
+
+		for(uint8_t i = 0; i < NUM_OF_TEMPERATURE_SOURCE; i++)
+			PrintTemperature(clock->lastPayload.aggregateTable[i]);
+
+		printf("\n");
+		fflush(stdout);
+	}
+
+	close(udpSocket);
+
+	return 1;
+}
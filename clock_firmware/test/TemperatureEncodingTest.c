@@ -0,0 +1,140 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Test of TemperatureEncoding: coded bytes of values from description of zig-zag varint
+ * coding, round trip of smooth samples, of extreme differences and of
+ * INVALID_READ_SENSOR_VALUE, and coding stopped at end of buffer like at end of message.
+ */
+
+#include "TemperatureEncoding.h"
+#include "TestAssert.h"
+#include <stdint.h>
+#include <string.h>
+
+#define TEST_INVALID_READ_SENSOR_VALUE	0xFFFFU //INVALID_READ_SENSOR_VALUE of GUI_Clock.h
+#define TEST_NUMBER_OF_SAMPLES			96U
+
+static void CheckCodedBytes(const uint16_t* values, uint8_t numberOfValues, const uint8_t* expectedBytes,
+	uint16_t expectedSize)
+{
+	uint8_t buffer[TEST_NUMBER_OF_SAMPLES*TEMPERATURE_ENCODING_MAX_VALUE_SIZE];
+	uint8_t numberOfEncodedValues = 0;
+
+	TEST_ASSERT_EQUAL(expectedSize, TemperatureEncoding_EncodeDelta(values, numberOfValues, buffer, sizeof(buffer),
+		&numberOfEncodedValues));
+	TEST_ASSERT_EQUAL(numberOfValues, numberOfEncodedValues);
+	TEST_ASSERT(memcmp(buffer, expectedBytes, expectedSize) == 0);
+}
+
+/*****************************************************************************************
+* CheckRoundTrip() - code values and decode them again.
+*
+* Return: size of coded values.
+*****************************************************************************************/
+static uint16_t CheckRoundTrip(const uint16_t* values, uint8_t numberOfValues)
+{
+	uint8_t buffer[TEST_NUMBER_OF_SAMPLES*TEMPERATURE_ENCODING_MAX_VALUE_SIZE];
+	uint16_t decodedValues[TEST_NUMBER_OF_SAMPLES];
+	uint8_t numberOfEncodedValues = 0;
+	uint16_t size = TemperatureEncoding_EncodeDelta(values, numberOfValues, buffer, sizeof(buffer), &numberOfEncodedValues);
+
+	TEST_ASSERT_EQUAL(numberOfValues, numberOfEncodedValues);
+	TEST_ASSERT(size <= numberOfValues*TEMPERATURE_ENCODING_MAX_VALUE_SIZE);
+	TEST_ASSERT_EQUAL(numberOfValues, TemperatureEncoding_DecodeDelta(buffer, size, decodedValues, TEST_NUMBER_OF_SAMPLES));
+	TEST_ASSERT(memcmp(decodedValues, values, numberOfValues*sizeof(uint16_t)) == 0);
+
+	return size;
+}
+
+static void TestCodedBytes(void)
+{
+	//differences 0, -1, 1, -2, 2 give 0, 1, 2, 3, 4
+	const uint16_t smallDifferences[] = {0, 0xFFFF, 0, 0xFFFE, 0};
+	const uint8_t smallDifferencesBytes[] = {0x00, 0x01, 0x02, 0x03, 0x04};
+	//63 and -64 are the last differences coded in one byte
+	const uint16_t oneByteLimit[] = {63, 63 - 64, 63 - 64 + 64};
+	const uint8_t oneByteLimitBytes[] = {0x7E, 0x7F, 0x80, 0x01};
+	//-32768 give the biggest zig-zag value
+	const uint16_t threeBytes[] = {0x8000};
+	const uint8_t threeBytesBytes[] = {0xFF, 0xFF, 0x03};
+
+	CheckCodedBytes(smallDifferences, 5, smallDifferencesBytes, sizeof(smallDifferencesBytes));
+	CheckCodedBytes(oneByteLimit, 3, oneByteLimitBytes, sizeof(oneByteLimitBytes));
+	CheckCodedBytes(threeBytes, 1, threeBytesBytes, sizeof(threeBytesBytes));
+}
+
+static void TestRoundTrip(void)
+{
+	uint16_t smooth[TEST_NUMBER_OF_SAMPLES];
+	uint16_t extreme[TEST_NUMBER_OF_SAMPLES];
+
+	//inside temperature about 21 degrees changing by tenths of degree
+	for(uint8_t i = 0; i < TEST_NUMBER_OF_SAMPLES; i++)
+		smooth[i] = 210U + (i % 7U) - (i % 3U);
+
+	//first value take two bytes, other one byte each
+	TEST_ASSERT_EQUAL(2 + (TEST_NUMBER_OF_SAMPLES - 1), CheckRoundTrip(smooth, TEST_NUMBER_OF_SAMPLES));
+
+	for(uint8_t i = 0; i < TEST_NUMBER_OF_SAMPLES; i++)
+	{
+		static const uint16_t extremeTable[] = {0, 0xFFFF, 0x8000, 0x7FFF, 1, TEST_INVALID_READ_SENSOR_VALUE};
+
+		extreme[i] = extremeTable[i % (sizeof(extremeTable)/sizeof(uint16_t))];
+	}
+
+	CheckRoundTrip(extreme, TEST_NUMBER_OF_SAMPLES);
+
+	//sensor error in the middle of day
+	smooth[40] = TEST_INVALID_READ_SENSOR_VALUE;
+	CheckRoundTrip(smooth, TEST_NUMBER_OF_SAMPLES);
+}
+
+static void TestEndOfBuffer(void)
+{
+	const uint16_t values[] = {1, 2, 200, 201};//coded as 02 02 8C 03 02
+	uint16_t decodedValues[4];
+	uint8_t buffer[8];
+	uint8_t numberOfEncodedValues = 0;
+
+	//value isn't divided between messages
+	TEST_ASSERT_EQUAL(2, TemperatureEncoding_EncodeDelta(values, 4, buffer, 3, &numberOfEncodedValues));
+	TEST_ASSERT_EQUAL(2, numberOfEncodedValues);
+	TEST_ASSERT_EQUAL(4, TemperatureEncoding_EncodeDelta(values, 4, buffer, 4, &numberOfEncodedValues));
+	TEST_ASSERT_EQUAL(3, numberOfEncodedValues);
+	TEST_ASSERT_EQUAL(0, TemperatureEncoding_EncodeDelta(values, 4, buffer, 0, &numberOfEncodedValues));
+	TEST_ASSERT_EQUAL(0, numberOfEncodedValues);
+
+	//incomplete value at end of buffer is ignored
+	TEST_ASSERT_EQUAL(5, TemperatureEncoding_EncodeDelta(values, 4, buffer, sizeof(buffer), &numberOfEncodedValues));
+	TEST_ASSERT_EQUAL(2, TemperatureEncoding_DecodeDelta(buffer, 3, decodedValues, 4));
+	TEST_ASSERT_EQUAL(4, TemperatureEncoding_DecodeDelta(buffer, 5, decodedValues, 4));
+	TEST_ASSERT_EQUAL(201, decodedValues[3]);
+
+	//decoding is stopped when table for values is full
+	TEST_ASSERT_EQUAL(3, TemperatureEncoding_DecodeDelta(buffer, 5, decodedValues, 3));
+}
+
+int main(void)
+{
+	TestCodedBytes();
+	TestRoundTrip();
+	TestEndOfBuffer();
+
+	return TEST_RESULT("TemperatureEncodingTest");
+}
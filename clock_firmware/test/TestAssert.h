@@ -0,0 +1,54 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _TEST_ASSERT_H_
+#define _TEST_ASSERT_H_
+
+/*
+ * Minimal assertions used by host tests. Failed assertion print location and test continue,
+ * TEST_RESULT return exit code of test program.
+ */
+
+#include <stdio.h>
+
+static unsigned int TestAssertFailures;
+
+#define TEST_ASSERT(condition) \
+	do{ \
+		if(!(condition)) \
+		{ \
+			printf("%s:%d: assertion failed: %s\n", __FILE__, __LINE__, #condition); \
+			TestAssertFailures++; \
+		} \
+	}while(0)
+
+#define TEST_ASSERT_EQUAL(expected, actual) \
+	do{ \
+		long long expectedTmp = (long long)(expected); \
+		long long actualTmp = (long long)(actual); \
+		if(expectedTmp != actualTmp) \
+		{ \
+			printf("%s:%d: expected %s == %lld, got %lld\n", __FILE__, __LINE__, #actual, expectedTmp, actualTmp); \
+			TestAssertFailures++; \
+		} \
+	}while(0)
+
+#define TEST_RESULT(testName) \
+	((TestAssertFailures == 0) ? (printf("%s: passed\n", testName), 0) : (printf("%s: %u failures\n", testName, TestAssertFailures), 1))
+
+#endif /* _TEST_ASSERT_H_ */
@@ -0,0 +1,170 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Test of UART_CalculateBaudrateDividers and of registers written by UART_DriverInit.
+ * For standard baudrates up to 921600 real baudrate of LPC11E6x is calculated again from
+ * returned dividers by formula of user manual:
+ *   baudrate = PCLK/(16*(256*DLM + DLL)*(1 + DIVADDVAL/MULVAL))
+ * and compared with requested baudrate, reported error and error of best dividers found
+ * by search of all MULVAL and DIVADDVAL. Baudrate which can't be reached must be rejected
+ * by UART_DriverInit without change of already configured port.
+ */
+
+#include "HostUsart.h"
+#include "UART_Driver.h"
+#include "TestAssert.h"
+#include <stdio.h>
+
+#define TEST_PERIPHERAL_CLOCK		48000000U //main clock of HostChip.c, UART_CLOCK_DIVIDER is 1
+#define TEST_ERROR_TOLERANCE_PPM	1 //rounding of error calculated by driver
+
+static const uint32_t StandardBaudrates[] = {1200, 2400, 4800, 9600, 14400, 19200, 38400, 57600, 115200,
+	230400, 460800, 921600};
+
+void USART0_IRQHandler(void)
+{
+	UART_ProcessTransmitInterrupt(0);
+}
+
+static double RealBaudrate(uint32_t divisorLatch, uint32_t divAddVal, uint32_t mulVal)
+{
+	return (double)TEST_PERIPHERAL_CLOCK / (16.0 * divisorLatch * (1.0 + (double)divAddVal/mulVal));
+}
+
+static double ErrorPpm(double realBaudrate, uint32_t baudrate)
+{
+	return (realBaudrate - baudrate) * 1000000.0 / baudrate;
+}
+
+static double Absolute(double value)
+{
+	return (value < 0) ? -value : value;
+}
+
+/*****************************************************************************************
+* BestErrorPpm() - search all dividers allowed by user manual: 1 <= MULVAL <= 15,
+* 0 <= DIVADDVAL < MULVAL, 1 <= DL <= 65535 and DL >= 3 when DIVADDVAL isn't zero.
+*
+* Return: absolute error of best dividers.
+*****************************************************************************************/
+static double BestErrorPpm(uint32_t baudrate)
+{
+	double bestError = 1e12;
+
+	for(uint32_t mulVal = 1; mulVal <= 15; mulVal++)
+	{
+		for(uint32_t divAddVal = 0; divAddVal < mulVal; divAddVal++)
+		{
+			double exactDivisorLatch = RealBaudrate(1, divAddVal, mulVal) / baudrate;
+
+			//error has minimum at one of two divisor latches closest to exact value
+			for(uint32_t divisorLatch = (uint32_t)exactDivisorLatch; divisorLatch <= (uint32_t)exactDivisorLatch + 1;
+				divisorLatch++)
+			{
+				double error;
+
+				if((divisorLatch == 0) || (divisorLatch > 0xFFFF) || ((divAddVal != 0) && (divisorLatch < 3)))
+					continue;
+
+				error = Absolute(ErrorPpm(RealBaudrate(divisorLatch, divAddVal, mulVal), baudrate));
+
+				if(error < bestError)
+					bestError = error;
+			}
+		}
+	}
+
+	return bestError;
+}
+
+static void TestStandardBaudrates(void)
+{
+	for(uint32_t i = 0; i < sizeof(StandardBaudrates)/sizeof(StandardBaudrates[0]); i++)
+	{
+		uint32_t baudrate = StandardBaudrates[i];
+		UART_BaudrateDividers dividers = {0};
+		double errorPpm;
+
+		TEST_ASSERT(UART_CalculateBaudrateDividers(TEST_PERIPHERAL_CLOCK, baudrate, &dividers));
+
+		//register ranges of LPC11E6x
+		TEST_ASSERT((dividers.mulVal >= 1) && (dividers.mulVal <= 15));
+		TEST_ASSERT(dividers.divAddVal < dividers.mulVal);
+		TEST_ASSERT(dividers.divisorLatch >= ((dividers.divAddVal != 0) ? 3 : 1));
+
+		errorPpm = ErrorPpm(RealBaudrate(dividers.divisorLatch, dividers.divAddVal, dividers.mulVal), baudrate);
+
+		TEST_ASSERT(Absolute(errorPpm) <= UART_MAX_BAUDRATE_ERROR_PPM);
+		TEST_ASSERT(Absolute(errorPpm - dividers.errorPpm) <= TEST_ERROR_TOLERANCE_PPM);
+		TEST_ASSERT(Absolute(errorPpm) <= BestErrorPpm(baudrate) + TEST_ERROR_TOLERANCE_PPM);
+
+		printf("%7u baud: DLM %3u DLL %3u DIVADDVAL %2u MULVAL %2u, error %+6.0f ppm\n", baudrate,
+			dividers.divisorLatch >> 8, dividers.divisorLatch & 0xFF, dividers.divAddVal, dividers.mulVal, errorPpm);
+	}
+}
+
+static void TestDriverRegisters(void)
+{
+	for(uint32_t i = 0; i < sizeof(StandardBaudrates)/sizeof(StandardBaudrates[0]); i++)
+	{
+		UART_BaudrateDividers dividers = {0};
+
+		TEST_ASSERT(UART_CalculateBaudrateDividers(TEST_PERIPHERAL_CLOCK, StandardBaudrates[i], &dividers));
+
+		HostUsart_Reset();
+		TEST_ASSERT(UART_DriverInit(0, StandardBaudrates[i], L8_BIT, ONE_BIT, NONE_PARITY));
+
+		TEST_ASSERT_EQUAL(UART_CLOCK_DIVIDER, LPC_SYSCON->USART0CLKDIV);
+		TEST_ASSERT_EQUAL(dividers.divisorLatch >> 8, LPC_USART0->DLM);
+		TEST_ASSERT_EQUAL(dividers.divisorLatch & 0xFF, LPC_USART0->DLL);
+		TEST_ASSERT_EQUAL((dividers.mulVal << 4) | dividers.divAddVal, LPC_USART0->FDR);
+		TEST_ASSERT_EQUAL(0, LPC_USART0->LCR & ENABLE_DIVISOR_LATCH);
+	}
+}
+
+static void TestUnsupportedBaudrate(void)
+{
+	UART_BaudrateDividers dividers = {0};
+	uint32_t configuredBaudrate;
+
+	TEST_ASSERT(UART_CalculateBaudrateDividers(TEST_PERIPHERAL_CLOCK, 0, &dividers) == false);
+	//divisor latch would be below 1
+	TEST_ASSERT(UART_CalculateBaudrateDividers(TEST_PERIPHERAL_CLOCK, TEST_PERIPHERAL_CLOCK/16 + 1, &dividers) == false);
+	//divisor latch would be above 65535 even with the largest fractional divider
+	TEST_ASSERT(UART_CalculateBaudrateDividers(TEST_PERIPHERAL_CLOCK, 10, &dividers) == false);
+
+	HostUsart_Reset();
+	TEST_ASSERT(UART_DriverInit(0, 115200, L8_BIT, ONE_BIT, NONE_PARITY));
+	configuredBaudrate = HostUsart_GetBaudrate();
+
+	TEST_ASSERT(UART_DriverInit(0, 4000000, L8_BIT, ONE_BIT, NONE_PARITY) == false);
+	TEST_ASSERT_EQUAL(configuredBaudrate, HostUsart_GetBaudrate());
+	TEST_ASSERT(UART_ChangeBaudrate(0, 10) == false);
+	TEST_ASSERT_EQUAL(configuredBaudrate, HostUsart_GetBaudrate());
+	TEST_ASSERT(UART_DriverInit(1, 115200, L8_BIT, ONE_BIT, NONE_PARITY) == false);
+}
+
+int main(void)
+{
+	TestStandardBaudrates();
+	TestDriverRegisters();
+	TestUnsupportedBaudrate();
+
+	return TEST_RESULT("UartBaudrateTest");
+}
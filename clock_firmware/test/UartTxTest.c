@@ -0,0 +1,193 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Test of UART_Driver TX path with model of USART0 registers. SOME/IP reply with 200 bytes
+ * is written by UART_Write which must return at once with whole message queued in TX ring,
+ * rest of transmission is done by THRE interrupts during simulated wire time. Driver which
+ * write bytes to THR by polling would keep caller until last 16 bytes are in FIFO, this
+ * time is printed for comparison. Test also check back to back writes during transmission
+ * and write of message longer than TX ring.
+ */
+
+#include "HostUsart.h"
+#include "UART_Driver.h"
+#include "SOMEIP_Layer.h"
+#include "TestAssert.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define TEST_REPLY_SIZE				200U
+#define TEST_LONG_MESSAGE_SIZE		300U
+#define TEST_STEP_US				100U
+#define TEST_TIMEOUT_US				200000U
+#define TEST_MAX_BAUDRATE_ERROR		(UART_MAX_BAUDRATE_ERROR_PPM/10000U) //percents
+
+static uint8_t Message[TEST_LONG_MESSAGE_SIZE + 1];//coder clear padding byte after CRC
+
+void USART0_IRQHandler(void)
+{
+	UART_ProcessTransmitInterrupt(0);
+}
+
+/*****************************************************************************************
+* RunUntilTransmitFinished() - simulate time until driver report end of transmission.
+*
+* Return: simulated time in microseconds.
+*****************************************************************************************/
+static uint32_t RunUntilTransmitFinished(void)
+{
+	uint32_t time = 0;
+
+	while((UART_IsTransmitFinished(0) == false) && (time < TEST_TIMEOUT_US))
+	{
+		HostUsart_Run(TEST_STEP_US);
+		time += TEST_STEP_US;
+	}
+
+	TEST_ASSERT(UART_IsTransmitFinished(0));
+
+	return time;
+}
+
+static void CheckWireData(const uint8_t* data, uint32_t size)
+{
+	uint32_t wireSize;
+	const uint8_t* wireData = HostUsart_GetWireData(&wireSize);
+
+	TEST_ASSERT_EQUAL(size, wireSize);
+	TEST_ASSERT((wireSize == size) && (memcmp(wireData, data, size) == 0));
+	TEST_ASSERT_EQUAL(0, HostUsart_GetFifoOverruns());
+}
+
+static void InitUart(uint32_t baudrate)
+{
+	HostUsart_Reset();
+	UART_DriverInit(0, baudrate, L8_BIT, ONE_BIT, NONE_PARITY);
+
+	TEST_ASSERT(HostUsart_GetBaudrate() >= baudrate*(100U - TEST_MAX_BAUDRATE_ERROR)/100U);
+	TEST_ASSERT(HostUsart_GetBaudrate() <= baudrate*(100U + TEST_MAX_BAUDRATE_ERROR)/100U);
+}
+
+static uint16_t CodeReply(void)
+{
+	uint8_t payload[TEST_REPLY_SIZE];
+	uint16_t overhead;
+
+	for(uint32_t i = 0; i < sizeof(payload); i++)
+		payload[i] = (uint8_t)(i*7 + 1);
+
+	overhead = SOMEIP_CodeTxMessage(1, 1, SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE, Message, payload, 0);
+
+	return SOMEIP_CodeTxMessage(1, 1, SOME_IP_RESPONSE_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE, Message, payload,
+		TEST_REPLY_SIZE - overhead);
+}
+
+/*****************************************************************************************
+* TestReply() - write 200 bytes reply and measure how long caller is kept by UART_Write.
+*****************************************************************************************/
+static void TestReply(uint32_t baudrate)
+{
+	uint16_t size;
+	uint16_t queuedBytes;
+	struct timespec start, end;
+	uint32_t wireTime;
+
+	InitUart(baudrate);
+	size = CodeReply();
+	TEST_ASSERT_EQUAL(TEST_REPLY_SIZE, size);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	queuedBytes = UART_Write(0, Message, size);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	//first 16 bytes are in FIFO, rest is in TX ring and no simulated time passed
+	TEST_ASSERT_EQUAL(size, queuedBytes);
+	TEST_ASSERT_EQUAL(UART_BUFFER_SIZE, HostUsart_GetFifoLevel());
+	TEST_ASSERT_EQUAL(0, HostUsart_GetTimeNs());
+	TEST_ASSERT(UART_IsTransmitFinished(0) == false);
+
+	wireTime = RunUntilTransmitFinished();
+	CheckWireData(Message, size);
+	TEST_ASSERT(HostUsart_GetNumberOfInterrupts() >= (size - UART_BUFFER_SIZE)/UART_BUFFER_SIZE);
+
+	printf("%7u baud: UART_Write of %u B returned after 0 us of wire time (%ld ns on host), "
+		"transmission took %.1f ms with %u THRE interrupts, polling driver would keep caller %.1f ms\n",
+		(unsigned)baudrate, size, (long)((end.tv_sec - start.tv_sec)*1000000000L + (end.tv_nsec - start.tv_nsec)),
+		wireTime/1000.0, HostUsart_GetNumberOfInterrupts(),
+		(size - UART_BUFFER_SIZE)*(double)HostUsart_GetFrameTimeNs()/1000000.0);
+}
+
+/*****************************************************************************************
+* TestBackToBackWrites() - second reply is queued when first one is on wire.
+*****************************************************************************************/
+static void TestBackToBackWrites(void)
+{
+	uint8_t expected[2*TEST_REPLY_SIZE];
+	uint16_t size;
+
+	InitUart(115200);
+	size = CodeReply();
+	memcpy(expected, Message, size);
+	TEST_ASSERT_EQUAL(size, UART_Write(0, Message, size));
+
+	HostUsart_Run(15000);//first reply is mostly out of TX ring, last bytes are still in FIFO
+	TEST_ASSERT(UART_IsTransmitFinished(0) == false);
+
+	Message[0] ^= 0xFF;
+	memcpy(&expected[size], Message, size);
+	TEST_ASSERT_EQUAL(size, UART_Write(0, Message, size));
+
+	RunUntilTransmitFinished();
+	CheckWireData(expected, 2*size);
+}
+
+/*****************************************************************************************
+* TestLongMessage() - TX ring accept only UART_TX_RING_SIZE - 1 bytes, caller must write
+* rest later.
+*****************************************************************************************/
+static void TestLongMessage(void)
+{
+	uint16_t queuedBytes;
+
+	InitUart(115200);
+
+	for(uint32_t i = 0; i < TEST_LONG_MESSAGE_SIZE; i++)
+		Message[i] = (uint8_t)i;
+
+	queuedBytes = UART_Write(0, Message, TEST_LONG_MESSAGE_SIZE);
+	TEST_ASSERT_EQUAL(UART_TX_RING_SIZE - 1, queuedBytes);
+
+	RunUntilTransmitFinished();
+	TEST_ASSERT_EQUAL(TEST_LONG_MESSAGE_SIZE - queuedBytes,
+		UART_Write(0, &Message[queuedBytes], TEST_LONG_MESSAGE_SIZE - queuedBytes));
+
+	RunUntilTransmitFinished();
+	CheckWireData(Message, TEST_LONG_MESSAGE_SIZE);
+}
+
+int main(void)
+{
+	TestReply(115200);
+	TestReply(460800);
+	TestBackToBackWrites();
+	TestLongMessage();
+
+	return TEST_RESULT("UartTxTest");
+}
@@ -0,0 +1,167 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Stress test of per-socket request queues. Five clients are connected to TCP server of
+ * clock and each of them keep given number of CLOCK_STATUS GET requests in flight(next
+ * request is send immediately after response), so all sockets have pending requests all
+ * the time. Test check that each request get exactly one response(normal response or
+ * SOME/IP error with SOME_IP_RETURN_CODE_E_NOT_READY code), that responses are valid and
+ * that all clients are served fairly. With more requests in flight than RX buffers some
+ * requests are dropped by ESP layer and must be rejected by error.
+ */
+
+#include "HostClock.h"
+#include "HostEsp.h"
+#include "HostUart.h"
+#include "ESP_Layer.h"
+#include "SOMEIP_Layer.h"
+#include "WIFI_InteractionLayer.h"
+#include "TestAssert.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_NUMBER_OF_CLIENTS		5U
+#define TEST_STARTUP_TICKS			(60U*50U) //ESP startup sequence and connection to access point
+#define TEST_STRESS_TICKS			(30U*50U)
+#define TEST_FINISH_TICKS			(5U*50U) //time for responses to last requests
+//requests in flight of one client, requests received at once are answered if they fit in socket
+//buffers and queue of dropped messages(MAX_NUMBER_OF_SOCKET_BUFFER + ESP_DROPPED_MESSAGE_QUEUE_SIZE)
+#define TEST_MAX_WINDOW				WIFI_REQUEST_QUEUE_SIZE
+
+typedef struct
+{
+	uint32_t sentRequests;
+	uint32_t responses;
+	uint32_t busyErrors;
+	uint8_t pendingRequests;
+}TestClient;
+
+static TestClient ClientTable[TEST_NUMBER_OF_CLIENTS];
+
+static void SendRequest(uint8_t linkId)
+{
+	uint8_t request[SOME_IP_MINIMAL_MESSAGE_SIZE + SOME_IP_CRC_SIZE + 1];//coder clear padding byte after CRC
+	uint16_t size = SOMEIP_CodeTxMessage(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET,
+		SOME_IP_REQUEST_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE, request, NULL, 0);
+
+	HostEsp_SendToDevice(linkId, request, size);
+	ClientTable[linkId].sentRequests++;
+	ClientTable[linkId].pendingRequests++;
+}
+
+/*****************************************************************************************
+* ReceiveResponses() - read messages send to client and check them.
+*****************************************************************************************/
+static void ReceiveResponses(uint8_t linkId)
+{
+	TestClient* client = &ClientTable[linkId];
+	uint8_t message[600];
+	uint16_t messageSize;
+
+	while((messageSize = HostEsp_ReceiveMessage(linkId, message, sizeof(message))) != 0)
+	{
+		TEST_ASSERT_EQUAL(SOME_IP_SERVICE_CLOCK_STATUS, SOMEIP_GetServiceId(message));
+		TEST_ASSERT_EQUAL(SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET, SOMEIP_GetMethodId(message));
+
+		//SOMEIP_ValidateRxMessage don't accept error message type
+		if(SOMEIP_GetMessageType(message) == SOME_IP_ERROR_CODE)
+		{
+			TEST_ASSERT_EQUAL(SOME_IP_RETURN_CODE_E_NOT_READY, message[SOME_IP_RETURN_CODE_FIELD_BEGIN]);
+			client->busyErrors++;
+		}
+		else
+		{
+			TEST_ASSERT(SOMEIP_ValidateRxMessage(message, messageSize));
+			TEST_ASSERT_EQUAL(SOME_IP_RESPONSE_CODE, SOMEIP_GetMessageType(message));
+		}
+
+		//response without request
+		TEST_ASSERT(client->pendingRequests > 0);
+		client->pendingRequests--;
+		client->responses++;
+	}
+}
+
+/*****************************************************************************************
+* RunClients() - all clients send requests until TEST_STRESS_TICKS and wait for responses.
+*
+* Parameters:
+* @window: number of requests in flight of each client.
+*
+*****************************************************************************************/
+static void RunClients(uint8_t window)
+{
+	uint32_t minimalServed = UINT32_MAX;
+	uint32_t maximalServed = 0;
+
+	memset(ClientTable, 0, sizeof(ClientTable));
+
+	for(uint32_t tick = 0; tick < (TEST_STRESS_TICKS + TEST_FINISH_TICKS); tick++)
+	{
+		for(uint8_t i = 0; i < TEST_NUMBER_OF_CLIENTS; i++)
+		{
+			ReceiveResponses(i);
+
+			if((ClientTable[i].pendingRequests < window) && (tick < TEST_STRESS_TICKS))
+				SendRequest(i);
+		}
+
+		HostEsp_RunTicks(1);
+	}
+
+	for(uint8_t i = 0; i < TEST_NUMBER_OF_CLIENTS; i++)
+	{
+		TestClient* client = &ClientTable[i];
+		uint32_t served = client->responses - client->busyErrors;
+
+		printf("window %u, client %u: %u requests, %u responses, %u busy errors\n", window, i,
+			client->sentRequests, client->responses, client->busyErrors);
+
+		TEST_ASSERT_EQUAL(client->sentRequests, client->responses);
+		TEST_ASSERT_EQUAL(0, client->pendingRequests);
+
+		minimalServed = (served < minimalServed) ? served : minimalServed;
+		maximalServed = (served > maximalServed) ? served : maximalServed;
+	}
+
+	//round robin service of sockets
+	TEST_ASSERT(minimalServed > 0);
+	TEST_ASSERT((maximalServed - minimalServed) <= (maximalServed/10U));
+}
+
+int main(void)
+{
+	HostUart_Reset();
+	HostEsp_Init();
+	HostClock_Init();
+	HostClock_SetTime(12, 30, 15, 6, 24);
+
+	HostEsp_RunTicks(TEST_STARTUP_TICKS);
+	TEST_ASSERT(HostEsp_ServerIsRunning());
+
+	for(uint8_t i = 0; i < TEST_NUMBER_OF_CLIENTS; i++)
+		TEST_ASSERT(HostEsp_ConnectClient(i));
+
+	HostEsp_RunTicks(3);
+
+	for(uint8_t window = 1; window <= TEST_MAX_WINDOW; window++)
+		RunClients(window);
+
+	return TEST_RESULT("WifiClientsTest");
+}
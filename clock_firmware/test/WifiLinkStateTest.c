@@ -0,0 +1,230 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Test of link state tracking by events of ESP8266. Simulated module send events like real
+ * module(n,CONNECT, n,CLOSED, WIFI DISCONNECT, WIFI CONNECTED and WIFI GOT IP in response
+ * of AT+CWJAP_CUR) and test measure number of ticks(20ms) until state of ESP and WIFI layer
+ * is updated. AT+CIPSTATUS is only watchdog which detect lost events so test check also
+ * that it is send once per WIFI_CONNECTION_WATCHDOG_PERIOD and that connection lost without
+ * event is detected by it.
+ */
+
+#include "HostClock.h"
+#include "HostEsp.h"
+#include "HostUart.h"
+#include "ESP_Layer.h"
+#include "GUI_Clock.h"
+#include "SOMEIP_Layer.h"
+#include "WIFI_InteractionLayer.h"
+#include "TestAssert.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_TICKS_PER_SECOND		50U
+#define TEST_STARTUP_TICKS			(60U*TEST_TICKS_PER_SECOND) //ESP startup sequence and connection to access point
+#define TEST_EVENT_REACTION_TICKS	2U //event is parsed and processed in the same or next tick
+#define TEST_RECONNECT_DELAY		30U //seconds between connection attempts, see connectToApnCounter
+#define TEST_LINK_ID				1U
+
+static uint8_t TestLinkId;
+
+static bool StationIsDisconnected(void)
+{
+	return ClockState.wifiConnected == false;
+}
+
+static bool StationIsConnected(void)
+{
+	return ClockState.wifiConnected && (ClockState.ipAddressAssignedToDevice[0] != 0);
+}
+
+static bool LinkIsOpen(void)
+{
+	return ESP_ReturnLinkInformation(TestLinkId).socketIsOpen;
+}
+
+static bool LinkIsClosed(void)
+{
+	return ESP_ReturnLinkInformation(TestLinkId).socketIsOpen == false;
+}
+
+/*****************************************************************************************
+* RunUntil() - run clock and simulator until condition will be fulfilled.
+*
+* Return: number of ticks or UINT32_MAX if condition wasn't fulfilled in maxTicks.
+*****************************************************************************************/
+static uint32_t RunUntil(bool (*condition)(void), uint32_t maxTicks)
+{
+	for(uint32_t tick = 0; tick <= maxTicks; tick++)
+	{
+		if(condition())
+			return tick;
+
+		HostEsp_RunTicks(1);
+	}
+
+	return UINT32_MAX;
+}
+
+/*****************************************************************************************
+* CheckRequestIsAnswered() - send CLOCK_STATUS GET request and check that response is
+* received.
+*****************************************************************************************/
+static void CheckRequestIsAnswered(uint8_t linkId)
+{
+	uint8_t message[600];
+	uint16_t size = SOMEIP_CodeTxMessage(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET,
+		SOME_IP_REQUEST_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE, message, NULL, 0);
+
+	HostEsp_SendToDevice(linkId, message, size);
+	HostEsp_RunTicks(TEST_TICKS_PER_SECOND);
+
+	size = HostEsp_ReceiveMessage(linkId, message, sizeof(message));
+	TEST_ASSERT(size > 0);
+	TEST_ASSERT(SOMEIP_ValidateRxMessage(message, size));
+	TEST_ASSERT_EQUAL(SOME_IP_RESPONSE_CODE, SOMEIP_GetMessageType(message));
+}
+
+static void TestLinkEvents(void)
+{
+	uint32_t ticks;
+
+	TestLinkId = TEST_LINK_ID;
+	HostEsp_ClearStatistics();
+
+	TEST_ASSERT(HostEsp_ConnectClient(TEST_LINK_ID));
+	ticks = RunUntil(LinkIsOpen, TEST_TICKS_PER_SECOND);
+	printf("n,CONNECT reaction: %u ticks\n", ticks);
+	TEST_ASSERT(ticks <= TEST_EVENT_REACTION_TICKS);
+
+	CheckRequestIsAnswered(TEST_LINK_ID);
+
+	HostEsp_CloseClient(TEST_LINK_ID);
+	ticks = RunUntil(LinkIsClosed, TEST_TICKS_PER_SECOND);
+	printf("n,CLOSED reaction: %u ticks\n", ticks);
+	TEST_ASSERT(ticks <= TEST_EVENT_REACTION_TICKS);
+
+	//state of links isn't polled
+	TEST_ASSERT_EQUAL(0, HostEsp_GetStatistics().numberOfStatusRequests);
+}
+
+/*****************************************************************************************
+* TestStationDisconnect() - access point is switched off for given time. Disconnect must be
+* detected by event and WIFI layer must connect again after TEST_RECONNECT_DELAY seconds
+* since disconnect(or since last failed attempt).
+*****************************************************************************************/
+static void TestStationDisconnect(uint32_t outageSeconds)
+{
+	uint32_t ticks;
+	uint32_t expectedAttempts = outageSeconds/TEST_RECONNECT_DELAY;
+	uint32_t reconnectSeconds = (expectedAttempts + 1U)*TEST_RECONNECT_DELAY;
+
+	TestLinkId = TEST_LINK_ID;
+	TEST_ASSERT(HostEsp_ConnectClient(TEST_LINK_ID));
+	HostEsp_RunTicks(TEST_EVENT_REACTION_TICKS);
+	HostEsp_ClearStatistics();
+
+	HostEsp_SetAccessPointAvailable(false);
+	ticks = RunUntil(StationIsDisconnected, TEST_TICKS_PER_SECOND);
+	printf("WIFI DISCONNECT reaction: %u ticks\n", ticks);
+	TEST_ASSERT(ticks <= TEST_EVENT_REACTION_TICKS);
+	TEST_ASSERT_EQUAL(0, ClockState.ipAddressAssignedToDevice[0]);
+	TEST_ASSERT(LinkIsClosed());
+
+	HostEsp_RunTicks(outageSeconds*TEST_TICKS_PER_SECOND - ticks);
+	HostEsp_SetAccessPointAvailable(true);
+
+	//failed attempts during outage
+	TEST_ASSERT_EQUAL(expectedAttempts, HostEsp_GetStatistics().numberOfConnectRequests);
+
+	ticks = RunUntil(StationIsConnected, (reconnectSeconds + 5U)*TEST_TICKS_PER_SECOND);
+	printf("reconnect after %u s outage: %u ticks after access point is available\n", outageSeconds, ticks);
+	TEST_ASSERT(ticks != UINT32_MAX);
+	TEST_ASSERT(((outageSeconds*TEST_TICKS_PER_SECOND + ticks)/TEST_TICKS_PER_SECOND) <= (reconnectSeconds + 1U));
+	TEST_ASSERT_EQUAL(expectedAttempts + 1U, HostEsp_GetStatistics().numberOfConnectRequests);
+
+	//TCP server stay created in module so client can connect again
+	TEST_ASSERT(HostEsp_ConnectClient(TEST_LINK_ID));
+	HostEsp_RunTicks(TEST_EVENT_REACTION_TICKS);
+	CheckRequestIsAnswered(TEST_LINK_ID);
+	HostEsp_CloseClient(TEST_LINK_ID);
+	HostEsp_RunTicks(TEST_EVENT_REACTION_TICKS);
+}
+
+/*****************************************************************************************
+* TestLostDisconnectEvent() - station is disconnected without WIFI DISCONNECT event. Lost
+* connection must be found by AT+CIPSTATUS send by watchdog.
+*****************************************************************************************/
+static void TestLostDisconnectEvent(void)
+{
+	uint32_t ticks;
+
+	HostEsp_SetEventsEnabled(false);
+	HostEsp_SetAccessPointAvailable(false);
+	HostEsp_SetEventsEnabled(true);
+	HostEsp_SetAccessPointAvailable(true);
+
+	ticks = RunUntil(StationIsDisconnected, (WIFI_CONNECTION_WATCHDOG_PERIOD + 5U)*TEST_TICKS_PER_SECOND);
+	printf("lost WIFI DISCONNECT found by watchdog after: %u ticks\n", ticks);
+	TEST_ASSERT(ticks != UINT32_MAX);
+	TEST_ASSERT(ticks <= ((WIFI_CONNECTION_WATCHDOG_PERIOD + 1U)*TEST_TICKS_PER_SECOND));
+
+	TEST_ASSERT(RunUntil(StationIsConnected, (TEST_RECONNECT_DELAY + 5U)*TEST_TICKS_PER_SECOND) != UINT32_MAX);
+}
+
+/*****************************************************************************************
+* TestWatchdogPeriod() - connected station without traffic. Only AT+CIPSTATUS of watchdog
+* can be send.
+*****************************************************************************************/
+static void TestWatchdogPeriod(void)
+{
+	const uint32_t testMinutes = 5U;
+	HostEspStatistics statistics;
+
+	HostEsp_ClearStatistics();
+	HostEsp_RunTicks(testMinutes*60U*TEST_TICKS_PER_SECOND);
+	statistics = HostEsp_GetStatistics();
+
+	printf("AT requests in %u minutes: %u, AT+CIPSTATUS: %u\n", testMinutes, statistics.numberOfRequests,
+		statistics.numberOfStatusRequests);
+	TEST_ASSERT(statistics.numberOfStatusRequests >= ((testMinutes*60U)/WIFI_CONNECTION_WATCHDOG_PERIOD - 1U));
+	TEST_ASSERT(statistics.numberOfStatusRequests <= ((testMinutes*60U)/WIFI_CONNECTION_WATCHDOG_PERIOD + 1U));
+	TEST_ASSERT_EQUAL(statistics.numberOfStatusRequests, statistics.numberOfRequests);
+	TEST_ASSERT(ClockState.wifiConnected);
+}
+
+int main(void)
+{
+	HostUart_Reset();
+	HostEsp_Init();
+	HostClock_Init();
+	HostClock_SetTime(12, 30, 15, 6, 24);
+
+	HostEsp_RunTicks(TEST_STARTUP_TICKS);
+	TEST_ASSERT(HostEsp_ServerIsRunning());
+	TEST_ASSERT(StationIsConnected());
+
+	TestLinkEvents();
+	TestStationDisconnect(10);
+	TestStationDisconnect(70);
+	TestLostDisconnectEvent();
+	TestWatchdogPeriod();
+
+	return TEST_RESULT("WifiLinkStateTest");
+}
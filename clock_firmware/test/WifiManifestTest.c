@@ -0,0 +1,392 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Test of synchronization of history by SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST.
+ * Client keep CRC of each day measurement of last 90 days before present day and sync them
+ * in three rounds:
+ * - first sync: client has nothing, so manifest of 90 days is followed by range queries
+ *   (step 0) of all days found in manifest,
+ * - repeat sync without change in FRAM: one manifest request and its response messages,
+ *   no range query or day measurement requests and no day measurement loaded from FRAM,
+ * - sync after change of one day measurement in FRAM: manifest and one range query of
+ *   changed day and source.
+ * FRAM of clock has place only for MAX_RECORD_IN_FRAM day measurements so it hold 40 last
+ * days of three sources, older days of range don't have manifest entries. Record cache is
+ * cleared before each sync so CRC is read from FRAM.
+ */
+
+#include "HostClock.h"
+#include "HostEsp.h"
+#include "HostUart.h"
+#include "HostPeripherals.h"
+#include "FRAM_Driver.h"
+#include "GUI_Clock.h"
+#include "SOMEIP_Layer.h"
+#include "TemperatureRecordCache.h"
+#include "WIFI_InteractionLayer.h"
+#include "TestAssert.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_LINK_ID				0U
+#define TEST_TICKS_PER_SECOND		(1000U/HOST_UART_TICK_PERIOD_MS)
+#define TEST_STARTUP_TICKS			(60U*TEST_TICKS_PER_SECOND) //ESP startup sequence and connection
+#define TEST_RESPONSE_TICKS			(20U*TEST_TICKS_PER_SECOND) //FRAM search read one header per tick
+#define TEST_SYNCED_DAYS			90U
+#define TEST_STORED_DAYS			40U
+#define TEST_FIRST_STORED_DAY		(TEST_SYNCED_DAYS - TEST_STORED_DAYS)
+#define TEST_CHANGED_DAY			70U
+#define TEST_CHANGED_SOURCE			1U
+#define TEST_SOURCE_MASK			((1U << NUM_OF_TEMPERATURE_SOURCE) - 1U)
+
+typedef struct
+{
+	uint32_t manifestRequests;
+	uint32_t rangeQueryRequests;
+	uint32_t responses;
+	uint32_t otherResponses;//responses of other methods than the requested one
+	uint32_t manifestEntries;
+	uint32_t changedEntries;
+	uint32_t rangeQueryEntries;
+	uint32_t ticks;
+	uint32_t uartBytes;//both directions of UART with AT requests, headers and echo
+	uint32_t sendRequests;//AT+CIPSEND requests
+	HostFramStatistics fram;
+}TestResult;
+
+//present day is 15.06.2024, synced days are 17.03 - 14.06
+static const DayMeasurementHeader PresentDay = {0, 15, 6, 24};
+static DayMeasurementHeader DayTable[TEST_SYNCED_DAYS];//oldest day first
+static TemperatureSingleDayRecordType RecordTable[TEST_SYNCED_DAYS][NUM_OF_TEMPERATURE_SOURCE];
+
+//state of client
+static bool LocalValidTable[TEST_SYNCED_DAYS][NUM_OF_TEMPERATURE_SOURCE];
+static uint16_t LocalCrcTable[TEST_SYNCED_DAYS][NUM_OF_TEMPERATURE_SOURCE];
+static uint16_t ManifestCrcTable[TEST_SYNCED_DAYS][NUM_OF_TEMPERATURE_SOURCE];
+static uint8_t ChangedSourceMaskTable[TEST_SYNCED_DAYS];
+
+static void DecrementDate(DayMeasurementHeader* date)
+{
+	static const uint8_t daysInMonth[] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};//2024
+
+	if(--date->day == 0)
+	{
+		date->month--;
+		date->day = daysInMonth[date->month - 1];
+	}
+}
+
+static void WriteRecord(uint8_t day, uint8_t source)
+{
+	TemperatureSingleDayRecordType* record = &RecordTable[day][source];
+	uint16_t framIndex = (day - TEST_FIRST_STORED_DAY)*NUM_OF_TEMPERATURE_SOURCE + source;
+
+	GUI_CalculateTemperatureStatistics(record);
+	record->CRC16Value = Chip_CRC_CRC16((uint16_t*)record, offsetof(TemperatureSingleDayRecordType, CRC16Value)/2);
+
+	memcpy(&HostPeripherals_GetFramMemory()[FRAM_MEASUREMENT_DATA_BEGIN + framIndex*sizeof(TemperatureSingleDayRecordType)],
+		record, sizeof(TemperatureSingleDayRecordType));
+}
+
+/*****************************************************************************************
+* FillFram() - write day measurements of TEST_STORED_DAYS days before present day with
+* statistics and CRC like written by clock.
+*****************************************************************************************/
+static void FillFram(void)
+{
+	DayMeasurementHeader date = PresentDay;
+
+	for(int8_t day = TEST_SYNCED_DAYS - 1; day >= 0; day--)
+	{
+		DecrementDate(&date);
+		DayTable[day] = date;
+	}
+
+	for(uint8_t day = TEST_FIRST_STORED_DAY; day < TEST_SYNCED_DAYS; day++)
+	{
+		for(uint8_t source = 0; source < NUM_OF_TEMPERATURE_SOURCE; source++)
+		{
+			TemperatureSingleDayRecordType* record = &RecordTable[day][source];
+
+			memset(record, 0, sizeof(TemperatureSingleDayRecordType));
+			record->source = source;
+			record->day = DayTable[day].day;
+			record->month = DayTable[day].month;
+			record->year = DayTable[day].year;
+
+			for(uint8_t i = 0; i < MAX_TEMP_RECORD_PER_DAY; i++)
+				record->temperatureValues[i] = 400U + 50U*source + (day % 7U) + (i % 24U);
+
+			WriteRecord(day, source);
+		}
+	}
+}
+
+static uint8_t FindDay(const DayMeasurementHeader* header)
+{
+	for(uint8_t day = 0; day < TEST_SYNCED_DAYS; day++)
+	{
+		if((DayTable[day].day == header->day) && (DayTable[day].month == header->month)
+			&& (DayTable[day].year == header->year))
+			return day;
+	}
+
+	return TEST_SYNCED_DAYS;
+}
+
+static void SendRangeRequest(uint16_t methodId, uint8_t sourceMask, uint8_t firstDay, uint8_t lastDay)
+{
+	SomeIpRangeQueryRequestPayload payload = {.sourceMask = sourceMask, .step = 0,
+		.firstDay = DayTable[firstDay].day, .firstMonth = DayTable[firstDay].month, .firstYear = DayTable[firstDay].year,
+		.lastDay = DayTable[lastDay].day, .lastMonth = DayTable[lastDay].month, .lastYear = DayTable[lastDay].year};
+	uint8_t request[64];
+	uint16_t size = SOMEIP_CodeTxMessage(SOME_IP_SERVICE_DAY_MEASUREMENT, methodId, SOME_IP_REQUEST_CODE,
+		SOME_IP_RETURN_CODE_E_OK_VALUE, request, (uint8_t*)&payload, sizeof(payload));
+
+	HostEsp_SendToDevice(TEST_LINK_ID, request, size);
+}
+
+/*****************************************************************************************
+* ReceiveResponse() - run ticks until response of method is received.
+*
+* Return: header of response or NULL after TEST_RESPONSE_TICKS.
+*****************************************************************************************/
+static SomeIpRangeQueryResponseHeader* ReceiveResponse(uint16_t methodId, uint8_t* message, uint16_t bufferSize,
+	TestResult* result)
+{
+	for(uint32_t tick = 0; tick < TEST_RESPONSE_TICKS; tick++)
+	{
+		uint16_t messageSize = HostEsp_ReceiveMessage(TEST_LINK_ID, message, bufferSize);
+
+		if(messageSize != 0)
+		{
+			TEST_ASSERT(SOMEIP_ValidateRxMessage(message, messageSize));
+			TEST_ASSERT_EQUAL(SOME_IP_RESPONSE_CODE, SOMEIP_GetMessageType(message));
+			TEST_ASSERT_EQUAL(SOME_IP_RETURN_CODE_E_OK_VALUE, message[SOME_IP_RETURN_CODE_FIELD_BEGIN]);
+			result->responses++;
+
+			if((SOMEIP_GetServiceId(message) != SOME_IP_SERVICE_DAY_MEASUREMENT) || (SOMEIP_GetMethodId(message) != methodId))
+				result->otherResponses++;
+
+			return (SomeIpRangeQueryResponseHeader*)SOMEIP_GetPayload(message);
+		}
+
+		HostEsp_RunTicks(1);
+		result->ticks++;
+	}
+
+	TEST_ASSERT(false);
+
+	return NULL;
+}
+
+/*****************************************************************************************
+* ReadManifest() - request manifest of all synced days and mark day measurements which are
+* new or have other CRC than local copy.
+*****************************************************************************************/
+static void ReadManifest(TestResult* result)
+{
+	uint8_t message[256];
+	bool moreMessages = true;
+
+	memset(ChangedSourceMaskTable, 0, sizeof(ChangedSourceMaskTable));
+
+	SendRangeRequest(SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST, TEST_SOURCE_MASK, 0, TEST_SYNCED_DAYS - 1);
+	result->manifestRequests++;
+
+	while(moreMessages)
+	{
+		SomeIpRangeQueryResponseHeader* header = ReceiveResponse(SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_MANIFEST,
+			message, sizeof(message), result);
+		SomeIpManifestEntry* entry;
+
+		if(header == NULL)
+			break;
+
+		entry = (SomeIpManifestEntry*)&header[1];
+		moreMessages = header->moreMessages;
+
+		for(uint8_t i = 0; i < header->numberOfEntries; i++, entry++)
+		{
+			uint8_t day = FindDay(&entry->header);
+			uint8_t source = entry->header.source;
+
+			TEST_ASSERT((day >= TEST_FIRST_STORED_DAY) && (day < TEST_SYNCED_DAYS));
+			TEST_ASSERT(source < NUM_OF_TEMPERATURE_SOURCE);
+
+			if((day >= TEST_SYNCED_DAYS) || (source >= NUM_OF_TEMPERATURE_SOURCE))
+				continue;
+
+			TEST_ASSERT_EQUAL(RecordTable[day][source].CRC16Value, entry->crc16Value);
+			ManifestCrcTable[day][source] = entry->crc16Value;
+			result->manifestEntries++;
+
+			if((LocalValidTable[day][source] == false) || (LocalCrcTable[day][source] != entry->crc16Value))
+			{
+				ChangedSourceMaskTable[day] |= (1U << source);
+				result->changedEntries++;
+			}
+		}
+	}
+}
+
+/*****************************************************************************************
+* ReadChangedDays() - read summary of changed day measurements by range queries. Range
+* begin on first changed day and contain sources changed in this day, it is extended over
+* next days with the same mask of changed sources but no longer than WIFI_RANGE_QUERY_MAX_DAYS.
+*****************************************************************************************/
+static void ReadChangedDays(TestResult* result)
+{
+	uint8_t message[256];
+
+	for(uint8_t firstDay = 0; firstDay < TEST_SYNCED_DAYS;)
+	{
+		uint8_t sourceMask = ChangedSourceMaskTable[firstDay];
+		uint8_t lastDay = firstDay;
+		bool moreMessages = true;
+
+		if(sourceMask == 0)
+		{
+			firstDay++;
+			continue;
+		}
+
+		while(((lastDay + 1U) < TEST_SYNCED_DAYS) && ((lastDay + 1U - firstDay) < WIFI_RANGE_QUERY_MAX_DAYS)
+			&& (ChangedSourceMaskTable[lastDay + 1] == sourceMask))
+		{
+			lastDay++;
+		}
+
+		SendRangeRequest(SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_RANGE_QUERY, sourceMask, firstDay, lastDay);
+		result->rangeQueryRequests++;
+
+		while(moreMessages)
+		{
+			SomeIpRangeQueryResponseHeader* header = ReceiveResponse(SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_RANGE_QUERY,
+				message, sizeof(message), result);
+			SomeIpRangeQuerySummaryEntry* entry;
+
+			if(header == NULL)
+				break;
+
+			entry = (SomeIpRangeQuerySummaryEntry*)&header[1];
+			moreMessages = header->moreMessages;
+
+			for(uint8_t i = 0; i < header->numberOfEntries; i++, entry++)
+			{
+				uint8_t day = FindDay(&entry->header);
+				uint8_t source = entry->header.source;
+
+				TEST_ASSERT((day >= firstDay) && (day <= lastDay) && (sourceMask & (1U << source)));
+
+				if((day > lastDay) || (source >= NUM_OF_TEMPERATURE_SOURCE))
+					continue;
+
+				TEST_ASSERT_EQUAL(RecordTable[day][source].minTemperature, entry->summary.minTemperature);
+				TEST_ASSERT_EQUAL(RecordTable[day][source].maxTemperature, entry->summary.maxTemperature);
+
+				//day is stored by client with CRC from manifest
+				LocalValidTable[day][source] = true;
+				LocalCrcTable[day][source] = ManifestCrcTable[day][source];
+				result->rangeQueryEntries++;
+			}
+		}
+
+		firstDay = lastDay + 1;
+	}
+}
+
+static TestResult Sync(const char* name)
+{
+	TestResult result;
+
+	memset(&result, 0, sizeof(TestResult));
+	TemperatureRecordCache_Init();
+	HostPeripherals_ClearFramStatistics();
+	HostEsp_ClearStatistics();
+	result.uartBytes = HostUart_GetNumberOfRxBytes() + HostUart_GetNumberOfTxBytes();
+
+	ReadManifest(&result);
+	ReadChangedDays(&result);
+
+	result.fram = HostPeripherals_GetFramStatistics();
+	result.uartBytes = HostUart_GetNumberOfRxBytes() + HostUart_GetNumberOfTxBytes() - result.uartBytes;
+	result.sendRequests = HostEsp_GetStatistics().numberOfSendRequests;
+
+	printf("%-14s %u manifest + %2u range query requests, %2u responses, %3u manifest entries (%3u changed), "
+		"%3u FRAM reads (%5u B), %6u UART bytes, %2u AT+CIPSEND, %5.1f s\n", name, (unsigned)result.manifestRequests,
+		(unsigned)result.rangeQueryRequests, (unsigned)result.responses, (unsigned)result.manifestEntries,
+		(unsigned)result.changedEntries, (unsigned)result.fram.numberOfReads, (unsigned)result.fram.readBytes,
+		(unsigned)result.uartBytes, (unsigned)result.sendRequests, result.ticks/(double)TEST_TICKS_PER_SECOND);
+
+	return result;
+}
+
+int main(void)
+{
+	TestResult firstSync, repeatSync, changeSync;
+
+	HostUart_Reset();
+	HostEsp_Init();
+	HostClock_Init();
+	HostClock_SetTime(12, 30, PresentDay.day, PresentDay.month, PresentDay.year);
+	FillFram();
+
+	HostEsp_RunTicks(TEST_STARTUP_TICKS);
+	TEST_ASSERT(HostEsp_ServerIsRunning());
+	TEST_ASSERT(HostEsp_ConnectClient(TEST_LINK_ID));
+	HostEsp_RunTicks(3);
+
+	firstSync = Sync("first sync");
+	TEST_ASSERT_EQUAL(TEST_STORED_DAYS*NUM_OF_TEMPERATURE_SOURCE, firstSync.manifestEntries);
+	TEST_ASSERT_EQUAL(TEST_STORED_DAYS*NUM_OF_TEMPERATURE_SOURCE, firstSync.changedEntries);
+	TEST_ASSERT_EQUAL(TEST_STORED_DAYS*NUM_OF_TEMPERATURE_SOURCE, firstSync.rangeQueryEntries);
+	TEST_ASSERT_EQUAL((TEST_STORED_DAYS + WIFI_RANGE_QUERY_MAX_DAYS - 1)/WIFI_RANGE_QUERY_MAX_DAYS,
+		firstSync.rangeQueryRequests);
+	TEST_ASSERT_EQUAL(0, firstSync.otherResponses);
+
+	repeatSync = Sync("repeat sync");
+	TEST_ASSERT_EQUAL(1, repeatSync.manifestRequests);
+	TEST_ASSERT_EQUAL(0, repeatSync.rangeQueryRequests);
+	TEST_ASSERT_EQUAL(0, repeatSync.otherResponses);
+	TEST_ASSERT_EQUAL(TEST_STORED_DAYS*NUM_OF_TEMPERATURE_SOURCE, repeatSync.manifestEntries);
+	TEST_ASSERT_EQUAL(0, repeatSync.changedEntries);
+	TEST_ASSERT_EQUAL(repeatSync.responses, repeatSync.sendRequests);
+	TEST_ASSERT(repeatSync.responses < firstSync.responses);
+	//only headers of all FRAM places and CRC of each day measurement, no day measurement is loaded
+	TEST_ASSERT_EQUAL(MAX_RECORD_IN_FRAM + TEST_STORED_DAYS*NUM_OF_TEMPERATURE_SOURCE, repeatSync.fram.numberOfReads);
+	TEST_ASSERT_EQUAL(MAX_RECORD_IN_FRAM*DAY_MEASUREMENT_HEADER_SIZE
+		+ TEST_STORED_DAYS*NUM_OF_TEMPERATURE_SOURCE*sizeof(uint16_t), repeatSync.fram.readBytes);
+
+	RecordTable[TEST_CHANGED_DAY][TEST_CHANGED_SOURCE].temperatureValues[10] += 5;
+	WriteRecord(TEST_CHANGED_DAY, TEST_CHANGED_SOURCE);
+
+	changeSync = Sync("changed day");
+	TEST_ASSERT_EQUAL(1, changeSync.changedEntries);
+	TEST_ASSERT_EQUAL(1, changeSync.rangeQueryRequests);
+	TEST_ASSERT_EQUAL(1, changeSync.rangeQueryEntries);
+	TEST_ASSERT_EQUAL(0, changeSync.otherResponses);
+
+	printf("repeat sync / first sync: %.2f x UART bytes, %.2f x FRAM bytes, %.2f x time\n",
+		repeatSync.uartBytes/(double)firstSync.uartBytes, repeatSync.fram.readBytes/(double)firstSync.fram.readBytes,
+		repeatSync.ticks/(double)firstSync.ticks);
+
+	return TEST_RESULT("WifiManifestTest");
+}
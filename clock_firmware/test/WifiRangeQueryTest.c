@@ -0,0 +1,421 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Comparison of export of 30 days of all three temperature sources by day measurement
+ * requests, by one range query and by one range query with compact encoding of samples. FRAM is filled with day measurements of 40 days before
+ * present day(120 of MAX_RECORD_IN_FRAM places) in order in which clock write them. Client
+ * first read each day of each source by requests of all SOME_IP_SERVICE_DAY_MEASUREMENT_NUMBER_OF_PARTS
+ * parts, one request at a time, then the same days by one
+ * SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_RANGE_QUERY with step 1, first with raw samples and
+ * then with SOME_IP_RANGE_QUERY_COMPACT_ENCODING_FLAG. Coded samples are decoded by the same
+ * TemperatureEncoding module which is reference decoder of host application. Samples are
+ * synthetic: inside and outside temperatures change smoothly by few tenths of degree per 15
+ * minutes, furnace temperature jump by tens of degrees so its entries fall back to raw
+ * values. Test check that each way return samples written to FRAM and count FRAM reads,
+ * requests, responses, UART bytes, AT+CIPSEND requests and simulated time.
+ * Record cache is cleared before each export so none of them use days loaded by other.
+ */
+
+#include "HostClock.h"
+#include "HostEsp.h"
+#include "HostUart.h"
+#include "HostPeripherals.h"
+#include "FRAM_Driver.h"
+#include "GUI_Clock.h"
+#include "SOMEIP_Layer.h"
+#include "TemperatureEncoding.h"
+#include "TemperatureRecordCache.h"
+#include "WIFI_InteractionLayer.h"
+#include "TestAssert.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_LINK_ID				0U
+#define TEST_TICKS_PER_SECOND		(1000U/HOST_UART_TICK_PERIOD_MS)
+#define TEST_STARTUP_TICKS			(60U*TEST_TICKS_PER_SECOND) //ESP startup sequence and connection
+#define TEST_RESPONSE_TICKS			(20U*TEST_TICKS_PER_SECOND) //FRAM search read one header per tick
+#define TEST_STORED_DAYS			40U
+#define TEST_EXPORTED_DAYS			30U
+#define TEST_SOURCE_MASK			((1U << NUM_OF_TEMPERATURE_SOURCE) - 1U)
+#define TEST_SAMPLES_SIZE			(DAY_MEASUREMENT_HEADER_SIZE + (MAX_TEMP_RECORD_PER_DAY*sizeof(uint16_t)))
+
+typedef struct
+{
+	uint32_t requests;
+	uint32_t responses;
+	uint32_t responseBytes;
+	uint32_t ticks;
+	uint32_t uartBytes;//both directions of UART with AT requests, headers and echo
+	uint32_t sendRequests;//AT+CIPSEND requests
+	HostFramStatistics fram;
+}TestResult;
+
+//present day is 15.06.2024, exported days are 16.05 - 14.06
+static const DayMeasurementHeader PresentDay = {0, 15, 6, 24};
+static DayMeasurementHeader DayTable[TEST_STORED_DAYS];//oldest day first
+static TemperatureSingleDayRecordType RecordTable[TEST_STORED_DAYS][NUM_OF_TEMPERATURE_SOURCE];
+
+static uint32_t RandomSeed = 1;
+
+static uint16_t Random(uint16_t range)
+{
+	RandomSeed = RandomSeed*1103515245U + 12345U;
+
+	return (RandomSeed >> 16) % range;
+}
+
+/*****************************************************************************************
+* SyntheticSample() - temperature in tenths of degree. Inside temperature follow slow day
+* cycle, outside temperature follow faster day cycle and furnace temperature jump when
+* burner is switched on and off.
+*****************************************************************************************/
+static uint16_t SyntheticSample(uint8_t source, uint8_t day, uint8_t index)
+{
+	uint8_t cycle = (index < (MAX_TEMP_RECORD_PER_DAY/2)) ? index : (MAX_TEMP_RECORD_PER_DAY - index);
+
+	switch(source)
+	{
+	case 0:
+		return 205U + (day % 3U) + (cycle/4U) + Random(3);
+	case 1:
+		return 120U + 5U*(day % 5U) + cycle + Random(7);
+	default:
+		return 300U + Random(400);
+	}
+}
+
+static void DecrementDate(DayMeasurementHeader* date)
+{
+	static const uint8_t daysInMonth[] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};//2024
+
+	if(--date->day == 0)
+	{
+		date->month--;
+		date->day = daysInMonth[date->month - 1];
+	}
+}
+
+/*****************************************************************************************
+* FillFram() - write day measurements of TEST_STORED_DAYS days before present day with
+* statistics and CRC like written by clock.
+*****************************************************************************************/
+static void FillFram(void)
+{
+	DayMeasurementHeader date = PresentDay;
+	uint16_t framIndex = 0;
+
+	for(int8_t day = TEST_STORED_DAYS - 1; day >= 0; day--)
+	{
+		DecrementDate(&date);
+		DayTable[day] = date;
+	}
+
+	for(uint8_t day = 0; day < TEST_STORED_DAYS; day++)
+	{
+		for(uint8_t source = 0; source < NUM_OF_TEMPERATURE_SOURCE; source++)
+		{
+			TemperatureSingleDayRecordType* record = &RecordTable[day][source];
+
+			memset(record, 0, sizeof(TemperatureSingleDayRecordType));
+			record->source = source;
+			record->day = DayTable[day].day;
+			record->month = DayTable[day].month;
+			record->year = DayTable[day].year;
+
+			for(uint8_t i = 0; i < MAX_TEMP_RECORD_PER_DAY; i++)
+				record->temperatureValues[i] = SyntheticSample(source, day, i);
+
+			GUI_CalculateTemperatureStatistics(record);
+			record->CRC16Value = Chip_CRC_CRC16((uint16_t*)record, offsetof(TemperatureSingleDayRecordType, CRC16Value)/2);
+
+			memcpy(&HostPeripherals_GetFramMemory()[FRAM_MEASUREMENT_DATA_BEGIN + framIndex*sizeof(TemperatureSingleDayRecordType)],
+				record, sizeof(TemperatureSingleDayRecordType));
+			framIndex++;
+		}
+	}
+}
+
+static void SendRequest(uint16_t methodId, uint8_t* payload, uint16_t payloadSize, TestResult* result)
+{
+	uint8_t request[64];
+	uint16_t size = SOMEIP_CodeTxMessage(SOME_IP_SERVICE_DAY_MEASUREMENT, methodId, SOME_IP_REQUEST_CODE,
+		SOME_IP_RETURN_CODE_E_OK_VALUE, request, payload, payloadSize);
+
+	HostEsp_SendToDevice(TEST_LINK_ID, request, size);
+	result->requests++;
+}
+
+/*****************************************************************************************
+* ReceiveResponse() - run ticks until response is received.
+*
+* Return: size of response or 0 after TEST_RESPONSE_TICKS.
+*****************************************************************************************/
+static uint16_t ReceiveResponse(uint8_t* message, uint16_t bufferSize, TestResult* result)
+{
+	for(uint32_t tick = 0; tick < TEST_RESPONSE_TICKS; tick++)
+	{
+		uint16_t messageSize = HostEsp_ReceiveMessage(TEST_LINK_ID, message, bufferSize);
+
+		if(messageSize != 0)
+		{
+			TEST_ASSERT(SOMEIP_ValidateRxMessage(message, messageSize));
+			TEST_ASSERT_EQUAL(SOME_IP_RESPONSE_CODE, SOMEIP_GetMessageType(message));
+			result->responses++;
+			result->responseBytes += messageSize;
+
+			return messageSize;
+		}
+
+		HostEsp_RunTicks(1);
+		result->ticks++;
+	}
+
+	return 0;
+}
+
+static void StartExport(TestResult* result)
+{
+	memset(result, 0, sizeof(TestResult));
+	TemperatureRecordCache_Init();
+	HostPeripherals_ClearFramStatistics();
+	HostEsp_ClearStatistics();
+	result->uartBytes = HostUart_GetNumberOfRxBytes() + HostUart_GetNumberOfTxBytes();
+}
+
+static void FinishExport(const char* name, TestResult* result)
+{
+	result->fram = HostPeripherals_GetFramStatistics();
+	result->uartBytes = HostUart_GetNumberOfRxBytes() + HostUart_GetNumberOfTxBytes() - result->uartBytes;
+	result->sendRequests = HostEsp_GetStatistics().numberOfSendRequests;
+
+	printf("%-17s %4u requests, %4u responses (%6u B), %6u FRAM reads (%7u B), %6u UART bytes, "
+		"%4u AT+CIPSEND, %6.1f s\n", name, (unsigned)result->requests, (unsigned)result->responses,
+		(unsigned)result->responseBytes, (unsigned)result->fram.numberOfReads, (unsigned)result->fram.readBytes,
+		(unsigned)result->uartBytes, (unsigned)result->sendRequests, result->ticks/(double)TEST_TICKS_PER_SECOND);
+}
+
+/*****************************************************************************************
+* ExportByDayRequests() - read header and samples of each day and source part by part.
+*****************************************************************************************/
+static TestResult ExportByDayRequests(void)
+{
+	TestResult result;
+	uint8_t message[256];
+
+	StartExport(&result);
+
+	for(uint8_t day = TEST_STORED_DAYS - TEST_EXPORTED_DAYS; day < TEST_STORED_DAYS; day++)
+	{
+		for(uint8_t source = 0; source < NUM_OF_TEMPERATURE_SOURCE; source++)
+		{
+			uint8_t recordData[SOME_IP_SERVICE_DAY_MEASUREMENT_NUMBER_OF_PARTS*SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE];
+			SomeIpDayMeasurmentRequestPayload payload = DayTable[day];
+
+			payload.source = source;
+
+			for(uint8_t part = 0; part < SOME_IP_SERVICE_DAY_MEASUREMENT_NUMBER_OF_PARTS; part++)
+			{
+				SendRequest(part, (uint8_t*)&payload, sizeof(payload), &result);
+				TEST_ASSERT(ReceiveResponse(message, sizeof(message), &result) != 0);
+				TEST_ASSERT_EQUAL(part, SOMEIP_GetMethodId(message));
+				memcpy(&recordData[part*SOME_IP_SERVICE_DAY_MEASUREMENT_MAX_RESP_PAYLOAD_SIZE], SOMEIP_GetPayload(message),
+					SOMEIP_GetPayloadSize(message));
+			}
+
+			TEST_ASSERT(memcmp(recordData, &RecordTable[day][source], TEST_SAMPLES_SIZE) == 0);
+		}
+	}
+
+	FinishExport("day measurements", &result);
+
+	return result;
+}
+
+/*****************************************************************************************
+* ReadEntry() - copy samples of raw or coded entry of range query response.
+*
+* Return: size of entry.
+*****************************************************************************************/
+static uint16_t ReadEntry(const uint8_t* entryPointer, bool compact, DayMeasurementHeader* header,
+	uint8_t* firstSampleIndex, uint8_t* numberOfSamples, uint16_t* samples, uint32_t* encodedEntries)
+{
+	if(compact)
+	{
+		const SomeIpRangeQueryEncodedSamplesEntry* entry = (const SomeIpRangeQueryEncodedSamplesEntry*)entryPointer;
+
+		*header = entry->header;
+		*firstSampleIndex = entry->firstSampleIndex;
+		*numberOfSamples = entry->numberOfSamples;
+
+		if(entry->encoding == TEMPERATURE_ENCODING_DELTA_VARINT)
+		{
+			TEST_ASSERT_EQUAL(entry->numberOfSamples,
+				TemperatureEncoding_DecodeDelta(entry->data, entry->dataSize, samples, entry->numberOfSamples));
+			(*encodedEntries)++;
+		}
+		else
+		{
+			TEST_ASSERT_EQUAL(TEMPERATURE_ENCODING_RAW, entry->encoding);
+			TEST_ASSERT_EQUAL(entry->numberOfSamples*sizeof(uint16_t), entry->dataSize);
+
+			for(uint8_t i = 0; i < entry->numberOfSamples; i++)
+				samples[i] = entry->data[2*i] | (entry->data[2*i + 1] << 8);
+		}
+
+		return SOME_IP_SERVICE_DAY_MEASUREMENT_ENCODED_SAMPLES_ENTRY_HEADER_SIZE + entry->dataSize;
+	}
+	else
+	{
+		const SomeIpRangeQuerySamplesEntry* entry = (const SomeIpRangeQuerySamplesEntry*)entryPointer;
+
+		*header = entry->header;
+		*firstSampleIndex = entry->firstSampleIndex;
+		*numberOfSamples = entry->numberOfSamples;
+		memcpy(samples, entry->temperatureValues, entry->numberOfSamples*sizeof(uint16_t));
+
+		return SOME_IP_SERVICE_DAY_MEASUREMENT_RANGE_QUERY_SAMPLES_ENTRY_HEADER_SIZE + entry->numberOfSamples*sizeof(uint16_t);
+	}
+}
+
+/*****************************************************************************************
+* ExportByRangeQuery() - read all days and sources by one range query with step 1. Samples
+* of one day can be split between messages.
+*
+* Parameters:
+* @compact: client allow compact encoding of samples.
+*
+*****************************************************************************************/
+static TestResult ExportByRangeQuery(bool compact)
+{
+	TestResult result;
+	SomeIpRangeQueryRequestPayload payload = {
+		.sourceMask = TEST_SOURCE_MASK | (compact ? SOME_IP_RANGE_QUERY_COMPACT_ENCODING_FLAG : 0), .step = 1,
+		.firstDay = DayTable[TEST_STORED_DAYS - TEST_EXPORTED_DAYS].day,
+		.firstMonth = DayTable[TEST_STORED_DAYS - TEST_EXPORTED_DAYS].month,
+		.firstYear = DayTable[TEST_STORED_DAYS - TEST_EXPORTED_DAYS].year,
+		.lastDay = DayTable[TEST_STORED_DAYS - 1].day,
+		.lastMonth = DayTable[TEST_STORED_DAYS - 1].month,
+		.lastYear = DayTable[TEST_STORED_DAYS - 1].year};
+	uint8_t message[256];
+	uint32_t receivedSamples = 0;
+	uint32_t entries = 0;
+	uint32_t encodedEntries = 0;
+	uint8_t day = TEST_STORED_DAYS - TEST_EXPORTED_DAYS;
+	uint8_t source = 0;
+	bool moreMessages = true;
+
+	StartExport(&result);
+	SendRequest(SOME_IP_SERVICE_DAY_MEASUREMENT_METHOD_RANGE_QUERY, (uint8_t*)&payload, sizeof(payload), &result);
+
+	while(moreMessages)
+	{
+		SomeIpRangeQueryResponseHeader* header = (SomeIpRangeQueryResponseHeader*)SOMEIP_GetPayload(message);
+		uint8_t* entryPointer;
+
+		if(ReceiveResponse(message, sizeof(message), &result) == 0)
+		{
+			TEST_ASSERT(false);
+			break;
+		}
+
+		entryPointer = (uint8_t*)&header[1];
+		moreMessages = header->moreMessages;
+
+		//entries are in order of date and source
+		for(uint8_t i = 0; i < header->numberOfEntries; i++)
+		{
+			DayMeasurementHeader entryHeader;
+			uint8_t firstSampleIndex, numberOfSamples;
+			uint16_t samples[MAX_TEMP_RECORD_PER_DAY];
+
+			entryPointer += ReadEntry(entryPointer, compact, &entryHeader, &firstSampleIndex, &numberOfSamples,
+				samples, &encodedEntries);
+
+			TEST_ASSERT(day < TEST_STORED_DAYS);
+			TEST_ASSERT_EQUAL(source, entryHeader.source);
+			TEST_ASSERT_EQUAL(DayTable[day].day, entryHeader.day);
+			TEST_ASSERT(firstSampleIndex + numberOfSamples <= MAX_TEMP_RECORD_PER_DAY);
+
+			TEST_ASSERT(memcmp(samples, &RecordTable[day][source].temperatureValues[firstSampleIndex],
+				numberOfSamples*sizeof(uint16_t)) == 0);
+			receivedSamples += numberOfSamples;
+			entries++;
+
+			if((firstSampleIndex + numberOfSamples) == MAX_TEMP_RECORD_PER_DAY)
+			{
+				source = (source + 1) % NUM_OF_TEMPERATURE_SOURCE;
+				day += (source == 0);
+			}
+		}
+	}
+
+	TEST_ASSERT_EQUAL(TEST_EXPORTED_DAYS*NUM_OF_TEMPERATURE_SOURCE*MAX_TEMP_RECORD_PER_DAY, receivedSamples);
+
+	//smooth sources are coded, furnace samples are send raw
+	if(compact)
+	{
+		TEST_ASSERT(encodedEntries >= TEST_EXPORTED_DAYS*(NUM_OF_TEMPERATURE_SOURCE - 1));
+		TEST_ASSERT(encodedEntries < entries);
+	}
+	else
+		TEST_ASSERT_EQUAL(0, encodedEntries);
+
+	FinishExport(compact ? "compact query" : "range query", &result);
+
+	return result;
+}
+
+int main(void)
+{
+	TestResult dayRequests, rangeQuery, compactQuery;
+
+	HostUart_Reset();
+	HostEsp_Init();
+	HostClock_Init();
+	HostClock_SetTime(12, 30, PresentDay.day, PresentDay.month, PresentDay.year);
+	FillFram();
+
+	HostEsp_RunTicks(TEST_STARTUP_TICKS);
+	TEST_ASSERT(HostEsp_ServerIsRunning());
+	TEST_ASSERT(HostEsp_ConnectClient(TEST_LINK_ID));
+	HostEsp_RunTicks(3);
+
+	dayRequests = ExportByDayRequests();
+	rangeQuery = ExportByRangeQuery(false);
+	compactQuery = ExportByRangeQuery(true);
+
+	TEST_ASSERT_EQUAL(1, rangeQuery.requests);
+	TEST_ASSERT(rangeQuery.fram.numberOfReads < dayRequests.fram.numberOfReads);
+	TEST_ASSERT(rangeQuery.ticks < dayRequests.ticks);
+
+	printf("day measurements / range query: %.1f x FRAM reads, %.1f x FRAM bytes, %u x requests, %.1f x time\n",
+		dayRequests.fram.numberOfReads/(double)rangeQuery.fram.numberOfReads,
+		dayRequests.fram.readBytes/(double)rangeQuery.fram.readBytes, (unsigned)dayRequests.requests,
+		dayRequests.ticks/(double)rangeQuery.ticks);
+
+	TEST_ASSERT(compactQuery.uartBytes < rangeQuery.uartBytes);
+	TEST_ASSERT(compactQuery.sendRequests < rangeQuery.sendRequests);
+
+	printf("range query / compact query: %.2f x UART bytes, %.2f x AT+CIPSEND\n",
+		rangeQuery.uartBytes/(double)compactQuery.uartBytes,
+		rangeQuery.sendRequests/(double)compactQuery.sendRequests);
+
+	return TEST_RESULT("WifiRangeQueryTest");
+}
@@ -0,0 +1,185 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Test of request handling by whole clock firmware with simulated ESP8266. Client send
+ * requests coalesced in one +IPD payload and divided between few +IPD payloads and test
+ * check that each request get exactly one response(normal response or SOME/IP error with
+ * SOME_IP_RETURN_CODE_E_NOT_READY code when queue of socket is full). Responses don't
+ * contain client and session ID of request so they are matched by service and method ID.
+ */
+
+#include "HostClock.h"
+#include "HostEsp.h"
+#include "HostUart.h"
+#include "ESP_Layer.h"
+#include "SOMEIP_Layer.h"
+#include "WIFI_InteractionLayer.h"
+#include "TestAssert.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_LINK_ID				0U
+#define TEST_STARTUP_TICKS			(60U*50U) //ESP startup sequence and connection to access point
+#define TEST_RESPONSE_TICKS			(5U*50U)
+#define TEST_FRAGMENT_TICKS			3U //ticks between fragments, shorter than ESP_FRAME_TIMEOUT
+#define TEST_MAX_REQUESTS			(MAX_NUMBER_OF_SOCKET_BUFFER + ESP_DROPPED_MESSAGE_QUEUE_SIZE)
+#define TEST_UNKNOWN_METHOD			0x30U
+
+typedef struct
+{
+	uint16_t serviceId;
+	uint16_t methodId;
+}TestRequest;
+
+static uint8_t StreamBuffer[TEST_MAX_REQUESTS*40U];
+
+/*****************************************************************************************
+* CodeRequests() - code requests one after another in StreamBuffer.
+*
+* Return: size of coded stream.
+*****************************************************************************************/
+static uint16_t CodeRequests(const TestRequest* requestTable, uint8_t numberOfRequests)
+{
+	uint16_t size = 0;
+
+	for(uint8_t i = 0; i < numberOfRequests; i++)
+	{
+		size += SOMEIP_CodeTxMessage(requestTable[i].serviceId, requestTable[i].methodId, SOME_IP_REQUEST_CODE,
+			SOME_IP_RETURN_CODE_E_OK_VALUE, &StreamBuffer[size], NULL, 0);
+	}
+
+	return size;
+}
+
+/*****************************************************************************************
+* CheckResponses() - read all messages send to link and check that each request has exactly
+* one response.
+*****************************************************************************************/
+static void CheckResponses(const TestRequest* requestTable, uint8_t numberOfRequests)
+{
+	bool answeredTable[TEST_MAX_REQUESTS] = {false};
+	uint8_t message[600];
+	uint16_t messageSize;
+	uint8_t numberOfResponses = 0;
+
+	while((messageSize = HostEsp_ReceiveMessage(TEST_LINK_ID, message, sizeof(message))) != 0)
+	{
+		uint8_t i;
+
+		//SOMEIP_ValidateRxMessage don't accept error message type
+		if(SOMEIP_GetMessageType(message) == SOME_IP_ERROR_CODE)
+		{
+			TEST_ASSERT_EQUAL(SOME_IP_RETURN_CODE_E_NOT_READY, message[SOME_IP_RETURN_CODE_FIELD_BEGIN]);
+		}
+		else
+		{
+			TEST_ASSERT(SOMEIP_ValidateRxMessage(message, messageSize));
+			TEST_ASSERT_EQUAL(SOME_IP_RESPONSE_CODE, SOMEIP_GetMessageType(message));
+		}
+
+		for(i = 0; i < numberOfRequests; i++)
+		{
+			if((answeredTable[i] == false) && (requestTable[i].serviceId == SOMEIP_GetServiceId(message))
+				&& (requestTable[i].methodId == SOMEIP_GetMethodId(message)))
+			{
+				answeredTable[i] = true;
+				break;
+			}
+		}
+
+		//response without request
+		TEST_ASSERT(i < numberOfRequests);
+		numberOfResponses++;
+	}
+
+	TEST_ASSERT_EQUAL(numberOfRequests, numberOfResponses);
+}
+
+static void TestCoalescedRequests(uint8_t numberOfRequests)
+{
+	TestRequest requestTable[TEST_MAX_REQUESTS];
+	uint16_t size;
+
+	for(uint8_t i = 0; i < numberOfRequests; i++)
+	{
+		requestTable[i].serviceId = SOME_IP_SERVICE_CLOCK_STATUS;
+		requestTable[i].methodId = (i % 2) ? TEST_UNKNOWN_METHOD : SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET;
+	}
+
+	size = CodeRequests(requestTable, numberOfRequests);
+	HostEsp_SendToDevice(TEST_LINK_ID, StreamBuffer, size);
+	HostEsp_RunTicks(TEST_RESPONSE_TICKS);
+
+	CheckResponses(requestTable, numberOfRequests);
+}
+
+/*****************************************************************************************
+* TestFragmentedRequests() - send stream of requests in fragments of given size, each
+* fragment is separate +IPD message. Fragments contain parts of few messages.
+*****************************************************************************************/
+static void TestFragmentedRequests(uint8_t numberOfRequests, uint16_t fragmentSize)
+{
+	TestRequest requestTable[TEST_MAX_REQUESTS];
+	uint16_t size;
+
+	for(uint8_t i = 0; i < numberOfRequests; i++)
+	{
+		requestTable[i].serviceId = SOME_IP_SERVICE_CLOCK_STATUS;
+		requestTable[i].methodId = (i % 2) ? SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET : TEST_UNKNOWN_METHOD;
+	}
+
+	size = CodeRequests(requestTable, numberOfRequests);
+
+	for(uint16_t offset = 0; offset < size; offset += fragmentSize)
+	{
+		uint16_t fragment = ((size - offset) < fragmentSize) ? (size - offset) : fragmentSize;
+
+		HostEsp_SendToDevice(TEST_LINK_ID, &StreamBuffer[offset], fragment);
+		HostEsp_RunTicks(TEST_FRAGMENT_TICKS);
+	}
+
+	HostEsp_RunTicks(TEST_RESPONSE_TICKS);
+
+	CheckResponses(requestTable, numberOfRequests);
+}
+
+int main(void)
+{
+	const uint16_t fragmentSizeTable[] = {1, 5, 16, 23, 40};
+
+	HostUart_Reset();
+	HostEsp_Init();
+	HostClock_Init();
+	HostClock_SetTime(12, 30, 15, 6, 24);
+
+	HostEsp_RunTicks(TEST_STARTUP_TICKS);
+	TEST_ASSERT(HostEsp_ServerIsRunning());
+	TEST_ASSERT(HostEsp_ConnectClient(TEST_LINK_ID));
+	HostEsp_RunTicks(TEST_FRAGMENT_TICKS);
+
+	//request isn't lost when number of coalesced requests exceed size of request queue or number
+	//of RX buffers(requests dropped by ESP layer are rejected by error)
+	for(uint8_t numberOfRequests = 1; numberOfRequests <= TEST_MAX_REQUESTS; numberOfRequests++)
+		TestCoalescedRequests(numberOfRequests);
+
+	for(uint8_t i = 0; i < sizeof(fragmentSizeTable)/sizeof(uint16_t); i++)
+		TestFragmentedRequests(3, fragmentSizeTable[i]);
+
+	return TEST_RESULT("WifiRequestTest");
+}
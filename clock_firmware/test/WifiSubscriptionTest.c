@@ -0,0 +1,183 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Comparison of UART traffic of client which follow state of clock for one hour of simulated
+ * time. First client poll SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET every second, then the same
+ * client subscribe all eventgroups of clock status service with minimum interval of one
+ * second and only receive notifications. In both hours temperatures change every five
+ * minutes and time change every minute. Traffic is counted on UART between firmware and ESP8266
+ * simulator in both directions, so it include AT+CIPSEND handshakes and +IPD headers.
+ */
+
+#include "HostClock.h"
+#include "HostEsp.h"
+#include "HostUart.h"
+#include "HostPeripherals.h"
+#include "SOMEIP_Layer.h"
+#include "TemperatureSensor.h"
+#include "WIFI_InteractionLayer.h"
+#include "TestAssert.h"
+#include <stdio.h>
+
+#define TEST_LINK_ID				0U
+#define TEST_TICKS_PER_SECOND		(1000U/HOST_UART_TICK_PERIOD_MS)
+#define TEST_STARTUP_TICKS			(60U*TEST_TICKS_PER_SECOND) //ESP startup sequence and connection
+#define TEST_DURATION				3600U //seconds of each measurement
+#define TEST_TEMPERATURE_PERIOD		300U //seconds between changes of temperatures
+#define TEST_MINIMUM_INTERVAL		1U //seconds between notifications
+#define TEST_MIN_TRAFFIC_RATIO		10U //polling must need at least so many times more UART bytes
+#define TEST_BASE_RAW_TEMPERATURE	26000U //about 22.9 degrees
+
+typedef struct
+{
+	uint32_t requests;
+	uint32_t messages;//responses and notifications received by client
+	uint32_t notifications;
+	uint32_t uartBytes;
+	uint32_t sendRequests;//AT+CIPSEND requests
+}TestResult;
+
+static void SendRequest(uint16_t methodId, uint8_t* payload, uint16_t payloadSize, TestResult* result)
+{
+	uint8_t request[64];
+	uint16_t size = SOMEIP_CodeTxMessage(SOME_IP_SERVICE_CLOCK_STATUS, methodId, SOME_IP_REQUEST_CODE,
+		SOME_IP_RETURN_CODE_E_OK_VALUE, request, payload, payloadSize);
+
+	HostEsp_SendToDevice(TEST_LINK_ID, request, size);
+	result->requests++;
+}
+
+static void ReceiveMessages(TestResult* result)
+{
+	uint8_t message[600];
+	uint16_t messageSize;
+
+	while((messageSize = HostEsp_ReceiveMessage(TEST_LINK_ID, message, sizeof(message))) != 0)
+	{
+		TEST_ASSERT(SOMEIP_ValidateRxMessage(message, messageSize));
+		TEST_ASSERT_EQUAL(SOME_IP_SERVICE_CLOCK_STATUS, SOMEIP_GetServiceId(message));
+		result->messages++;
+
+		if(SOMEIP_GetMessageType(message) == SOME_IP_NOTIFICATION_CODE)
+		{
+			TEST_ASSERT(SOMEIP_GetMethodId(message) >= SOME_IP_SERVICE_CLOCK_STATUS_EVENT_TIME);
+			TEST_ASSERT(SOMEIP_GetMethodId(message) <= SOME_IP_SERVICE_CLOCK_STATUS_EVENT_ALARM);
+			result->notifications++;
+		}
+		else
+		{
+			TEST_ASSERT_EQUAL(SOME_IP_RESPONSE_CODE, SOMEIP_GetMessageType(message));
+		}
+	}
+}
+
+/*****************************************************************************************
+* RunHour() - simulate one hour, client send GET request every second when polling is set.
+* Temperatures are changed every TEST_TEMPERATURE_PERIOD seconds.
+*****************************************************************************************/
+static void RunHour(bool polling, TestResult* result)
+{
+	static uint16_t temperatureStep = 0;
+
+	for(uint32_t second = 0; second < TEST_DURATION; second++)
+	{
+		if((second % TEST_TEMPERATURE_PERIOD) == 0)
+		{
+			temperatureStep++;
+			HostPeripherals_SetTemperature(CN6_TEMP_INSIDE, TEST_BASE_RAW_TEMPERATURE + 40U*(temperatureStep % 4U));
+			HostPeripherals_SetTemperature(CN5_TEMP_OUTSIDE, TEST_BASE_RAW_TEMPERATURE - 100U*(temperatureStep % 8U));
+		}
+
+		if(polling)
+			SendRequest(SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET, NULL, 0, result);
+
+		for(uint32_t tick = 0; tick < TEST_TICKS_PER_SECOND; tick++)
+		{
+			HostEsp_RunTicks(1);
+			ReceiveMessages(result);
+		}
+	}
+}
+
+static TestResult MeasureHour(bool polling)
+{
+	TestResult result = {0};
+	uint32_t uartBytes = HostUart_GetNumberOfRxBytes() + HostUart_GetNumberOfTxBytes();
+	SomeIpClockStatusSubscribeRequestMethodPayload subscribePayload = {
+		.eventgroupMask = (1U << WIFI_NUMBER_OF_EVENTGROUPS) - 1U,
+		.minimumInterval = TEST_MINIMUM_INTERVAL};
+
+	HostEsp_ClearStatistics();
+
+	if(polling == false)
+	{
+		SendRequest(SOME_IP_SERVICE_CLOCK_STATUS_METHOD_SUBSCRIBE, (uint8_t*)&subscribePayload,
+			sizeof(subscribePayload), &result);
+	}
+
+	RunHour(polling, &result);
+
+	if(polling == false)
+	{
+		SendRequest(SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE, (uint8_t*)&subscribePayload,
+			SOME_IP_SERVICE_CLOCK_STATUS_METHOD_UNSUBSCRIBE_PAYLOAD_SIZE, &result);
+		HostEsp_RunTicks(TEST_TICKS_PER_SECOND);
+		ReceiveMessages(&result);
+	}
+
+	result.uartBytes = HostUart_GetNumberOfRxBytes() + HostUart_GetNumberOfTxBytes() - uartBytes;
+	result.sendRequests = HostEsp_GetStatistics().numberOfSendRequests;
+
+	printf("%s: %u requests, %u messages (%u notifications), %u AT+CIPSEND, %u UART bytes in one hour\n",
+		polling ? "polling every second" : "subscription", (unsigned)result.requests, (unsigned)result.messages,
+		(unsigned)result.notifications, (unsigned)result.sendRequests, (unsigned)result.uartBytes);
+
+	return result;
+}
+
+int main(void)
+{
+	TestResult polling, subscription;
+
+	HostUart_Reset();
+	HostEsp_Init();
+	HostClock_Init();
+	HostClock_SetTime(12, 30, 15, 6, 24);
+	HostPeripherals_SetTemperature(CN4_TEMP_FURNACE, TEST_BASE_RAW_TEMPERATURE);
+
+	HostEsp_RunTicks(TEST_STARTUP_TICKS);
+	TEST_ASSERT(HostEsp_ServerIsRunning());
+	TEST_ASSERT(HostEsp_ConnectClient(TEST_LINK_ID));
+	HostEsp_RunTicks(3);
+
+	polling = MeasureHour(true);
+	subscription = MeasureHour(false);
+
+	//each poll is answered, notification follow each minute and each change of temperatures
+	TEST_ASSERT_EQUAL(polling.requests, polling.messages);
+	TEST_ASSERT_EQUAL(0, polling.notifications);
+	TEST_ASSERT(subscription.notifications >= (TEST_DURATION/60U));
+	TEST_ASSERT(subscription.notifications < (TEST_DURATION/10U));
+	TEST_ASSERT(subscription.uartBytes*TEST_MIN_TRAFFIC_RATIO < polling.uartBytes);
+
+	printf("subscription need %.1f%% of UART bytes and %.1f%% of AT+CIPSEND requests of polling\n",
+		subscription.uartBytes*100.0/polling.uartBytes, subscription.sendRequests*100.0/polling.sendRequests);
+
+	return TEST_RESULT("WifiSubscriptionTest");
+}
@@ -0,0 +1,354 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Test of UDP telemetry. Firmware is built with WIFI_TELEMETRY_MODE and send notifications
+ * to ESP8266 simulator, which keep data send to UDP link like data of clients. Test check:
+ * - link setup: after creation of TCP server clock send
+ *   AT+CIPSTART=WIFI_TELEMETRY_LINK_ID,"UDP" with collector address and port,
+ * - retry: failed AT+CIPSTART is repeated after about 10 seconds and link closed by module
+ *   is opened again, then notifications continue,
+ * - payload: TEST_NUMBER_OF_CLOCKS clocks with different time and temperatures send
+ *   notifications to collector(TelemetryCollector module), each clock send one notification
+ *   per minute and one after store of 15 minutes temperatures at minute 14, last payload
+ *   contain time, present temperatures and stored temperatures of the clock.
+ * Firmware modules keep state in static variables, so each simulated clock is separate
+ * child process which run own firmware and forward datagrams of UDP link to collector in
+ * test process by pipe.
+ */
+
+#include "HostClock.h"
+#include "HostEsp.h"
+#include "HostUart.h"
+#include "HostPeripherals.h"
+#include "SOMEIP_Layer.h"
+#include "TemperatureSensor.h"
+#include "WIFI_InteractionLayer.h"
+#include "TelemetryCollector.h"
+#include "TestAssert.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if (WIFI_TELEMETRY_MODE == 0)
+#error "test must be built with WIFI_TELEMETRY_MODE"
+#endif
+
+#define TEST_TICKS_PER_SECOND		(1000U/HOST_UART_TICK_PERIOD_MS)
+#define TEST_STARTUP_TICKS			(60U*TEST_TICKS_PER_SECOND) //ESP startup sequence and connection
+#define TEST_RETRY_TICKS			(10U*TEST_TICKS_PER_SECOND) //period of AT+CIPSTART retry
+#define TEST_START_FAILURES			2U
+#define TEST_NUMBER_OF_CLOCKS		8U
+#define TEST_FIRST_HOUR				6U
+#define TEST_START_MINUTE			10U
+#define TEST_END_MINUTE				16U //last 15 minutes temperature is stored at minute 14
+#define TEST_CLOCK_TICKS			(((TEST_END_MINUTE - TEST_START_MINUTE)*60U + 30U)*TEST_TICKS_PER_SECOND)
+#define TEST_CLOCK_PORT				(4000U + WIFI_TELEMETRY_LINK_ID)
+#define TEST_MAX_MESSAGE_SIZE		TELEMETRY_COLLECTOR_MAX_DATAGRAM
+
+static const char TestCollectorRemote[] = "\"UDP\",\"192.168.1.100\",3001";
+
+static uint16_t RawTemperature(uint8_t clockIndex, uint8_t sensorNumber)
+{
+	return 0x5000U + 0x400U*sensorNumber + 0x40U*clockIndex;
+}
+
+//the same conversion like in HostPeripherals model of sensor
+static uint16_t ExpectedTemperature(uint8_t clockIndex, uint8_t source)
+{
+	static const uint8_t sensorNumberTable[NUM_OF_TEMPERATURE_SOURCE] = {CN5_TEMP_OUTSIDE, CN6_TEMP_INSIDE, CN4_TEMP_FURNACE};
+	uint32_t rawValue = RawTemperature(clockIndex, sensorNumberTable[source]);
+
+	return (uint16_t)((1757 * (rawValue*10)) / 655360);
+}
+
+static uint32_t ClockAddress(uint8_t clockIndex)
+{
+	return (192U << 24) | (168U << 16) | (1U << 8) | (51U + clockIndex);
+}
+
+static void StartClock(uint8_t clockIndex)
+{
+	HostUart_Reset();
+	HostEsp_Init();
+	HostClock_Init();
+	HostClock_SetTime(TEST_FIRST_HOUR + clockIndex, TEST_START_MINUTE, 15, 6, 24);
+
+	HostPeripherals_SetTemperature(CN6_TEMP_INSIDE, RawTemperature(clockIndex, CN6_TEMP_INSIDE));
+	HostPeripherals_SetTemperature(CN5_TEMP_OUTSIDE, RawTemperature(clockIndex, CN5_TEMP_OUTSIDE));
+	HostPeripherals_SetTemperature(CN4_TEMP_FURNACE, RawTemperature(clockIndex, CN4_TEMP_FURNACE));
+
+	for(uint8_t i = 0; i < NUM_OF_TEMPERATURE_SOURCE; i++)
+		ClockState.TemperatureSensorTable[i].recordTemperature = true;
+}
+
+/*****************************************************************************************
+* RunUntilLinkOpen() - execute firmware until UDP link is opened.
+*
+* Return: number of executed ticks.
+*****************************************************************************************/
+static uint32_t RunUntilLinkOpen(uint32_t maxTicks)
+{
+	uint32_t ticks = 0;
+
+	for(; (ticks < maxTicks) && (HostEsp_LinkIsOpen(WIFI_TELEMETRY_LINK_ID) == false); ticks++)
+		HostEsp_RunTicks(1);
+
+	return ticks;
+}
+
+/*****************************************************************************************
+* CollectTelemetry() - execute firmware and pass datagrams of UDP link to collector. Time of
+* each notification is checked against time of clock, because notification is send in the
+* same minute.
+*****************************************************************************************/
+static void CollectTelemetry(uint32_t numberOfTicks)
+{
+	uint8_t message[TEST_MAX_MESSAGE_SIZE];
+
+	for(uint32_t tick = 0; tick < numberOfTicks; tick++)
+	{
+		uint16_t size;
+
+		HostEsp_RunTicks(1);
+
+		while((size = HostEsp_ReceiveMessage(WIFI_TELEMETRY_LINK_ID, message, sizeof(message))) != 0)
+		{
+			const TelemetryCollectorClock* clock = TelemetryCollector_Receive(ClockAddress(0), TEST_CLOCK_PORT,
+				message, size);
+
+			TEST_ASSERT(clock != NULL);
+
+			if(clock != NULL)
+			{
+				TEST_ASSERT_EQUAL(ClockState.currentTimeHour, clock->lastPayload.hour);
+				TEST_ASSERT_EQUAL(ClockState.currentTimeMinute, clock->lastPayload.minute);
+			}
+		}
+	}
+}
+
+/*****************************************************************************************
+* TestLinkSetup() - check AT+CIPSTART of UDP link, retry after failed requests and after link
+* was closed by module, and notifications send once a minute while link is open.
+*****************************************************************************************/
+static void TestLinkSetup(void)
+{
+	uint32_t ticks = 0;
+	uint32_t linkTicks = 0;
+	uint32_t notifications = 0;
+
+	TelemetryCollector_Init();
+	StartClock(0);
+	HostEsp_SetStartFailures(TEST_START_FAILURES);
+
+	for(ticks = 0; (ticks < TEST_STARTUP_TICKS) && (HostEsp_ServerIsRunning() == false); ticks++)
+		HostEsp_RunTicks(1);
+
+	TEST_ASSERT(HostEsp_ServerIsRunning());
+
+	//first request after creation of TCP server and two retries
+	linkTicks = RunUntilLinkOpen((TEST_START_FAILURES + 1U)*(TEST_RETRY_TICKS + TEST_TICKS_PER_SECOND));
+	TEST_ASSERT(HostEsp_LinkIsOpen(WIFI_TELEMETRY_LINK_ID));
+	TEST_ASSERT(linkTicks >= TEST_START_FAILURES*TEST_RETRY_TICKS);
+	TEST_ASSERT(linkTicks <= (TEST_START_FAILURES + 1U)*(TEST_RETRY_TICKS + TEST_TICKS_PER_SECOND));
+	TEST_ASSERT_EQUAL(TEST_START_FAILURES + 1U, HostEsp_GetStatistics().numberOfStartRequests);
+	TEST_ASSERT_EQUAL(0, strcmp(TestCollectorRemote, HostEsp_GetLinkRemote(WIFI_TELEMETRY_LINK_ID)));
+
+	//notification of present minute and one per each next minute
+	CollectTelemetry(150U*TEST_TICKS_PER_SECOND);
+	TEST_ASSERT_EQUAL(1, TelemetryCollector_GetNumberOfClocks());
+
+	if(TelemetryCollector_GetNumberOfClocks() != 1)
+		return;
+
+	notifications = TelemetryCollector_GetClock(0)->numberOfNotifications;
+	TEST_ASSERT((notifications >= 3U) && (notifications <= 4U));
+
+	//link closed by module is opened again and notifications continue
+	HostEsp_ClearStatistics();
+	HostEsp_CloseClient(WIFI_TELEMETRY_LINK_ID);
+	RunUntilLinkOpen(TEST_RETRY_TICKS + 5U*TEST_TICKS_PER_SECOND);
+	TEST_ASSERT(HostEsp_LinkIsOpen(WIFI_TELEMETRY_LINK_ID));
+	TEST_ASSERT_EQUAL(1, HostEsp_GetStatistics().numberOfStartRequests);
+
+	CollectTelemetry(65U*TEST_TICKS_PER_SECOND);
+	TEST_ASSERT(TelemetryCollector_GetClock(0)->numberOfNotifications > notifications);
+	TEST_ASSERT_EQUAL(0, TelemetryCollector_GetRejectedDatagrams());
+
+	printf("WifiTelemetryTest: link opened %u ticks after TCP server with %u failed requests, %u notifications\n",
+		linkTicks, TEST_START_FAILURES, TelemetryCollector_GetClock(0)->numberOfNotifications);
+}
+
+/*****************************************************************************************
+* RunClock() - execute firmware of one clock in child process and write each datagram of UDP
+* link to pipe as size(2 bytes) and data.
+*
+* Return: exit code of child process.
+*****************************************************************************************/
+static int RunClock(uint8_t clockIndex, int pipeFd)
+{
+	uint8_t message[TEST_MAX_MESSAGE_SIZE];
+	uint32_t ticks = TEST_STARTUP_TICKS;
+
+	StartClock(clockIndex);
+	HostEsp_RunTicks(TEST_STARTUP_TICKS);
+	ticks += RunUntilLinkOpen(TEST_RETRY_TICKS + TEST_TICKS_PER_SECOND);
+	TEST_ASSERT(HostEsp_LinkIsOpen(WIFI_TELEMETRY_LINK_ID));
+
+	for(; ticks < TEST_CLOCK_TICKS; ticks++)
+	{
+		uint16_t size;
+
+		HostEsp_RunTicks(1);
+
+		while((size = HostEsp_ReceiveMessage(WIFI_TELEMETRY_LINK_ID, message, sizeof(message))) != 0)
+		{
+			TEST_ASSERT(write(pipeFd, &size, sizeof(size)) == sizeof(size));
+			TEST_ASSERT(write(pipeFd, message, size) == size);
+		}
+	}
+
+	close(pipeFd);
+
+	return (TestAssertFailures == 0) ? 0 : 1;
+}
+
+static bool ReadPipe(int pipeFd, void* data, uint16_t size)
+{
+	uint16_t receivedBytes = 0;
+
+	while(receivedBytes < size)
+	{
+		ssize_t result = read(pipeFd, (uint8_t*)data + receivedBytes, size - receivedBytes);
+
+		if(result <= 0)
+			return false;
+
+		receivedBytes += result;
+	}
+
+	return true;
+}
+
+/*****************************************************************************************
+* TestManyClocks() - collect telemetry of TEST_NUMBER_OF_CLOCKS clocks and check that
+* collector received notifications of each clock with its time, present temperatures and
+* 15 minutes temperatures.
+*****************************************************************************************/
+static void TestManyClocks(const pid_t* pidTable, const int* pipeTable)
+{
+	TelemetryCollector_Init();
+
+	for(uint8_t i = 0; i < TEST_NUMBER_OF_CLOCKS; i++)
+	{
+		uint8_t message[TEST_MAX_MESSAGE_SIZE];
+		uint16_t size;
+		int status = 1;
+
+		while(ReadPipe(pipeTable[i], &size, sizeof(size)))
+		{
+			TEST_ASSERT(size <= sizeof(message));
+
+			if((size > sizeof(message)) || (ReadPipe(pipeTable[i], message, size) == false))
+				break;
+
+			TEST_ASSERT(TelemetryCollector_Receive(ClockAddress(i), TEST_CLOCK_PORT, message, size) != NULL);
+		}
+
+		close(pipeTable[i]);
+		TEST_ASSERT(waitpid(pidTable[i], &status, 0) == pidTable[i]);
+		TEST_ASSERT(WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+	}
+
+	TEST_ASSERT_EQUAL(TEST_NUMBER_OF_CLOCKS, TelemetryCollector_GetNumberOfClocks());
+	TEST_ASSERT_EQUAL(0, TelemetryCollector_GetRejectedDatagrams());
+
+	for(uint8_t i = 0; i < TelemetryCollector_GetNumberOfClocks(); i++)
+	{
+		const TelemetryCollectorClock* clock = TelemetryCollector_GetClock(i);
+		uint8_t clockIndex = clock->address - ClockAddress(0);
+
+		TEST_ASSERT(clockIndex < TEST_NUMBER_OF_CLOCKS);
+
+		if(clockIndex >= TEST_NUMBER_OF_CLOCKS)
+			continue;
+
+		//minutes 11-16 and second notification of minute 14 after store of temperatures
+		TEST_ASSERT_EQUAL(TEST_END_MINUTE - TEST_START_MINUTE + 1U, clock->numberOfNotifications);
+		TEST_ASSERT_EQUAL(1, clock->numberOfAggregateChanges);
+		TEST_ASSERT_EQUAL(TEST_FIRST_HOUR + clockIndex, clock->lastPayload.hour);
+		TEST_ASSERT_EQUAL(TEST_END_MINUTE, clock->lastPayload.minute);
+
+		for(uint8_t source = 0; source < NUM_OF_TEMPERATURE_SOURCE; source++)
+		{
+			TEST_ASSERT_EQUAL(ExpectedTemperature(clockIndex, source), clock->lastPayload.temperatureTable[source]);
+			TEST_ASSERT_EQUAL(ExpectedTemperature(clockIndex, source), clock->lastPayload.aggregateTable[source]);
+		}
+	}
+
+	printf("WifiTelemetryTest: %u clocks, %u notifications of first clock\n", TelemetryCollector_GetNumberOfClocks(),
+		(TelemetryCollector_GetNumberOfClocks() > 0) ? TelemetryCollector_GetClock(0)->numberOfNotifications : 0U);
+}
+
+int main(void)
+{
+	pid_t pidTable[TEST_NUMBER_OF_CLOCKS];
+	int pipeTable[TEST_NUMBER_OF_CLOCKS];
+
+	//clocks are started before firmware of test process is initialized
+	fflush(stdout);
+
+	for(uint8_t i = 0; i < TEST_NUMBER_OF_CLOCKS; i++)
+	{
+		int pipeFd[2];
+
+		if(pipe(pipeFd) != 0)
+		{
+			perror("WifiTelemetryTest");
+			return 1;
+		}
+
+		pidTable[i] = fork();
+
+		if(pidTable[i] == 0)
+		{
+			for(uint8_t j = 0; j < i; j++)
+				close(pipeTable[j]);
+
+			close(pipeFd[0]);
+			exit(RunClock(i, pipeFd[1]));
+		}
+
+		close(pipeFd[1]);
+		pipeTable[i] = pipeFd[0];
+
+		if(pidTable[i] < 0)
+		{
+			perror("WifiTelemetryTest");
+			return 1;
+		}
+	}
+
+	TestLinkSetup();
+	TestManyClocks(pidTable, pipeTable);
+
+	return TEST_RESULT("WifiTelemetryTest");
+}
@@ -0,0 +1,175 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+/*
+ * Measurement of requests per second and bytes per second of one client with simulated
+ * ESP8266. Test is built twice: with TCP server where each response is send by AT+CIPSEND
+ * handshake and requests come in +IPD messages, and with WIFI_PASSTHROUGH_MODE where
+ * device connect to remote server and messages are exchanged as raw stream. Client send
+ * GET requests one by one(round trip) and with window of requests equal to request queue
+ * (throughput). Rates are counted in simulated time so they show cost of protocol on UART
+ * and number of Thread_Call periods, not CPU time of host.
+ */
+
+#include "HostClock.h"
+#include "HostEsp.h"
+#include "HostUart.h"
+#include "ESP_Layer.h"
+#include "SOMEIP_Layer.h"
+#include "WIFI_InteractionLayer.h"
+#include "TestAssert.h"
+#include <stdio.h>
+
+#define TEST_LINK_ID				0U
+#define TEST_TICKS_PER_SECOND		(1000U/HOST_UART_TICK_PERIOD_MS)
+#define TEST_STARTUP_TICKS			(60U*TEST_TICKS_PER_SECOND) //ESP startup sequence and connection
+#define TEST_MEASUREMENT_TICKS		(20U*TEST_TICKS_PER_SECOND)
+#define TEST_FINISH_TICKS			(5U*TEST_TICKS_PER_SECOND) //time for responses to last requests
+#define TEST_EXIT_TICKS				(5U*TEST_TICKS_PER_SECOND) //"+++" escape sequence
+
+#if WIFI_PASSTHROUGH_MODE
+#define TEST_MODE_NAME				"passthrough"
+#define TEST_MIN_THROUGHPUT			30U //responses per second with full request queue
+#else
+#define TEST_MODE_NAME				"AT+CIPSEND"
+#define TEST_MIN_THROUGHPUT			15U
+#endif
+
+typedef struct
+{
+	uint32_t requests;
+	uint32_t responses;
+	uint32_t busyErrors;
+	uint32_t responseBytes;//SOME/IP messages received by client
+	uint32_t uartBytes;//both directions of UART with AT requests, headers and echo
+	uint32_t sendRequests;//AT+CIPSEND requests
+}TestResult;
+
+static uint32_t PendingRequests;
+
+static void SendRequest(TestResult* result)
+{
+	uint8_t request[64];
+	uint16_t size = SOMEIP_CodeTxMessage(SOME_IP_SERVICE_CLOCK_STATUS, SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET,
+		SOME_IP_REQUEST_CODE, SOME_IP_RETURN_CODE_E_OK_VALUE, request, NULL, 0);
+
+	HostEsp_SendToDevice(TEST_LINK_ID, request, size);
+	PendingRequests++;
+	result->requests++;
+}
+
+static void ReceiveResponses(TestResult* result)
+{
+	uint8_t message[600];
+	uint16_t messageSize;
+
+	while((messageSize = HostEsp_ReceiveMessage(TEST_LINK_ID, message, sizeof(message))) != 0)
+	{
+		TEST_ASSERT(PendingRequests > 0);
+		PendingRequests--;
+
+		if(SOMEIP_GetMessageType(message) == SOME_IP_ERROR_CODE)
+		{
+			TEST_ASSERT_EQUAL(SOME_IP_RETURN_CODE_E_NOT_READY, message[SOME_IP_RETURN_CODE_FIELD_BEGIN]);
+			result->busyErrors++;
+		}
+		else
+		{
+			TEST_ASSERT(SOMEIP_ValidateRxMessage(message, messageSize));
+			TEST_ASSERT_EQUAL(SOME_IP_SERVICE_CLOCK_STATUS_METHOD_GET, SOMEIP_GetMethodId(message));
+			result->responses++;
+			result->responseBytes += messageSize;
+		}
+	}
+}
+
+/*****************************************************************************************
+* RunClient() - client keep given number of requests in flight during measurement time and
+* then wait for responses to last requests.
+*****************************************************************************************/
+static TestResult RunClient(uint32_t window)
+{
+	TestResult result = {0};
+	uint32_t uartBytes = HostUart_GetNumberOfRxBytes() + HostUart_GetNumberOfTxBytes();
+
+	HostEsp_ClearStatistics();
+	PendingRequests = 0;
+
+	for(uint32_t tick = 0; tick < (TEST_MEASUREMENT_TICKS + TEST_FINISH_TICKS); tick++)
+	{
+		while((PendingRequests < window) && (tick < TEST_MEASUREMENT_TICKS))
+			SendRequest(&result);
+
+		HostEsp_RunTicks(1);
+		ReceiveResponses(&result);
+	}
+
+	TEST_ASSERT_EQUAL(0, PendingRequests);
+	TEST_ASSERT_EQUAL(result.requests, result.responses + result.busyErrors);
+
+	result.uartBytes = HostUart_GetNumberOfRxBytes() + HostUart_GetNumberOfTxBytes() - uartBytes;
+	result.sendRequests = HostEsp_GetStatistics().numberOfSendRequests;
+
+	printf("%s, window %u: %.1f requests/s, %.0f response bytes/s, %u busy errors, "
+		"%.1f UART bytes and %.2f AT+CIPSEND per response\n", TEST_MODE_NAME, (unsigned)window,
+		result.responses*(double)TEST_TICKS_PER_SECOND/TEST_MEASUREMENT_TICKS,
+		result.responseBytes*(double)TEST_TICKS_PER_SECOND/TEST_MEASUREMENT_TICKS,
+		(unsigned)result.busyErrors, result.uartBytes/(double)result.responses,
+		result.sendRequests/(double)result.responses);
+
+	return result;
+}
+
+int main(void)
+{
+	TestResult roundTrip, throughput;
+
+	HostUart_Reset();
+	HostEsp_Init();
+	HostClock_Init();
+	HostClock_SetTime(12, 30, 15, 6, 24);
+
+	HostEsp_RunTicks(TEST_STARTUP_TICKS);
+#if WIFI_PASSTHROUGH_MODE
+	TEST_ASSERT(HostEsp_PassthroughIsActive());
+#else
+	TEST_ASSERT(HostEsp_ServerIsRunning());
+	TEST_ASSERT(HostEsp_ConnectClient(TEST_LINK_ID));
+#endif
+	HostEsp_RunTicks(3);
+
+	roundTrip = RunClient(1);
+	throughput = RunClient(WIFI_REQUEST_QUEUE_SIZE);
+
+	TEST_ASSERT(roundTrip.responses > 0);
+	TEST_ASSERT(throughput.responses >= roundTrip.responses);
+	TEST_ASSERT(throughput.responses >= TEST_MIN_THROUGHPUT*(TEST_MEASUREMENT_TICKS/TEST_TICKS_PER_SECOND));
+
+#if WIFI_PASSTHROUGH_MODE
+	//no handshake per message and module return to command mode after "+++"
+	TEST_ASSERT_EQUAL(0, roundTrip.sendRequests + throughput.sendRequests);
+	TEST_ASSERT(ESP_StopPassthrough());
+	HostEsp_RunTicks(TEST_EXIT_TICKS);
+	TEST_ASSERT(HostEsp_PassthroughIsActive() == false);
+	TEST_ASSERT(ESP_PassthroughIsActive() == false);
+#else
+	TEST_ASSERT_EQUAL(roundTrip.responses + roundTrip.busyErrors, roundTrip.sendRequests);
+#endif
+
+	return TEST_RESULT("WifiThroughputTest(" TEST_MODE_NAME ")");
+}
@@ -0,0 +1,109 @@
+/*
+
+clock_firmware
+Copyright (C) 2019 Adrian Chemicz
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+#ifndef _HOST_CHIP_H_
+#define _HOST_CHIP_H_
+
+/*
+ * Replacement of LPCOpen chip library used by host build of tests. Only registers and
+ * functions used by modules linked into host tests are declared. Registers are plain
+ * structures defined in HostChip.c and functions are implemented there. Chip.h is also
+ * forced into each module by Makefile, because few modules use atoi and itoa without
+ * include of stdlib.h and implicit declaration truncate returned pointer on 64 bit host.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum
+{
+	USART0_IRQn,
+	TIMER_16_0_IRQn,
+	RTC_IRQn,
+}IRQn_Type;
+
+typedef struct
+{
+	volatile uint32_t SYSAHBCLKCTRL;
+	volatile uint32_t USART0CLKDIV;
+}LPC_SYSCON_T;
+
+typedef struct
+{
+	volatile uint32_t PIO0[24];
+}LPC_IOCON_T;
+
+/*
+ * Registers of USART0 used by UART_Driver.c, they are emulated by HostUsart.c. Hardware
+ * registers have side effects which can't be done by plain memory, so THR and LSR are
+ * replaced by macros: each write of THR is stored in next entry of TX FIFO and each read
+ * of LSR first update status bits from state of model.
+ */
+#define HOST_USART_FIFO_SIZE	16
+
+typedef struct
+{
+	volatile uint32_t RBR;
+	volatile uint32_t DLL;
+	volatile uint32_t DLM;
+	volatile uint32_t IER;
+	volatile uint32_t FCR;
+	volatile uint32_t LCR;
+	volatile uint32_t TER;
+	volatile uint32_t FDR;
+	volatile uint32_t TX_FIFO[HOST_USART_FIFO_SIZE];
+	volatile uint32_t LSR_VALUE[1];
+}LPC_USART0_T;
+
+#define THR		TX_FIFO[HostUsart_PushTxFifo()]
+#define LSR		LSR_VALUE[HostUsart_UpdateLineStatus()]
+
+uint32_t HostUsart_PushTxFifo(void);
+uint32_t HostUsart_UpdateLineStatus(void);
+
+typedef struct
+{
+	volatile uint32_t IR;
+	volatile uint32_t TCR;
+	volatile uint32_t TC;
+	volatile uint32_t PR;
+	volatile uint32_t PC;
+	volatile uint32_t MCR;
+	volatile uint32_t MR[4];
+}LPC_TIMER_T;
+
+extern LPC_SYSCON_T *LPC_SYSCON;
+extern LPC_TIMER_T *LPC_TIMER16_0;
+extern LPC_IOCON_T *LPC_IOCON;
+extern LPC_USART0_T *LPC_USART0;
+
+#define LPC_USART0_BASE		LPC_USART0
+
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority);
+void NVIC_SystemReset(void);
+void Chip_CRC_Init(void);
+uint16_t Chip_CRC_CRC16(const uint16_t *data, uint32_t hwords);
+uint32_t Chip_Clock_GetMainClockRate(void);
+char* itoa(int value, char* string, int radix);
+
+#endif /* _HOST_CHIP_H_ */
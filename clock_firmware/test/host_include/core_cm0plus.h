@@ -0,0 +1 @@
+#include "chip.h"